@@ -41,7 +41,8 @@ class RenderContext;
 For older graphics APIs (such as OpenGL and Direct3D 11) it makes not much sense to create multiple command buffers,
 but for recent graphics APIs (such as Vulkan, Direct3D 12, and Metal) it might be sensible to have more than one command buffer,
 to maximize CPU utilization with several worker threads and one command buffer for each thread.
-However, multi-threading for command buffers is currently not supported by LLGL!
+For multi-threaded recording, create secondary command buffers (see CommandBufferFlags::Secondary) and record each of them on a separate thread,
+then execute them within a primary command buffer with CommandBuffer::Execute.
 Assume that all states that can be changed with a setter function are not persistent except the opposite is mentioned.
 Before any command can be recorded, the command buffer must be set into record mode, which is done by the CommandQueue::Begin function.
 There are only a few exceptions of functions that can be used outside of recording,
@@ -492,6 +493,20 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) = 0;
 
+        /* ----- Secondary Command Buffers ----- */
+
+        /**
+        \brief Executes the specified secondary command buffer within the current render pass.
+        \param[in] secondaryCommandBuffer Specifies the secondary command buffer to execute.
+        This must have been created with the CommandBufferFlags::Secondary flag and its recording must have been completed.
+        \remarks The current render pass must have been begun within a recording with the RecordingFlags::SecondaryContents flag.
+        The secondary command buffer must not be recorded again, until this command buffer has been completed by the GPU.
+        \note Only supported with: Vulkan. The other renderers throw std::runtime_error.
+        \see CommandQueue::BeginSecondary
+        \see RecordingFlags::SecondaryContents
+        */
+        virtual void Execute(CommandBuffer& secondaryCommandBuffer) = 0;
+
     protected:
 
         CommandBuffer() = default;
@@ -10,6 +10,7 @@
 
 
 #include "ColorRGBA.h"
+#include "CommandQueueFlags.h"
 
 
 namespace LLGL
@@ -35,6 +36,17 @@ enum class RenderConditionMode
     ByRegionNoWaitInverted, //!< Same as ByRegionNoWait, but the condition is inverted.
 };
 
+/**
+\brief Policy enumeration for pipelines that are bound before their background compilation has finished.
+\see CommandBufferDescriptor::pendingPipelinePolicy
+\see RenderSystem::CreateGraphicsPipelineAsync
+*/
+enum class PendingPipelinePolicy
+{
+    Wait,   //!< Block the command buffer until the pipeline is ready. This is the default policy.
+    Skip,   //!< Skip all draw or dispatch commands until the next pipeline is bound.
+};
+
 
 /* ----- Flags ----- */
 
@@ -56,6 +68,25 @@ struct ClearFlags
     };
 };
 
+/**
+\brief Command buffer creation flags.
+\see CommandBufferDescriptor::flags
+*/
+struct CommandBufferFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies a secondary command buffer, which inherits the render pass state of the primary command buffer it is executed in.
+        \remarks Secondary command buffers are recorded with CommandQueue::BeginSecondary and executed with CommandBuffer::Execute.
+        \note Only supported with: Vulkan.
+        \see CommandQueue::BeginSecondary
+        \see CommandBuffer::Execute
+        */
+        Secondary = (1 << 0),
+    };
+};
+
 
 /* ----- Structures ----- */
 
@@ -173,7 +204,32 @@ struct CommandBufferDescriptor
     because it waits for a command buffer to be completed before it can be reused.
     \see CommandQueue::Begin(CommandBuffer&, long)
     */
-    std::uint32_t numNativeBuffers = 2;
+    std::uint32_t           numNativeBuffers        = 2;
+
+    /**
+    \brief Specifies the creation flags. By default 0.
+    \remarks This can be a bitwise OR combination of the CommandBufferFlags enumeration entries.
+    \see CommandBufferFlags
+    */
+    long                    flags                   = 0;
+
+    /**
+    \brief Specifies how the command buffer handles pipelines that are not ready yet when they are bound. By default PendingPipelinePolicy::Wait.
+    \remarks This only affects pipelines that are created with RenderSystem::CreateGraphicsPipelineAsync or RenderSystem::CreateComputePipelineAsync.
+    With PendingPipelinePolicy::Skip, binding a pending pipeline does not modify the currently bound pipeline
+    and all subsequent draw or dispatch commands are ignored until the next pipeline is bound.
+    \see GraphicsPipeline::IsReady
+    \see ComputePipeline::IsReady
+    */
+    PendingPipelinePolicy   pendingPipelinePolicy   = PendingPipelinePolicy::Wait;
+
+    /**
+    \brief Specifies the type of command queue this command buffer is submitted to. By default CommandQueueType::Graphics.
+    \remarks The command buffer must only be submitted to the command queue that is returned by RenderSystem::GetDedicatedCommandQueue for the same type.
+    \note Only supported with: Vulkan. For the other renderers, this member is ignored.
+    \see RenderSystem::GetDedicatedCommandQueue
+    */
+    CommandQueueType        queueType               = CommandQueueType::Graphics;
 };
 
 
@@ -20,6 +20,8 @@ namespace LLGL
 
 class CommandBuffer;
 class Fence;
+class RenderTarget;
+class RenderPass;
 
 /**
 \brief Command queue interface.
@@ -44,6 +46,27 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void Begin(CommandBuffer& commandBuffer, long flags = 0) = 0;
 
+        /**
+        \brief Begins recording of the specified secondary command buffer.
+        \param[in] commandBuffer Specifies the command buffer to record. This must have been created with the CommandBufferFlags::Secondary flag.
+        \param[in] renderTarget Specifies the render target whose render pass is continued by the secondary command buffer.
+        \param[in] renderPass Specifies an optional render pass object. If this is null, the default render pass for the specified render target will be used.
+        \param[in] flags Optional flags with hints about how is to be recorded. By default 0.
+        \remarks A secondary command buffer only contains commands for the inside of a render pass
+        and is executed within the primary command buffer with CommandBuffer::Execute.
+        Each secondary command buffer can be recorded on a separate thread,
+        as long as each command buffer is only recorded by one thread at a time.
+        \note Only supported with: Vulkan. The other renderers throw std::runtime_error.
+        \see CommandBufferFlags::Secondary
+        \see CommandBuffer::Execute
+        */
+        virtual void BeginSecondary(
+            CommandBuffer&      commandBuffer,
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass  = nullptr,
+            long                flags       = 0
+        ) = 0;
+
         /**
         \brief Ends recording of the specified command buffer.
         \remarks If this is not a pre-recorded command buffer, this will automatically submit the recording to the queue.
@@ -61,6 +84,18 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void Submit(CommandBuffer& commandBuffer) = 0;
 
+        /**
+        \brief Submits the specified array of command buffers to the command queue at once.
+        \param[in] numCommandBuffers Specifies the number of command buffers in the array.
+        \param[in] commandBuffers Pointer to the array of command buffers.
+        \remarks This is the preferred way to submit several command buffers that were recorded with RecordingFlags::DeferredSubmit,
+        since it avoids the overhead of one submission per command buffer.
+        For Vulkan, command buffers can be submitted from multiple threads, since all queue submissions are serialized internally.
+        \note Only supported with: Vulkan, Direct3D 12.
+        \see RecordingFlags::DeferredSubmit
+        */
+        virtual void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) = 0;
+
         /* ----- Fences ----- */
 
         //! Submits the specified fence to the command queue for CPU/GPU synchronization.
@@ -88,6 +123,67 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void WaitIdle() = 0;
 
+        /**
+        \brief Submits a signal operation for the specified timeline fence into the command queue.
+        \param[in] fence Specifies the fence to signal. This must have been created with RenderSystem::CreateTimelineFence.
+        \param[in] value Specifies the value the fence is set to when all previously submitted work has been completed.
+        This must be greater than any value that has been signaled for this fence before.
+        \throws std::invalid_argument If the fence is not a timeline fence.
+        \throws std::invalid_argument If 'value' is not greater than the value that has been signaled for this fence before.
+        \note Only supported with: OpenGL, Vulkan.
+        \see RenderSystem::CreateTimelineFence
+        */
+        virtual void Signal(Fence& fence, std::uint64_t value);
+
+        /**
+        \brief Returns the highest value the specified timeline fence has reached on the GPU, without blocking the CPU execution.
+        \remarks For binary fences, this returns 1 if the fence has been signaled and 0 otherwise.
+        \note Only supported with: OpenGL, Vulkan.
+        \see Signal
+        */
+        virtual std::uint64_t GetCompletedValue(Fence& fence);
+
+        /**
+        \brief Blocks the CPU execution until all or any of the specified fences have been signaled.
+        \param[in] numFences Specifies the number of fences.
+        \param[in] fences Pointer to the array of fences. Either all or none of them must be timeline fences.
+        \param[in] values Pointer to the array of values each timeline fence must reach. This is ignored for binary fences and can then be null.
+        \param[in] waitAll Specifies whether to wait for all fences (true) or for any of them (false).
+        \param[in] timeout Specifies the waiting timeout (in nanoseconds).
+        \return True on success, or false if the fences have a timeout or the device is lost.
+        \throws std::invalid_argument If binary and timeline fences are mixed.
+        \note Timeline fences are only supported with: OpenGL, Vulkan. For the other renderers, binary fences are waited for with WaitFence.
+        \see WaitFence
+        */
+        virtual bool WaitFences(
+            std::uint32_t           numFences,
+            Fence* const *          fences,
+            const std::uint64_t*    values,
+            bool                    waitAll,
+            std::uint64_t           timeout
+        );
+
+        /* ----- Queue synchronization ----- */
+
+        /**
+        \brief Lets all subsequent submissions to this command queue wait on the GPU until all work that has been submitted to the other command queue so far has been completed.
+        \param[in] otherQueue Specifies the command queue to wait for. This is typically a queue returned by RenderSystem::GetDedicatedCommandQueue.
+        \remarks This does not block the CPU execution. Waiting for the same queue or for a queue that shares the native queue with this one has no effect.
+        The wait also makes all memory writes of the other queue visible to the subsequent submissions to this queue.
+        Resources are shared between all queue families, so no ownership transfer is required (see RenderSystem::GetDedicatedCommandQueue).
+        \code
+        // Upload on the transfer queue while the graphics queue keeps rendering
+        auto myCopyQueue = myRenderSystem->GetDedicatedCommandQueue(LLGL::CommandQueueType::Transfer);
+        myCopyQueue->Begin(*myCopyCmdBuffer);
+        // ...
+        myCopyQueue->End(*myCopyCmdBuffer);
+        myRenderSystem->GetCommandQueue()->WaitQueue(*myCopyQueue);
+        \endcode
+        \note Only supported with: Vulkan. For the other renderers, all work is executed in order anyway and this function has no effect.
+        \see RenderSystem::GetDedicatedCommandQueue
+        */
+        virtual void WaitQueue(CommandQueue& otherQueue);
+
     protected:
 
         CommandQueue() = default;
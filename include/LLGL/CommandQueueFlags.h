@@ -13,6 +13,21 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Command queue type enumeration.
+\see RenderSystem::GetDedicatedCommandQueue
+\see CommandBufferDescriptor::queueType
+*/
+enum class CommandQueueType
+{
+    Graphics,   //!< Queue for graphics, compute, and transfer commands. This is the queue returned by RenderSystem::GetCommandQueue.
+    Compute,    //!< Queue for compute and transfer commands, which can be executed asynchronously to the graphics queue.
+    Transfer,   //!< Queue for transfer (i.e. copy) commands only, which can be executed asynchronously to the graphics queue.
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -24,7 +39,23 @@ struct RecordingFlags
     enum
     {
         //! Specifies that each recording of a command buffer is only submitted once.
-        OneTimeSubmit = (1 << 0),
+        OneTimeSubmit       = (1 << 0),
+
+        /**
+        \brief Specifies that the command buffer is not submitted automatically when its recording ends.
+        \remarks This can be used to record several command buffers (e.g. on multiple threads)
+        and submit all of them at once with CommandQueue::Submit(std::uint32_t, CommandBuffer* const *).
+        \note Only supported with: Vulkan, Direct3D 12.
+        */
+        DeferredSubmit      = (1 << 1),
+
+        /**
+        \brief Specifies that all render passes of this recording are only filled by secondary command buffers.
+        \remarks If this is specified, the only commands that are allowed inside a render pass are calls to CommandBuffer::Execute.
+        \note Only supported with: Vulkan.
+        \see CommandBuffer::Execute
+        */
+        SecondaryContents   = (1 << 2),
     };
 };
 
@@ -17,8 +17,33 @@ namespace LLGL
 {
 
 
-//! Compute pipeline interface.
-class LLGL_EXPORT ComputePipeline : public RenderSystemChild { };
+/**
+\brief Compute pipeline interface.
+\see RenderSystem::CreateComputePipeline
+\see RenderSystem::CreateComputePipelineAsync
+\see CommandBuffer::SetComputePipeline
+*/
+class LLGL_EXPORT ComputePipeline : public RenderSystemChild
+{
+
+    public:
+
+        /**
+        \brief Returns true if this compute pipeline has finished compiling and can be bound without blocking.
+        \remarks Compute pipelines that are created with RenderSystem::CreateComputePipeline are always ready.
+        \see RenderSystem::CreateComputePipelineAsync
+        \see CommandBufferDescriptor::pendingPipelinePolicy
+        */
+        virtual bool IsReady() const;
+
+        /**
+        \brief Blocks the calling thread until this compute pipeline has finished compiling.
+        \throws std::runtime_error If the background compilation of this compute pipeline failed.
+        \see IsReady
+        */
+        virtual void WaitReady();
+
+};
 
 
 } // /namespace LLGL
@@ -9,6 +9,10 @@
 #define LLGL_COMPUTE_PIPELINE_FLAGS_H
 
 
+#include "ShaderFlags.h"
+#include <vector>
+
+
 namespace LLGL
 {
 
@@ -42,6 +46,14 @@ struct ComputePipelineDescriptor
     \note Only supported with: Vulkan, Direct3D 12
     */
     PipelineLayout* pipelineLayout  = nullptr;
+
+    /**
+    \brief Optional list of specialization constants for the compute shader of this pipeline.
+    \remarks These override the specialization constants with the same ID that are specified for the compute shader.
+    \note Only supported with: Vulkan.
+    \see ShaderDescriptor::specializationConstants
+    */
+    std::vector<SpecializationConstant> specializationConstants;
 };
 
 
@@ -27,25 +27,31 @@ namespace Constants
 \brief Specifies the maximal number of threads the system supports.
 \see ConvertImageBuffer
 */
-static const std::size_t    maxThreadCount      = ~0;
+static const std::size_t    maxThreadCount       = ~0;
 
 /**
 \brief Offset value to determine the offset automatically, e.g. to append a vertex attribute at the end of a vertex format.
 \see VertexFormat::AppendAttribute
 */
-static const std::uint32_t  ignoreOffset        = ~0;
+static const std::uint32_t  ignoreOffset         = ~0;
 
 /**
 \brief Specifies an invalid binding slot for shader resources.
 \see ShaderReflectionDescriptor::ResourceView::slot
 */
-static const std::uint32_t  invalidSlot         = ~0;
+static const std::uint32_t  invalidSlot          = ~0;
 
 /**
 \brief Value for a query result that was not successfully determined.
 \see QueryPipelineStatistics
 */
-static const std::uint64_t  invalidQueryResult  = ~0;
+static const std::uint64_t  invalidQueryResult   = ~0;
+
+/**
+\brief Specifies an invalid render graph resource.
+\see RenderGraphPassDescriptor::depthStencilAttachment
+*/
+static const std::uint32_t  invalidGraphResource = ~0;
 
 
 } // /namespace Constants
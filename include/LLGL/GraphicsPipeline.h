@@ -19,9 +19,30 @@ namespace LLGL
 /**
 \brief Graphics pipeline interface.
 \see RenderSystem::CreateGraphicsPipeline
+\see RenderSystem::CreateGraphicsPipelineAsync
 \see CommandBuffer::SetGraphicsPipeline
 */
-class LLGL_EXPORT GraphicsPipeline : public RenderSystemChild { };
+class LLGL_EXPORT GraphicsPipeline : public RenderSystemChild
+{
+
+    public:
+
+        /**
+        \brief Returns true if this graphics pipeline has finished compiling and can be bound without blocking.
+        \remarks Graphics pipelines that are created with RenderSystem::CreateGraphicsPipeline are always ready.
+        \see RenderSystem::CreateGraphicsPipelineAsync
+        \see CommandBufferDescriptor::pendingPipelinePolicy
+        */
+        virtual bool IsReady() const;
+
+        /**
+        \brief Blocks the calling thread until this graphics pipeline has finished compiling.
+        \throws std::runtime_error If the background compilation of this graphics pipeline failed.
+        \see IsReady
+        */
+        virtual void WaitReady();
+
+};
 
 
 } // /namespace LLGL
@@ -13,6 +13,7 @@
 #include "ColorRGBA.h"
 #include "Types.h"
 #include "ForwardDecls.h"
+#include "ShaderFlags.h"
 #include <vector>
 #include <cstdint>
 
@@ -703,6 +704,14 @@ struct GraphicsPipelineDescriptor
 
     //! Specifies the blending state descriptor.
     BlendDescriptor         blend;
+
+    /**
+    \brief Optional list of specialization constants for all shader stages of this pipeline.
+    \remarks These override the specialization constants with the same ID that are specified for the individual shaders.
+    \note Only supported with: Vulkan.
+    \see ShaderDescriptor::specializationConstants
+    */
+    std::vector<SpecializationConstant> specializationConstants;
 };
 
 
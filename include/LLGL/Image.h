@@ -114,6 +114,16 @@ class LLGL_EXPORT Image
         */
         void Resize(const Extent3D& extent, const SamplerFilter filter);
 
+        /**
+        \brief Generates all MIP levels of this image on the CPU.
+        \param[in] mipChainDesc Specifies the MIP chain descriptor.
+        \return The new allocated byte buffer with all MIP levels (including a copy of this image as base level) tightly packed one after another.
+        This image remains unchanged.
+        \see GenerateMipChain
+        \see MipChainDataSize
+        */
+        ByteBuffer GenerateMips(const MipChainDescriptor& mipChainDesc = {}) const;
+
         //! Swaps all attributes with the specified image.
         void Swap(Image& rhs);
 
@@ -136,13 +146,14 @@ class LLGL_EXPORT Image
         /**
         \brief Copies a region of the specified source image into this image.
         \param[in] dstRegionOffset Specifies the offset within the destination image (i.e. this Image instance). This can also be outside of the image area.
-        \param[in] srcImage Specifies the source image whose region is to be copied. This must have the same format and data type as this image.
+        \param[in] srcImage Specifies the source image whose region is to be copied.
+        If the source image has a different format or data type, the region is converted while it is copied (see ConvertImageBufferRegion).
         If the source image is the same object as this image and the destination and source regions overlap, an internal temporary copy is allocated for reading the data.
         \param[in] srcRegionOffset Specifies the offset within the source image. This will be clamped if it exceeds the source image area.
         \param[in] srcRegionExtent Specifies the extent of the region to copy. This will be clamped if it exceeds the source or destination image area.
         \remarks If one of the region offsets is clamped, the region extent will be adjusted respectively.
-        If the source image has a different format or data type compared to this image, the function has no effect.
-        \see ConvertImageBuffer
+        \throw std::invalid_argument If the source image has a different format or data type and either of the images has a compressed or depth-stencil format.
+        \see ConvertImageBufferRegion
         */
         void Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRegionOffset, Extent3D srcRegionExtent);
 
@@ -161,7 +172,7 @@ class LLGL_EXPORT Image
         \param[in] extent Specifies the region extent within this image to read from.
         \param[in] imageDesc Specifies the destination image descriptor to write the region to.
         If the 'data' member of this descriptor is null or if the sub-image region is not inside the image, this function has no effect.
-        \param[in] threadCount Specifies the number of threads to use if the data needs to be converted (see ConvertImageBuffer for more details). By default 0.
+        \param[in] threadCount Specifies the number of threads to use if the data needs to be converted (see ConvertImageBufferRegion for more details). By default 0.
         \remarks To read a single pixel, use the following code example:
         \code
         LLGL::ColorRGBAub ReadSinglePixelRGBAub(const LLGL::Image& image, const LLGL::Offset3D& position) {
@@ -174,7 +185,7 @@ class LLGL_EXPORT Image
         \throws std::invalid_argument If the 'data' member of the image descriptor is non-null, the sub-image region is inside the image,
         but the 'dataSize' member of the image descriptor is too small.
         \see IsRegionInside
-        \see ConvertImageBuffer
+        \see ConvertImageBufferRegion
         */
         void ReadPixels(const Offset3D& offset, const Extent3D& extent, const DstImageDescriptor& imageDesc, std::size_t threadCount = 0) const;
 
@@ -184,9 +195,9 @@ class LLGL_EXPORT Image
         \param[in] extent Specifies the region extent within this image to write to.
         \param[in] imageDesc Specifies the source image descriptor to read the region from.
         If the 'data' member of this descriptor is null or if the sub-image region is not inside the image, this function has no effect.
-        \param[in] threadCount Specifies the number of threads to use if the data needs to be converted (see ConvertImageBuffer for more details). By default 0.
+        \param[in] threadCount Specifies the number of threads to use if the data needs to be converted (see ConvertImageBufferRegion for more details). By default 0.
         \see IsRegionInside
-        \see ConvertImageBuffer
+        \see ConvertImageBufferRegion
         */
         void WritePixels(const Offset3D& offset, const Extent3D& extent, const SrcImageDescriptor& imageDesc, std::size_t threadCount = 0);
 
@@ -62,6 +62,27 @@ enum class ImageFormat
     CompressedRGBA, //!< Generic compressed format with four color components: Red, Green, Blue, Alpha.
 };
 
+/**
+\brief Filter enumeration for the generation of MIP-maps on the CPU.
+\see MipChainDescriptor::filter
+*/
+enum class MipFilter
+{
+    Box,            //!< Box filter that averages all texels covered by the destination texel. This is the fastest filter.
+    Kaiser,         //!< Kaiser-windowed sinc filter. Produces sharper MIP-maps with less aliasing, but is slower than the box filter.
+};
+
+
+/**
+\brief Quality enumeration for the compression of images into block-compressed formats.
+\see CompressImageBuffer
+*/
+enum class CompressionQuality
+{
+    Fast,           //!< Endpoints are taken from the bounding box of each block. This is fast enough to compress images at runtime.
+    High,           //!< Endpoints are taken from the principal axis of each block and refined by least squares fitting. Slower, but with less error.
+};
+
 
 /* ----- Structures ----- */
 
@@ -135,6 +156,46 @@ struct DstImageDescriptor
     std::size_t dataSize    = 0;
 };
 
+/**
+\brief Descriptor structure for the generation of a MIP chain on the CPU.
+\see GenerateMipChain
+\see Image::GenerateMips
+*/
+struct MipChainDescriptor
+{
+    //! Specifies the filter to downsample each MIP level. By default MipFilter::Box.
+    MipFilter       filter              = MipFilter::Box;
+
+    /**
+    \brief Specifies the number of MIP levels to generate, including the base level. By default 0.
+    \remarks If this is 0, the full MIP chain down to a 1x1x1 image is generated.
+    \see NumMipLevels(std::uint32_t, std::uint32_t, std::uint32_t)
+    */
+    std::uint32_t   numMipLevels        = 0;
+
+    /**
+    \brief Specifies whether the color components are sRGB encoded. By default false.
+    \remarks If this is true, the red, green, and blue components are converted into linear space before they are averaged,
+    and converted back into sRGB space afterwards. The alpha component is always treated as linear.
+    */
+    bool            sRGB                = false;
+
+    /**
+    \brief Specifies whether the color components are weighted by the alpha component during filtering. By default false.
+    \remarks Use this for images with straight (i.e. non-premultiplied) alpha,
+    so the color of fully transparent texels does not bleed into their neighbors in the lower MIP levels.
+    The output images still have straight alpha.
+    */
+    bool            premultiplyAlpha    = false;
+
+    /**
+    \brief Specifies the number of threads to use for filtering and conversion. By default 0.
+    \remarks If this is less than 2, no multi-threading is used. If this is 'Constants::maxThreadCount',
+    the maximal count of threads the system supports will be used.
+    */
+    std::size_t     threadCount         = 0;
+};
+
 
 /* ----- Functions ----- */
 
@@ -240,6 +301,37 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     std::size_t                 threadCount = 0
 );
 
+/**
+\brief Converts a region of pixels from the source into the destination buffer, where each buffer has its own row and depth stride.
+\param[in] srcImageDesc Specifies the source image descriptor. The 'data' member must point to the first pixel of the source region.
+\param[in] srcRowStride Specifies the source row stride (in bytes).
+\param[in] srcDepthStride Specifies the source depth stride (in bytes), i.e. the stride between two depth slices.
+\param[out] dstImageDesc Specifies the destination image descriptor. The 'data' member must point to the first pixel of the destination region.
+\param[in] dstRowStride Specifies the destination row stride (in bytes).
+\param[in] dstDepthStride Specifies the destination depth stride (in bytes).
+\param[in] extent Specifies the extent of the region (in pixels).
+\param[in] threadCount Specifies the number of threads to use for conversion.
+If this is less than 2, no multi-threading is used. If this is 'Constants::maxThreadCount',
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\remarks In contrast to ConvertImageBuffer, this function converts each row directly into the destination region without any intermediate buffers.
+It can be used to read or write a sub-region of an image with a different format, e.g. to copy tiles into a texture atlas.
+If the source and destination have the same format and data type, the rows are only copied.
+\throw std::invalid_argument If the formats differ and a compressed or depth-stencil image format is specified either as source or destination.
+\throw std::invalid_argument If the source or destination buffer is a null pointer.
+\throw std::invalid_argument If the source or destination buffer size is too small for the region and strides.
+\see ConvertImageBuffer
+*/
+LLGL_EXPORT void ConvertImageBufferRegion(
+    const SrcImageDescriptor&   srcImageDesc,
+    std::size_t                 srcRowStride,
+    std::size_t                 srcDepthStride,
+    const DstImageDescriptor&   dstImageDesc,
+    std::size_t                 dstRowStride,
+    std::size_t                 dstDepthStride,
+    const Extent3D&             extent,
+    std::size_t                 threadCount = 0
+);
+
 /**
 \brief Generates an image buffer with the specified fill data for each pixel.
 \param[in] format Specifies the image format of each pixel in the output image.
@@ -276,6 +368,101 @@ LLGL_EXPORT ByteBuffer GenerateImageBuffer(
 */
 LLGL_EXPORT ByteBuffer GenerateEmptyByteBuffer(std::size_t bufferSize, bool initialize = true);
 
+/**
+\brief Returns the size (in bytes) of a tightly packed MIP chain with the specified attributes.
+\param[in] format Specifies the image format of each pixel.
+\param[in] dataType Specifies the data type of each pixel component.
+\param[in] extent Specifies the extent of the base MIP level.
+\param[in] numMipLevels Specifies the number of MIP levels, including the base level.
+\remarks This can also be used to determine the offset of a MIP level within the buffer that is generated by GenerateMipChain,
+i.e. <code>MipChainDataSize(format, dataType, extent, mipLevel)</code> returns the offset of the MIP level 'mipLevel'.
+\see GenerateMipChain
+*/
+LLGL_EXPORT std::size_t MipChainDataSize(ImageFormat format, DataType dataType, const Extent3D& extent, std::uint32_t numMipLevels);
+
+/**
+\brief Generates all MIP levels of the specified source image on the CPU.
+\param[in] srcImageDesc Specifies the source image descriptor for the base MIP level.
+\param[in] extent Specifies the extent of the source image.
+\param[in] mipChainDesc Specifies the MIP chain descriptor.
+\return The new allocated byte buffer with all MIP levels (including a copy of the base level) tightly packed one after another.
+All MIP levels have the same format and data type as the source image.
+\remarks Each MIP level is downsampled from its previous MIP level, where each dimension is halved and clamped to 1.
+The resulting buffer can be uploaded level by level with the offsets determined by MipChainDataSize.
+Usage example for a 2D image:
+\code
+LLGL::MipChainDescriptor mipChainDesc;
+mipChainDesc.sRGB           = true;
+mipChainDesc.threadCount    = LLGL::Constants::maxThreadCount;
+
+auto numMipLevels = LLGL::NumMipLevels(512, 512);
+auto mipChain     = LLGL::GenerateMipChain(srcImageDesc, { 512, 512, 1 }, mipChainDesc);
+\endcode
+\throw std::invalid_argument If a compressed image format or a depth-stencil format is specified.
+\throw std::invalid_argument If the source buffer is a null pointer or its size is less than the size of the base MIP level.
+\see MipChainDataSize
+\see Image::GenerateMips
+*/
+LLGL_EXPORT ByteBuffer GenerateMipChain(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    const MipChainDescriptor&   mipChainDesc = {}
+);
+
+/**
+\brief Returns the size (in bytes) of an image in the specified block-compressed format.
+\param[in] format Specifies the block-compressed format. This must be Format::BC1RGB, Format::BC1RGBA, Format::BC2RGBA, or Format::BC3RGBA.
+\param[in] extent Specifies the image extent. Width and height are rounded up to a multiple of 4 and each depth slice is compressed separately.
+\return Size of the compressed image data, or 0 if the format is not supported by the block compression functions.
+\see CompressImageBuffer
+*/
+LLGL_EXPORT std::size_t CompressedImageDataSize(const Format format, const Extent3D& extent);
+
+/**
+\brief Compresses the specified image into a block-compressed format.
+\param[in] srcImageDesc Specifies the source image descriptor. This must be an uncompressed color image.
+\param[in] extent Specifies the source image extent.
+\param[in] dstFormat Specifies the destination format. This must be Format::BC1RGB, Format::BC1RGBA, Format::BC2RGBA, or Format::BC3RGBA.
+\param[in] quality Specifies the compression quality. By default CompressionQuality::Fast.
+\param[in] threadCount Specifies the number of threads to use for compression.
+If this is less than 2, no multi-threading is used. If this is 'Constants::maxThreadCount',
+the maximal count of threads the system supports will be used. By default 0.
+\return The new allocated byte buffer with the compressed blocks of all depth slices. Its size is determined by CompressedImageDataSize.
+\remarks Blocks at the right and bottom borders of images whose size is not a multiple of 4 are padded by replicating the border texels.
+For Format::BC1RGBA, texels with an alpha value less than 0.5 are encoded as transparent.
+\throw std::invalid_argument If 'dstFormat' is not one of the supported block-compressed formats.
+\throw std::invalid_argument If the source buffer is a null pointer.
+\throw std::invalid_argument If the source image cannot be converted (see ConvertImageBuffer) or its buffer is too small.
+\see CompressedImageDataSize
+\see DecompressImageBuffer
+*/
+LLGL_EXPORT ByteBuffer CompressImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    const Format                dstFormat,
+    const CompressionQuality    quality     = CompressionQuality::Fast,
+    std::size_t                 threadCount = 0
+);
+
+/**
+\brief Decompresses the specified block-compressed image.
+\param[in] srcImageDesc Specifies the source image descriptor with the compressed blocks.
+\param[in] srcFormat Specifies the format of the compressed blocks. This must be Format::BC1RGB, Format::BC1RGBA, Format::BC2RGBA, or Format::BC3RGBA.
+\param[in] extent Specifies the image extent.
+\param[in] threadCount Specifies the number of threads to use for decompression. By default 0.
+\return The new allocated byte buffer with the decompressed image in the format ImageFormat::RGBA and data type DataType::UInt8.
+\remarks This can be used as fallback if a renderer does not support the respective block-compressed format.
+\throw std::invalid_argument If 'srcFormat' is not one of the supported block-compressed formats.
+\throw std::invalid_argument If the source buffer is a null pointer or its size is less than CompressedImageDataSize.
+\see CompressImageBuffer
+*/
+LLGL_EXPORT ByteBuffer DecompressImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Format                srcFormat,
+    const Extent3D&             extent,
+    std::size_t                 threadCount = 0
+);
+
 /** @} */
 
 
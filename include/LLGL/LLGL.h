@@ -18,6 +18,8 @@
 #include "ColorRGB.h"
 #include "ColorRGBA.h"
 #include "RenderSystem.h"
+#include "RenderGraph.h"
+#include "ObjectCache.h"
 
 
 //DOXYGEN MAIN PAGE
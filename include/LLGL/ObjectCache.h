@@ -0,0 +1,191 @@
+/*
+ * ObjectCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_OBJECT_CACHE_H
+#define LLGL_OBJECT_CACHE_H
+
+
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+struct ShaderDescriptor;
+struct ShaderProgramDescriptor;
+struct SamplerDescriptor;
+struct RenderPassDescriptor;
+struct GraphicsPipelineDescriptor;
+
+/**
+\brief Object cache statistics structure.
+\see ObjectCache::GetStatistics
+*/
+struct ObjectCacheStatistics
+{
+    //! Statistics for a single object type.
+    struct Counter
+    {
+        //! Number of create calls that returned an existing object.
+        std::uint32_t hits      = 0;
+
+        //! Number of create calls that created a new object.
+        std::uint32_t misses    = 0;
+
+        //! Number of objects that are currently held by the cache.
+        std::uint32_t objects   = 0;
+    };
+
+    Counter shaders;            //!< Statistics for shaders.
+    Counter shaderPrograms;     //!< Statistics for shader programs.
+    Counter samplers;           //!< Statistics for samplers.
+    Counter renderPasses;       //!< Statistics for render passes.
+    Counter graphicsPipelines;  //!< Statistics for graphics pipelines.
+};
+
+/**
+\brief Deduplication cache for shaders, shader programs, samplers, render passes, and graphics pipelines.
+\remarks This is an opt-in front-end to the render system: create calls through this cache return an existing object,
+if one was created with an equal descriptor before. The cache key is a stable 64-bit hash over the canonical content of the descriptor,
+i.e. shaders are identified by their source code or binary code and not by their filename.
+Shader files are only read again if their modification time or size has changed since the last lookup.
+Shader programs are identified by the hashes of their attached shaders and their vertex formats.
+Each object handed out by the cache is reference counted and must be released with the respective ObjectCache::Release function.
+The native object is only released when its reference counter drops to zero.
+Here is an example usage:
+\code
+LLGL::ObjectCache myCache(*myRenderer);
+auto mySampler1 = myCache.CreateSampler(mySamplerDesc);
+auto mySampler2 = myCache.CreateSampler(mySamplerDesc); // Returns mySampler1
+myCache.Release(*mySampler2);
+myCache.Release(*mySampler1);                           // Releases the native sampler
+\endcode
+\note A shader program that was created by this cache holds a reference to each of its attached shaders that was also created by this cache.
+\note Graphics pipelines refer to their shader program, render pass, and pipeline layout by identity, i.e. two pipeline descriptors are only equal if they refer to the same objects.
+*/
+class LLGL_EXPORT ObjectCache : public NonCopyable
+{
+
+    public:
+
+        //! Constructs the object cache for the specified render system. The render system must outlive the cache.
+        ObjectCache(RenderSystem& renderSystem);
+
+        //! Releases all objects that are still held by this cache.
+        ~ObjectCache();
+
+        //! Returns a shader for the specified descriptor. \see RenderSystem::CreateShader
+        Shader* CreateShader(const ShaderDescriptor& desc);
+
+        //! Returns a shader program for the specified descriptor. \see RenderSystem::CreateShaderProgram
+        ShaderProgram* CreateShaderProgram(const ShaderProgramDescriptor& desc);
+
+        //! Returns a sampler for the specified descriptor. \see RenderSystem::CreateSampler
+        Sampler* CreateSampler(const SamplerDescriptor& desc);
+
+        //! Returns a render pass for the specified descriptor. \see RenderSystem::CreateRenderPass
+        RenderPass* CreateRenderPass(const RenderPassDescriptor& desc);
+
+        //! Returns a graphics pipeline for the specified descriptor. \see RenderSystem::CreateGraphicsPipeline
+        GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc);
+
+        /**
+        \brief Decrements the reference counter of the specified shader and releases it when the counter drops to zero.
+        \remarks If the shader was not created by this cache, it is released immediately.
+        */
+        void Release(Shader& shader);
+
+        //! \see Release(Shader&)
+        void Release(ShaderProgram& shaderProgram);
+
+        //! \see Release(Shader&)
+        void Release(Sampler& sampler);
+
+        //! \see Release(Shader&)
+        void Release(RenderPass& renderPass);
+
+        //! \see Release(Shader&)
+        void Release(GraphicsPipeline& graphicsPipeline);
+
+        //! Releases all objects that are still held by this cache regardless of their reference counters.
+        void Clear();
+
+        //! Returns the cache statistics.
+        inline const ObjectCacheStatistics& GetStatistics() const
+        {
+            return statistics_;
+        }
+
+        //! Resets the hit and miss counters of the cache statistics.
+        void ResetStatistics();
+
+    private:
+
+        struct CacheEntry
+        {
+            std::vector<char>       key;            // Canonical content of the descriptor; used to resolve hash collisions
+            void*                   object      = nullptr;
+            std::uint32_t           refCount    = 0;
+            std::vector<Shader*>    shaders;        // Shaders that are retained by a shader program entry
+        };
+
+        struct ShaderFileHash
+        {
+            std::int64_t            modificationTime    = 0;
+            std::uint64_t           fileSize            = 0;
+            std::uint64_t           contentHash         = 0;
+        };
+
+        using CacheMap = std::unordered_multimap<std::uint64_t, CacheEntry>;
+
+    private:
+
+        void* Find(CacheMap& cache, std::uint64_t hash, const std::vector<char>& key, ObjectCacheStatistics::Counter& counter);
+        CacheEntry& Insert(CacheMap& cache, std::uint64_t hash, std::vector<char>&& key, void* object, ObjectCacheStatistics::Counter& counter);
+
+        // Returns true if the reference counter of the specified object has dropped to zero, or the object is not part of the cache.
+        bool Unref(CacheMap& cache, const void* object, ObjectCacheStatistics::Counter& counter, std::vector<Shader*>* retainedShaders = nullptr);
+
+        // Increments the reference counter of the specified shader if it was created by this cache, and returns true in that case.
+        bool RefShader(Shader* shader);
+
+        // Returns the content hash of the specified shader file, which is only read again if its modification time or size has changed.
+        std::uint64_t HashShaderFile(const char* filename);
+
+    private:
+
+        RenderSystem&                                   renderSystem_;
+
+        CacheMap                                        shaders_;
+        CacheMap                                        shaderPrograms_;
+        CacheMap                                        samplers_;
+        CacheMap                                        renderPasses_;
+        CacheMap                                        graphicsPipelines_;
+
+        std::unordered_map<const void*, std::uint64_t>  objectHashes_;
+        std::unordered_map<std::string, ShaderFileHash> shaderFileHashes_;
+
+        ObjectCacheStatistics                           statistics_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -111,6 +111,16 @@ class LLGL_EXPORT RenderContext : public RenderTarget
             return *surface_;
         }
 
+        /**
+        \brief Returns true if this render context has a surface. Only headless render contexts have no surface.
+        \remarks If this returns false, the function GetSurface must not be called.
+        \see RenderContextDescriptor::headless
+        */
+        inline bool HasSurface() const
+        {
+            return (surface_ != nullptr);
+        }
+
         /* ----- Configuration ----- */
 
         /**
@@ -187,6 +197,14 @@ class LLGL_EXPORT RenderContext : public RenderTarget
         */
         void SetOrCreateSurface(const std::shared_ptr<Surface>& surface, VideoModeDescriptor videoModeDesc, const void* windowContext);
 
+        /**
+        \brief Initializes the render context without any surface, e.g. for headless rendering.
+        \param[in] videoModeDesc Specifies the video mode descriptor. Fullscreen mode is not supported without a surface.
+        \see RenderContextDescriptor::headless
+        \see HasSurface
+        */
+        void SetHeadlessVideoMode(VideoModeDescriptor videoModeDesc);
+
         /**
         \brief Shares the surface and video mode with another render context.
         \note This is only used by the renderer debug layer.
@@ -50,6 +50,26 @@ enum class OpenGLContextProfile
     ESProfile,
 };
 
+/**
+\brief Swap-chain presentation mode enumeration.
+\remarks If the requested presentation mode is not supported, the renderer falls back to PresentMode::Fifo.
+\see RenderContextDescriptor::presentMode
+*/
+enum class PresentMode
+{
+    //! Presentation mode is determined by the Vsync descriptor. This is the default.
+    Default,
+
+    //! Images are presented in the order they were queued and synchronized with the vertical blank (no tearing).
+    Fifo,
+
+    //! Images are synchronized with the vertical blank, but a queued image is replaced by a newer one (no tearing, low latency).
+    Mailbox,
+
+    //! Images are presented immediately without vertical synchronization (tearing may occur).
+    Immediate,
+};
+
 
 /* ----- Structures ----- */
 
@@ -165,6 +185,29 @@ struct RenderContextDescriptor
     //! OpenGL profile descriptor (to switch between compatability or core profile).
     ProfileOpenGLDescriptor profileOpenGL;
 
+    /**
+    \brief Swap-chain presentation mode. By default PresentMode::Default.
+    \note Only supported with: Vulkan.
+    */
+    PresentMode             presentMode     = PresentMode::Default;
+
+    /**
+    \brief Maximum number of frames the CPU can record ahead of the GPU (also called "frames in flight"). By default 2.
+    \remarks Higher values allow more overlap between CPU and GPU work at the cost of input latency. A value of 0 is treated as 1.
+    \note Only supported with: Vulkan.
+    */
+    std::uint32_t           maxFrameLatency = 2;
+
+    /**
+    \brief Specifies whether to create a headless render context if no surface is specified. By default false.
+    \remarks A headless render context has neither a surface nor a back buffer and does not require any window system,
+    i.e. all rendering must go into RenderTarget objects and RenderContext::Present has no effect.
+    This member is ignored if a surface is passed to RenderSystem::CreateRenderContext.
+    \note Only supported with: OpenGL on Linux (if LLGL is built with the 'LLGL_GL_ENABLE_EGL' option).
+    \see RenderContext::HasSurface
+    */
+    bool                    headless        = false;
+
     //! Debuging callback function object.
     DebugCallback           debugCallback;
 };
@@ -0,0 +1,268 @@
+/*
+ * RenderGraph.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDER_GRAPH_H
+#define LLGL_RENDER_GRAPH_H
+
+
+#include "NonCopyable.h"
+#include "RenderGraphFlags.h"
+#include "TextureFlags.h"
+#include "BufferFlags.h"
+#include "RenderPassFlags.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+
+/**
+\brief Frame graph of render passes with automatic pass culling and transient resource aliasing.
+\remarks The render graph is rebuilt each frame (or whenever the frame setup changes) in three phases:
+- <b>Setup</b>: Declare virtual resources with CreateTexture/CreateBuffer (transient) or ImportTexture/ImportBuffer (external) and add passes with AddPass.
+- <b>Compile</b>: Culls all passes whose outputs are never consumed, computes the lifetime of each transient resource,
+assigns physical resources (transient resources with disjoint lifetimes and identical descriptors share the same physical resource),
+and derives the attachment load and store operations of each render pass.
+- <b>Execute</b>: Records all remaining passes into a command buffer.
+Physical resources are pooled and reused across frames, so recompiling the same graph each frame does not allocate any new resources.
+Here is an example usage:
+\code
+myRenderGraph.Reset();
+
+auto gbuffer = myRenderGraph.CreateTexture("GBuffer", myGBufferDesc);
+auto depth   = myRenderGraph.CreateTexture("Depth", myDepthDesc);
+
+LLGL::RenderGraphPassDescriptor geometryPass;
+{
+    geometryPass.name                   = "Geometry";
+    geometryPass.flags                  = LLGL::RenderGraphPassFlags::ClearColor | LLGL::RenderGraphPassFlags::ClearDepth;
+    geometryPass.colorAttachments       = { gbuffer };
+    geometryPass.depthStencilAttachment = depth;
+    geometryPass.callback               = [&](LLGL::CommandBuffer& cmdBuffer, const LLGL::RenderGraph&) { DrawScene(cmdBuffer); };
+}
+myRenderGraph.AddPass(geometryPass);
+
+LLGL::RenderGraphPassDescriptor lightingPass;
+{
+    lightingPass.name           = "Lighting";
+    lightingPass.reads          = { gbuffer };
+    lightingPass.renderTarget   = myRenderContext;
+    lightingPass.callback       = [&](LLGL::CommandBuffer& cmdBuffer, const LLGL::RenderGraph& graph) { DrawLighting(cmdBuffer, graph.GetTexture(gbuffer)); };
+}
+myRenderGraph.AddPass(lightingPass);
+
+myRenderGraph.Compile();
+myRenderGraph.Execute(*myCmdBuffer);
+\endcode
+\note All transitions between passes are expressed by render pass boundaries,
+i.e. each pass with attachments is enclosed by CommandBuffer::BeginRenderPass and CommandBuffer::EndRenderPass.
+*/
+class LLGL_EXPORT RenderGraph : public NonCopyable
+{
+
+    public:
+
+        //! Constructs the render graph for the specified render system. The render system must outlive the render graph.
+        RenderGraph(RenderSystem& renderSystem);
+
+        //! Releases all physical resources that have been allocated by this render graph.
+        ~RenderGraph();
+
+        /* ----- Setup ----- */
+
+        /**
+        \brief Declares a new transient texture and returns its virtual resource ID.
+        \remarks The physical texture is only allocated during Compile and might be shared with other transient textures whose lifetimes don't overlap.
+        Transient textures used as attachment must have been declared with the TextureFlags::AttachmentUsage flag.
+        */
+        std::uint32_t CreateTexture(const std::string& name, const TextureDescriptor& desc);
+
+        /**
+        \brief Imports an external texture into the render graph and returns its virtual resource ID.
+        \remarks The content of imported resources is always preserved, i.e. passes writing into an imported resource are never culled.
+        */
+        std::uint32_t ImportTexture(const std::string& name, Texture& texture);
+
+        //! Declares a new transient buffer and returns its virtual resource ID.
+        std::uint32_t CreateBuffer(const std::string& name, const BufferDescriptor& desc);
+
+        //! Imports an external buffer into the render graph and returns its virtual resource ID.
+        std::uint32_t ImportBuffer(const std::string& name, Buffer& buffer);
+
+        /**
+        \brief Adds a new pass to the render graph.
+        \remarks Passes are executed in the order they are added.
+        \throws std::invalid_argument If the pass descriptor refers to an invalid virtual resource ID, or a buffer is used as attachment.
+        */
+        void AddPass(const RenderGraphPassDescriptor& desc);
+
+        /**
+        \brief Removes all passes and virtual resources, but keeps the pool of physical resources for the next frame.
+        \remarks Call this before the setup phase of each frame.
+        */
+        void Reset();
+
+        /* ----- Compilation and execution ----- */
+
+        /**
+        \brief Compiles the render graph, i.e. culls unused passes and assigns the physical resources.
+        \remarks Physical resources that were not used by this compilation are released.
+        */
+        void Compile();
+
+        /**
+        \brief Records all passes that have not been culled into the specified command buffer.
+        \remarks The command buffer must be in recording state (i.e. between CommandQueue::Begin and CommandQueue::End).
+        \throws std::runtime_error If the render graph has not been compiled since the last setup change.
+        */
+        void Execute(CommandBuffer& commandBuffer);
+
+        /* ----- Resources ----- */
+
+        /**
+        \brief Returns the physical texture of the specified virtual resource.
+        \remarks This is only valid after Compile and returns null if the resource is unused or not a texture.
+        */
+        Texture* GetTexture(std::uint32_t id) const;
+
+        /**
+        \brief Returns the physical buffer of the specified virtual resource.
+        \remarks This is only valid after Compile and returns null if the resource is unused or not a buffer.
+        */
+        Buffer* GetBuffer(std::uint32_t id) const;
+
+        //! Returns the number of passes that will be executed by the last compilation.
+        std::uint32_t GetNumActivePasses() const;
+
+        //! Returns the number of physical textures currently allocated by the render graph.
+        inline std::uint32_t GetNumPhysicalTextures() const
+        {
+            return static_cast<std::uint32_t>(texturePool_.size());
+        }
+
+        //! Returns the number of physical buffers currently allocated by the render graph.
+        inline std::uint32_t GetNumPhysicalBuffers() const
+        {
+            return static_cast<std::uint32_t>(bufferPool_.size());
+        }
+
+    private:
+
+        enum class ResourceKind
+        {
+            Texture,
+            Buffer,
+        };
+
+        struct VirtualResource
+        {
+            std::string         name;
+            ResourceKind        kind;
+            TextureDescriptor   textureDesc;
+            BufferDescriptor    bufferDesc;
+            Texture*            texture     = nullptr;  // Physical texture (imported or assigned by the pool)
+            Buffer*             buffer      = nullptr;  // Physical buffer (imported or assigned by the pool)
+            bool                imported    = false;
+            std::uint32_t       firstPass   = 0;        // Index of first active pass using this resource
+            std::uint32_t       lastPass    = 0;        // Index of last active pass using this resource
+            bool                used        = false;
+        };
+
+        struct Pass
+        {
+            RenderGraphPassDescriptor   desc;
+            bool                        active          = false;
+            std::vector<std::uint32_t>  dependencies;               // Indices of passes this pass depends on
+            RenderPass*                 renderPass      = nullptr;  // Render pass with derived load/store operations
+            RenderTarget*               renderTarget    = nullptr;  // Render target for the attachments (created by the render graph)
+        };
+
+        struct PooledTexture
+        {
+            TextureDescriptor   desc;
+            Texture*            texture     = nullptr;
+            std::uint32_t       freePass    = 0;        // Index of the first pass this texture is available again
+            bool                assigned    = false;    // Specifies whether this texture is used by the current compilation
+        };
+
+        struct PooledBuffer
+        {
+            BufferDescriptor    desc;
+            Buffer*             buffer      = nullptr;
+            std::uint32_t       freePass    = 0;
+            bool                assigned    = false;
+        };
+
+        struct PooledRenderPass
+        {
+            RenderPassDescriptor    desc;
+            RenderPass*             renderPass  = nullptr;
+            bool                    assigned    = false;
+        };
+
+        struct PooledRenderTarget
+        {
+            std::vector<Texture*>   attachments;
+            const RenderPass*       renderPass      = nullptr;
+            RenderTarget*           renderTarget    = nullptr;
+            bool                    assigned        = false;
+        };
+
+    private:
+
+        std::uint32_t AddResource(const std::string& name, ResourceKind kind);
+        void ValidateResourceID(std::uint32_t id, ResourceKind kind) const;
+
+        void BuildDependencies();
+        void CullPasses();
+        void ComputeLifetimes();
+        void AssignPhysicalResources();
+        void BuildRenderTargets();
+
+        Texture* AcquireTexture(const TextureDescriptor& desc, std::uint32_t firstPass, std::uint32_t lastPass);
+        Buffer* AcquireBuffer(const BufferDescriptor& desc, std::uint32_t firstPass, std::uint32_t lastPass);
+        RenderPass* AcquireRenderPass(const RenderPassDescriptor& desc);
+        RenderTarget* AcquireRenderTarget(const std::vector<Texture*>& attachments, const RenderPass* renderPass);
+
+        AttachmentFormatDescriptor MakeAttachmentFormat(std::uint32_t id, std::uint32_t passIndex, bool clear) const;
+
+        bool IsResourceUsedBefore(std::uint32_t id, std::uint32_t passIndex) const;
+        bool IsResourceUsedAfter(std::uint32_t id, std::uint32_t passIndex) const;
+
+        void TrimPools();
+        void ReleaseAll();
+
+    private:
+
+        RenderSystem&                       renderSystem_;
+
+        std::vector<VirtualResource>        resources_;
+        std::vector<Pass>                   passes_;
+
+        std::vector<PooledTexture>          texturePool_;
+        std::vector<PooledBuffer>           bufferPool_;
+        std::vector<PooledRenderPass>       renderPassPool_;
+        std::vector<PooledRenderTarget>     renderTargetPool_;
+
+        bool                                compiled_           = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,131 @@
+/*
+ * RenderGraphFlags.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_RENDER_GRAPH_FLAGS_H
+#define LLGL_RENDER_GRAPH_FLAGS_H
+
+
+#include "Export.h"
+#include "Constants.h"
+#include "ForwardDecls.h"
+#include <functional>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderGraph;
+
+
+/* ----- Types ----- */
+
+/**
+\brief Render graph pass callback function interface.
+\param[in] commandBuffer Specifies the command buffer the pass is recorded into.
+If the pass has any attachments, the render pass for these attachments has already been begun.
+\param[in] renderGraph Specifies the render graph that executes the pass.
+This can be used to retrieve the physical resources with RenderGraph::GetTexture and RenderGraph::GetBuffer.
+\ingroup group_callbacks
+*/
+using RenderGraphPassCallback = std::function<void(CommandBuffer& commandBuffer, const RenderGraph& renderGraph)>;
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Render graph pass flags.
+\see RenderGraphPassDescriptor::flags
+*/
+struct RenderGraphPassFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the pass is never culled, even if none of its outputs are used.
+        \remarks Use this for passes with side effects the render graph cannot see, e.g. writing into a resource that is read by the CPU.
+        */
+        KeepAlive       = (1 << 0),
+
+        //! Specifies that all color attachments are cleared when the pass begins.
+        ClearColor      = (1 << 1),
+
+        //! Specifies that the depth-stencil attachment is cleared when the pass begins.
+        ClearDepth      = (1 << 2),
+    };
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Render graph pass descriptor structure.
+\remarks A pass declares which virtual resources it reads and writes.
+The render graph uses these declarations to cull unused passes, to derive the load and store operations of the render pass attachments,
+and to determine the lifetime of each transient resource.
+\see RenderGraph::AddPass
+*/
+struct RenderGraphPassDescriptor
+{
+    //! Name of the pass for debugging purposes.
+    std::string                         name;
+
+    /**
+    \brief Specifies the pass flags. By default 0.
+    \remarks This can be a bitwise OR combination of the RenderGraphPassFlags enumeration entries.
+    \see RenderGraphPassFlags
+    */
+    long                                flags                   = 0;
+
+    /**
+    \brief Virtual textures this pass renders into as color attachments.
+    \remarks Unless the pass has the RenderGraphPassFlags::ClearColor flag, the previous content is loaded,
+    i.e. the pass depends on the last pass that has written into these textures (e.g. to accumulate several passes into the same texture).
+    */
+    std::vector<std::uint32_t>          colorAttachments;
+
+    /**
+    \brief Virtual texture this pass uses as depth-stencil attachment. By default Constants::invalidGraphResource.
+    \remarks Unless the pass has the RenderGraphPassFlags::ClearDepth flag, the previous content is loaded.
+    */
+    std::uint32_t                       depthStencilAttachment  = Constants::invalidGraphResource;
+
+    /**
+    \brief Virtual textures and buffers this pass reads from (e.g. as shader resources).
+    \remarks If an attachment is also listed here, its previous content is loaded when the render pass begins.
+    */
+    std::vector<std::uint32_t>          reads;
+
+    /**
+    \brief Virtual textures and buffers this pass writes to, other than attachments (e.g. as storage resources in a compute shader).
+    \remarks Writes are treated as read-modify-write, i.e. the pass depends on the last pass that has written into these resources.
+    */
+    std::vector<std::uint32_t>          writes;
+
+    /**
+    \brief Optional external render target (e.g. a RenderContext) this pass renders into. By default null.
+    \remarks If this is specified, the 'colorAttachments' and 'depthStencilAttachment' members are ignored,
+    and the pass is never culled since its output is visible outside of the render graph.
+    */
+    RenderTarget*                       renderTarget            = nullptr;
+
+    //! Callback function that records the commands of this pass.
+    RenderGraphPassCallback             callback;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
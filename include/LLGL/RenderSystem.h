@@ -37,6 +37,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <map>
 #include <cstdint>
 
 
@@ -175,6 +176,23 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         //! Returns the single instance of the command queue.
         virtual CommandQueue* GetCommandQueue() = 0;
 
+        /**
+        \brief Returns the command queue for the specified type of work.
+        \param[in] type Specifies the type of command queue.
+        \return Pointer to a command queue that is executed asynchronously to the main command queue,
+        or the main command queue (see GetCommandQueue) if the device does not provide a dedicated queue for this type of work.
+        \remarks Resources that are written on a dedicated queue and read on another queue must be synchronized with CommandQueue::WaitQueue.
+        Command buffers that are submitted to a dedicated queue must be created with the same CommandBufferDescriptor::queueType.
+        \remarks With Vulkan, all buffers and textures are shared concurrently between the queue families of all command queues,
+        so they can be accessed on any command queue without queue family ownership transfers.
+        The content of a resource is consistent across queues as long as all accesses are ordered with CommandQueue::WaitQueue.
+        Only the swap-chain images of a RenderContext are exclusive to the main command queue.
+        \note Only supported with: Vulkan. For the other renderers, this function always returns the main command queue.
+        \see CommandQueue::WaitQueue
+        \see CommandBufferDescriptor::queueType
+        */
+        virtual CommandQueue* GetDedicatedCommandQueue(const CommandQueueType type);
+
         /* ----- Command buffers ----- */
 
         /**
@@ -215,6 +233,19 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) = 0;
 
+        /**
+        \brief Creates a new generic hardware buffer whose storage is allocated and initialized in the background.
+        \param[in] desc Specifies the buffer descriptor.
+        \param[in] initialData Optional raw pointer to the initial buffer data. The data is copied before this function returns.
+        \param[in,out] fence Specifies the fence that is signaled when the buffer is ready to be used.
+        \remarks The buffer must not be used or released before the fence has been signaled (see CommandQueue::WaitFence).
+        Each fence must only be used for a single pending operation at a time.
+        If background uploads are disabled or not supported by the renderer, this function falls back to CreateBuffer and signals the fence immediately.
+        \see RenderSystemConfiguration::backgroundUploads
+        \see CreateBuffer
+        */
+        virtual Buffer* CreateBufferAsync(const BufferDescriptor& desc, const void* initialData, Fence& fence);
+
         /**
         \brief Creates a new buffer array.
         \param[in] numBuffers Specifies the number of buffers in the array. This must be greater than 0.
@@ -271,11 +302,24 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         If this is null, the texture will be initialized with the currently configured default image color.
         If this is non-null, it is used to initialize the texture data.
         This parameter will be ignored if the texture type is a multi-sampled texture (i.e. TextureType::Texture2DMS or TextureType::Texture2DMSArray).
+        \remarks If the OpenGL render system does not support the BC1, BC2, or BC3 texture formats, such textures are created with Format::RGBA8UNorm instead,
+        and their initial image data as well as all image data written with WriteTexture or WriteTextureAsync is decompressed on the CPU (see DecompressImageBuffer).
         \see WriteTexture
         \see RenderSystemConfiguration::imageInitialization
         */
         virtual Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) = 0;
 
+        /**
+        \brief Creates a new texture whose storage is allocated and initialized in the background.
+        \param[in] textureDesc Specifies the texture descriptor.
+        \param[in] imageDesc Optional pointer to the image data descriptor. The image data is copied before this function returns.
+        \param[in,out] fence Specifies the fence that is signaled when the texture is ready to be used.
+        \remarks The same restrictions as for CreateBufferAsync apply.
+        \see CreateBufferAsync
+        \see CreateTexture
+        */
+        virtual Texture* CreateTextureAsync(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc, Fence& fence);
+
         //! Releases the specified texture object. After this call, the specified object must no longer be used.
         virtual void Release(Texture& texture) = 0;
 
@@ -288,6 +332,15 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Updates the image data of the specified texture in the background.
+        \param[in,out] fence Specifies the fence that is signaled when the texture update has finished.
+        \remarks The image data is copied before this function returns. The same restrictions as for CreateBufferAsync apply.
+        \see CreateBufferAsync
+        \see WriteTexture
+        */
+        virtual void WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc, Fence& fence);
+
         /**
         \brief Reads the image data from the specified texture.
         \param[in] texture Specifies the texture object to read from.
@@ -322,6 +375,43 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Begins to read the image data from the specified texture without stalling the CPU.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] mipLevel Specifies the MIP-level from which to read the texture data.
+        \param[in,out] fence Specifies the fence that is signaled when the image data is available on the CPU side.
+        \return Handle of the pending read operation, which must be passed to ResolveTextureRead once the fence has been signaled.
+        \remarks The texture data is copied into an internal staging memory in the native format of the texture.
+        The OpenGL renderer uses a ring of pixel pack buffers (PBO) and the Vulkan renderer uses host-visible staging buffers for this purpose.
+        Renderers that do not support asynchronous texture reads fall back to a synchronous read and signal the fence immediately.
+        \code
+        auto myReadHandle = myRenderSystem->ReadTextureAsync(*myTexture, 0, *myFence);
+
+        // Do some other work ...
+
+        myCommandQueue->WaitFence(*myFence, ~0ull);
+        myRenderSystem->ResolveTextureRead(myReadHandle, myImageDesc);
+        \endcode
+        \throws std::invalid_argument If the texture has a compressed format.
+        \throws std::invalid_argument If 'fence' is a timeline fence and the Vulkan renderer is used.
+        \see ResolveTextureRead
+        \see ReadTexture
+        */
+        virtual TextureReadHandle ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence);
+
+        /**
+        \brief Finishes a texture read operation that was started with ReadTextureAsync.
+        \param[in] handle Specifies the handle of the pending read operation. After this call, the handle is no longer valid.
+        \param[out] imageDesc Specifies the destination image descriptor to write the texture data to.
+        If the image format or data type differ from the native format of the texture, the image data is converted (see ConvertImageBuffer).
+        If 'imageDesc.data' is null, the read operation is discarded without copying any data.
+        \remarks The fence that was passed to ReadTextureAsync must have been signaled before this function is called,
+        otherwise the content of the destination image is undefined.
+        \throws std::invalid_argument If 'handle' does not refer to a pending read operation.
+        \see ReadTextureAsync
+        */
+        virtual void ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc);
+
         /**
         \brief Generates all MIP-maps for the specified texture.
         \param[in,out] texture Specifies the texture whose MIP-maps are to be generated.
@@ -348,6 +438,27 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) = 0;
 
+        /**
+        \brief Generates all MIP-maps for the specified texture in the background.
+        \param[in,out] fence Specifies the fence that is signaled when the MIP-maps have been generated.
+        \remarks The same restrictions as for CreateBufferAsync apply.
+        \see CreateBufferAsync
+        \see GenerateMips(Texture&)
+        */
+        virtual void GenerateMipsAsync(Texture& texture, Fence& fence);
+
+        /**
+        \brief Generates all MIP-maps for each of the specified textures with as few queue submissions as possible.
+        \param[in] numTextures Specifies the number of textures in the array 'textures'.
+        \param[in] textures Pointer to an array of texture objects whose MIP-maps are to be generated. This must not be null if 'numTextures' is greater than 0.
+        \param[in,out] fence Optional pointer to a fence that is signaled when the MIP-maps of all textures have been generated. By default null.
+        \remarks This is the preferred way to generate the MIP-maps of many textures at once, e.g. after a level has been loaded.
+        The Vulkan render system records all MIP-map chains into a single command buffer and submits it once, instead of waiting for the queue for each texture.
+        \see GenerateMips(Texture&)
+        \see RenderSystemConfiguration::deferMipGeneration
+        */
+        virtual void GenerateMipsBatch(std::uint32_t numTextures, Texture* const * textures, Fence* fence = nullptr);
+
         /* ----- Samplers ---- */
 
         /**
@@ -467,6 +578,29 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) = 0;
 
+        /**
+        \brief Creates a new graphics pipeline whose shaders are compiled in the background.
+        \remarks The returned pipeline can be bound immediately, but it might not be ready to be used for drawing yet (see GraphicsPipeline::IsReady).
+        How a command buffer handles a pipeline that is not ready yet is specified by CommandBufferDescriptor::pendingPipelinePolicy.
+        All objects the descriptor refers to (i.e. shader program, pipeline layout, and render pass) must not be released before the pipeline is ready.
+        If background compilation is not supported by the renderer, this function falls back to CreateGraphicsPipeline.
+        \note Only supported with: OpenGL (with GL_KHR_parallel_shader_compile), Vulkan.
+        \see CreateGraphicsPipeline
+        \see GraphicsPipeline::IsReady
+        */
+        virtual GraphicsPipeline* CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc);
+
+        /**
+        \brief Creates a new compute pipeline whose shaders are compiled in the background.
+        \remarks The returned pipeline can be bound immediately, but it might not be ready to be used for dispatching yet (see ComputePipeline::IsReady).
+        All objects the descriptor refers to (i.e. shader program and pipeline layout) must not be released before the pipeline is ready.
+        If background compilation is not supported by the renderer, this function falls back to CreateComputePipeline.
+        \note Only supported with: OpenGL (with GL_KHR_parallel_shader_compile), Vulkan.
+        \see CreateComputePipeline
+        \see ComputePipeline::IsReady
+        */
+        virtual ComputePipeline* CreateComputePipelineAsync(const ComputePipelineDescriptor& desc);
+
         //! Releases the specified GraphicsPipeline object. After this call, the specified object must no longer be used.
         virtual void Release(GraphicsPipeline& graphicsPipeline) = 0;
 
@@ -490,6 +624,29 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         virtual Fence* CreateFence() = 0;
 
+        /**
+        \brief Creates a new timeline fence, i.e. a fence with a monotonically increasing 64-bit value.
+        \param[in] initialValue Specifies the initial value of the fence. By default 0.
+        \remarks A timeline fence is signaled with CommandQueue::Signal and can be queried without blocking with CommandQueue::GetCompletedValue.
+        A single timeline fence can replace a ring of binary fences, e.g. for frame pacing:
+        \code
+        // Signal the frame counter after each frame
+        myCmdQueue->Signal(*myFrameFence, ++myFrameCounter);
+
+        // Wait until the frame that used the same resources two frames ago has been completed
+        std::uint64_t frameValue = myFrameCounter - 1;
+        myCmdQueue->WaitFences(1, &myFrameFence, &frameValue, true, ~0ull);
+        \endcode
+        Submitting a timeline fence with CommandQueue::Submit(Fence&) signals the next value after the highest value that has been signaled so far,
+        and CommandQueue::WaitFence waits for the highest value that has been signaled so far.
+        Timeline fences must not be passed to the asynchronous resource functions such as CreateBufferAsync.
+        \throws std::runtime_error If timeline fences are not supported (see RenderingFeatures::hasTimelineFences).
+        \note Only supported with: OpenGL, Vulkan.
+        \see RenderingFeatures::hasTimelineFences
+        \see CommandQueue::Signal
+        */
+        virtual Fence* CreateTimelineFence(std::uint64_t initialValue = 0);
+
         //! Releases the specified Fence object. After this call, the specified object must no longer be used.
         virtual void Release(Fence& fence) = 0;
 
@@ -524,6 +681,25 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         //! Validates the specified image data size against the required size (in bytes).
         void AssertImageDataSize(std::size_t dataSize, std::size_t requiredDataSize, const char* info = nullptr);
 
+        /**
+        \brief Determines the image format and data type a texture read operation uses for the specified hardware format.
+        \throws std::invalid_argument If the specified format cannot be read back (e.g. compressed formats).
+        */
+        void GetTextureReadFormat(const Format format, ImageFormat& imageFormat, DataType& dataType);
+
+        //! Copies the image data of a finished texture read operation into the destination image, and converts it if necessary.
+        void CopyTextureReadData(const SrcImageDescriptor& srcImageDesc, const DstImageDescriptor& dstImageDesc);
+
+    private:
+
+        // Texture read operation of the synchronous fallback for ReadTextureAsync.
+        struct PendingTextureRead
+        {
+            ImageFormat         format      = ImageFormat::RGBA;
+            DataType            dataType    = DataType::UInt8;
+            std::vector<char>   data;
+        };
+
     private:
 
         int                         rendererID_ = 0;
@@ -533,6 +709,9 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         RenderingCapabilities       caps_;
         RenderSystemConfiguration   config_;
 
+        std::map<std::uint64_t, PendingTextureRead> pendingTextureReads_;
+        std::uint64_t                               textureReadCounter_ = 0;
+
 };
 
 
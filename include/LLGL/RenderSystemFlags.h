@@ -157,6 +157,25 @@ struct RenderSystemConfiguration
     \see Constants::maxThreadCount
     */
     std::size_t         threadCount         = Constants::maxThreadCount;
+
+    /**
+    \brief Specifies whether the render system may upload resources on a background thread. By default false.
+    \remarks This only affects the asynchronous functions of the render system, e.g. RenderSystem::CreateTextureAsync.
+    The OpenGL render system creates a worker thread with a shared GL context for this purpose.
+    On Linux, XInitThreads must be called before any other Xlib function when this is enabled, since the worker uses the same X11 display.
+    If this is false, the asynchronous functions are executed immediately on the calling thread.
+    \see RenderSystem::CreateBufferAsync
+    */
+    bool                backgroundUploads   = false;
+
+    /**
+    \brief Specifies whether MIP-map generation may be deferred until the next command queue submission. By default false.
+    \remarks If this is true, RenderSystem::GenerateMips only records the request,
+    and all pending requests are executed at first within the next submission of a command buffer or fence to the command queue.
+    This is currently only supported by the Vulkan render system and ignored by all other render systems.
+    \see RenderSystem::GenerateMipsBatch
+    */
+    bool                deferMipGeneration  = false;
 };
 
 /**
@@ -418,6 +437,13 @@ struct RenderingFeatures
     \see BlendDescriptor::logicOp
     */
     bool hasLogicOp                     = false;
+
+    /**
+    \brief Specifies whether timeline fences with a monotonically increasing 64-bit value are supported.
+    \note For Vulkan, the extension VK_KHR_timeline_semaphore is required. For OpenGL, timeline fences are emulated with sync objects.
+    \see RenderSystem::CreateTimelineFence
+    */
+    bool hasTimelineFences              = false;
 };
 
 /**
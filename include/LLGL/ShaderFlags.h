@@ -11,7 +11,10 @@
 
 #include "Export.h"
 #include "StreamOutputFormat.h"
+#include "ShaderUniformFlags.h"
+#include <vector>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace LLGL
@@ -114,6 +117,95 @@ struct StageFlags
 
 /* ----- Structures ----- */
 
+/**
+\brief Shader specialization constant structure.
+\remarks Specialization constants override the default value of a constant in a shader without compiling another variant of the shader source.
+For SPIR-V modules, the constant is identified by its ID (e.g. <code>layout(constant_id = 1) const int numLights = 4;</code>).
+For GLSL source code, the constant is injected as macro definition with its name (e.g. <code>#define NUM_LIGHTS 4</code>) after the <code>#version</code> directive.
+\see ShaderDescriptor::specializationConstants
+\see GraphicsPipelineDescriptor::specializationConstants
+\see ComputePipelineDescriptor::specializationConstants
+*/
+struct SpecializationConstant
+{
+    //! Specialization constant value. Which member is used depends on the 'type' member.
+    union Value
+    {
+        double          f64;    //!< Value for UniformType::Double1.
+        float           f32;    //!< Value for UniformType::Float1.
+        std::int32_t    i32;    //!< Value for UniformType::Int1.
+        std::uint32_t   u32;    //!< Value for UniformType::UInt1 and UniformType::Bool1 (where 0 is false and every other value is true).
+    };
+
+    SpecializationConstant() = default;
+    SpecializationConstant(const SpecializationConstant&) = default;
+    SpecializationConstant& operator = (const SpecializationConstant&) = default;
+
+    //! Constructs a specialization constant of type UniformType::Float1.
+    inline SpecializationConstant(std::uint32_t constantID, float value, const char* name = nullptr) :
+        constantID { constantID           },
+        name       { name                 },
+        type       { UniformType::Float1  }
+    {
+        this->value.f32 = value;
+    }
+
+    //! Constructs a specialization constant of type UniformType::Double1.
+    inline SpecializationConstant(std::uint32_t constantID, double value, const char* name = nullptr) :
+        constantID { constantID           },
+        name       { name                 },
+        type       { UniformType::Double1 }
+    {
+        this->value.f64 = value;
+    }
+
+    //! Constructs a specialization constant of type UniformType::Int1.
+    inline SpecializationConstant(std::uint32_t constantID, std::int32_t value, const char* name = nullptr) :
+        constantID { constantID           },
+        name       { name                 },
+        type       { UniformType::Int1    }
+    {
+        this->value.i32 = value;
+    }
+
+    //! Constructs a specialization constant of type UniformType::UInt1.
+    inline SpecializationConstant(std::uint32_t constantID, std::uint32_t value, const char* name = nullptr) :
+        constantID { constantID           },
+        name       { name                 },
+        type       { UniformType::UInt1   }
+    {
+        this->value.u32 = value;
+    }
+
+    //! Constructs a specialization constant of type UniformType::Bool1.
+    inline SpecializationConstant(std::uint32_t constantID, bool value, const char* name = nullptr) :
+        constantID { constantID           },
+        name       { name                 },
+        type       { UniformType::Bool1   }
+    {
+        this->value.u32 = (value ? 1u : 0u);
+    }
+
+    //! Specialization constant ID, i.e. the value of the <code>constant_id</code> layout qualifier in GLSL for SPIR-V. By default 0.
+    std::uint32_t   constantID  = 0;
+
+    /**
+    \brief Name of the macro that is defined for GLSL source code. If this is null, the constant is ignored for GLSL source code. By default null.
+    \note Only supported with: OpenGL.
+    */
+    const char*     name        = nullptr;
+
+    /**
+    \brief Scalar data type of the constant. By default UniformType::Undefined.
+    \remarks This must be either UniformType::Float1, UniformType::Double1, UniformType::Int1, UniformType::UInt1, or UniformType::Bool1.
+    Specialization constants of type UniformType::Double1 are not supported for SPIR-V modules with OpenGL.
+    */
+    UniformType     type        = UniformType::Undefined;
+
+    //! Value of the constant. By default zero.
+    Value           value       = {};
+};
+
 /**
 \brief Shader source and binary code descriptor structure.
 \see RenderSystem::CreateShader
@@ -205,6 +297,14 @@ struct ShaderDescriptor
 
     //! Optional stream output descriptor for a geometry shader (or a vertex shader when used with OpenGL).
     StreamOutput        streamOutput;
+
+    /**
+    \brief Optional list of specialization constants for this shader.
+    \remarks Shaders that only differ in their specialization constants can share the same SPIR-V module.
+    \note Only supported with: OpenGL, Vulkan.
+    \see SpecializationConstant
+    */
+    std::vector<SpecializationConstant> specializationConstants;
 };
 
 
@@ -88,6 +88,7 @@ class LLGL_EXPORT ShaderProgram : public RenderSystemChild
             myShaderProgram->UnlockShaderUniform();
         }
         \endcode
+        If GL_ARB_separate_shader_objects is supported, the uniforms are set directly to the shader program without binding it.
         \note Only supported with: OpenGL.
         \see UnlockShaderUniform
         */
@@ -94,6 +94,52 @@ struct ShaderProgramDescriptor
 */
 struct ShaderReflectionDescriptor
 {
+    /**
+    \brief Shader reflection buffer field structure.
+    \remarks Describes the memory layout of a single field within a constant buffer, storage buffer, or push constant block.
+    Fields of nested structures are flattened into separate entries whose names are separated by a dot (e.g. "light.color").
+    \note Only supported with: Vulkan.
+    */
+    struct BufferField
+    {
+        //! Name of the field. Fields of nested structures are prefixed by the name of their parent field.
+        std::string         name;
+
+        //! Data type of the field. This is UniformType::Undefined for arrays of structures, whose layout is only described by the array stride.
+        UniformType         type            = UniformType::Undefined;
+
+        //! Byte offset of the field from the beginning of the buffer. By default 0.
+        std::uint32_t       offset          = 0;
+
+        //! Size (in bytes) of the field, including all array elements. This is 0 for runtime sized arrays. By default 0.
+        std::uint32_t       size            = 0;
+
+        //! Number of array elements, or 0 if the field is not an array. By default 0.
+        std::uint32_t       arraySize       = 0;
+
+        //! Stride (in bytes) between two array elements, or 0 if the field is not an array. By default 0.
+        std::uint32_t       arrayStride     = 0;
+
+        //! Stride (in bytes) between two matrix columns (or rows for row-major matrices), or 0 if the field is not a matrix. By default 0.
+        std::uint32_t       matrixStride    = 0;
+    };
+
+    /**
+    \brief Shader reflection specialization constant structure.
+    \note Only supported with: Vulkan.
+    */
+    struct SpecializationConstant
+    {
+        //! Name of the specialization constant, i.e. the identifier used in the shader.
+        std::string         name;
+
+        //! Specialization constant ID, i.e. the value of the <code>constant_id</code> layout qualifier in GLSL. By default 0.
+        std::uint32_t       constantID      = 0;
+
+        //! Scalar data type of the specialization constant. By default UniformType::Undefined.
+        UniformType         type            = UniformType::Undefined;
+    };
+
     /**
     \brief Shader reflection resource view structure.
     \remarks A mapping between this structure and a binding descriptor may look like this:
@@ -152,6 +198,14 @@ struct ShaderReflectionDescriptor
         \remarks Additional attribute exclusively used for storage buffer resources.
         */
         StorageBufferType   storageBufferType   = StorageBufferType::Undefined;
+
+        /**
+        \brief Specifies the memory layout of a constant buffer or storage buffer resource.
+        \remarks Additional attribute exclusively used for constant buffer and storage buffer resources.
+        \note Only supported with: Vulkan.
+        \see BufferField
+        */
+        std::vector<BufferField>    fields;
     };
 
     //! List of all vertex attributes.
@@ -165,9 +219,16 @@ struct ShaderReflectionDescriptor
 
     /**
     \brief List of all uniforms.
+    \remarks For Vulkan, these are the fields of the push constant block, where the location specifies the byte offset of each field.
     \note Only supported with: OpenGL, Vulkan.
     */
     std::vector<UniformDescriptor>      uniforms;
+
+    /**
+    \brief List of all specialization constants, sorted by their constant ID.
+    \note Only supported with: Vulkan.
+    */
+    std::vector<SpecializationConstant> specializationConstants;
 };
 
 
@@ -28,6 +28,23 @@ class LLGL_EXPORT ShaderUniform : public NonCopyable
 
     public:
 
+        /**
+        \brief Returns the location of the specified uniform, or -1 if the shader program has no active uniform with that name.
+        \remarks The uniform locations are cached once per shader program, so this does not query the driver.
+        Store the returned location and use the location based setters to avoid the name lookup for each update.
+        Single array elements can be specified with a subscript, e.g. \c "myLights[2]".
+        */
+        virtual UniformLocation GetUniformLocation(const char* name) = 0;
+
+        /**
+        \brief Sets multiple uniforms at once.
+        \param[in] numUniformValues Specifies the number of elements in the 'uniformValues' array.
+        \param[in] uniformValues Pointer to an array of uniform values.
+        \throws std::invalid_argument If a uniform value has an unsupported type (see UniformValue::type).
+        \see GetUniformLocation
+        */
+        virtual void SetUniforms(std::size_t numUniformValues, const UniformValue* uniformValues) = 0;
+
         /**
         \brief Sets an integral scalar uniform.
         \remarks This can be used to set the binding slot for samplers, like in the following GLSL example:
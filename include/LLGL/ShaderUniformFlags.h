@@ -94,6 +94,29 @@ struct UniformDescriptor
     std::uint32_t   size        = 0;
 };
 
+/**
+\brief Shader uniform value structure for batched uniform updates.
+\see ShaderUniform::SetUniforms
+*/
+struct UniformValue
+{
+    //! Location of the uniform within a shader program. Uniforms with location -1 are ignored. By default -1.
+    UniformLocation location    = -1;
+
+    /**
+    \brief Data type of the uniform. By default UniformType::Undefined.
+    \remarks Only scalars, vectors, and square matrices of type float, int, and bool, as well as samplers are supported.
+    Boolean uniforms are specified as 32-bit integers.
+    */
+    UniformType     type        = UniformType::Undefined;
+
+    //! Number of array elements to set. By default 1.
+    std::uint32_t   count       = 1;
+
+    //! Pointer to the uniform data. This must point to at least 'count' elements of the specified type.
+    const void*     data        = nullptr;
+};
+
 
 } // /namespace LLGL
 
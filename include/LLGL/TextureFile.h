@@ -0,0 +1,165 @@
+/*
+ * TextureFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_FILE_H
+#define LLGL_TEXTURE_FILE_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ImageFlags.h"
+#include "TextureFlags.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class MappedFile;
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Texture container file format enumeration.
+\see TextureFile::GetFileFormat
+*/
+enum class TextureFileFormat
+{
+    DDS,    //!< DirectDraw Surface (DDS), including the DX10 header extension.
+    KTX,    //!< Khronos Texture (KTX) version 1.1.
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Read-only texture container file (DDS or KTX) that is memory mapped for its entire lifetime.
+
+This class parses the container header into a texture descriptor and provides image descriptors for each MIP-map level and array layer.
+The image descriptors point directly into the mapped file, i.e. no image data is copied or converted when the file is loaded.
+The only exception are uncompressed KTX images whose rows are padded to 4 bytes (e.g. Format::RGB8UNorm with an odd width),
+which are repacked into tightly packed rows, since image descriptors have no row stride.
+Block compressed images (i.e. Format::BC1RGB, Format::BC1RGBA, Format::BC2RGBA, and Format::BC3RGBA) are passed through as they are,
+so they can be uploaded to the GPU without any decompression.
+\remarks The image descriptors returned by this class are only valid for the lifetime of this object.
+Example usage:
+\code
+LLGL::TextureFile textureFile("Texture.dds");
+auto texture = renderer->CreateTexture(textureFile.GetDesc(), &textureFile.GetImageDesc(0));
+for (std::uint32_t mipLevel = 1; mipLevel < textureFile.GetNumMipLevels(); ++mipLevel)
+{
+    LLGL::SubTextureDescriptor subTextureDesc;
+    subTextureDesc.mipLevel = mipLevel;
+    subTextureDesc.extent   = textureFile.GetMipExtent(mipLevel);
+    renderer->WriteTexture(*texture, subTextureDesc, textureFile.GetImageDesc(mipLevel));
+}
+\endcode
+\note The example above is only valid for non-array textures. For array textures, see GetContiguousImageDesc.
+*/
+class LLGL_EXPORT TextureFile : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Maps the specified texture file into memory and parses its header.
+        \param[in] filename Specifies the filename of the DDS or KTX file. The container format is determined by the file content, not by the file extension.
+        \throw std::runtime_error If the file could not be mapped, if the container format is not recognized,
+        if the header is malformed, if the pixel format is not supported, if the image sizes overflow, or if any image exceeds the file size.
+        */
+        TextureFile(const std::string& filename);
+
+        ~TextureFile();
+
+        //! Returns the container format of this texture file.
+        inline TextureFileFormat GetFileFormat() const
+        {
+            return fileFormat_;
+        }
+
+        /**
+        \brief Returns the texture descriptor parsed from the file header.
+        \remarks The number of MIP-map levels is 0, if the file requests the MIP-maps to be generated (only KTX).
+        For cube textures, the number of array layers includes all cube faces.
+        */
+        inline const TextureDescriptor& GetDesc() const
+        {
+            return textureDesc_;
+        }
+
+        //! Returns the number of MIP-map levels that are stored in the file. This is always greater than zero.
+        inline std::uint32_t GetNumMipLevels() const
+        {
+            return numMipLevels_;
+        }
+
+        //! Returns the number of array layers that are stored in the file, including all cube faces. This is always greater than zero.
+        inline std::uint32_t GetNumArrayLayers() const
+        {
+            return textureDesc_.arrayLayers;
+        }
+
+        //! Returns true if the images of this file are block compressed.
+        bool IsCompressed() const;
+
+        //! Returns the extent of the specified MIP-map level. The depth component is only greater than 1 for 3D textures.
+        Extent3D GetMipExtent(std::uint32_t mipLevel) const;
+
+        /**
+        \brief Returns the image descriptor of the specified MIP-map level and array layer.
+        \remarks For 3D textures, the image descriptor covers all depth slices of the respective MIP-map level.
+        \throw std::out_of_range If 'mipLevel' or 'arrayLayer' is out of range.
+        */
+        const SrcImageDescriptor& GetImageDesc(std::uint32_t mipLevel, std::uint32_t arrayLayer = 0) const;
+
+        /**
+        \brief Queries an image descriptor that covers all array layers of the specified MIP-map level.
+        \param[in] mipLevel Specifies the MIP-map level.
+        \param[out] imageDesc Specifies the output image descriptor.
+        \return True if all array layers of the specified MIP-map level are stored contiguously.
+        Otherwise, the array layers must be written individually (e.g. DDS files store all MIP-maps of one layer contiguously).
+        \throw std::out_of_range If 'mipLevel' is out of range.
+        */
+        bool GetContiguousImageDesc(std::uint32_t mipLevel, SrcImageDescriptor& imageDesc) const;
+
+    private:
+
+        void ParseDDS();
+        void ParseKTX();
+
+        void InitImages(Format format, std::uint32_t numMipLevels);
+        void SetImage(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::size_t offset, std::size_t dataSize);
+
+        // Copies the padded rows of all array layers of the specified MIP-map level into tightly packed images (only KTX).
+        void SetRepackedImages(std::uint32_t mipLevel, std::size_t offset, std::size_t rowSize, std::size_t rowPitch, std::size_t numRows);
+
+        std::size_t GetImageDataSize(std::uint32_t mipLevel) const;
+
+    private:
+
+        std::unique_ptr<MappedFile>     file_;
+        TextureFileFormat               fileFormat_     = TextureFileFormat::DDS;
+        TextureDescriptor               textureDesc_;
+        std::uint32_t                   numMipLevels_   = 1;
+        std::vector<SrcImageDescriptor> images_;
+
+        std::vector<std::unique_ptr<char[]>> repackedImages_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
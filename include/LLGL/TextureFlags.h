@@ -236,6 +236,24 @@ struct SubTextureDescriptor
     Extent3D        extent      = { 1, 1, 1 };
 };
 
+/**
+\brief Handle of an asynchronous texture read operation.
+\remarks This is an opaque handle that is returned by RenderSystem::ReadTextureAsync and consumed by RenderSystem::ResolveTextureRead.
+\see RenderSystem::ReadTextureAsync
+\see RenderSystem::ResolveTextureRead
+*/
+struct TextureReadHandle
+{
+    //! Returns true if this handle refers to a pending texture read operation.
+    inline bool IsValid() const
+    {
+        return (id != 0);
+    }
+
+    //! Internal identifier of the read operation. A value of zero denotes an invalid handle. By default 0.
+    std::uint64_t id = 0;
+};
+
 
 /* ----- Functions ----- */
 
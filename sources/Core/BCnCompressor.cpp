@@ -0,0 +1,658 @@
+/*
+ * BCnCompressor.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "BCnCompressor.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+static const int g_numBlockTexels = 16;
+
+static int ClampInt(int x, int lo, int hi)
+{
+    return std::max(lo, std::min(x, hi));
+}
+
+static std::uint16_t ReadUInt16LE(const std::uint8_t* src)
+{
+    return static_cast<std::uint16_t>(src[0] | (src[1] << 8));
+}
+
+static void WriteUInt16LE(std::uint8_t* dst, std::uint16_t value)
+{
+    dst[0] = static_cast<std::uint8_t>(value & 0xFF);
+    dst[1] = static_cast<std::uint8_t>(value >> 8);
+}
+
+static std::uint32_t ReadUInt32LE(const std::uint8_t* src)
+{
+    return
+    (
+        static_cast<std::uint32_t>(src[0])         |
+        (static_cast<std::uint32_t>(src[1]) << 8)  |
+        (static_cast<std::uint32_t>(src[2]) << 16) |
+        (static_cast<std::uint32_t>(src[3]) << 24)
+    );
+}
+
+static void WriteUInt32LE(std::uint8_t* dst, std::uint32_t value)
+{
+    WriteUInt16LE(dst, static_cast<std::uint16_t>(value & 0xFFFF));
+    WriteUInt16LE(dst + 2, static_cast<std::uint16_t>(value >> 16));
+}
+
+// Quantizes the specified RGB color (in range [0, 255]) to R5G6B5.
+static std::uint16_t PackRGB565(const float (&color)[3])
+{
+    auto r = ClampInt(static_cast<int>(color[0] * (31.0f / 255.0f) + 0.5f), 0, 31);
+    auto g = ClampInt(static_cast<int>(color[1] * (63.0f / 255.0f) + 0.5f), 0, 63);
+    auto b = ClampInt(static_cast<int>(color[2] * (31.0f / 255.0f) + 0.5f), 0, 31);
+    return static_cast<std::uint16_t>((r << 11) | (g << 5) | b);
+}
+
+// Expands the specified R5G6B5 color to 8-bit components by bit replication.
+static void UnpackRGB565(std::uint16_t color, int (&rgb)[3])
+{
+    auto r = (color >> 11) & 0x1F;
+    auto g = (color >>  5) & 0x3F;
+    auto b = (color      ) & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Generates the color palette of a BC1 block. Returns true if the block is in 3-color mode (with transparent black as 4th color).
+static bool GenerateColorPalette(std::uint16_t c0, std::uint16_t c1, int (&palette)[4][3], bool forceFourColors)
+{
+    UnpackRGB565(c0, palette[0]);
+    UnpackRGB565(c1, palette[1]);
+
+    if (c0 > c1 || forceFourColors)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        return false;
+    }
+    else
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+        return true;
+    }
+}
+
+static int ColorDistanceSq(const std::uint8_t* texel, const int (&color)[3])
+{
+    const int dr = static_cast<int>(texel[0]) - color[0];
+    const int dg = static_cast<int>(texel[1]) - color[1];
+    const int db = static_cast<int>(texel[2]) - color[2];
+    return (dr*dr + dg*dg + db*db);
+}
+
+// Selects the nearest palette index for each texel and returns the total squared error.
+static int SelectColorIndices(
+    const std::uint8_t* srcRGBA,
+    const bool          (&transparent)[g_numBlockTexels],
+    std::uint16_t       c0,
+    std::uint16_t       c1,
+    bool                threeColorMode,
+    std::uint8_t        (&indices)[g_numBlockTexels])
+{
+    int palette[4][3];
+    GenerateColorPalette(c0, c1, palette, !threeColorMode);
+
+    const int numColors = (threeColorMode ? 3 : 4);
+    int error = 0;
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        if (transparent[i])
+        {
+            indices[i] = 3;
+            continue;
+        }
+
+        const auto texel = srcRGBA + i * 4;
+        int bestIndex = 0, bestDist = ColorDistanceSq(texel, palette[0]);
+
+        for (int j = 1; j < numColors; ++j)
+        {
+            const int dist = ColorDistanceSq(texel, palette[j]);
+            if (dist < bestDist)
+            {
+                bestDist    = dist;
+                bestIndex   = j;
+            }
+        }
+
+        indices[i]  = static_cast<std::uint8_t>(bestIndex);
+        error       += bestDist;
+    }
+
+    return error;
+}
+
+// Puts the endpoints into the order that selects the specified mode (the indices must be selected afterwards).
+static void OrderColorEndpoints(std::uint16_t& c0, std::uint16_t& c1, bool threeColorMode)
+{
+    if (threeColorMode ? (c0 > c1) : (c0 < c1))
+        std::swap(c0, c1);
+}
+
+// Determines the endpoints from the bounding box of the opaque texels, oriented along the dominant diagonal.
+static void FindEndpointsBoundingBox(
+    const std::uint8_t* srcRGBA,
+    const bool          (&transparent)[g_numBlockTexels],
+    float               (&minColor)[3],
+    float               (&maxColor)[3])
+{
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    int count = 0;
+
+    for (int c = 0; c < 3; ++c)
+    {
+        minColor[c] = 255.0f;
+        maxColor[c] = 0.0f;
+    }
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        if (transparent[i])
+            continue;
+        for (int c = 0; c < 3; ++c)
+        {
+            const auto value = static_cast<float>(srcRGBA[i * 4 + c]);
+            minColor[c] = std::min(minColor[c], value);
+            maxColor[c] = std::max(maxColor[c], value);
+            mean[c] += value;
+        }
+        ++count;
+    }
+
+    for (int c = 0; c < 3; ++c)
+        mean[c] /= static_cast<float>(count);
+
+    /* Flip red and blue extents if they are negatively correlated with green */
+    float covRG = 0.0f, covBG = 0.0f;
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        if (transparent[i])
+            continue;
+        const auto texel = srcRGBA + i * 4;
+        const float dg = static_cast<float>(texel[1]) - mean[1];
+        covRG += (static_cast<float>(texel[0]) - mean[0]) * dg;
+        covBG += (static_cast<float>(texel[2]) - mean[2]) * dg;
+    }
+
+    if (covRG < 0.0f)
+        std::swap(minColor[0], maxColor[0]);
+    if (covBG < 0.0f)
+        std::swap(minColor[2], maxColor[2]);
+
+    /* Inset bounding box by 1/16 of its size to reduce the quantization error of the endpoints */
+    for (int c = 0; c < 3; ++c)
+    {
+        const float inset = (maxColor[c] - minColor[c]) / 16.0f;
+        minColor[c] += inset;
+        maxColor[c] -= inset;
+    }
+}
+
+// Determines the endpoints by projecting the opaque texels onto the principal axis of their color distribution.
+static void FindEndpointsPrincipalAxis(
+    const std::uint8_t* srcRGBA,
+    const bool          (&transparent)[g_numBlockTexels],
+    float               (&minColor)[3],
+    float               (&maxColor)[3])
+{
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    int count = 0;
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        if (transparent[i])
+            continue;
+        for (int c = 0; c < 3; ++c)
+            mean[c] += static_cast<float>(srcRGBA[i * 4 + c]);
+        ++count;
+    }
+
+    for (int c = 0; c < 3; ++c)
+        mean[c] /= static_cast<float>(count);
+
+    /* Compute covariance matrix */
+    float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        if (transparent[i])
+            continue;
+
+        const auto texel = srcRGBA + i * 4;
+        const float r = static_cast<float>(texel[0]) - mean[0];
+        const float g = static_cast<float>(texel[1]) - mean[1];
+        const float b = static_cast<float>(texel[2]) - mean[2];
+
+        cov[0] += r*r;
+        cov[1] += r*g;
+        cov[2] += r*b;
+        cov[3] += g*g;
+        cov[4] += g*b;
+        cov[5] += b*b;
+    }
+
+    /* Find principal axis by power iteration */
+    float axis[3] = { 1.0f, 1.0f, 1.0f };
+
+    for (int iteration = 0; iteration < 8; ++iteration)
+    {
+        const float x = axis[0]*cov[0] + axis[1]*cov[1] + axis[2]*cov[2];
+        const float y = axis[0]*cov[1] + axis[1]*cov[3] + axis[2]*cov[4];
+        const float z = axis[0]*cov[2] + axis[1]*cov[4] + axis[2]*cov[5];
+
+        const float len = std::max(std::abs(x), std::max(std::abs(y), std::abs(z)));
+        if (len < 1.0e-6f)
+            break;
+
+        axis[0] = x / len;
+        axis[1] = y / len;
+        axis[2] = z / len;
+    }
+
+    /* Project texels onto principal axis and take the extremes as endpoints */
+    float minDot = 0.0f, maxDot = 0.0f;
+    int minIndex = -1, maxIndex = -1;
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        if (transparent[i])
+            continue;
+
+        const auto texel = srcRGBA + i * 4;
+        const float dot =
+        (
+            (static_cast<float>(texel[0]) - mean[0]) * axis[0] +
+            (static_cast<float>(texel[1]) - mean[1]) * axis[1] +
+            (static_cast<float>(texel[2]) - mean[2]) * axis[2]
+        );
+
+        if (minIndex < 0 || dot < minDot)
+        {
+            minDot      = dot;
+            minIndex    = i;
+        }
+        if (maxIndex < 0 || dot > maxDot)
+        {
+            maxDot      = dot;
+            maxIndex    = i;
+        }
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        minColor[c] = static_cast<float>(srcRGBA[minIndex * 4 + c]);
+        maxColor[c] = static_cast<float>(srcRGBA[maxIndex * 4 + c]);
+    }
+}
+
+/*
+Refines the endpoints for the specified indices by solving the least squares problem
+that minimizes the distance between each texel and its interpolated palette color.
+Returns false if the system is singular, i.e. all texels use the same weights.
+*/
+static bool RefineEndpointsLeastSquares(
+    const std::uint8_t* srcRGBA,
+    const bool          (&transparent)[g_numBlockTexels],
+    const std::uint8_t  (&indices)[g_numBlockTexels],
+    bool                threeColorMode,
+    float               (&color0)[3],
+    float               (&color1)[3])
+{
+    static const float weights4[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+    static const float weights3[4] = { 1.0f, 0.0f, 0.5f, 0.0f };
+
+    const auto weights = (threeColorMode ? weights3 : weights4);
+
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ax[3] = { 0.0f, 0.0f, 0.0f };
+    float bx[3] = { 0.0f, 0.0f, 0.0f };
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        if (transparent[i])
+            continue;
+
+        const float a = weights[indices[i]];
+        const float b = 1.0f - a;
+
+        aa += a*a;
+        ab += a*b;
+        bb += b*b;
+
+        for (int c = 0; c < 3; ++c)
+        {
+            const auto x = static_cast<float>(srcRGBA[i * 4 + c]);
+            ax[c] += a*x;
+            bx[c] += b*x;
+        }
+    }
+
+    const float det = aa*bb - ab*ab;
+    if (std::abs(det) < 1.0e-6f)
+        return false;
+
+    const float invDet = 1.0f / det;
+
+    for (int c = 0; c < 3; ++c)
+    {
+        color0[c] = std::max(0.0f, std::min((ax[c]*bb - bx[c]*ab) * invDet, 255.0f));
+        color1[c] = std::max(0.0f, std::min((bx[c]*aa - ax[c]*ab) * invDet, 255.0f));
+    }
+
+    return true;
+}
+
+static void WriteColorBlock(std::uint8_t* dst, std::uint16_t c0, std::uint16_t c1, const std::uint8_t (&indices)[g_numBlockTexels])
+{
+    std::uint32_t bits = 0;
+    for (int i = 0; i < g_numBlockTexels; ++i)
+        bits |= (static_cast<std::uint32_t>(indices[i]) << (i * 2));
+
+    WriteUInt16LE(dst, c0);
+    WriteUInt16LE(dst + 2, c1);
+    WriteUInt32LE(dst + 4, bits);
+}
+
+// Compresses the color part of a block (8 bytes). Transparent texels are only allowed for BC1 blocks.
+static void CompressColorBlock(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool alphaMask, bool highQuality)
+{
+    /* Determine transparent texels (only in 3-color mode of BC1) */
+    bool transparent[g_numBlockTexels];
+    bool threeColorMode = false;
+    int  numOpaque      = 0;
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        transparent[i] = (alphaMask && srcRGBA[i * 4 + 3] < 128);
+        if (transparent[i])
+            threeColorMode = true;
+        else
+            ++numOpaque;
+    }
+
+    /* Encode fully transparent block with all indices referring to transparent black */
+    if (numOpaque == 0)
+    {
+        std::uint8_t indices[g_numBlockTexels];
+        std::fill(std::begin(indices), std::end(indices), std::uint8_t(3));
+        WriteColorBlock(dst, 0, 0, indices);
+        return;
+    }
+
+    /* Find initial endpoints */
+    float color0[3], color1[3];
+
+    if (highQuality)
+        FindEndpointsPrincipalAxis(srcRGBA, transparent, color0, color1);
+    else
+        FindEndpointsBoundingBox(srcRGBA, transparent, color0, color1);
+
+    auto c0 = PackRGB565(color0);
+    auto c1 = PackRGB565(color1);
+    OrderColorEndpoints(c0, c1, threeColorMode);
+
+    std::uint8_t indices[g_numBlockTexels];
+    int error = SelectColorIndices(srcRGBA, transparent, c0, c1, threeColorMode, indices);
+
+    /* Refine endpoints by least squares fitting as long as the error decreases */
+    if (highQuality)
+    {
+        for (int iteration = 0; iteration < 2 && error > 0; ++iteration)
+        {
+            if (!RefineEndpointsLeastSquares(srcRGBA, transparent, indices, threeColorMode, color0, color1))
+                break;
+
+            auto refinedC0 = PackRGB565(color0);
+            auto refinedC1 = PackRGB565(color1);
+            OrderColorEndpoints(refinedC0, refinedC1, threeColorMode);
+
+            std::uint8_t refinedIndices[g_numBlockTexels];
+            const int refinedError = SelectColorIndices(srcRGBA, transparent, refinedC0, refinedC1, threeColorMode, refinedIndices);
+
+            if (refinedError >= error)
+                break;
+
+            c0      = refinedC0;
+            c1      = refinedC1;
+            error   = refinedError;
+            std::copy(std::begin(refinedIndices), std::end(refinedIndices), std::begin(indices));
+        }
+    }
+
+    /* Equal endpoints in 4-color mode would be decoded in 3-color mode, so only the first color must be used */
+    if (c0 == c1 && !threeColorMode)
+        std::fill(std::begin(indices), std::end(indices), std::uint8_t(0));
+
+    WriteColorBlock(dst, c0, c1, indices);
+}
+
+static void DecompressColorBlock(const std::uint8_t* src, std::uint8_t* dstRGBA, bool alphaMask, bool forceFourColors)
+{
+    const auto c0   = ReadUInt16LE(src);
+    const auto c1   = ReadUInt16LE(src + 2);
+    const auto bits = ReadUInt32LE(src + 4);
+
+    int palette[4][3];
+    const bool threeColorMode = GenerateColorPalette(c0, c1, palette, forceFourColors);
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        const auto index = (bits >> (i * 2)) & 0x3;
+        auto texel = dstRGBA + i * 4;
+
+        texel[0] = static_cast<std::uint8_t>(palette[index][0]);
+        texel[1] = static_cast<std::uint8_t>(palette[index][1]);
+        texel[2] = static_cast<std::uint8_t>(palette[index][2]);
+        texel[3] = static_cast<std::uint8_t>(threeColorMode && index == 3 && alphaMask ? 0 : 255);
+    }
+}
+
+// Generates the alpha palette of a BC3 block.
+static void GenerateAlphaPalette(int a0, int a1, int (&palette)[8])
+{
+    palette[0] = a0;
+    palette[1] = a1;
+
+    if (a0 > a1)
+    {
+        for (int i = 1; i <= 6; ++i)
+            palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+    }
+    else
+    {
+        for (int i = 1; i <= 4; ++i)
+            palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Selects the nearest alpha palette index for each texel and returns the total squared error.
+static int SelectAlphaIndices(const std::uint8_t* srcRGBA, int a0, int a1, std::uint8_t (&indices)[g_numBlockTexels])
+{
+    int palette[8];
+    GenerateAlphaPalette(a0, a1, palette);
+
+    int error = 0;
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        const int alpha = srcRGBA[i * 4 + 3];
+        int bestIndex = 0, bestDist = std::abs(alpha - palette[0]);
+
+        for (int j = 1; j < 8; ++j)
+        {
+            const int dist = std::abs(alpha - palette[j]);
+            if (dist < bestDist)
+            {
+                bestDist    = dist;
+                bestIndex   = j;
+            }
+        }
+
+        indices[i]  = static_cast<std::uint8_t>(bestIndex);
+        error       += bestDist * bestDist;
+    }
+
+    return error;
+}
+
+static void CompressAlphaBlockBC3(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool highQuality)
+{
+    /* Find alpha range, and the range without the values 0 and 255 (for the 6-value mode) */
+    int minAlpha = 255, maxAlpha = 0;
+    int minInnerAlpha = 255, maxInnerAlpha = 0;
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        const int alpha = srcRGBA[i * 4 + 3];
+        minAlpha = std::min(minAlpha, alpha);
+        maxAlpha = std::max(maxAlpha, alpha);
+        if (alpha > 0 && alpha < 255)
+        {
+            minInnerAlpha = std::min(minInnerAlpha, alpha);
+            maxInnerAlpha = std::max(maxInnerAlpha, alpha);
+        }
+    }
+
+    /* Use 8-value mode (a0 > a1) with the full range */
+    int a0 = maxAlpha, a1 = minAlpha;
+
+    std::uint8_t indices[g_numBlockTexels];
+    int error = SelectAlphaIndices(srcRGBA, a0, a1, indices);
+
+    /* Try 6-value mode (a0 <= a1) with explicit 0 and 255 */
+    if (highQuality && error > 0)
+    {
+        if (minInnerAlpha > maxInnerAlpha)
+        {
+            minInnerAlpha = 0;
+            maxInnerAlpha = 255;
+        }
+
+        std::uint8_t innerIndices[g_numBlockTexels];
+        const int innerError = SelectAlphaIndices(srcRGBA, minInnerAlpha, maxInnerAlpha, innerIndices);
+
+        if (innerError < error)
+        {
+            a0 = minInnerAlpha;
+            a1 = maxInnerAlpha;
+            std::copy(std::begin(innerIndices), std::end(innerIndices), std::begin(indices));
+        }
+    }
+
+    /* Write endpoints and 16 indices with 3 bits each */
+    dst[0] = static_cast<std::uint8_t>(a0);
+    dst[1] = static_cast<std::uint8_t>(a1);
+
+    std::uint64_t bits = 0;
+    for (int i = 0; i < g_numBlockTexels; ++i)
+        bits |= (static_cast<std::uint64_t>(indices[i]) << (i * 3));
+
+    for (int i = 0; i < 6; ++i)
+        dst[2 + i] = static_cast<std::uint8_t>((bits >> (i * 8)) & 0xFF);
+}
+
+static void DecompressAlphaBlockBC3(const std::uint8_t* src, std::uint8_t* dstRGBA)
+{
+    int palette[8];
+    GenerateAlphaPalette(src[0], src[1], palette);
+
+    std::uint64_t bits = 0;
+    for (int i = 0; i < 6; ++i)
+        bits |= (static_cast<std::uint64_t>(src[2 + i]) << (i * 8));
+
+    for (int i = 0; i < g_numBlockTexels; ++i)
+        dstRGBA[i * 4 + 3] = static_cast<std::uint8_t>(palette[(bits >> (i * 3)) & 0x7]);
+}
+
+static void CompressAlphaBlockBC2(const std::uint8_t* srcRGBA, std::uint8_t* dst)
+{
+    for (int i = 0; i < g_numBlockTexels; i += 2)
+    {
+        const int alpha0 = (srcRGBA[i * 4 + 3] * 15 + 127) / 255;
+        const int alpha1 = (srcRGBA[i * 4 + 7] * 15 + 127) / 255;
+        dst[i / 2] = static_cast<std::uint8_t>(alpha0 | (alpha1 << 4));
+    }
+}
+
+static void DecompressAlphaBlockBC2(const std::uint8_t* src, std::uint8_t* dstRGBA)
+{
+    for (int i = 0; i < g_numBlockTexels; ++i)
+    {
+        const int alpha = (src[i / 2] >> ((i % 2) * 4)) & 0xF;
+        dstRGBA[i * 4 + 3] = static_cast<std::uint8_t>(alpha * 17);
+    }
+}
+
+
+/* ----- Functions ----- */
+
+void CompressBlockBC1(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool alphaMask, bool highQuality)
+{
+    CompressColorBlock(srcRGBA, dst, alphaMask, highQuality);
+}
+
+void CompressBlockBC2(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool highQuality)
+{
+    CompressAlphaBlockBC2(srcRGBA, dst);
+    CompressColorBlock(srcRGBA, dst + 8, false, highQuality);
+}
+
+void CompressBlockBC3(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool highQuality)
+{
+    CompressAlphaBlockBC3(srcRGBA, dst, highQuality);
+    CompressColorBlock(srcRGBA, dst + 8, false, highQuality);
+}
+
+void DecompressBlockBC1(const std::uint8_t* src, std::uint8_t* dstRGBA, bool alphaMask)
+{
+    DecompressColorBlock(src, dstRGBA, alphaMask, false);
+}
+
+void DecompressBlockBC2(const std::uint8_t* src, std::uint8_t* dstRGBA)
+{
+    DecompressColorBlock(src + 8, dstRGBA, false, true);
+    DecompressAlphaBlockBC2(src, dstRGBA);
+}
+
+void DecompressBlockBC3(const std::uint8_t* src, std::uint8_t* dstRGBA)
+{
+    DecompressColorBlock(src + 8, dstRGBA, false, true);
+    DecompressAlphaBlockBC3(src, dstRGBA);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,51 @@
+/*
+ * BCnCompressor.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BCN_COMPRESSOR_H
+#define LLGL_BCN_COMPRESSOR_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+All block functions operate on a single block of 4x4 texels.
+Uncompressed blocks are 16 RGBA texels with 8-bit unsigned components in row-major order (64 bytes).
+Compressed blocks are 8 bytes for BC1 and 16 bytes for BC2 and BC3.
+*/
+
+// Compresses the specified RGBA block into a BC1 block. If 'alphaMask' is true, texels with alpha less than 128 are encoded as transparent.
+void CompressBlockBC1(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool alphaMask, bool highQuality);
+
+// Compresses the specified RGBA block into a BC2 block (explicit 4-bit alpha).
+void CompressBlockBC2(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool highQuality);
+
+// Compresses the specified RGBA block into a BC3 block (interpolated alpha).
+void CompressBlockBC3(const std::uint8_t* srcRGBA, std::uint8_t* dst, bool highQuality);
+
+// Decompresses the specified BC1 block into an RGBA block. If 'alphaMask' is false, transparent texels are decoded as opaque black.
+void DecompressBlockBC1(const std::uint8_t* src, std::uint8_t* dstRGBA, bool alphaMask);
+
+// Decompresses the specified BC2 block into an RGBA block.
+void DecompressBlockBC2(const std::uint8_t* src, std::uint8_t* dstRGBA);
+
+// Decompresses the specified BC3 block into an RGBA block.
+void DecompressBlockBC3(const std::uint8_t* src, std::uint8_t* dstRGBA);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -197,6 +197,14 @@ T GetAlignedSize(T size, T alignment)
     return size;
 }
 
+// Combines the hash value of 'value' into the specified 'seed' (same as 'boost::hash_combine').
+template <typename T>
+void HashCombine(std::size_t& seed, const T& value)
+{
+    std::hash<T> hasher;
+    seed ^= hasher(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
 
 /* ----- Functions ----- */
 
@@ -211,6 +211,11 @@ void Image::Resize(const Extent3D& extent, const SamplerFilter filter)
     //todo
 }
 
+ByteBuffer Image::GenerateMips(const MipChainDescriptor& mipChainDesc) const
+{
+    return GenerateMipChain(QuerySrcDesc(), GetExtent(), mipChainDesc);
+}
+
 void Image::Swap(Image& rhs)
 {
     std::swap(extent_,   rhs.extent_  );
@@ -301,15 +306,15 @@ static bool Overlap3DRegion(const Offset3D& dstOffset, const Offset3D& srcOffset
 
 void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRegionOffset, Extent3D srcRegionExtent)
 {
-    if (GetFormat() == srcImage.GetFormat() && GetDataType() == srcImage.GetDataType())
-    {
-        /* First clamp source region to source image dimension */
-        srcImage.ClampRegion(srcRegionOffset, srcRegionExtent);
+    /* First clamp source region to source image dimension */
+    srcImage.ClampRegion(srcRegionOffset, srcRegionExtent);
 
-        /* Then shift negative destination region */
-        if ( ShiftNegative1DRegion(dstRegionOffset.x, GetExtent().width,  srcRegionOffset.x, srcRegionExtent.width ) &&
-             ShiftNegative1DRegion(dstRegionOffset.y, GetExtent().height, srcRegionOffset.y, srcRegionExtent.height) &&
-             ShiftNegative1DRegion(dstRegionOffset.z, GetExtent().depth,  srcRegionOffset.z, srcRegionExtent.depth ) )
+    /* Then shift negative destination region */
+    if ( ShiftNegative1DRegion(dstRegionOffset.x, GetExtent().width,  srcRegionOffset.x, srcRegionExtent.width ) &&
+         ShiftNegative1DRegion(dstRegionOffset.y, GetExtent().height, srcRegionOffset.y, srcRegionExtent.height) &&
+         ShiftNegative1DRegion(dstRegionOffset.z, GetExtent().depth,  srcRegionOffset.z, srcRegionExtent.depth ) )
+    {
+        if (GetFormat() == srcImage.GetFormat() && GetDataType() == srcImage.GetDataType())
         {
             /* Check if a temporary copy of the source image must be allocated */
             Image srcImageTemp;
@@ -340,6 +345,28 @@ void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRe
                 src, srcRowStride, srcDepthStride
             );
         }
+        else
+        {
+            /* Get destination image parameters (source and destination can not be the same image if their formats differ) */
+            const auto  dstRowStride    = GetRowStride();
+            const auto  dstDepthStride  = GetDepthStride();
+            auto        dst             = data_.get() + GetDataPtrOffset(dstRegionOffset);
+
+            /* Get source image parameters */
+            const auto  srcRowStride    = srcImage.GetRowStride();
+            const auto  srcDepthStride  = srcImage.GetDepthStride();
+            auto        src             = srcImage.data_.get() + srcImage.GetDataPtrOffset(srcRegionOffset);
+
+            /* Convert source region directly into destination region */
+            const SrcImageDescriptor srcImageDesc { srcImage.GetFormat(), srcImage.GetDataType(), src, srcImage.GetDataSize() - srcImage.GetDataPtrOffset(srcRegionOffset) };
+            const DstImageDescriptor dstImageDesc { GetFormat(), GetDataType(), dst, GetDataSize() - GetDataPtrOffset(dstRegionOffset) };
+
+            ConvertImageBufferRegion(
+                srcImageDesc, srcRowStride, srcDepthStride,
+                dstImageDesc, dstRowStride, dstDepthStride,
+                srcRegionExtent
+            );
+        }
     }
 }
 
@@ -408,20 +435,19 @@ void Image::ReadPixels(const Offset3D& offset, const Extent3D& extent, const Dst
         }
         else
         {
-            /* Copy region into temporary sub-image */
-            Image subImage { extent, GetFormat(), GetDataType() };
-
-            BitBlit(
-                extent, bpp,
-                reinterpret_cast<char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride(),
-                src, srcRowStride, srcDepthStride
-            );
+            /* Get destination image parameters */
+            const auto  dstBpp          = ImageFormatSize(imageDesc.format) * DataTypeSize(imageDesc.dataType);
+            const auto  dstRowStride    = dstBpp * extent.width;
+            const auto  dstDepthStride  = dstRowStride * extent.height;
 
-            /* Convert sub-image */
-            subImage.Convert(imageDesc.format, imageDesc.dataType, threadCount);
+            /* Convert region directly into destination image */
+            const SrcImageDescriptor srcImageDesc { GetFormat(), GetDataType(), src, GetDataSize() - GetDataPtrOffset(offset) };
 
-            /* Copy sub-image into output data */
-            ::memcpy(imageDesc.data, subImage.GetData(), imageDesc.dataSize);
+            ConvertImageBufferRegion(
+                srcImageDesc, srcRowStride, srcDepthStride,
+                imageDesc, dstRowStride, dstDepthStride,
+                extent, threadCount
+            );
         }
     }
 }
@@ -455,18 +481,18 @@ void Image::WritePixels(const Offset3D& offset, const Extent3D& extent, const Sr
         }
         else
         {
-            /* Copy input data into sub-image into */
-            Image subImage { extent, imageDesc.format, imageDesc.dataType };
-            ::memcpy(subImage.GetData(), imageDesc.data, imageDesc.dataSize);
+            /* Get source image parameters */
+            const auto  srcBpp          = ImageFormatSize(imageDesc.format) * DataTypeSize(imageDesc.dataType);
+            const auto  srcRowStride    = srcBpp * extent.width;
+            const auto  srcDepthStride  = srcRowStride * extent.height;
 
-            /* Convert sub-image */
-            subImage.Convert(GetFormat(), GetDataType(), threadCount);
+            /* Convert source image directly into region */
+            const DstImageDescriptor dstImageDesc { GetFormat(), GetDataType(), dst, GetDataSize() - GetDataPtrOffset(offset) };
 
-            /* Copy temporary sub-image into region */
-            BitBlit(
-                extent, bpp,
-                dst, dstRowStride, dstDepthStride,
-                reinterpret_cast<const char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride()
+            ConvertImageBufferRegion(
+                imageDesc, srcRowStride, srcDepthStride,
+                dstImageDesc, dstRowStride, dstDepthStride,
+                extent, threadCount
             );
         }
     }
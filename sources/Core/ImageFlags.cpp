@@ -12,8 +12,12 @@
 #include <cstdint>
 #include <thread>
 #include <cstring>
+#include <cmath>
+#include <vector>
+#include <iterator>
 #include "../Core/Assertion.h"
 #include "Float16Compressor.h"
+#include "BCnCompressor.h"
 
 
 namespace LLGL
@@ -511,6 +515,519 @@ static void ConvertImageBufferFormat(
     }
 }
 
+/* ----- Row-strided conversion ----- */
+
+// Minimal number of rows each worker thread shall process
+static const std::size_t g_threadMinRowCount = 16;
+
+// Executes the specified function for each row in the range [0, numRows) distributed over the specified number of threads.
+template <typename TFunc>
+void ForEachRowConcurrent(std::size_t numRows, std::size_t threadCount, const TFunc& func)
+{
+    threadCount = std::min(threadCount, numRows / g_threadMinRowCount);
+
+    const auto rowWorker = [&func](std::size_t rowBegin, std::size_t rowEnd)
+    {
+        for (auto row = rowBegin; row < rowEnd; ++row)
+            func(row);
+    };
+
+    if (threadCount > 1)
+    {
+        /* Create worker threads */
+        std::vector<std::thread> workers(threadCount);
+
+        auto workSize       = numRows / threadCount;
+        auto workSizeRemain = numRows % threadCount;
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers[i] = std::thread(rowWorker, offset, offset + workSize);
+            offset += workSize;
+        }
+
+        /* Execute remaining rows on main thread */
+        if (workSizeRemain > 0)
+            rowWorker(offset, offset + workSizeRemain);
+
+        /* Join worker threads */
+        for (auto& w : workers)
+            w.join();
+    }
+    else
+    {
+        /* Execute all rows only on main thread */
+        rowWorker(0, numRows);
+    }
+}
+
+// Returns the number of components of the specified image format and the component index of each RGBA channel (or -1 if the channel is not present).
+static std::uint32_t GetImageFormatChannelComponents(ImageFormat format, int (&components)[4])
+{
+    /* Channel index (R=0, G=1, B=2, A=3) of each component in memory order */
+    static const int channelsR[]    = { 0 };
+    static const int channelsRG[]   = { 0, 1 };
+    static const int channelsRGB[]  = { 0, 1, 2 };
+    static const int channelsBGR[]  = { 2, 1, 0 };
+    static const int channelsRGBA[] = { 0, 1, 2, 3 };
+    static const int channelsBGRA[] = { 2, 1, 0, 3 };
+    static const int channelsARGB[] = { 3, 0, 1, 2 };
+    static const int channelsABGR[] = { 3, 2, 1, 0 };
+
+    const int* channels = nullptr;
+    switch (format)
+    {
+        case ImageFormat::R:    channels = channelsR;       break;
+        case ImageFormat::RG:   channels = channelsRG;      break;
+        case ImageFormat::RGB:  channels = channelsRGB;     break;
+        case ImageFormat::BGR:  channels = channelsBGR;     break;
+        case ImageFormat::RGBA: channels = channelsRGBA;    break;
+        case ImageFormat::BGRA: channels = channelsBGRA;    break;
+        case ImageFormat::ARGB: channels = channelsARGB;    break;
+        case ImageFormat::ABGR: channels = channelsABGR;    break;
+        default:                                            break;
+    }
+
+    const auto numComponents = ImageFormatSize(format);
+
+    std::fill(std::begin(components), std::end(components), -1);
+    if (channels != nullptr)
+    {
+        for (std::uint32_t i = 0; i < numComponents; ++i)
+            components[channels[i]] = static_cast<int>(i);
+    }
+
+    return numComponents;
+}
+
+// Parameters of a row-strided conversion, shared by all rows of a region.
+struct StridedConversion
+{
+    DataType        srcDataType;
+    std::uint32_t   srcNumComponents;
+    int             srcComponents[4];
+    DataType        dstDataType;
+    std::uint32_t   dstNumComponents;
+    int             dstComponents[4];
+    Variant         defaultValues[4];   // Values of missing channels in the destination data type, i.e. (0, 0, 0, 1)
+};
+
+static void InitStridedConversion(
+    StridedConversion&  conv,
+    ImageFormat         srcFormat,
+    DataType            srcDataType,
+    ImageFormat         dstFormat,
+    DataType            dstDataType)
+{
+    conv.srcDataType        = srcDataType;
+    conv.srcNumComponents   = GetImageFormatChannelComponents(srcFormat, conv.srcComponents);
+    conv.dstDataType        = dstDataType;
+    conv.dstNumComponents   = GetImageFormatChannelComponents(dstFormat, conv.dstComponents);
+
+    for (int channel = 0; channel < 4; ++channel)
+        SetVariantMinMax(dstDataType, conv.defaultValues[channel], (channel < 3));
+}
+
+// Converts a single row of pixels with the same data type by copying each component.
+static void ConvertImageRowComponents(const StridedConversion& conv, const char* src, char* dst, std::uint32_t numPixels)
+{
+    const auto typeSize = DataTypeSize(conv.dstDataType);
+    const auto srcPixelSize = typeSize * conv.srcNumComponents;
+
+    for (std::uint32_t i = 0; i < numPixels; ++i, src += srcPixelSize)
+    {
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            const auto dstComponent = conv.dstComponents[channel];
+            if (dstComponent >= 0)
+            {
+                const auto srcComponent = conv.srcComponents[channel];
+                if (srcComponent >= 0)
+                    ::memcpy(dst + dstComponent * typeSize, src + srcComponent * typeSize, typeSize);
+                else
+                    ::memcpy(dst + dstComponent * typeSize, &(conv.defaultValues[channel]), typeSize);
+            }
+        }
+        dst += typeSize * conv.dstNumComponents;
+    }
+}
+
+// Converts a single row of pixels with different data types by normalizing each component.
+static void ConvertImageRowNormalized(const StridedConversion& conv, const char* src, char* dst, std::uint32_t numPixels)
+{
+    const VariantConstBuffer srcBuffer { src };
+    VariantBuffer dstBuffer { dst };
+
+    for (std::uint32_t i = 0; i < numPixels; ++i)
+    {
+        const auto srcIdx = static_cast<std::size_t>(i) * conv.srcNumComponents;
+        const auto dstIdx = static_cast<std::size_t>(i) * conv.dstNumComponents;
+
+        for (int channel = 0; channel < 4; ++channel)
+        {
+            const auto dstComponent = conv.dstComponents[channel];
+            if (dstComponent >= 0)
+            {
+                const auto srcComponent = conv.srcComponents[channel];
+                const auto value        = (srcComponent >= 0 ? ReadNormalizedTypedVariant(conv.srcDataType, srcBuffer, srcIdx + srcComponent) : (channel < 3 ? 0.0 : 1.0));
+                WriteNormalizedTypedVariant(conv.dstDataType, dstBuffer, dstIdx + dstComponent, value);
+            }
+        }
+    }
+}
+
+// Returns the minimal buffer size (in bytes) to access the specified region with the specified strides.
+static std::size_t GetStridedRegionSize(const Extent3D& extent, std::size_t bpp, std::size_t rowStride, std::size_t depthStride)
+{
+    if (extent.width == 0 || extent.height == 0 || extent.depth == 0)
+        return 0;
+    return ((extent.depth - 1) * depthStride + (extent.height - 1) * rowStride + extent.width * bpp);
+}
+
+/* ----- MIP chain generation ----- */
+
+// Filter kernel to resample one dimension: the taps of destination index 'i' are in the range [offsets[i], offsets[i + 1]).
+struct MipFilterKernel
+{
+    std::vector<std::size_t>    offsets;
+    std::vector<std::uint32_t>  indices;
+    std::vector<float>          weights;
+};
+
+static const double g_pi                = 3.14159265358979323846;
+static const double g_kaiserRadius      = 3.0;
+static const double g_kaiserAlpha       = 4.0;
+
+static double Sinc(double x)
+{
+    if (std::abs(x) < 1.0e-6)
+        return 1.0;
+    x *= g_pi;
+    return std::sin(x) / x;
+}
+
+// Modified Bessel function of the first kind of order zero (power series).
+static double BesselI0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    const double halfX = x * 0.5;
+
+    for (int k = 1; k < 32; ++k)
+    {
+        term *= halfX / static_cast<double>(k);
+        const double termSq = term * term;
+        sum += termSq;
+        if (termSq < sum * 1.0e-12)
+            break;
+    }
+
+    return sum;
+}
+
+static double KaiserWindow(double t)
+{
+    if (t <= -1.0 || t >= 1.0)
+        return 0.0;
+    return BesselI0(g_kaiserAlpha * std::sqrt(1.0 - t * t)) / BesselI0(g_kaiserAlpha);
+}
+
+static void AppendFilterTap(MipFilterKernel& kernel, std::int64_t index, std::uint32_t srcSize, double weight)
+{
+    /* Clamp source index to edge */
+    index = std::max<std::int64_t>(0, std::min<std::int64_t>(index, static_cast<std::int64_t>(srcSize) - 1));
+    kernel.indices.push_back(static_cast<std::uint32_t>(index));
+    kernel.weights.push_back(static_cast<float>(weight));
+}
+
+static MipFilterKernel BuildMipFilterKernel(MipFilter filter, std::uint32_t srcSize, std::uint32_t dstSize)
+{
+    MipFilterKernel kernel;
+    kernel.offsets.reserve(dstSize + 1);
+    kernel.offsets.push_back(0);
+
+    const double scale = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+
+    for (std::uint32_t i = 0; i < dstSize; ++i)
+    {
+        const auto first = kernel.weights.size();
+
+        if (filter == MipFilter::Kaiser && srcSize > dstSize)
+        {
+            /* Sample windowed sinc function around the destination texel center (in source texel space) */
+            const double center = (static_cast<double>(i) + 0.5) * scale - 0.5;
+            const double radius = g_kaiserRadius * scale;
+
+            const auto begin    = static_cast<std::int64_t>(std::ceil(center - radius));
+            const auto end      = static_cast<std::int64_t>(std::floor(center + radius));
+
+            for (auto j = begin; j <= end; ++j)
+            {
+                const double x = (static_cast<double>(j) - center) / scale;
+                const double w = Sinc(x) * KaiserWindow(x / g_kaiserRadius);
+                if (w != 0.0)
+                    AppendFilterTap(kernel, j, srcSize, w);
+            }
+        }
+        else
+        {
+            /* Weight each source texel by its coverage of the destination texel */
+            const double lo = static_cast<double>(i) * scale;
+            const double hi = static_cast<double>(i + 1) * scale;
+
+            const auto begin    = static_cast<std::int64_t>(std::floor(lo));
+            const auto end      = static_cast<std::int64_t>(std::ceil(hi));
+
+            for (auto j = begin; j < end; ++j)
+            {
+                const double w = std::min(hi, static_cast<double>(j + 1)) - std::max(lo, static_cast<double>(j));
+                if (w > 0.0)
+                    AppendFilterTap(kernel, j, srcSize, w);
+            }
+        }
+
+        /* Normalize weights */
+        float sum = 0.0f;
+        for (auto k = first; k < kernel.weights.size(); ++k)
+            sum += kernel.weights[k];
+
+        if (sum != 0.0f)
+        {
+            for (auto k = first; k < kernel.weights.size(); ++k)
+                kernel.weights[k] /= sum;
+        }
+
+        kernel.offsets.push_back(kernel.weights.size());
+    }
+
+    return kernel;
+}
+
+// Accumulates the weighted source row into the destination row; this loop is simple enough to be vectorized by the compiler.
+static void AccumulateRow(float* dst, const float* src, float weight, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        dst[i] += src[i] * weight;
+}
+
+/*
+Downsamples the specified RGBA image (32-bit floats) with a separable filter.
+Each pass along one dimension is distributed over rows, i.e. each row of the destination is written by a single thread.
+*/
+static std::vector<float> DownsampleMipLevel(
+    const std::vector<float>&   src,
+    const Extent3D&             srcExtent,
+    const Extent3D&             dstExtent,
+    MipFilter                   filter,
+    std::size_t                 threadCount)
+{
+    std::vector<float> temp0, temp1;
+    const std::vector<float>* curr = &src;
+
+    /* Resample along X-axis: (sw, sh, sd) -> (dw, sh, sd) */
+    if (dstExtent.width != srcExtent.width)
+    {
+        const auto kernel   = BuildMipFilterKernel(filter, srcExtent.width, dstExtent.width);
+        const auto numRows  = static_cast<std::size_t>(srcExtent.height) * srcExtent.depth;
+
+        temp0.resize(numRows * dstExtent.width * 4);
+
+        ForEachRowConcurrent(
+            numRows,
+            threadCount,
+            [&](std::size_t row)
+            {
+                const auto srcRow = curr->data() + row * srcExtent.width * 4;
+                auto dstRow = temp0.data() + row * dstExtent.width * 4;
+
+                for (std::uint32_t x = 0; x < dstExtent.width; ++x)
+                {
+                    float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+                    for (auto k = kernel.offsets[x]; k < kernel.offsets[x + 1]; ++k)
+                        AccumulateRow(color, srcRow + kernel.indices[k] * 4, kernel.weights[k], 4);
+
+                    std::copy(color, color + 4, dstRow + x * 4);
+                }
+            }
+        );
+
+        curr = &temp0;
+    }
+
+    /* Resample along Y-axis: (dw, sh, sd) -> (dw, dh, sd) */
+    if (dstExtent.height != srcExtent.height)
+    {
+        const auto kernel   = BuildMipFilterKernel(filter, srcExtent.height, dstExtent.height);
+        const auto rowSize  = static_cast<std::size_t>(dstExtent.width) * 4;
+        const auto numRows  = static_cast<std::size_t>(dstExtent.height) * srcExtent.depth;
+
+        temp1.resize(numRows * rowSize, 0.0f);
+
+        ForEachRowConcurrent(
+            numRows,
+            threadCount,
+            [&](std::size_t row)
+            {
+                const auto y = row % dstExtent.height;
+                const auto z = row / dstExtent.height;
+                const auto srcSlice = curr->data() + z * srcExtent.height * rowSize;
+
+                for (auto k = kernel.offsets[y]; k < kernel.offsets[y + 1]; ++k)
+                    AccumulateRow(temp1.data() + row * rowSize, srcSlice + kernel.indices[k] * rowSize, kernel.weights[k], rowSize);
+            }
+        );
+
+        curr = &temp1;
+    }
+
+    /* Resample along Z-axis: (dw, dh, sd) -> (dw, dh, dd) */
+    if (dstExtent.depth != srcExtent.depth)
+    {
+        const auto kernel   = BuildMipFilterKernel(filter, srcExtent.depth, dstExtent.depth);
+        const auto rowSize  = static_cast<std::size_t>(dstExtent.width) * 4;
+        const auto numRows  = static_cast<std::size_t>(dstExtent.height) * dstExtent.depth;
+
+        std::vector<float> dst(numRows * rowSize, 0.0f);
+
+        ForEachRowConcurrent(
+            numRows,
+            threadCount,
+            [&](std::size_t row)
+            {
+                const auto y = row % dstExtent.height;
+                const auto z = row / dstExtent.height;
+
+                for (auto k = kernel.offsets[z]; k < kernel.offsets[z + 1]; ++k)
+                {
+                    const auto srcRow = curr->data() + (kernel.indices[k] * dstExtent.height + y) * rowSize;
+                    AccumulateRow(dst.data() + row * rowSize, srcRow, kernel.weights[k], rowSize);
+                }
+            }
+        );
+
+        return dst;
+    }
+
+    if (curr == &temp1)
+        return temp1;
+    if (curr == &temp0)
+        return temp0;
+    return src;
+}
+
+static float SRGBToLinear(float c)
+{
+    c = std::max(0.0f, c);
+    return (c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f));
+}
+
+static float LinearToSRGB(float c)
+{
+    c = std::max(0.0f, c);
+    return (c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f);
+}
+
+// Converts the RGBA colors of the base MIP level into the space where they are filtered.
+static void PrepareMipFilterColors(std::vector<float>& colors, const MipChainDescriptor& mipChainDesc, std::size_t threadCount)
+{
+    if (!mipChainDesc.sRGB && !mipChainDesc.premultiplyAlpha)
+        return;
+
+    const auto numPixels = colors.size() / 4;
+
+    ForEachRowConcurrent(
+        numPixels,
+        threadCount,
+        [&](std::size_t i)
+        {
+            auto color = &colors[i * 4];
+
+            if (mipChainDesc.sRGB)
+            {
+                for (int c = 0; c < 3; ++c)
+                    color[c] = SRGBToLinear(color[c]);
+            }
+
+            if (mipChainDesc.premultiplyAlpha)
+            {
+                for (int c = 0; c < 3; ++c)
+                    color[c] *= color[3];
+            }
+        }
+    );
+}
+
+// Converts the filtered RGBA colors back into the space of the source image and clamps them to the range of the output data type.
+static void FinalizeMipFilterColors(std::vector<float>& colors, const MipChainDescriptor& mipChainDesc, DataType dataType, std::size_t threadCount)
+{
+    /* Bias normalized integer types by half a step, since the conversion truncates the values */
+    const bool  isFloat = IsFloatDataType(dataType);
+    const float bias    = (isFloat ? 0.0f : 0.5f / static_cast<float>((1ull << (DataTypeSize(dataType) * 8)) - 1ull));
+
+    const auto numPixels = colors.size() / 4;
+
+    ForEachRowConcurrent(
+        numPixels,
+        threadCount,
+        [&](std::size_t i)
+        {
+            auto color = &colors[i * 4];
+
+            if (mipChainDesc.premultiplyAlpha)
+            {
+                color[3] = std::max(0.0f, color[3]);
+                for (int c = 0; c < 3; ++c)
+                    color[c] = (color[3] > 0.0f ? color[c] / color[3] : 0.0f);
+            }
+
+            if (mipChainDesc.sRGB)
+            {
+                for (int c = 0; c < 3; ++c)
+                    color[c] = LinearToSRGB(color[c]);
+            }
+
+            if (!isFloat)
+            {
+                for (int c = 0; c < 4; ++c)
+                    color[c] = std::max(0.0f, std::min(color[c] + bias, 1.0f));
+            }
+        }
+    );
+}
+
+static Extent3D NextMipExtent(const Extent3D& extent)
+{
+    return Extent3D
+    {
+        std::max(1u, extent.width  / 2),
+        std::max(1u, extent.height / 2),
+        std::max(1u, extent.depth  / 2)
+    };
+}
+
+
+/* ----- Block compression ----- */
+
+// Returns the size (in bytes) of a compressed 4x4 block in the specified format, or 0 if the format is not supported.
+static std::size_t GetBCnBlockSize(const Format format)
+{
+    switch (format)
+    {
+        case Format::BC1RGB:    return 8;
+        case Format::BC1RGBA:   return 8;
+        case Format::BC2RGBA:   return 16;
+        case Format::BC3RGBA:   return 16;
+        default:                return 0;
+    }
+}
+
+static std::uint32_t GetNumBlocks(std::uint32_t size)
+{
+    return (size + 3) / 4;
+}
+
 
 /* ----- Public functions ----- */
 
@@ -817,6 +1334,92 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     return nullptr;
 }
 
+LLGL_EXPORT void ConvertImageBufferRegion(
+    const SrcImageDescriptor&   srcImageDesc,
+    std::size_t                 srcRowStride,
+    std::size_t                 srcDepthStride,
+    const DstImageDescriptor&   dstImageDesc,
+    std::size_t                 dstRowStride,
+    std::size_t                 dstDepthStride,
+    const Extent3D&             extent,
+    std::size_t                 threadCount)
+{
+    const bool isSameFormat = (srcImageDesc.format == dstImageDesc.format && srcImageDesc.dataType == dstImageDesc.dataType);
+
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcImageDesc.data);
+    LLGL_ASSERT_PTR(dstImageDesc.data);
+
+    if (!isSameFormat)
+    {
+        if (IsCompressedFormat(srcImageDesc.format) || IsCompressedFormat(dstImageDesc.format))
+            throw std::invalid_argument("cannot convert compressed image formats");
+        if (IsDepthStencilFormat(srcImageDesc.format) || IsDepthStencilFormat(dstImageDesc.format))
+            throw std::invalid_argument("cannot convert depth-stencil image formats");
+    }
+
+    const auto srcBpp = static_cast<std::size_t>(ImageFormatSize(srcImageDesc.format) * DataTypeSize(srcImageDesc.dataType));
+    const auto dstBpp = static_cast<std::size_t>(ImageFormatSize(dstImageDesc.format) * DataTypeSize(dstImageDesc.dataType));
+
+    if (srcImageDesc.dataSize < GetStridedRegionSize(extent, srcBpp, srcRowStride, srcDepthStride))
+        throw std::invalid_argument("source image data size is too small for the specified region and strides");
+    if (dstImageDesc.dataSize < GetStridedRegionSize(extent, dstBpp, dstRowStride, dstDepthStride))
+        throw std::invalid_argument("destination image data size is too small for the specified region and strides");
+
+    if (threadCount == Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    auto src = reinterpret_cast<const char*>(srcImageDesc.data);
+    auto dst = reinterpret_cast<char*>(dstImageDesc.data);
+
+    const auto numRows = static_cast<std::size_t>(extent.height) * extent.depth;
+
+    const auto GetRowPointers = [&](std::size_t row, const char*& srcRow, char*& dstRow)
+    {
+        const auto y = row % extent.height;
+        const auto z = row / extent.height;
+        srcRow = src + z * srcDepthStride + y * srcRowStride;
+        dstRow = dst + z * dstDepthStride + y * dstRowStride;
+    };
+
+    if (isSameFormat)
+    {
+        /* Copy each row directly into the destination region */
+        const auto rowSize = extent.width * srcBpp;
+        ForEachRowConcurrent(
+            numRows,
+            threadCount,
+            [&](std::size_t row)
+            {
+                const char* srcRow;
+                char* dstRow;
+                GetRowPointers(row, srcRow, dstRow);
+                ::memcpy(dstRow, srcRow, rowSize);
+            }
+        );
+    }
+    else
+    {
+        /* Convert each row directly into the destination region */
+        StridedConversion conv;
+        InitStridedConversion(conv, srcImageDesc.format, srcImageDesc.dataType, dstImageDesc.format, dstImageDesc.dataType);
+
+        const auto ConvertRow = (srcImageDesc.dataType == dstImageDesc.dataType ? ConvertImageRowComponents : ConvertImageRowNormalized);
+
+        ForEachRowConcurrent(
+            numRows,
+            threadCount,
+            [&](std::size_t row)
+            {
+                const char* srcRow;
+                char* dstRow;
+                GetRowPointers(row, srcRow, dstRow);
+                ConvertRow(conv, srcRow, dstRow, extent.width);
+            }
+        );
+    }
+}
+
 LLGL_EXPORT ByteBuffer GenerateImageBuffer(
     ImageFormat         format,
     DataType            dataType,
@@ -862,6 +1465,240 @@ LLGL_EXPORT ByteBuffer GenerateEmptyByteBuffer(std::size_t bufferSize, bool init
 }
 
 
+LLGL_EXPORT std::size_t MipChainDataSize(ImageFormat format, DataType dataType, const Extent3D& extent, std::uint32_t numMipLevels)
+{
+    std::size_t dataSize = 0;
+
+    for (auto mipExtent = extent; numMipLevels > 0; --numMipLevels)
+    {
+        dataSize += ImageDataSize(format, dataType, mipExtent.width * mipExtent.height * mipExtent.depth);
+        mipExtent = NextMipExtent(mipExtent);
+    }
+
+    return dataSize;
+}
+
+LLGL_EXPORT ByteBuffer GenerateMipChain(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    const MipChainDescriptor&   mipChainDesc)
+{
+    /* Validate input parameters */
+    if (IsCompressedFormat(srcImageDesc.format))
+        throw std::invalid_argument("cannot generate MIP chain for compressed image format");
+    if (IsDepthStencilFormat(srcImageDesc.format))
+        throw std::invalid_argument("cannot generate MIP chain for depth-stencil image format");
+    if (srcImageDesc.data == nullptr)
+        throw std::invalid_argument("cannot generate MIP chain from null pointer source buffer");
+
+    const auto numPixels    = extent.width * extent.height * extent.depth;
+    const auto baseDataSize = static_cast<std::size_t>(ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, numPixels));
+
+    if (srcImageDesc.dataSize < baseDataSize)
+        throw std::invalid_argument("cannot generate MIP chain with source buffer size less than the base MIP level");
+
+    auto threadCount = mipChainDesc.threadCount;
+    if (threadCount == Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    auto numMipLevels = mipChainDesc.numMipLevels;
+    if (numMipLevels == 0)
+        numMipLevels = NumMipLevels(extent.width, extent.height, extent.depth);
+
+    /* Allocate output buffer and copy base MIP level */
+    auto dstBuffer = AllocByteArray(MipChainDataSize(srcImageDesc.format, srcImageDesc.dataType, extent, numMipLevels));
+    ::memcpy(dstBuffer.get(), srcImageDesc.data, baseDataSize);
+
+    if (numMipLevels < 2 || numPixels == 0)
+        return dstBuffer;
+
+    /* Convert base MIP level into RGBA colors with 32-bit floats */
+    std::vector<float> currLevel(static_cast<std::size_t>(numPixels) * 4);
+    {
+        const DstImageDescriptor floatImageDesc { ImageFormat::RGBA, DataType::Float32, currLevel.data(), currLevel.size() * sizeof(float) };
+        const SrcImageDescriptor baseImageDesc { srcImageDesc.format, srcImageDesc.dataType, srcImageDesc.data, baseDataSize };
+        if (!ConvertImageBuffer(baseImageDesc, floatImageDesc, threadCount))
+            ::memcpy(currLevel.data(), srcImageDesc.data, baseDataSize);
+    }
+
+    PrepareMipFilterColors(currLevel, mipChainDesc, threadCount);
+
+    /* Downsample each MIP level from its previous MIP level */
+    auto        currExtent  = extent;
+    std::size_t dstOffset   = baseDataSize;
+
+    for (std::uint32_t mipLevel = 1; mipLevel < numMipLevels; ++mipLevel)
+    {
+        const auto nextExtent = NextMipExtent(currExtent);
+        auto nextLevel = DownsampleMipLevel(currLevel, currExtent, nextExtent, mipChainDesc.filter, threadCount);
+
+        /* Convert filtered colors back into the source format and write them into the output buffer */
+        auto outputColors = nextLevel;
+        FinalizeMipFilterColors(outputColors, mipChainDesc, srcImageDesc.dataType, threadCount);
+
+        const auto mipDataSize = static_cast<std::size_t>(
+            ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, nextExtent.width * nextExtent.height * nextExtent.depth)
+        );
+
+        const SrcImageDescriptor floatImageDesc { ImageFormat::RGBA, DataType::Float32, outputColors.data(), outputColors.size() * sizeof(float) };
+        const DstImageDescriptor mipImageDesc { srcImageDesc.format, srcImageDesc.dataType, dstBuffer.get() + dstOffset, mipDataSize };
+        if (!ConvertImageBuffer(floatImageDesc, mipImageDesc, threadCount))
+            ::memcpy(mipImageDesc.data, outputColors.data(), mipDataSize);
+
+        dstOffset   += mipDataSize;
+        currExtent  = nextExtent;
+        currLevel   = std::move(nextLevel);
+    }
+
+    return dstBuffer;
+}
+
+LLGL_EXPORT std::size_t CompressedImageDataSize(const Format format, const Extent3D& extent)
+{
+    const auto numBlocks = static_cast<std::size_t>(GetNumBlocks(extent.width)) * GetNumBlocks(extent.height) * extent.depth;
+    return (numBlocks * GetBCnBlockSize(format));
+}
+
+LLGL_EXPORT ByteBuffer CompressImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    const Format                dstFormat,
+    const CompressionQuality    quality,
+    std::size_t                 threadCount)
+{
+    const auto blockSize = GetBCnBlockSize(dstFormat);
+    if (blockSize == 0)
+        throw std::invalid_argument("cannot compress image into unsupported block compression format");
+    if (srcImageDesc.data == nullptr)
+        throw std::invalid_argument("cannot compress image from null pointer source buffer");
+
+    if (threadCount == Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Convert source image into RGBA colors with 8-bit unsigned integers */
+    const auto numPixels    = extent.width * extent.height * extent.depth;
+    const auto srcDataSize  = static_cast<std::size_t>(ImageDataSize(srcImageDesc.format, srcImageDesc.dataType, numPixels));
+
+    if (srcImageDesc.dataSize < srcDataSize)
+        throw std::invalid_argument("cannot compress image with source buffer size less than the image size");
+
+    const SrcImageDescriptor rgbaImageDesc { srcImageDesc.format, srcImageDesc.dataType, srcImageDesc.data, srcDataSize };
+    auto rgbaBuffer = ConvertImageBuffer(rgbaImageDesc, ImageFormat::RGBA, DataType::UInt8, threadCount);
+    auto rgba = reinterpret_cast<const std::uint8_t*>(rgbaBuffer ? rgbaBuffer.get() : srcImageDesc.data);
+
+    /* Compress each row of blocks */
+    const auto numBlocksX       = GetNumBlocks(extent.width);
+    const auto numBlocksY       = GetNumBlocks(extent.height);
+    const auto numBlockRows     = static_cast<std::size_t>(numBlocksY) * extent.depth;
+    const bool highQuality      = (quality == CompressionQuality::High);
+
+    auto dstBuffer = AllocByteArray(CompressedImageDataSize(dstFormat, extent));
+    auto dst = reinterpret_cast<std::uint8_t*>(dstBuffer.get());
+
+    ForEachRowConcurrent(
+        numBlockRows,
+        threadCount,
+        [&](std::size_t row)
+        {
+            const auto z        = static_cast<std::uint32_t>(row / numBlocksY);
+            const auto blockY   = static_cast<std::uint32_t>(row % numBlocksY);
+
+            std::uint8_t block[64];
+            auto dstBlock = dst + row * numBlocksX * blockSize;
+
+            for (std::uint32_t blockX = 0; blockX < numBlocksX; ++blockX, dstBlock += blockSize)
+            {
+                /* Gather 4x4 texels and replicate border texels for incomplete blocks */
+                for (std::uint32_t j = 0; j < 4; ++j)
+                {
+                    const auto y = std::min(blockY * 4 + j, extent.height - 1);
+                    for (std::uint32_t i = 0; i < 4; ++i)
+                    {
+                        const auto x = std::min(blockX * 4 + i, extent.width - 1);
+                        ::memcpy(&block[(j * 4 + i) * 4], rgba + ((static_cast<std::size_t>(z) * extent.height + y) * extent.width + x) * 4, 4);
+                    }
+                }
+
+                switch (dstFormat)
+                {
+                    case Format::BC1RGB:    CompressBlockBC1(block, dstBlock, false, highQuality);  break;
+                    case Format::BC1RGBA:   CompressBlockBC1(block, dstBlock, true, highQuality);   break;
+                    case Format::BC2RGBA:   CompressBlockBC2(block, dstBlock, highQuality);         break;
+                    case Format::BC3RGBA:   CompressBlockBC3(block, dstBlock, highQuality);         break;
+                    default:                                                                        break;
+                }
+            }
+        }
+    );
+
+    return dstBuffer;
+}
+
+LLGL_EXPORT ByteBuffer DecompressImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Format                srcFormat,
+    const Extent3D&             extent,
+    std::size_t                 threadCount)
+{
+    const auto blockSize = GetBCnBlockSize(srcFormat);
+    if (blockSize == 0)
+        throw std::invalid_argument("cannot decompress image from unsupported block compression format");
+    if (srcImageDesc.data == nullptr)
+        throw std::invalid_argument("cannot decompress image from null pointer source buffer");
+    if (srcImageDesc.dataSize < CompressedImageDataSize(srcFormat, extent))
+        throw std::invalid_argument("cannot decompress image with source buffer size less than the compressed image size");
+
+    if (threadCount == Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Decompress each row of blocks */
+    const auto numBlocksX       = GetNumBlocks(extent.width);
+    const auto numBlocksY       = GetNumBlocks(extent.height);
+    const auto numBlockRows     = static_cast<std::size_t>(numBlocksY) * extent.depth;
+
+    auto dstBuffer = AllocByteArray(static_cast<std::size_t>(extent.width) * extent.height * extent.depth * 4);
+    auto dst = reinterpret_cast<std::uint8_t*>(dstBuffer.get());
+    auto src = reinterpret_cast<const std::uint8_t*>(srcImageDesc.data);
+
+    ForEachRowConcurrent(
+        numBlockRows,
+        threadCount,
+        [&](std::size_t row)
+        {
+            const auto z        = static_cast<std::uint32_t>(row / numBlocksY);
+            const auto blockY   = static_cast<std::uint32_t>(row % numBlocksY);
+
+            std::uint8_t block[64];
+            auto srcBlock = src + row * numBlocksX * blockSize;
+
+            for (std::uint32_t blockX = 0; blockX < numBlocksX; ++blockX, srcBlock += blockSize)
+            {
+                switch (srcFormat)
+                {
+                    case Format::BC1RGB:    DecompressBlockBC1(srcBlock, block, false); break;
+                    case Format::BC1RGBA:   DecompressBlockBC1(srcBlock, block, true);  break;
+                    case Format::BC2RGBA:   DecompressBlockBC2(srcBlock, block);        break;
+                    case Format::BC3RGBA:   DecompressBlockBC3(srcBlock, block);        break;
+                    default:                                                            break;
+                }
+
+                /* Scatter 4x4 texels and crop incomplete blocks */
+                for (std::uint32_t j = 0; j < 4 && blockY * 4 + j < extent.height; ++j)
+                {
+                    const auto y = blockY * 4 + j;
+                    for (std::uint32_t i = 0; i < 4 && blockX * 4 + i < extent.width; ++i)
+                    {
+                        const auto x = blockX * 4 + i;
+                        ::memcpy(dst + ((static_cast<std::size_t>(z) * extent.height + y) * extent.width + x) * 4, &block[(j * 4 + i) * 4], 4);
+                    }
+                }
+            }
+        }
+    );
+
+    return dstBuffer;
+}
+
 } // /namespace LLGL
 
 
@@ -0,0 +1,692 @@
+/*
+ * TextureFile.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TextureFile.h>
+#include <LLGL/Format.h>
+#include "../Platform/MappedFile.h"
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Reads a structure from the mapped file at the specified offset, or throws an exception if it exceeds the file size
+template <typename T>
+T ReadFileStruct(const MappedFile& file, std::size_t offset, const char* structName)
+{
+    if (offset > file.GetSize() || sizeof(T) > file.GetSize() - offset)
+        throw std::runtime_error(std::string("texture file too small to contain ") + structName);
+    T value;
+    ::memcpy(&value, reinterpret_cast<const char*>(file.GetData()) + offset, sizeof(T));
+    return value;
+}
+
+static std::size_t AlignOffset(std::size_t offset, std::size_t alignment)
+{
+    return ((offset + alignment - 1) / alignment) * alignment;
+}
+
+// Multiplies the specified sizes, or throws an exception if the result overflows
+static std::size_t MulImageSize(std::size_t lhs, std::size_t rhs)
+{
+    if (rhs != 0 && lhs > std::numeric_limits<std::size_t>::max() / rhs)
+        throw std::runtime_error("image size overflow in texture file");
+    return lhs * rhs;
+}
+
+// Multiplies the number of array elements by the number of cube faces, or throws an exception if the result overflows
+static std::uint32_t MulArrayLayers(std::uint32_t numElements, std::uint32_t numFaces)
+{
+    if (numElements > std::numeric_limits<std::uint32_t>::max() / numFaces)
+        throw std::runtime_error("too many array layers in texture file: " + std::to_string(numElements));
+    return numElements * numFaces;
+}
+
+
+/* ----- DDS ----- */
+
+static const std::uint32_t g_ddsMagic               = 0x20534444; // "DDS "
+static const std::uint32_t g_ddsFourCCDX10          = 0x30315844; // "DX10"
+
+static const std::uint32_t g_ddsFlagMipMapCount     = 0x00020000;
+static const std::uint32_t g_ddsFlagDepth           = 0x00800000;
+
+static const std::uint32_t g_ddsPixelFlagAlpha      = 0x00000001;
+static const std::uint32_t g_ddsPixelFlagFourCC     = 0x00000004;
+static const std::uint32_t g_ddsPixelFlagRGB        = 0x00000040;
+static const std::uint32_t g_ddsPixelFlagLuminance  = 0x00020000;
+
+static const std::uint32_t g_ddsCaps2Cubemap        = 0x00000200;
+static const std::uint32_t g_ddsCaps2AllFaces       = 0x0000FC00;
+static const std::uint32_t g_ddsCaps2Volume         = 0x00200000;
+
+static const std::uint32_t g_ddsDimensionTexture1D  = 2;
+static const std::uint32_t g_ddsDimensionTexture2D  = 3;
+static const std::uint32_t g_ddsDimensionTexture3D  = 4;
+
+static const std::uint32_t g_ddsMiscFlagCube        = 0x00000004;
+
+struct DDSPixelFormat
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t fourCC;
+    std::uint32_t rgbBitCount;
+    std::uint32_t rBitMask;
+    std::uint32_t gBitMask;
+    std::uint32_t bBitMask;
+    std::uint32_t aBitMask;
+};
+
+struct DDSHeader
+{
+    std::uint32_t   size;
+    std::uint32_t   flags;
+    std::uint32_t   height;
+    std::uint32_t   width;
+    std::uint32_t   pitchOrLinearSize;
+    std::uint32_t   depth;
+    std::uint32_t   mipMapCount;
+    std::uint32_t   reserved1[11];
+    DDSPixelFormat  pixelFormat;
+    std::uint32_t   caps;
+    std::uint32_t   caps2;
+    std::uint32_t   caps3;
+    std::uint32_t   caps4;
+    std::uint32_t   reserved2;
+};
+
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+static_assert(sizeof(DDSHeader) == 124, "DDSHeader must have a size of 124 bytes");
+static_assert(sizeof(DDSHeaderDX10) == 20, "DDSHeaderDX10 must have a size of 20 bytes");
+
+static std::uint32_t MakeFourCC(char a, char b, char c, char d)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(a))      ) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(b)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(d)) << 24)
+    );
+}
+
+// Maps the DXGI_FORMAT values that have an equivalent in the Format enumeration
+static Format MapDXGIFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case  2: return Format::RGBA32Float;
+        case  3: return Format::RGBA32UInt;
+        case  4: return Format::RGBA32SInt;
+        case  6: return Format::RGB32Float;
+        case  7: return Format::RGB32UInt;
+        case  8: return Format::RGB32SInt;
+        case 10: return Format::RGBA16Float;
+        case 11: return Format::RGBA16UNorm;
+        case 12: return Format::RGBA16UInt;
+        case 13: return Format::RGBA16SNorm;
+        case 14: return Format::RGBA16SInt;
+        case 16: return Format::RG32Float;
+        case 17: return Format::RG32UInt;
+        case 18: return Format::RG32SInt;
+        case 28: return Format::RGBA8UNorm;
+        case 30: return Format::RGBA8UInt;
+        case 31: return Format::RGBA8SNorm;
+        case 32: return Format::RGBA8SInt;
+        case 34: return Format::RG16Float;
+        case 35: return Format::RG16UNorm;
+        case 36: return Format::RG16UInt;
+        case 37: return Format::RG16SNorm;
+        case 38: return Format::RG16SInt;
+        case 40: return Format::D32Float;
+        case 41: return Format::R32Float;
+        case 42: return Format::R32UInt;
+        case 43: return Format::R32SInt;
+        case 49: return Format::RG8UNorm;
+        case 50: return Format::RG8UInt;
+        case 51: return Format::RG8SNorm;
+        case 52: return Format::RG8SInt;
+        case 54: return Format::R16Float;
+        case 55: return Format::D16UNorm;
+        case 56: return Format::R16UNorm;
+        case 57: return Format::R16UInt;
+        case 58: return Format::R16SNorm;
+        case 59: return Format::R16SInt;
+        case 61: return Format::R8UNorm;
+        case 62: return Format::R8UInt;
+        case 63: return Format::R8SNorm;
+        case 64: return Format::R8SInt;
+        case 71: return Format::BC1RGBA;
+        case 74: return Format::BC2RGBA;
+        case 77: return Format::BC3RGBA;
+        case 87: return Format::BGRA8UNorm;
+        case 91: return Format::BGRA8sRGB;
+        default: return Format::Undefined;
+    }
+}
+
+// Maps the legacy DDS pixel format (without DX10 header extension)
+static Format MapDDSPixelFormat(const DDSPixelFormat& pf)
+{
+    if ((pf.flags & g_ddsPixelFlagFourCC) != 0)
+    {
+        /* Map block compressed formats and D3DFORMAT values */
+        if (pf.fourCC == MakeFourCC('D', 'X', 'T', '1'))
+            return ((pf.flags & g_ddsPixelFlagAlpha) != 0 ? Format::BC1RGBA : Format::BC1RGB);
+        if (pf.fourCC == MakeFourCC('D', 'X', 'T', '2') || pf.fourCC == MakeFourCC('D', 'X', 'T', '3'))
+            return Format::BC2RGBA;
+        if (pf.fourCC == MakeFourCC('D', 'X', 'T', '4') || pf.fourCC == MakeFourCC('D', 'X', 'T', '5'))
+            return Format::BC3RGBA;
+
+        switch (pf.fourCC)
+        {
+            case  36: return Format::RGBA16UNorm;   // D3DFMT_A16B16G16R16
+            case 111: return Format::R16Float;      // D3DFMT_R16F
+            case 112: return Format::RG16Float;     // D3DFMT_G16R16F
+            case 113: return Format::RGBA16Float;   // D3DFMT_A16B16G16R16F
+            case 114: return Format::R32Float;      // D3DFMT_R32F
+            case 115: return Format::RG32Float;     // D3DFMT_G32R32F
+            case 116: return Format::RGBA32Float;   // D3DFMT_A32B32G32R32F
+            default:  return Format::Undefined;
+        }
+    }
+
+    if ((pf.flags & (g_ddsPixelFlagRGB | g_ddsPixelFlagLuminance)) != 0)
+    {
+        /* Map uncompressed formats by their bit masks */
+        const bool hasAlpha = ((pf.flags & g_ddsPixelFlagAlpha) != 0);
+        switch (pf.rgbBitCount)
+        {
+            case 32:
+                if (pf.rBitMask == 0x000000FF && pf.gBitMask == 0x0000FF00 && pf.bBitMask == 0x00FF0000 && hasAlpha && pf.aBitMask == 0xFF000000)
+                    return Format::RGBA8UNorm;
+                if (pf.rBitMask == 0x00FF0000 && pf.gBitMask == 0x0000FF00 && pf.bBitMask == 0x000000FF && hasAlpha && pf.aBitMask == 0xFF000000)
+                    return Format::BGRA8UNorm;
+                if (pf.rBitMask == 0x0000FFFF && pf.gBitMask == 0xFFFF0000)
+                    return Format::RG16UNorm;
+                break;
+            case 24:
+                if (pf.rBitMask == 0x000000FF && pf.gBitMask == 0x0000FF00 && pf.bBitMask == 0x00FF0000)
+                    return Format::RGB8UNorm;
+                break;
+            case 16:
+                if (pf.rBitMask == 0x000000FF && pf.gBitMask == 0x0000FF00)
+                    return Format::RG8UNorm;
+                if (pf.rBitMask == 0x0000FFFF)
+                    return Format::R16UNorm;
+                break;
+            case 8:
+                if (pf.rBitMask == 0x000000FF)
+                    return Format::R8UNorm;
+                break;
+        }
+    }
+
+    return Format::Undefined;
+}
+
+
+/* ----- KTX ----- */
+
+static const std::uint8_t g_ktxIdentifier[12]   = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+static const std::uint32_t g_ktxEndianness      = 0x04030201;
+
+struct KTXHeader
+{
+    std::uint8_t    identifier[12];
+    std::uint32_t   endianness;
+    std::uint32_t   glType;
+    std::uint32_t   glTypeSize;
+    std::uint32_t   glFormat;
+    std::uint32_t   glInternalFormat;
+    std::uint32_t   glBaseInternalFormat;
+    std::uint32_t   pixelWidth;
+    std::uint32_t   pixelHeight;
+    std::uint32_t   pixelDepth;
+    std::uint32_t   numberOfArrayElements;
+    std::uint32_t   numberOfFaces;
+    std::uint32_t   numberOfMipmapLevels;
+    std::uint32_t   bytesOfKeyValueData;
+};
+
+static_assert(sizeof(KTXHeader) == 64, "KTXHeader must have a size of 64 bytes");
+
+// Maps the GL internal formats that have an equivalent in the Format enumeration
+static Format MapKTXInternalFormat(std::uint32_t glInternalFormat, std::uint32_t glFormat)
+{
+    switch (glInternalFormat)
+    {
+        case 0x8229: return Format::R8UNorm;            // GL_R8
+        case 0x8F94: return Format::R8SNorm;            // GL_R8_SNORM
+        case 0x8232: return Format::R8UInt;             // GL_R8UI
+        case 0x8231: return Format::R8SInt;             // GL_R8I
+        case 0x822A: return Format::R16UNorm;           // GL_R16
+        case 0x8234: return Format::R16UInt;            // GL_R16UI
+        case 0x8233: return Format::R16SInt;            // GL_R16I
+        case 0x822D: return Format::R16Float;           // GL_R16F
+        case 0x8236: return Format::R32UInt;            // GL_R32UI
+        case 0x8235: return Format::R32SInt;            // GL_R32I
+        case 0x822E: return Format::R32Float;           // GL_R32F
+        case 0x822B: return Format::RG8UNorm;           // GL_RG8
+        case 0x822C: return Format::RG16UNorm;          // GL_RG16
+        case 0x822F: return Format::RG16Float;          // GL_RG16F
+        case 0x8230: return Format::RG32Float;          // GL_RG32F
+        case 0x8051: return Format::RGB8UNorm;          // GL_RGB8
+        case 0x881B: return Format::RGB16Float;         // GL_RGB16F
+        case 0x8815: return Format::RGB32Float;         // GL_RGB32F
+        case 0x8058:                                    // GL_RGBA8
+            return (glFormat == 0x80E1 ? Format::BGRA8UNorm : Format::RGBA8UNorm);
+        case 0x8F97: return Format::RGBA8SNorm;         // GL_RGBA8_SNORM
+        case 0x8D7C: return Format::RGBA8UInt;          // GL_RGBA8UI
+        case 0x805B: return Format::RGBA16UNorm;        // GL_RGBA16
+        case 0x881A: return Format::RGBA16Float;        // GL_RGBA16F
+        case 0x8D70: return Format::RGBA32UInt;         // GL_RGBA32UI
+        case 0x8814: return Format::RGBA32Float;        // GL_RGBA32F
+        case 0x81A5: return Format::D16UNorm;           // GL_DEPTH_COMPONENT16
+        case 0x8CAC: return Format::D32Float;           // GL_DEPTH_COMPONENT32F
+        case 0x83F0: return Format::BC1RGB;             // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+        case 0x83F1: return Format::BC1RGBA;            // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+        case 0x83F2: return Format::BC2RGBA;            // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+        case 0x83F3: return Format::BC3RGBA;            // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+        default:     return Format::Undefined;
+    }
+}
+
+
+/* ----- TextureFile class ----- */
+
+TextureFile::TextureFile(const std::string& filename) :
+    file_ { MappedFile::Open(filename) }
+{
+    /* Determine container format by the magic number */
+    const auto fileData = reinterpret_cast<const std::uint8_t*>(file_->GetData());
+    const auto fileSize = file_->GetSize();
+
+    if (fileSize >= sizeof(g_ddsMagic) && ReadFileStruct<std::uint32_t>(*file_, 0, "DDS magic number") == g_ddsMagic)
+    {
+        fileFormat_ = TextureFileFormat::DDS;
+        ParseDDS();
+    }
+    else if (fileSize >= sizeof(g_ktxIdentifier) && ::memcmp(fileData, g_ktxIdentifier, sizeof(g_ktxIdentifier)) == 0)
+    {
+        fileFormat_ = TextureFileFormat::KTX;
+        ParseKTX();
+    }
+    else
+        throw std::runtime_error("unknown texture container format: \"" + filename + "\"");
+}
+
+TextureFile::~TextureFile()
+{
+    // dummy
+}
+
+bool TextureFile::IsCompressed() const
+{
+    return IsCompressedFormat(textureDesc_.format);
+}
+
+Extent3D TextureFile::GetMipExtent(std::uint32_t mipLevel) const
+{
+    const auto& extent = textureDesc_.extent;
+    return Extent3D
+    {
+        std::max(1u, extent.width  >> mipLevel),
+        std::max(1u, extent.height >> mipLevel),
+        std::max(1u, extent.depth  >> mipLevel)
+    };
+}
+
+const SrcImageDescriptor& TextureFile::GetImageDesc(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    if (mipLevel >= numMipLevels_)
+        throw std::out_of_range("MIP-map level out of range for texture file: " + std::to_string(mipLevel));
+    if (arrayLayer >= textureDesc_.arrayLayers)
+        throw std::out_of_range("array layer out of range for texture file: " + std::to_string(arrayLayer));
+    return images_[mipLevel * textureDesc_.arrayLayers + arrayLayer];
+}
+
+bool TextureFile::GetContiguousImageDesc(std::uint32_t mipLevel, SrcImageDescriptor& imageDesc) const
+{
+    /* Check if each array layer immediately follows its predecessor */
+    const auto& first = GetImageDesc(mipLevel);
+
+    for (std::uint32_t arrayLayer = 1; arrayLayer < textureDesc_.arrayLayers; ++arrayLayer)
+    {
+        const auto& prev = images_[mipLevel * textureDesc_.arrayLayers + arrayLayer - 1];
+        const auto& next = images_[mipLevel * textureDesc_.arrayLayers + arrayLayer];
+        if (reinterpret_cast<const char*>(prev.data) + prev.dataSize != next.data)
+            return false;
+    }
+
+    imageDesc           = first;
+    imageDesc.dataSize  = first.dataSize * textureDesc_.arrayLayers;
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void TextureFile::ParseDDS()
+{
+    /* Read and validate main header */
+    auto header = ReadFileStruct<DDSHeader>(*file_, 4, "DDS header");
+
+    if (header.size != sizeof(DDSHeader) || header.pixelFormat.size != sizeof(DDSPixelFormat))
+        throw std::runtime_error("malformed DDS header");
+    if (header.width == 0 || header.height == 0)
+        throw std::runtime_error("invalid DDS texture extent");
+
+    std::size_t offset = 4 + sizeof(DDSHeader);
+
+    Format          format          = Format::Undefined;
+    std::uint32_t   numMipLevels    = ((header.flags & g_ddsFlagMipMapCount) != 0 ? std::max(1u, header.mipMapCount) : 1u);
+
+    textureDesc_.type           = TextureType::Texture2D;
+    textureDesc_.extent.width   = header.width;
+    textureDesc_.extent.height  = header.height;
+    textureDesc_.extent.depth   = 1;
+    textureDesc_.arrayLayers    = 1;
+
+    if ((header.pixelFormat.flags & g_ddsPixelFlagFourCC) != 0 && header.pixelFormat.fourCC == g_ddsFourCCDX10)
+    {
+        /* Read DX10 header extension */
+        auto headerDX10 = ReadFileStruct<DDSHeaderDX10>(*file_, offset, "DDS DX10 header");
+        offset += sizeof(DDSHeaderDX10);
+
+        format = MapDXGIFormat(headerDX10.dxgiFormat);
+        if (format == Format::Undefined)
+            throw std::runtime_error("unsupported DXGI format in DDS file: " + std::to_string(headerDX10.dxgiFormat));
+
+        const auto arraySize = std::max(1u, headerDX10.arraySize);
+
+        switch (headerDX10.resourceDimension)
+        {
+            case g_ddsDimensionTexture1D:
+                textureDesc_.type           = (arraySize > 1 ? TextureType::Texture1DArray : TextureType::Texture1D);
+                textureDesc_.extent.height  = 1;
+                textureDesc_.arrayLayers    = arraySize;
+                break;
+
+            case g_ddsDimensionTexture2D:
+                if ((headerDX10.miscFlag & g_ddsMiscFlagCube) != 0)
+                {
+                    textureDesc_.type           = (arraySize > 1 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+                    textureDesc_.arrayLayers    = MulArrayLayers(arraySize, 6);
+                }
+                else
+                {
+                    textureDesc_.type           = (arraySize > 1 ? TextureType::Texture2DArray : TextureType::Texture2D);
+                    textureDesc_.arrayLayers    = arraySize;
+                }
+                break;
+
+            case g_ddsDimensionTexture3D:
+                if (arraySize > 1)
+                    throw std::runtime_error("invalid array size for 3D texture in DDS file");
+                textureDesc_.type           = TextureType::Texture3D;
+                textureDesc_.extent.depth   = std::max(1u, header.depth);
+                break;
+
+            default:
+                throw std::runtime_error("unsupported resource dimension in DDS file: " + std::to_string(headerDX10.resourceDimension));
+        }
+    }
+    else
+    {
+        /* Map legacy pixel format */
+        format = MapDDSPixelFormat(header.pixelFormat);
+        if (format == Format::Undefined)
+            throw std::runtime_error("unsupported pixel format in DDS file");
+
+        if ((header.caps2 & g_ddsCaps2Cubemap) != 0)
+        {
+            if ((header.caps2 & g_ddsCaps2AllFaces) != g_ddsCaps2AllFaces)
+                throw std::runtime_error("partial cube maps in DDS files are not supported");
+            textureDesc_.type           = TextureType::TextureCube;
+            textureDesc_.arrayLayers    = 6;
+        }
+        else if ((header.caps2 & g_ddsCaps2Volume) != 0 && (header.flags & g_ddsFlagDepth) != 0)
+        {
+            textureDesc_.type           = TextureType::Texture3D;
+            textureDesc_.extent.depth   = std::max(1u, header.depth);
+        }
+    }
+
+    InitImages(format, numMipLevels);
+
+    /* DDS files store all MIP-map levels of one array layer contiguously */
+    for (std::uint32_t arrayLayer = 0; arrayLayer < textureDesc_.arrayLayers; ++arrayLayer)
+    {
+        for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels_; ++mipLevel)
+        {
+            const auto dataSize = GetImageDataSize(mipLevel);
+            SetImage(mipLevel, arrayLayer, offset, dataSize);
+            offset += dataSize;
+        }
+    }
+}
+
+void TextureFile::ParseKTX()
+{
+    /* Read and validate header */
+    auto header = ReadFileStruct<KTXHeader>(*file_, 0, "KTX header");
+
+    if (header.endianness != g_ktxEndianness)
+        throw std::runtime_error("KTX files with non-native endianness are not supported");
+    if (header.pixelWidth == 0)
+        throw std::runtime_error("invalid KTX texture extent");
+    if (header.numberOfFaces != 1 && header.numberOfFaces != 6)
+        throw std::runtime_error("invalid number of faces in KTX file: " + std::to_string(header.numberOfFaces));
+
+    const auto format = MapKTXInternalFormat(header.glInternalFormat, header.glFormat);
+    if (format == Format::Undefined)
+        throw std::runtime_error("unsupported internal format in KTX file: " + std::to_string(header.glInternalFormat));
+    if (IsCompressedFormat(format) && (header.glType != 0 || header.glFormat != 0))
+        throw std::runtime_error("malformed KTX header for compressed format");
+
+    /* Determine texture type */
+    const bool isArray  = (header.numberOfArrayElements > 0);
+    const bool isCube   = (header.numberOfFaces == 6);
+
+    textureDesc_.extent.width   = header.pixelWidth;
+    textureDesc_.extent.height  = std::max(1u, header.pixelHeight);
+    textureDesc_.extent.depth   = std::max(1u, header.pixelDepth);
+    textureDesc_.arrayLayers    = MulArrayLayers(std::max(1u, header.numberOfArrayElements), header.numberOfFaces);
+
+    if (header.pixelDepth > 0)
+    {
+        if (isArray || isCube)
+            throw std::runtime_error("3D array textures in KTX files are not supported");
+        textureDesc_.type = TextureType::Texture3D;
+    }
+    else if (isCube)
+        textureDesc_.type = (isArray ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (header.pixelHeight == 0)
+        textureDesc_.type = (isArray ? TextureType::Texture1DArray : TextureType::Texture1D);
+    else
+        textureDesc_.type = (isArray ? TextureType::Texture2DArray : TextureType::Texture2D);
+
+    /* A MIP-map count of zero requests the MIP-maps to be generated from the base level */
+    InitImages(format, std::max(1u, header.numberOfMipmapLevels));
+
+    if (header.numberOfMipmapLevels == 0)
+        textureDesc_.mipLevels = 0;
+
+    /* KTX files store all array layers and faces of one MIP-map level contiguously */
+    std::size_t offset = sizeof(KTXHeader) + header.bytesOfKeyValueData;
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels_; ++mipLevel)
+    {
+        const auto imageSize    = ReadFileStruct<std::uint32_t>(*file_, offset, "KTX image size");
+        const auto dataSize     = GetImageDataSize(mipLevel);
+
+        offset += sizeof(imageSize);
+
+        /* Rows of uncompressed images are padded to 4 bytes (GL_UNPACK_ALIGNMENT), so they must be repacked if the row size is not a multiple of 4 */
+        const auto extent       = GetMipExtent(mipLevel);
+        const auto compressed   = IsCompressedFormat(format);
+        const auto numRows      = (compressed ? 1 : MulImageSize(extent.height, extent.depth));
+        const auto rowSize      = dataSize / numRows;
+        const auto rowPitch     = (compressed ? rowSize : AlignOffset(rowSize, 4));
+        const auto layerSize    = MulImageSize(rowPitch, numRows);
+
+        if (isCube && !isArray)
+        {
+            /* Non-array cube maps specify the size of each face, and each face is padded to 4 bytes */
+            if (imageSize != layerSize)
+                throw std::runtime_error("unexpected image size in KTX file (MIP-map level " + std::to_string(mipLevel) + ")");
+
+            if (rowPitch != rowSize)
+            {
+                /* Faces are not padded any further, since the padded rows are a multiple of 4 bytes already */
+                SetRepackedImages(mipLevel, offset, rowSize, rowPitch, numRows);
+                offset += MulImageSize(layerSize, 6);
+            }
+            else
+            {
+                for (std::uint32_t face = 0; face < 6; ++face)
+                {
+                    SetImage(mipLevel, face, offset, dataSize);
+                    offset = AlignOffset(offset + dataSize, 4);
+                }
+            }
+        }
+        else
+        {
+            /* All other textures specify the size of all array layers together */
+            if (imageSize != MulImageSize(layerSize, textureDesc_.arrayLayers))
+                throw std::runtime_error("unexpected image size in KTX file (MIP-map level " + std::to_string(mipLevel) + ")");
+
+            if (rowPitch != rowSize)
+                SetRepackedImages(mipLevel, offset, rowSize, rowPitch, numRows);
+            else
+            {
+                for (std::uint32_t arrayLayer = 0; arrayLayer < textureDesc_.arrayLayers; ++arrayLayer)
+                    SetImage(mipLevel, arrayLayer, offset + arrayLayer * dataSize, dataSize);
+            }
+
+            offset = AlignOffset(offset + imageSize, 4);
+        }
+    }
+}
+
+void TextureFile::InitImages(Format format, std::uint32_t numMipLevels)
+{
+    /* Block compressed images are passed through as they are */
+    ImageFormat imageFormat;
+    DataType    dataType;
+
+    if (!FindSuitableImageFormat(format, imageFormat, dataType))
+        throw std::runtime_error("unsupported image format in texture file");
+
+    if (IsCompressedFormat(format))
+        dataType = DataType::UInt8;
+
+    if (numMipLevels > NumMipLevels(textureDesc_.extent.width, textureDesc_.extent.height, textureDesc_.extent.depth))
+        throw std::runtime_error("too many MIP-map levels in texture file: " + std::to_string(numMipLevels));
+
+    textureDesc_.format     = format;
+    textureDesc_.mipLevels  = numMipLevels;
+    numMipLevels_           = numMipLevels;
+
+    /* Validate that at least all array layers of the base MIP-map fit into the file before allocating image descriptors */
+    if (MulImageSize(GetImageDataSize(0), textureDesc_.arrayLayers) > file_->GetSize())
+        throw std::runtime_error("image data exceeds texture file size");
+
+    images_.resize(static_cast<std::size_t>(numMipLevels) * textureDesc_.arrayLayers, SrcImageDescriptor{ imageFormat, dataType, nullptr, 0 });
+}
+
+void TextureFile::SetImage(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::size_t offset, std::size_t dataSize)
+{
+    /* Validate image range against file size */
+    const auto fileSize = file_->GetSize();
+    if (offset > fileSize || dataSize > fileSize - offset)
+    {
+        throw std::runtime_error(
+            "image data exceeds texture file size (MIP-map level " + std::to_string(mipLevel) +
+            ", array layer " + std::to_string(arrayLayer) + ")"
+        );
+    }
+
+    /* Point image descriptor directly into the mapped file */
+    auto& imageDesc = images_[mipLevel * textureDesc_.arrayLayers + arrayLayer];
+    imageDesc.data      = reinterpret_cast<const char*>(file_->GetData()) + offset;
+    imageDesc.dataSize  = dataSize;
+}
+
+void TextureFile::SetRepackedImages(std::uint32_t mipLevel, std::size_t offset, std::size_t rowSize, std::size_t rowPitch, std::size_t numRows)
+{
+    /* Validate padded image range of all array layers against file size */
+    const auto numLayerRows = MulImageSize(numRows, textureDesc_.arrayLayers);
+    const auto paddedSize   = MulImageSize(rowPitch, numLayerRows);
+    const auto fileSize     = file_->GetSize();
+
+    if (offset > fileSize || paddedSize > fileSize - offset)
+        throw std::runtime_error("image data exceeds texture file size (MIP-map level " + std::to_string(mipLevel) + ")");
+
+    /* Copy all rows without their padding, so the array layers of this MIP-map level remain contiguous */
+    const auto dataSize = rowSize * numRows;
+
+    std::unique_ptr<char[]> data { new char[dataSize * textureDesc_.arrayLayers] };
+
+    const auto src = reinterpret_cast<const char*>(file_->GetData()) + offset;
+    for (std::size_t row = 0; row < numLayerRows; ++row)
+        ::memcpy(data.get() + row * rowSize, src + row * rowPitch, rowSize);
+
+    for (std::uint32_t arrayLayer = 0; arrayLayer < textureDesc_.arrayLayers; ++arrayLayer)
+    {
+        auto& imageDesc = images_[mipLevel * textureDesc_.arrayLayers + arrayLayer];
+        imageDesc.data      = data.get() + arrayLayer * dataSize;
+        imageDesc.dataSize  = dataSize;
+    }
+
+    repackedImages_.emplace_back(std::move(data));
+}
+
+std::size_t TextureFile::GetImageDataSize(std::uint32_t mipLevel) const
+{
+    const auto extent = GetMipExtent(mipLevel);
+    if (IsCompressedFormat(textureDesc_.format))
+    {
+        /* Compressed size of a 1x1x1 image is the size of a single 4x4 block */
+        const auto blockSize    = CompressedImageDataSize(textureDesc_.format, Extent3D{ 1, 1, 1 });
+        const auto numBlocksX   = (static_cast<std::size_t>(extent.width) + 3) / 4;
+        const auto numBlocksY   = (static_cast<std::size_t>(extent.height) + 3) / 4;
+        return MulImageSize(MulImageSize(MulImageSize(numBlocksX, numBlocksY), extent.depth), blockSize);
+    }
+    else
+    {
+        const auto texelSize = static_cast<std::size_t>(FormatBitSize(textureDesc_.format) / 8);
+        return MulImageSize(MulImageSize(MulImageSize(extent.width, extent.height), extent.depth), texelSize);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
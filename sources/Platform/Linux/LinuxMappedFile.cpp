@@ -0,0 +1,76 @@
+/*
+ * LinuxMappedFile.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "LinuxMappedFile.h"
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& filename)
+{
+    return std::unique_ptr<MappedFile>(new LinuxMappedFile(filename));
+}
+
+LinuxMappedFile::LinuxMappedFile(const std::string& filename)
+{
+    /* Open file for reading */
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1)
+        throw std::runtime_error("failed to open file: \"" + filename + "\"");
+
+    /* Determine file size */
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        throw std::runtime_error("failed to map empty file: \"" + filename + "\"");
+    }
+
+    size_ = static_cast<std::size_t>(fileStat.st_size);
+
+    /* Map entire file into memory; the mapping remains valid after the file descriptor has been closed */
+    data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data_ == MAP_FAILED)
+    {
+        data_ = nullptr;
+        throw std::runtime_error("failed to map file into memory: \"" + filename + "\"");
+    }
+
+    /* File content is mostly read front to back */
+    madvise(data_, size_, MADV_SEQUENTIAL);
+}
+
+LinuxMappedFile::~LinuxMappedFile()
+{
+    munmap(data_, size_);
+}
+
+const void* LinuxMappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t LinuxMappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,47 @@
+/*
+ * MappedFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_MAPPED_FILE_H
+#define LLGL_MAPPED_FILE_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <memory>
+#include <string>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+//! Read-only memory mapped file. The mapping stays valid for the lifetime of this object.
+class MappedFile : public NonCopyable
+{
+
+    public:
+
+        //! Maps the specified file into memory, or throws an std::runtime_error if the file could not be opened or mapped.
+        static std::unique_ptr<MappedFile> Open(const std::string& filename);
+
+        //! Returns a raw pointer to the beginning of the mapped file content.
+        virtual const void* GetData() const = 0;
+
+        //! Returns the size (in bytes) of the mapped file content.
+        virtual std::size_t GetSize() const = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,103 @@
+/*
+ * Win32MappedFile.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Win32MappedFile.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& filename)
+{
+    return std::unique_ptr<MappedFile>(new Win32MappedFile(filename));
+}
+
+Win32MappedFile::Win32MappedFile(const std::string& filename)
+{
+    /* Open file for sequential reading */
+    file_ = CreateFileA(
+        filename.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr
+    );
+
+    if (file_ == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("failed to open file: \"" + filename + "\"");
+
+    /* Determine file size */
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file_, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        ReleaseHandles();
+        throw std::runtime_error("failed to map empty file: \"" + filename + "\"");
+    }
+
+    size_ = static_cast<std::size_t>(fileSize.QuadPart);
+
+    /* Map entire file into memory */
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_ != nullptr)
+        data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+
+    if (data_ == nullptr)
+    {
+        ReleaseHandles();
+        throw std::runtime_error("failed to map file into memory: \"" + filename + "\"");
+    }
+}
+
+Win32MappedFile::~Win32MappedFile()
+{
+    ReleaseHandles();
+}
+
+const void* Win32MappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t Win32MappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void Win32MappedFile::ReleaseHandles()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+    }
+    if (mapping_ != nullptr)
+    {
+        CloseHandle(mapping_);
+        mapping_ = nullptr;
+    }
+    if (file_ != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(file_);
+        file_ = INVALID_HANDLE_VALUE;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,54 @@
+/*
+ * Win32MappedFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_WIN32_MAPPED_FILE_H
+#define LLGL_WIN32_MAPPED_FILE_H
+
+
+#include "../MappedFile.h"
+#include "Win32LeanAndMean.h"
+
+#include <Windows.h>
+
+
+namespace LLGL
+{
+
+
+class Win32MappedFile : public MappedFile
+{
+
+    public:
+
+        Win32MappedFile(const std::string& filename);
+        ~Win32MappedFile();
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        void ReleaseHandles();
+
+    private:
+
+        HANDLE      file_       = INVALID_HANDLE_VALUE;
+        HANDLE      mapping_    = nullptr;
+        LPVOID      data_       = nullptr;
+        std::size_t size_       = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,73 @@
+/*
+ * CommandQueue.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/CommandQueue.h>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+
+
+namespace LLGL
+{
+
+
+// Maximal time (in nanoseconds) to block on a single fence while waiting for any of several fences
+static const std::uint64_t g_waitAnySlice = 1000000;
+
+void CommandQueue::Signal(Fence& /*fence*/, std::uint64_t /*value*/)
+{
+    throw std::runtime_error("timeline fences are not supported by this renderer");
+}
+
+std::uint64_t CommandQueue::GetCompletedValue(Fence& /*fence*/)
+{
+    throw std::runtime_error("timeline fences are not supported by this renderer");
+}
+
+bool CommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* /*values*/, bool waitAll, std::uint64_t timeout)
+{
+    if (waitAll || numFences == 0)
+    {
+        /* Wait for each binary fence in order */
+        for (std::uint32_t i = 0; i < numFences; ++i)
+        {
+            if (!WaitFence(*fences[i], timeout))
+                return false;
+        }
+        return true;
+    }
+
+    /* Poll binary fences until any of them has been signaled, and block on one fence at a time for a bounded time slice in between */
+    const auto startTime = std::chrono::steady_clock::now();
+    for (std::uint32_t round = 0;; ++round)
+    {
+        for (std::uint32_t i = 0; i < numFences; ++i)
+        {
+            if (WaitFence(*fences[i], 0))
+                return true;
+        }
+
+        const auto elapsedTime = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+        if (elapsedTime >= timeout)
+            return false;
+
+        if (WaitFence(*fences[round % numFences], std::min(g_waitAnySlice, timeout - elapsedTime)))
+            return true;
+    }
+}
+
+void CommandQueue::WaitQueue(CommandQueue& /*otherQueue*/)
+{
+    // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
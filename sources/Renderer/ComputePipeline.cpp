@@ -0,0 +1,30 @@
+/*
+ * ComputePipeline.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/ComputePipeline.h>
+
+
+namespace LLGL
+{
+
+
+bool ComputePipeline::IsReady() const
+{
+    return true;
+}
+
+void ComputePipeline::WaitReady()
+{
+    // dummy
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -706,9 +706,28 @@ void DbgCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSiz
     LLGL_DBG_PROFILER_DO(dispatchComputeCalls.Inc());
 }
 
+/* ----- Secondary Command Buffers ----- */
+
+void DbgCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
+{
+    auto& secondaryCommandBufferDbg = LLGL_CAST(DbgCommandBuffer&, secondaryCommandBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+        AssertInsideRenderPass();
+
+        if (secondaryCommandBufferDbg.states_.recording)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot execute secondary command buffer while its recording is still active");
+    }
+
+    instance.Execute(secondaryCommandBufferDbg.instance);
+}
+
 /* ----- Extended functions ----- */
 
-void DbgCommandBuffer::EnableRecording(bool enable)
+void DbgCommandBuffer::EnableRecording(bool enable, bool secondary)
 {
     if (debugger_)
     {
@@ -721,6 +740,9 @@ void DbgCommandBuffer::EnableRecording(bool enable)
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end recording of command buffer while no recording is currently active");
         }
         states_.recording = enable;
+
+        /* Secondary command buffers are recorded entirely inside the render pass of their primary command buffer */
+        states_.insideRenderPass = (enable && secondary);
     }
 }
 
@@ -141,9 +141,13 @@ class DbgCommandBuffer : public CommandBufferExt
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
 
+        /* ----- Secondary Command Buffers ----- */
+
+        void Execute(CommandBuffer& secondaryCommandBuffer) override;
+
         /* ----- Extended functions ----- */
 
-        void EnableRecording(bool enable);
+        void EnableRecording(bool enable, bool secondary = false);
 
         /* ----- Debugging members ----- */
 
@@ -7,10 +7,13 @@
 
 #include "DbgCommandQueue.h"
 #include "DbgCommandBuffer.h"
+#include "DbgRenderContext.h"
+#include "DbgRenderTarget.h"
 #include "DbgCore.h"
 #include "../CheckedCast.h"
 #include <LLGL/RenderingProfiler.h>
 #include <LLGL/RenderingDebugger.h>
+#include <vector>
 
 
 namespace LLGL
@@ -33,7 +36,26 @@ void DbgCommandQueue::Begin(CommandBuffer& commandBuffer, long flags)
     if (debugger_)
         commandBufferDbg.EnableRecording(true);
 
-    instance.Begin(commandBufferDbg.instance);
+    instance.Begin(commandBufferDbg.instance, flags);
+}
+
+void DbgCommandQueue::BeginSecondary(CommandBuffer& commandBuffer, RenderTarget& renderTarget, const RenderPass* renderPass, long flags)
+{
+    auto& commandBufferDbg = LLGL_CAST(DbgCommandBuffer&, commandBuffer);
+
+    if (debugger_)
+        commandBufferDbg.EnableRecording(true, true);
+
+    if (renderTarget.IsRenderContext())
+    {
+        auto& renderContextDbg = LLGL_CAST(DbgRenderContext&, renderTarget);
+        instance.BeginSecondary(commandBufferDbg.instance, renderContextDbg.instance, renderPass, flags);
+    }
+    else
+    {
+        auto& renderTargetDbg = LLGL_CAST(DbgRenderTarget&, renderTarget);
+        instance.BeginSecondary(commandBufferDbg.instance, renderTargetDbg.instance, renderPass, flags);
+    }
 }
 
 void DbgCommandQueue::End(CommandBuffer& commandBuffer)
@@ -52,6 +74,20 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     instance.Submit(commandBufferDbg.instance);
 }
 
+void DbgCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Forward array of command buffer instances */
+    std::vector<CommandBuffer*> instances(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+        instances[i] = &(commandBufferDbg->instance);
+    }
+
+    instance.Submit(numCommandBuffers, instances.data());
+}
+
 /* ----- Fences ----- */
 
 void DbgCommandQueue::Submit(Fence& fence)
@@ -69,6 +105,35 @@ void DbgCommandQueue::WaitIdle()
     instance.WaitIdle();
 }
 
+void DbgCommandQueue::Signal(Fence& fence, std::uint64_t value)
+{
+    instance.Signal(fence, value);
+}
+
+std::uint64_t DbgCommandQueue::GetCompletedValue(Fence& fence)
+{
+    return instance.GetCompletedValue(fence);
+}
+
+bool DbgCommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, bool waitAll, std::uint64_t timeout)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (numFences > 0 && fences == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "array of fences must not be null");
+    }
+    return instance.WaitFences(numFences, fences, values, waitAll, timeout);
+}
+
+/* ----- Queue synchronization ----- */
+
+void DbgCommandQueue::WaitQueue(CommandQueue& otherQueue)
+{
+    auto& otherQueueDbg = LLGL_CAST(DbgCommandQueue&, otherQueue);
+    instance.WaitQueue(otherQueueDbg.instance);
+}
+
 
 } // /namespace LLGL
 
@@ -35,9 +35,18 @@ class DbgCommandQueue : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Begin(CommandBuffer& commandBuffer, long flags = 0) override;
+
+        void BeginSecondary(
+            CommandBuffer&      commandBuffer,
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass  = nullptr,
+            long                flags       = 0
+        ) override;
+
         void End(CommandBuffer& commandBuffer) override;
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
 
         /* ----- Fences ----- */
 
@@ -46,6 +55,22 @@ class DbgCommandQueue : public CommandQueue
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
         void WaitIdle() override;
 
+        void Signal(Fence& fence, std::uint64_t value) override;
+
+        std::uint64_t GetCompletedValue(Fence& fence) override;
+
+        bool WaitFences(
+            std::uint32_t           numFences,
+            Fence* const *          fences,
+            const std::uint64_t*    values,
+            bool                    waitAll,
+            std::uint64_t           timeout
+        ) override;
+
+        /* ----- Queue synchronization ----- */
+
+        void WaitQueue(CommandQueue& otherQueue) override;
+
         /* ----- Debugging members ----- */
 
         CommandQueue& instance;
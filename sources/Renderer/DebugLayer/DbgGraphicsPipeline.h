@@ -27,6 +27,16 @@ class DbgGraphicsPipeline : public GraphicsPipeline
         {
         }
 
+        bool IsReady() const override
+        {
+            return instance.IsReady();
+        }
+
+        void WaitReady() override
+        {
+            instance.WaitReady();
+        }
+
         GraphicsPipeline&                   instance;
         const GraphicsPipelineDescriptor    desc;
 
@@ -74,6 +74,25 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
     return commandQueue_.get();;
 }
 
+CommandQueue* DbgRenderSystem::GetDedicatedCommandQueue(const CommandQueueType type)
+{
+    /* Return main command queue if the instance has no dedicated queue for this type */
+    auto commandQueueDbg = LLGL_CAST(DbgCommandQueue*, GetCommandQueue());
+    auto instanceQueue = instance_->GetDedicatedCommandQueue(type);
+
+    if (instanceQueue == &(commandQueueDbg->instance))
+        return commandQueueDbg;
+
+    /* Find or instantiate dedicated command queue */
+    for (const auto& dedicatedQueue : dedicatedCommandQueues_)
+    {
+        if (&(dedicatedQueue->instance) == instanceQueue)
+            return dedicatedQueue.get();
+    }
+
+    return TakeOwnership(dedicatedCommandQueues_, MakeUnique<DbgCommandQueue>(*instanceQueue, profiler_, debugger_));
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
@@ -129,6 +148,28 @@ Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void*
     return TakeOwnership(buffers_, std::move(bufferDbg));
 }
 
+Buffer* DbgRenderSystem::CreateBufferAsync(const BufferDescriptor& desc, const void* initialData, Fence& fence)
+{
+    /* Validate and store format size (if supported) */
+    std::uint32_t formatSize = 0;
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateBufferDesc(desc, &formatSize);
+    }
+
+    /* Create buffer object */
+    auto bufferDbg = MakeUnique<DbgBuffer>(*instance_->CreateBufferAsync(desc, initialData, fence), desc.type);
+
+    /* Store settings */
+    bufferDbg->desc         = desc;
+    bufferDbg->elements     = (formatSize > 0 ? desc.size / formatSize : 0);
+    bufferDbg->initialized  = (initialData != nullptr);
+
+    return TakeOwnership(buffers_, std::move(bufferDbg));
+}
+
 BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     AssertCreateBufferArray(numBuffers, bufferArray);
@@ -239,6 +280,16 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
     return TakeOwnership(textures_, MakeUnique<DbgTexture>(*instance_->CreateTexture(textureDesc, imageDesc), textureDesc));
 }
 
+Texture* DbgRenderSystem::CreateTextureAsync(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc, Fence& fence)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateTextureDesc(textureDesc);
+    }
+    return TakeOwnership(textures_, MakeUnique<DbgTexture>(*instance_->CreateTextureAsync(textureDesc, imageDesc, fence), textureDesc));
+}
+
 void DbgRenderSystem::Release(Texture& texture)
 {
     ReleaseDbg(textures_, texture);
@@ -257,6 +308,19 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
     instance_->WriteTexture(textureDbg.instance, subTextureDesc, imageDesc);
 }
 
+void DbgRenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc, Fence& fence)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMipLevelLimit(subTextureDesc.mipLevel, textureDbg.mipLevels);
+    }
+
+    instance_->WriteTextureAsync(textureDbg.instance, subTextureDesc, imageDesc, fence);
+}
+
 void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
 {
     auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
@@ -285,6 +349,31 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel
     instance_->ReadTexture(textureDbg.instance, mipLevel, imageDesc);
 }
 
+TextureReadHandle DbgRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateMipLevelLimit(mipLevel, textureDbg.mipLevels);
+    }
+
+    return instance_->ReadTextureAsync(textureDbg.instance, mipLevel, fence);
+}
+
+void DbgRenderSystem::ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (!handle.IsValid())
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid texture read handle");
+    }
+
+    instance_->ResolveTextureRead(handle, imageDesc);
+}
+
 void DbgRenderSystem::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -316,6 +405,42 @@ void DbgRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
     instance_->GenerateMips(textureDbg.instance, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
 }
 
+void DbgRenderSystem::GenerateMipsAsync(Texture& texture, Fence& fence)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (ValidateTextureMips(textureDbg))
+            ValidateTextureMipRange(textureDbg, 0, textureDbg.mipLevels);
+    }
+
+    instance_->GenerateMipsAsync(textureDbg.instance, fence);
+}
+
+void DbgRenderSystem::GenerateMipsBatch(std::uint32_t numTextures, Texture* const * textures, Fence* fence)
+{
+    std::vector<Texture*> textureInstances;
+    textureInstances.reserve(numTextures);
+
+    for (std::uint32_t i = 0; i < numTextures; ++i)
+    {
+        auto& textureDbg = LLGL_CAST(DbgTexture&, *textures[i]);
+
+        if (debugger_)
+        {
+            LLGL_DBG_SOURCE;
+            if (ValidateTextureMips(textureDbg))
+                ValidateTextureMipRange(textureDbg, 0, textureDbg.mipLevels);
+        }
+
+        textureInstances.push_back(&(textureDbg.instance));
+    }
+
+    instance_->GenerateMipsBatch(numTextures, textureInstances.data(), fence);
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& desc)
@@ -469,40 +594,25 @@ void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
 GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
     LLGL_DBG_SOURCE;
-
-    if (debugger_)
-        ValidateGraphicsPipelineDesc(desc);
-
-    if (desc.shaderProgram)
-    {
-        auto instanceDesc = desc;
-        {
-            auto shaderProgramDbg = LLGL_CAST(const DbgShaderProgram*, desc.shaderProgram);
-            instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
-        }
-        return TakeOwnership(graphicsPipelines_, MakeUnique<DbgGraphicsPipeline>(*instance_->CreateGraphicsPipeline(instanceDesc), desc));
-    }
-    else
-        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
-
-    return nullptr;
+    return CreateGraphicsPipelineDbg(desc, false);
 }
 
 ComputePipeline* DbgRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
-    if (desc.shaderProgram)
-    {
-        auto instanceDesc = desc;
-        {
-            auto shaderProgramDbg = LLGL_CAST(DbgShaderProgram*, desc.shaderProgram);
-            instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
-        }
-        return instance_->CreateComputePipeline(instanceDesc);
-    }
-    else
-        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
+    LLGL_DBG_SOURCE;
+    return CreateComputePipelineDbg(desc, false);
+}
 
-    return nullptr;
+GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    LLGL_DBG_SOURCE;
+    return CreateGraphicsPipelineDbg(desc, true);
+}
+
+ComputePipeline* DbgRenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    LLGL_DBG_SOURCE;
+    return CreateComputePipelineDbg(desc, true);
 }
 
 void DbgRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
@@ -535,6 +645,11 @@ Fence* DbgRenderSystem::CreateFence()
     return instance_->CreateFence();
 }
 
+Fence* DbgRenderSystem::CreateTimelineFence(std::uint64_t initialValue)
+{
+    return instance_->CreateTimelineFence(initialValue);
+}
+
 void DbgRenderSystem::Release(Fence& fence)
 {
     return instance_->Release(fence);
@@ -545,6 +660,44 @@ void DbgRenderSystem::Release(Fence& fence)
  * ======= Private: =======
  */
 
+GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipelineDbg(const GraphicsPipelineDescriptor& desc, bool async)
+{
+    if (debugger_)
+        ValidateGraphicsPipelineDesc(desc);
+
+    if (desc.shaderProgram)
+    {
+        auto instanceDesc = desc;
+        {
+            auto shaderProgramDbg = LLGL_CAST(const DbgShaderProgram*, desc.shaderProgram);
+            instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
+        }
+        auto instance = (async ? instance_->CreateGraphicsPipelineAsync(instanceDesc) : instance_->CreateGraphicsPipeline(instanceDesc));
+        return TakeOwnership(graphicsPipelines_, MakeUnique<DbgGraphicsPipeline>(*instance, desc));
+    }
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
+
+    return nullptr;
+}
+
+ComputePipeline* DbgRenderSystem::CreateComputePipelineDbg(const ComputePipelineDescriptor& desc, bool async)
+{
+    if (desc.shaderProgram)
+    {
+        auto instanceDesc = desc;
+        {
+            auto shaderProgramDbg = LLGL_CAST(DbgShaderProgram*, desc.shaderProgram);
+            instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
+        }
+        return (async ? instance_->CreateComputePipelineAsync(instanceDesc) : instance_->CreateComputePipeline(instanceDesc));
+    }
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
+
+    return nullptr;
+}
+
 void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& desc, std::uint32_t* formatSize)
 {
     /* Validate (constant-) buffer size */
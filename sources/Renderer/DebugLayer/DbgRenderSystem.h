@@ -51,6 +51,7 @@ class DbgRenderSystem : public RenderSystem
         /* ----- Command queues ----- */
 
         CommandQueue* GetCommandQueue() override;
+        CommandQueue* GetDedicatedCommandQueue(const CommandQueueType type) override;
 
         /* ----- Command buffers ----- */
 
@@ -62,6 +63,7 @@ class DbgRenderSystem : public RenderSystem
         /* ----- Buffers ------ */
 
         Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) override;
+        Buffer* CreateBufferAsync(const BufferDescriptor& desc, const void* initialData, Fence& fence) override;
         BufferArray* CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray) override;
 
         void Release(Buffer& buffer) override;
@@ -75,14 +77,21 @@ class DbgRenderSystem : public RenderSystem
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+        Texture* CreateTextureAsync(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc, Fence& fence) override;
 
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) override;
+        void WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc, Fence& fence) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        TextureReadHandle ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence) override;
+        void ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
+        void GenerateMipsAsync(Texture& texture, Fence& fence) override;
+        void GenerateMipsBatch(std::uint32_t numTextures, Texture* const * textures, Fence* fence = nullptr) override;
 
         /* ----- Sampler States ---- */
 
@@ -128,6 +137,9 @@ class DbgRenderSystem : public RenderSystem
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
         ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
 
+        GraphicsPipeline* CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipelineAsync(const ComputePipelineDescriptor& desc) override;
+
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
@@ -140,11 +152,15 @@ class DbgRenderSystem : public RenderSystem
         /* ----- Fences ----- */
 
         Fence* CreateFence() override;
+        Fence* CreateTimelineFence(std::uint64_t initialValue = 0) override;
 
         void Release(Fence& fence) override;
 
     private:
 
+        GraphicsPipeline* CreateGraphicsPipelineDbg(const GraphicsPipelineDescriptor& desc, bool async);
+        ComputePipeline* CreateComputePipelineDbg(const ComputePipelineDescriptor& desc, bool async);
+
         void ValidateBufferDesc(const BufferDescriptor& desc, std::uint32_t* formatSize = nullptr);
         void ValidateBufferSize(std::uint64_t size);
         void ValidateConstantBufferSize(std::uint64_t size);
@@ -195,6 +211,7 @@ class DbgRenderSystem : public RenderSystem
 
         HWObjectContainer<DbgRenderContext>     renderContexts_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
+        HWObjectContainer<DbgCommandQueue>      dedicatedCommandQueues_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
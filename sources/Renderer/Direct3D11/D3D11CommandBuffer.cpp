@@ -12,6 +12,7 @@
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
 #include <algorithm>
+#include <stdexcept>
 
 #include "RenderState/D3D11StateManager.h"
 #include "RenderState/D3D11GraphicsPipelineBase.h"
@@ -537,6 +538,13 @@ void D3D11CommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupS
     context_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+/* ----- Secondary Command Buffers ----- */
+
+void D3D11CommandBuffer::Execute(CommandBuffer& /*secondaryCommandBuffer*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by Direct3D 11 renderer");
+}
+
 
 /*
  * ======= Private: =======
@@ -138,6 +138,10 @@ class D3D11CommandBuffer final : public CommandBufferExt
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
 
+        /* ----- Secondary Command Buffers ----- */
+
+        void Execute(CommandBuffer& secondaryCommandBuffer) override;
+
     private:
 
         struct D3D11FramebufferView
@@ -7,6 +7,7 @@
 
 #include "D3D11CommandQueue.h"
 #include "RenderState/D3D11Fence.h"
+#include <stdexcept>
 
 
 namespace LLGL
@@ -25,6 +26,11 @@ void D3D11CommandQueue::Begin(CommandBuffer& /*commandBuffer*/, long /*flags*/)
     // dummy
 }
 
+void D3D11CommandQueue::BeginSecondary(CommandBuffer& /*commandBuffer*/, RenderTarget& /*renderTarget*/, const RenderPass* /*renderPass*/, long /*flags*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by Direct3D 11 renderer");
+}
+
 void D3D11CommandQueue::End(CommandBuffer& /*commandBuffer*/)
 {
     // dummy
@@ -35,6 +41,11 @@ void D3D11CommandQueue::Submit(CommandBuffer& /*commandBuffer*/)
     // dummy
 }
 
+void D3D11CommandQueue::Submit(std::uint32_t /*numCommandBuffers*/, CommandBuffer* const * /*commandBuffers*/)
+{
+    // dummy
+}
+
 /* ----- Fences ----- */
 
 void D3D11CommandQueue::Submit(Fence& fence)
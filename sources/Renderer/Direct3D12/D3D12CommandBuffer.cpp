@@ -12,6 +12,7 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include <algorithm>
+#include <stdexcept>
 #include "D3DX12/d3dx12.h"
 
 #include "Buffer/D3D12VertexBuffer.h"
@@ -397,8 +398,20 @@ void D3D12CommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupS
     commandList_->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
 }
 
+/* ----- Secondary Command Buffers ----- */
+
+void D3D12CommandBuffer::Execute(CommandBuffer& /*secondaryCommandBuffer*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by Direct3D 12 renderer");
+}
+
 /* ----- Extended functions ----- */
 
+void D3D12CommandBuffer::SetDeferredSubmit(bool deferredSubmit)
+{
+    deferredSubmit_ = deferredSubmit;
+}
+
 void D3D12CommandBuffer::CloseCommandList()
 {
     /* Close native command list */
@@ -121,6 +121,10 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
 
+        /* ----- Secondary Command Buffers ----- */
+
+        void Execute(CommandBuffer& secondaryCommandBuffer) override;
+
         /* ----- Extended functions ----- */
 
         // Returns the native ID3D12GraphicsCommandList object.
@@ -129,6 +133,15 @@ class D3D12CommandBuffer final : public CommandBuffer
             return commandList_.Get();
         }
 
+        // Specifies whether the command list is only submitted with CommandQueue::Submit (see RecordingFlags::DeferredSubmit).
+        void SetDeferredSubmit(bool deferredSubmit);
+
+        // Returns true if the command list is not submitted automatically when its recording ends.
+        inline bool IsDeferredSubmit() const
+        {
+            return deferredSubmit_;
+        }
+
         // Closes the command list and resets internal states.
         void CloseCommandList();
 
@@ -181,6 +194,8 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         ID3D12Resource*                     boundBackBuffer_        = nullptr;  // Currently bound color buffer from D3D12RenderContext
 
+        bool                                deferredSubmit_         = false;
+
 };
 
 
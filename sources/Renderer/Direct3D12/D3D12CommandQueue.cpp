@@ -11,6 +11,8 @@
 #include "../CheckedCast.h"
 #include "../DXCommon/DXCore.h"
 #include "RenderState/D3D12Fence.h"
+#include <vector>
+#include <stdexcept>
 
 
 namespace LLGL
@@ -27,11 +29,18 @@ D3D12CommandQueue::D3D12CommandQueue(D3D12RenderSystem& renderSystem) :
 
 /* ----- Command Buffers ----- */
 
-void D3D12CommandQueue::Begin(CommandBuffer& /*commandBuffer*/, long /*flags*/)
+void D3D12CommandQueue::Begin(CommandBuffer& commandBuffer, long flags)
 {
+    auto& commandBufferD3D = LLGL_CAST(D3D12CommandBuffer&, commandBuffer);
+    commandBufferD3D.SetDeferredSubmit((flags & RecordingFlags::DeferredSubmit) != 0);
     NextCmdAllocator();
 }
 
+void D3D12CommandQueue::BeginSecondary(CommandBuffer& /*commandBuffer*/, RenderTarget& /*renderTarget*/, const RenderPass* /*renderPass*/, long /*flags*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by Direct3D 12 renderer");
+}
+
 void D3D12CommandQueue::End(CommandBuffer& commandBuffer)
 {
     /* Get native command list */
@@ -39,10 +48,8 @@ void D3D12CommandQueue::End(CommandBuffer& commandBuffer)
     commandBufferD3D.CloseCommandList();
 
     /* Submit command list if this is not a pre-recorded command buffer */
-    //if (TODO)
-    {
+    if (!commandBufferD3D.IsDeferredSubmit())
         Submit(commandBuffer);
-    }
 }
 
 void D3D12CommandQueue::Submit(CommandBuffer& commandBuffer)
@@ -59,6 +66,28 @@ void D3D12CommandQueue::Submit(CommandBuffer& commandBuffer)
     ResetCommandList(commandList);
 }
 
+void D3D12CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Gather native command lists */
+    std::vector<ID3D12CommandList*> cmdLists(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferD3D = LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i]);
+        cmdLists[i] = commandBufferD3D->GetNative();
+    }
+
+    /* Execute all command lists at once */
+    cmdQueue_->ExecuteCommandLists(numCommandBuffers, cmdLists.data());
+
+    /* Reset command lists */
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferD3D = LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i]);
+        ResetCommandList(commandBufferD3D->GetNative());
+    }
+}
+
 /* ----- Fences ----- */
 
 void D3D12CommandQueue::Submit(Fence& fence)
@@ -64,11 +64,16 @@ enum class GLExt
     ARB_texture_storage,
     ARB_texture_storage_multisample,
     ARB_buffer_storage,
+    ARB_map_buffer_range,
+    ARB_invalidate_subdata,
     ARB_direct_state_access,
     ARB_polygon_offset_clamp,
     ARB_texture_view,
     ARB_shader_image_load_store,
     ARB_framebuffer_no_attachments,
+    ARB_vertex_attrib_binding,
+    ARB_separate_shader_objects,
+    KHR_parallel_shader_compile,
 
     /* Extensions without procedures */
     ARB_texture_cube_map,
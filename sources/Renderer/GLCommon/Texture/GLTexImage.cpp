@@ -27,16 +27,6 @@ void GLTexImageInitialization(const ImageInitialization& imageInitialization)
     g_imageInitialization = imageInitialization;
 }
 
-static std::vector<ColorRGBAf> GenImageDataRGBAf(std::uint32_t numPixels, const ColorRGBAf& color)
-{
-    return std::vector<ColorRGBAf>(static_cast<std::size_t>(numPixels), color);
-}
-
-static std::vector<float> GenImageDataRf(std::uint32_t numPixels, float value)
-{
-    return std::vector<float>(static_cast<std::size_t>(numPixels), value);
-}
-
 [[noreturn]]
 static void ErrIllegalUseOfDepthFormat()
 {
@@ -60,6 +50,196 @@ static bool IsSecondaryCubeFaceTarget(GLenum target)
 
 #endif // /GL_ARB_texture_storage
 
+/* ----- Default initialization ----- */
+
+// Maximal number of texels of the intermediate buffer that is used to initialize textures without GL_ARB_clear_texture
+static const std::uint32_t g_maxFillTileSize = 16384;
+
+#ifdef GL_ARB_clear_texture
+
+static GLenum GetTextureBindingTarget(const TextureType type)
+{
+    switch (type)
+    {
+        case TextureType::Texture1D:        return GL_TEXTURE_BINDING_1D;
+        case TextureType::Texture2D:        return GL_TEXTURE_BINDING_2D;
+        case TextureType::Texture3D:        return GL_TEXTURE_BINDING_3D;
+        case TextureType::TextureCube:      return GL_TEXTURE_BINDING_CUBE_MAP;
+        case TextureType::Texture1DArray:   return GL_TEXTURE_BINDING_1D_ARRAY;
+        case TextureType::Texture2DArray:   return GL_TEXTURE_BINDING_2D_ARRAY;
+        case TextureType::TextureCubeArray: return GL_TEXTURE_BINDING_CUBE_MAP_ARRAY;
+        default:                            return 0;
+    }
+}
+
+// Clears all MIP levels of the currently bound texture with the default clear value (requires GL_ARB_clear_texture)
+static void GLClearTexImageDefault(const TextureDescriptor& desc)
+{
+    GLint texID = 0;
+    glGetIntegerv(GetTextureBindingTarget(desc.type), &texID);
+
+    const auto  texture         = static_cast<GLuint>(texID);
+    const auto  numMipLevels    = NumMipLevels(desc);
+    const auto& clearValue      = g_imageInitialization.clearValue;
+
+    if (desc.format == Format::D24UNormS8UInt)
+    {
+        /* Clear with packed 24-bit depth and 8-bit stencil value */
+        const auto depth = static_cast<GLuint>(std::max(0.0f, std::min(clearValue.depth, 1.0f)) * 16777215.0f);
+        const GLuint value = ((depth << 8) | (clearValue.stencil & 0xFF));
+        for (std::uint32_t i = 0; i < numMipLevels; ++i)
+            glClearTexImage(texture, static_cast<GLint>(i), GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, &value);
+    }
+    else if (desc.format == Format::D32FloatS8X24UInt)
+    {
+        /* Clear with 32-bit float depth and 8-bit stencil value (padded to 24 bits) */
+        const struct
+        {
+            GLfloat depth;
+            GLuint  stencil;
+        }
+        value { clearValue.depth, (clearValue.stencil & 0xFF) };
+
+        for (std::uint32_t i = 0; i < numMipLevels; ++i)
+            glClearTexImage(texture, static_cast<GLint>(i), GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, &value);
+    }
+    else if (IsDepthStencilFormat(desc.format))
+    {
+        /* Clear with depth value */
+        for (std::uint32_t i = 0; i < numMipLevels; ++i)
+            glClearTexImage(texture, static_cast<GLint>(i), GL_DEPTH_COMPONENT, GL_FLOAT, &(clearValue.depth));
+    }
+    else
+    {
+        /* Clear with color value */
+        for (std::uint32_t i = 0; i < numMipLevels; ++i)
+            glClearTexImage(texture, static_cast<GLint>(i), GL_RGBA, GL_FLOAT, clearValue.color.Ptr());
+    }
+}
+
+#endif // /GL_ARB_clear_texture
+
+// Writes the specified number of rows and slices of a MIP level from the tile buffer, which is reused for all sub-regions
+template <typename T>
+static void GLTexSubImageFillTiled(
+    const TextureDescriptor&    desc,
+    std::vector<T>&             tile,
+    GLint                       mipLevel,
+    std::uint32_t               width,
+    std::uint32_t               height,
+    std::uint32_t               depth,
+    GLenum                      format)
+{
+    const auto rowsPerTile  = std::max(1u, static_cast<std::uint32_t>(tile.size()) / width);
+    const auto sx           = static_cast<GLsizei>(width);
+
+    for (std::uint32_t z = 0; z < depth; ++z)
+    {
+        for (std::uint32_t y = 0; y < height; y += rowsPerTile)
+        {
+            const auto sy = static_cast<GLsizei>(std::min(rowsPerTile, height - y));
+            const auto oy = static_cast<GLint>(y);
+            const auto oz = static_cast<GLint>(z);
+
+            switch (desc.type)
+            {
+                #ifdef LLGL_OPENGL
+                case TextureType::Texture1D:
+                    glTexSubImage1D(GL_TEXTURE_1D, mipLevel, 0, sx, format, GL_FLOAT, tile.data());
+                    break;
+                case TextureType::Texture1DArray:
+                    glTexSubImage2D(GL_TEXTURE_1D_ARRAY, mipLevel, 0, oy, sx, sy, format, GL_FLOAT, tile.data());
+                    break;
+                case TextureType::TextureCubeArray:
+                    glTexSubImage3D(GL_TEXTURE_CUBE_MAP_ARRAY, mipLevel, 0, oy, oz, sx, sy, 1, format, GL_FLOAT, tile.data());
+                    break;
+                #endif
+                case TextureType::Texture2D:
+                    glTexSubImage2D(GL_TEXTURE_2D, mipLevel, 0, oy, sx, sy, format, GL_FLOAT, tile.data());
+                    break;
+                case TextureType::TextureCube:
+                    glTexSubImage2D(GLTypes::ToTextureCubeMap(z), mipLevel, 0, oy, sx, sy, format, GL_FLOAT, tile.data());
+                    break;
+                case TextureType::Texture3D:
+                    glTexSubImage3D(GL_TEXTURE_3D, mipLevel, 0, oy, oz, sx, sy, 1, format, GL_FLOAT, tile.data());
+                    break;
+                case TextureType::Texture2DArray:
+                    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, mipLevel, 0, oy, oz, sx, sy, 1, format, GL_FLOAT, tile.data());
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+/*
+Initializes all MIP levels and array layers of the currently bound texture with the specified value,
+using a small tile buffer instead of a buffer for the entire image.
+*/
+template <typename T>
+static void GLTexImageFillTiled(const TextureDescriptor& desc, GLenum format, const T& value)
+{
+    /* Allocate tile buffer that is large enough for at least one row */
+    std::vector<T> tile(std::max(g_maxFillTileSize, desc.extent.width), value);
+
+    auto width  = desc.extent.width;
+    auto height = desc.extent.height;
+    auto depth  = desc.extent.depth;
+
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:
+            height  = 1;
+            depth   = 1;
+            break;
+        case TextureType::Texture1DArray:
+            height  = desc.arrayLayers;
+            depth   = 1;
+            break;
+        case TextureType::Texture2D:
+            depth   = 1;
+            break;
+        case TextureType::TextureCube:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCubeArray:
+            depth   = desc.arrayLayers;
+            break;
+        default:
+            break;
+    }
+
+    for (std::uint32_t i = 0, n = NumMipLevels(desc); i < n; ++i)
+    {
+        GLTexSubImageFillTiled(desc, tile, static_cast<GLint>(i), width, height, depth, format);
+
+        /* Reduce extent for next MIP level (array layers are not reduced) */
+        width = std::max(1u, width / 2u);
+        if (desc.type != TextureType::Texture1DArray)
+            height = std::max(1u, height / 2u);
+        if (desc.type == TextureType::Texture3D)
+            depth = std::max(1u, depth / 2u);
+    }
+}
+
+// Initializes all MIP levels of the currently bound texture with the default clear value
+static void GLTexImageInitialize(const TextureDescriptor& desc)
+{
+    #ifdef GL_ARB_clear_texture
+    if (HasExtension(GLExt::ARB_clear_texture))
+    {
+        GLClearTexImageDefault(desc);
+        return;
+    }
+    #endif
+
+    //TODO: add support for default initialization of stencil values
+    if (IsDepthStencilFormat(desc.format))
+        GLTexImageFillTiled(desc, GL_DEPTH_COMPONENT, g_imageInitialization.clearValue.depth);
+    else
+        GLTexImageFillTiled(desc, GL_RGBA, g_imageInitialization.clearValue.color);
+}
+
 /* ----- Back-end OpenGL functions ----- */
 
 #ifdef LLGL_OPENGL
@@ -453,7 +633,7 @@ void GLTexImage1D(const TextureDescriptor& desc, const SrcImageDescriptor* image
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage1D(
@@ -464,19 +644,10 @@ void GLTexImage1D(const TextureDescriptor& desc, const SrcImageDescriptor* image
             GL_UNSIGNED_BYTE,
             nullptr
         );
-    }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width, g_imageInitialization.clearValue.color);
-        GLTexImage1D(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
+
+        /* Initialize all MIP levels with default color */
+        if (!IsCompressedFormat(desc.format) && g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
 }
 
@@ -500,61 +671,37 @@ void GLTexImage2D(const TextureDescriptor& desc, const SrcImageDescriptor* image
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
-        {
-            //TODO: add support for default initialization of stencil values
-            /* Initialize depth texture image with default depth */
-            auto image = GenImageDataRf(desc.extent.width * desc.extent.height, g_imageInitialization.clearValue.depth);
-            GLTexImage2D(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                image.data()
-            );
-        }
-        else
-        {
-            /* Allocate depth texture image without initial data */
-            GLTexImage2D(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                nullptr
-            );
-        }
-    }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
-    {
-        /* Allocate texture without initial data */
+        /* Allocate depth texture image without initial data */
         GLTexImage2D(
             NumMipLevels(desc),
             desc.format,
             desc.extent.width,
             desc.extent.height,
-            GL_RGBA,
-            GL_UNSIGNED_BYTE,
+            GL_DEPTH_COMPONENT,
+            GL_FLOAT,
             nullptr
         );
+
+        /* Initialize all MIP levels with default depth */
+        if (g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height, g_imageInitialization.clearValue.color);
+        /* Allocate texture without initial data */
         GLTexImage2D(
             NumMipLevels(desc),
             desc.format,
             desc.extent.width,
             desc.extent.height,
             GL_RGBA,
-            GL_FLOAT,
-            image.data()
+            GL_UNSIGNED_BYTE,
+            nullptr
         );
+
+        /* Initialize all MIP levels with default color */
+        if (!IsCompressedFormat(desc.format) && g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
 }
 
@@ -580,7 +727,7 @@ void GLTexImage3D(const TextureDescriptor& desc, const SrcImageDescriptor* image
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage3D(
@@ -593,21 +740,10 @@ void GLTexImage3D(const TextureDescriptor& desc, const SrcImageDescriptor* image
             GL_UNSIGNED_BYTE,
             nullptr
         );
-    }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height * desc.extent.depth, g_imageInitialization.clearValue.color);
-        GLTexImage3D(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            desc.extent.height,
-            desc.extent.depth,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
+
+        /* Initialize all MIP levels with default color */
+        if (!IsCompressedFormat(desc.format) && g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
 }
 
@@ -648,7 +784,7 @@ void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* ima
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         for (std::uint32_t arrayLayer = 0; arrayLayer < desc.arrayLayers; ++arrayLayer)
@@ -664,24 +800,10 @@ void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* ima
                 nullptr
             );
         }
-    }
-    else
-    {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height, g_imageInitialization.clearValue.color);
-        for (std::uint32_t arrayLayer = 0; arrayLayer < desc.arrayLayers; ++arrayLayer)
-        {
-            GLTexImageCube(
-                numMipLevels,
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                arrayLayer,
-                GL_RGBA,
-                GL_FLOAT,
-                image.data()
-            );
-        }
+
+        /* Initialize all MIP levels with default color */
+        if (!IsCompressedFormat(desc.format) && g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
 }
 
@@ -708,7 +830,7 @@ void GLTexImage1DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage1DArray(
@@ -720,20 +842,10 @@ void GLTexImage1DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
             GL_UNSIGNED_BYTE,
             nullptr
         );
-    }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.arrayLayers, g_imageInitialization.clearValue.color);
-        GLTexImage1DArray(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            desc.arrayLayers,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
+
+        /* Initialize all MIP levels with default color */
+        if (!IsCompressedFormat(desc.format) && g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
 }
 
@@ -758,54 +870,25 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
-        {
-            /* Initialize depth texture image with default depth */
-            auto image = GenImageDataRf(desc.extent.width * desc.extent.height * desc.arrayLayers, g_imageInitialization.clearValue.depth);
-            GLTexImage2DArray(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                desc.arrayLayers,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                image.data()
-            );
-        }
-        else
-        {
-            /* Allocate depth texture image without initial data */
-            GLTexImage2DArray(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                desc.arrayLayers,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                nullptr
-            );
-        }
-    }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
-    {
-        /* Allocate texture without initial data */
+        /* Allocate depth texture image without initial data */
         GLTexImage2DArray(
             NumMipLevels(desc),
             desc.format,
             desc.extent.width,
             desc.extent.height,
             desc.arrayLayers,
-            GL_RGBA,
-            GL_UNSIGNED_BYTE,
+            GL_DEPTH_COMPONENT,
+            GL_FLOAT,
             nullptr
         );
+
+        /* Initialize all MIP levels with default depth */
+        if (g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height * desc.arrayLayers, g_imageInitialization.clearValue.color);
+        /* Allocate texture without initial data */
         GLTexImage2DArray(
             NumMipLevels(desc),
             desc.format,
@@ -813,9 +896,13 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
             desc.extent.height,
             desc.arrayLayers,
             GL_RGBA,
-            GL_FLOAT,
-            image.data()
+            GL_UNSIGNED_BYTE,
+            nullptr
         );
+
+        /* Initialize all MIP levels with default color */
+        if (!IsCompressedFormat(desc.format) && g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
 }
 
@@ -843,7 +930,7 @@ void GLTexImageCubeArray(const TextureDescriptor& desc, const SrcImageDescriptor
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImageCubeArray(
@@ -856,21 +943,10 @@ void GLTexImageCubeArray(const TextureDescriptor& desc, const SrcImageDescriptor
             GL_UNSIGNED_BYTE,
             nullptr
         );
-    }
-    else
-    {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height * desc.arrayLayers, g_imageInitialization.clearValue.color);
-        GLTexImageCubeArray(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            desc.extent.height,
-            desc.arrayLayers,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
+
+        /* Initialize all MIP levels with default color */
+        if (!IsCompressedFormat(desc.format) && g_imageInitialization.enabled)
+            GLTexImageInitialize(desc);
     }
 }
 
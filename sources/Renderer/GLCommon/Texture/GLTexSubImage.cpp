@@ -327,6 +327,132 @@ void GLTexSubImageCubeArray(const SubTextureDescriptor& desc, const SrcImageDesc
     );
 }
 
+#if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+
+static void GLTextureSubImage1D(GLuint texID, const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+    {
+        glCompressedTextureSubImage1D(
+            texID,
+            static_cast<GLint>(desc.mipLevel),
+            desc.offset.x,
+            static_cast<GLsizei>(desc.extent.width),
+            GLTypes::Map(imageDesc.format),
+            static_cast<GLsizei>(imageDesc.dataSize),
+            imageDesc.data
+        );
+    }
+    else
+    {
+        glTextureSubImage1D(
+            texID,
+            static_cast<GLint>(desc.mipLevel),
+            desc.offset.x,
+            static_cast<GLsizei>(desc.extent.width),
+            GLTypes::Map(imageDesc.format),
+            GLTypes::Map(imageDesc.dataType),
+            imageDesc.data
+        );
+    }
+}
+
+static void GLTextureSubImage2D(GLuint texID, const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+    {
+        glCompressedTextureSubImage2D(
+            texID,
+            static_cast<GLint>(desc.mipLevel),
+            desc.offset.x,
+            desc.offset.y,
+            static_cast<GLsizei>(desc.extent.width),
+            static_cast<GLsizei>(desc.extent.height),
+            GLTypes::Map(imageDesc.format),
+            static_cast<GLsizei>(imageDesc.dataSize),
+            imageDesc.data
+        );
+    }
+    else
+    {
+        glTextureSubImage2D(
+            texID,
+            static_cast<GLint>(desc.mipLevel),
+            desc.offset.x,
+            desc.offset.y,
+            static_cast<GLsizei>(desc.extent.width),
+            static_cast<GLsizei>(desc.extent.height),
+            GLTypes::Map(imageDesc.format),
+            GLTypes::Map(imageDesc.dataType),
+            imageDesc.data
+        );
+    }
+}
+
+static void GLTextureSubImage3D(GLuint texID, const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc)
+{
+    if (IsCompressedFormat(imageDesc.format))
+    {
+        glCompressedTextureSubImage3D(
+            texID,
+            static_cast<GLint>(desc.mipLevel),
+            desc.offset.x,
+            desc.offset.y,
+            desc.offset.z,
+            static_cast<GLsizei>(desc.extent.width),
+            static_cast<GLsizei>(desc.extent.height),
+            static_cast<GLsizei>(desc.extent.depth),
+            GLTypes::Map(imageDesc.format),
+            static_cast<GLsizei>(imageDesc.dataSize),
+            imageDesc.data
+        );
+    }
+    else
+    {
+        glTextureSubImage3D(
+            texID,
+            static_cast<GLint>(desc.mipLevel),
+            desc.offset.x,
+            desc.offset.y,
+            desc.offset.z,
+            static_cast<GLsizei>(desc.extent.width),
+            static_cast<GLsizei>(desc.extent.height),
+            static_cast<GLsizei>(desc.extent.depth),
+            GLTypes::Map(imageDesc.format),
+            GLTypes::Map(imageDesc.dataType),
+            imageDesc.data
+        );
+    }
+}
+
+void GLTextureSubImage(GLuint texID, const TextureType type, const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc)
+{
+    switch (type)
+    {
+        case TextureType::Texture1D:
+            GLTextureSubImage1D(texID, desc, imageDesc);
+            break;
+
+        case TextureType::Texture2D:
+        case TextureType::Texture1DArray:
+            GLTextureSubImage2D(texID, desc, imageDesc);
+            break;
+
+        case TextureType::Texture3D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            /* With DSA, cube faces are addressed as array layers of a 2D array texture */
+            GLTextureSubImage3D(texID, desc, imageDesc);
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif // /GL_ARB_direct_state_access
+
 #endif
 
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/ImageFlags.h>
 #include <LLGL/TextureFlags.h>
+#include "../GLImport.h"
 
 
 namespace LLGL
@@ -27,6 +28,13 @@ void GLTexSubImage1DArray(const SubTextureDescriptor& desc, const SrcImageDescri
 void GLTexSubImage2DArray(const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc);
 void GLTexSubImageCubeArray(const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc);
 
+#if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+
+// Writes the texture sub data via direct state access (GL_ARB_direct_state_access), i.e. the texture does not need to be bound.
+void GLTextureSubImage(GLuint texID, const TextureType type, const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc);
+
+#endif
+
 #else
 
 void GLTexSubImage2D(const SubTextureDescriptor& desc, const SrcImageDescriptor& imageDesc);
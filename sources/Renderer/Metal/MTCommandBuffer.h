@@ -128,6 +128,10 @@ class MTCommandBuffer : public CommandBufferExt
         /* ----- Compute ----- */
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
+
+        /* ----- Secondary Command Buffers ----- */
+
+        void Execute(CommandBuffer& secondaryCommandBuffer) override;
     
         /* ----- Extended functions ----- */
     
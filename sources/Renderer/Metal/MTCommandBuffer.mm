@@ -16,6 +16,7 @@
 #include "Texture/MTSampler.h"
 #include "../CheckedCast.h"
 #include <algorithm>
+#include <stdexcept>
 
 
 namespace LLGL
@@ -712,6 +713,13 @@ void MTCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSize
     //todo
 }
 
+/* ----- Secondary Command Buffers ----- */
+
+void MTCommandBuffer::Execute(CommandBuffer& /*secondaryCommandBuffer*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by Metal renderer");
+}
+
 /* ----- Extended functions ----- */
 
 void MTCommandBuffer::NextCommandBuffer(id<MTLCommandQueue> cmdQueue)
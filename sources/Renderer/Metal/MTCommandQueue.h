@@ -31,9 +31,18 @@ class MTCommandQueue : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Begin(CommandBuffer& commandBuffer, long flags = 0) override;
+
+        void BeginSecondary(
+            CommandBuffer&      commandBuffer,
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass  = nullptr,
+            long                flags       = 0
+        ) override;
+
         void End(CommandBuffer& commandBuffer) override;
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
 
         /* ----- Fences ----- */
 
@@ -8,6 +8,7 @@
 #include "MTCommandQueue.h"
 #include "MTCommandBuffer.h"
 #include "../CheckedCast.h"
+#include <stdexcept>
 
 
 namespace LLGL
@@ -32,6 +33,11 @@ void MTCommandQueue::Begin(CommandBuffer& commandBuffer, long /*flags*/)
     commandBufferMT.NextCommandBuffer(queue_);
 }
 
+void MTCommandQueue::BeginSecondary(CommandBuffer& /*commandBuffer*/, RenderTarget& /*renderTarget*/, const RenderPass* /*renderPass*/, long /*flags*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by Metal renderer");
+}
+
 void MTCommandQueue::End(CommandBuffer& commandBuffer)
 {
     //todo
@@ -42,6 +48,12 @@ void MTCommandQueue::Submit(CommandBuffer& commandBuffer)
     //todo
 }
 
+void MTCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+        Submit(*commandBuffers[i]);
+}
+
 /* ----- Fences ----- */
 
 void MTCommandQueue::Submit(Fence& fence)
@@ -0,0 +1,604 @@
+/*
+ * ObjectCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/ObjectCache.h>
+#include <LLGL/RenderSystem.h>
+#include "../Core/Helper.h"
+#include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+
+namespace LLGL
+{
+
+
+// Returns the 64-bit FNV-1a hash of the specified data. This is stable across platforms and runs, unlike std::hash.
+static std::uint64_t HashFNV1a(const void* data, std::size_t size)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/*
+ * Internal helper to serialize descriptors into a canonical byte sequence.
+ * Fields are appended one by one (never entire structs), so padding bytes never contribute to the key.
+ */
+class DescriptorKeyWriter
+{
+
+    public:
+
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value, "DescriptorKeyWriter::Write only accepts scalar types");
+            auto bytes = reinterpret_cast<const char*>(&value);
+            key_.insert(key_.end(), bytes, bytes + sizeof(T));
+        }
+
+        void WriteBytes(const void* data, std::size_t size)
+        {
+            Write(static_cast<std::uint64_t>(size));
+            auto bytes = reinterpret_cast<const char*>(data);
+            key_.insert(key_.end(), bytes, bytes + size);
+        }
+
+        void WriteString(const char* str)
+        {
+            if (str != nullptr)
+                WriteBytes(str, std::strlen(str));
+            else
+                Write(~0ull);
+        }
+
+        // Returns the 64-bit FNV-1a hash of the key.
+        std::uint64_t Hash() const
+        {
+            return HashFNV1a(key_.data(), key_.size());
+        }
+
+        std::vector<char>& GetKey()
+        {
+            return key_;
+        }
+
+    private:
+
+        std::vector<char> key_;
+
+};
+
+static void WriteKey(DescriptorKeyWriter& writer, const std::vector<SpecializationConstant>& constants)
+{
+    writer.Write(static_cast<std::uint64_t>(constants.size()));
+    for (const auto& constant : constants)
+    {
+        writer.Write(constant.constantID);
+        writer.WriteString(constant.name);
+        writer.Write(constant.type);
+
+        /* Write only the active union member, so unused bytes never contribute to the key */
+        if (constant.type == UniformType::Double1)
+            writer.Write(constant.value.f64);
+        else
+            writer.Write(constant.value.u32);
+    }
+}
+
+static void WriteKey(DescriptorKeyWriter& writer, const ShaderDescriptor& desc, std::uint64_t fileContentHash)
+{
+    writer.Write(desc.type);
+    writer.Write(desc.sourceType);
+
+    /* Write shader code by content, so the same code from different files is detected; files are written by their content hash only */
+    switch (desc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+            if (desc.sourceSize > 0)
+                writer.WriteBytes(desc.source, desc.sourceSize);
+            else
+                writer.WriteString(desc.source);
+            break;
+
+        case ShaderSourceType::BinaryBuffer:
+            writer.WriteBytes(desc.source, desc.sourceSize);
+            break;
+
+        case ShaderSourceType::CodeFile:
+        case ShaderSourceType::BinaryFile:
+            writer.Write(fileContentHash);
+            break;
+    }
+
+    writer.WriteString(desc.entryPoint);
+    writer.WriteString(desc.profile);
+    writer.Write(desc.flags);
+
+    const auto& streamOutputFormat = desc.streamOutput.format;
+    writer.Write(static_cast<std::uint64_t>(streamOutputFormat.attributes.size()));
+
+    for (const auto& attrib : streamOutputFormat.attributes)
+    {
+        writer.WriteString(attrib.name.c_str());
+        writer.Write(attrib.stream);
+        writer.Write(attrib.startComponent);
+        writer.Write(attrib.components);
+        writer.Write(attrib.semanticIndex);
+        writer.Write(attrib.outputSlot);
+    }
+
+    WriteKey(writer, desc.specializationConstants);
+}
+
+static void WriteKey(DescriptorKeyWriter& writer, const VertexFormat& desc)
+{
+    writer.Write(static_cast<std::uint64_t>(desc.attributes.size()));
+    for (const auto& attrib : desc.attributes)
+    {
+        writer.WriteString(attrib.name.c_str());
+        writer.Write(attrib.format);
+        writer.Write(attrib.instanceDivisor);
+        writer.Write(attrib.offset);
+        writer.Write(attrib.semanticIndex);
+    }
+    writer.Write(desc.stride);
+    writer.Write(desc.inputSlot);
+}
+
+static void WriteKey(DescriptorKeyWriter& writer, const SamplerDescriptor& desc)
+{
+    writer.Write(desc.addressModeU);
+    writer.Write(desc.addressModeV);
+    writer.Write(desc.addressModeW);
+    writer.Write(desc.minFilter);
+    writer.Write(desc.magFilter);
+    writer.Write(desc.mipMapFilter);
+    writer.Write(desc.mipMapping);
+    writer.Write(desc.mipMapLODBias);
+    writer.Write(desc.minLOD);
+    writer.Write(desc.maxLOD);
+    writer.Write(desc.maxAnisotropy);
+    writer.Write(desc.compareEnabled);
+    writer.Write(desc.compareOp);
+    writer.Write(desc.borderColor.r);
+    writer.Write(desc.borderColor.g);
+    writer.Write(desc.borderColor.b);
+    writer.Write(desc.borderColor.a);
+}
+
+static void WriteKey(DescriptorKeyWriter& writer, const AttachmentFormatDescriptor& desc)
+{
+    writer.Write(desc.format);
+    writer.Write(desc.loadOp);
+    writer.Write(desc.storeOp);
+}
+
+static void WriteKey(DescriptorKeyWriter& writer, const RenderPassDescriptor& desc)
+{
+    writer.Write(static_cast<std::uint64_t>(desc.colorAttachments.size()));
+    for (const auto& attachment : desc.colorAttachments)
+        WriteKey(writer, attachment);
+    WriteKey(writer, desc.depthAttachment);
+    WriteKey(writer, desc.stencilAttachment);
+}
+
+static void WriteKey(DescriptorKeyWriter& writer, const StencilFaceDescriptor& desc)
+{
+    writer.Write(desc.stencilFailOp);
+    writer.Write(desc.depthFailOp);
+    writer.Write(desc.depthPassOp);
+    writer.Write(desc.compareOp);
+    writer.Write(desc.readMask);
+    writer.Write(desc.writeMask);
+    writer.Write(desc.reference);
+}
+
+static void WriteKey(DescriptorKeyWriter& writer, const GraphicsPipelineDescriptor& desc)
+{
+    /* Write referenced objects by identity */
+    writer.Write(desc.shaderProgram);
+    writer.Write(desc.renderPass);
+    writer.Write(desc.pipelineLayout);
+    writer.Write(desc.primitiveTopology);
+
+    /* Write static viewports and scissors */
+    writer.Write(static_cast<std::uint64_t>(desc.viewports.size()));
+    for (const auto& viewport : desc.viewports)
+    {
+        writer.Write(viewport.x);
+        writer.Write(viewport.y);
+        writer.Write(viewport.width);
+        writer.Write(viewport.height);
+        writer.Write(viewport.minDepth);
+        writer.Write(viewport.maxDepth);
+    }
+
+    writer.Write(static_cast<std::uint64_t>(desc.scissors.size()));
+    for (const auto& scissor : desc.scissors)
+    {
+        writer.Write(scissor.x);
+        writer.Write(scissor.y);
+        writer.Write(scissor.width);
+        writer.Write(scissor.height);
+    }
+
+    /* Write depth and stencil states */
+    writer.Write(desc.depth.testEnabled);
+    writer.Write(desc.depth.writeEnabled);
+    writer.Write(desc.depth.compareOp);
+
+    writer.Write(desc.stencil.testEnabled);
+    WriteKey(writer, desc.stencil.front);
+    WriteKey(writer, desc.stencil.back);
+
+    /* Write rasterizer state */
+    const auto& rasterizer = desc.rasterizer;
+    writer.Write(rasterizer.polygonMode);
+    writer.Write(rasterizer.cullMode);
+    writer.Write(rasterizer.depthBias.constantFactor);
+    writer.Write(rasterizer.depthBias.slopeFactor);
+    writer.Write(rasterizer.depthBias.clamp);
+    writer.Write(rasterizer.multiSampling.enabled);
+    writer.Write(rasterizer.multiSampling.samples);
+    writer.Write(rasterizer.frontCCW);
+    writer.Write(rasterizer.depthClampEnabled);
+    writer.Write(rasterizer.scissorTestEnabled);
+    writer.Write(rasterizer.antiAliasedLineEnabled);
+    writer.Write(rasterizer.conservativeRasterization);
+    writer.Write(rasterizer.lineWidth);
+
+    /* Write blend state */
+    const auto& blend = desc.blend;
+    writer.Write(blend.blendEnabled);
+    writer.Write(blend.blendFactor.r);
+    writer.Write(blend.blendFactor.g);
+    writer.Write(blend.blendFactor.b);
+    writer.Write(blend.blendFactor.a);
+    writer.Write(blend.alphaToCoverageEnabled);
+    writer.Write(blend.logicOp);
+
+    writer.Write(static_cast<std::uint64_t>(blend.targets.size()));
+    for (const auto& target : blend.targets)
+    {
+        writer.Write(target.srcColor);
+        writer.Write(target.dstColor);
+        writer.Write(target.colorArithmetic);
+        writer.Write(target.srcAlpha);
+        writer.Write(target.dstAlpha);
+        writer.Write(target.alphaArithmetic);
+        writer.Write(target.colorMask.r);
+        writer.Write(target.colorMask.g);
+        writer.Write(target.colorMask.b);
+        writer.Write(target.colorMask.a);
+    }
+
+    WriteKey(writer, desc.specializationConstants);
+}
+
+
+ObjectCache::ObjectCache(RenderSystem& renderSystem) :
+    renderSystem_ { renderSystem }
+{
+}
+
+ObjectCache::~ObjectCache()
+{
+    Clear();
+}
+
+Shader* ObjectCache::CreateShader(const ShaderDescriptor& desc)
+{
+    std::uint64_t fileContentHash = 0;
+    if (desc.sourceType == ShaderSourceType::CodeFile || desc.sourceType == ShaderSourceType::BinaryFile)
+        fileContentHash = HashShaderFile(desc.source);
+
+    DescriptorKeyWriter writer;
+    WriteKey(writer, desc, fileContentHash);
+
+    auto hash = writer.Hash();
+    if (auto object = Find(shaders_, hash, writer.GetKey(), statistics_.shaders))
+        return static_cast<Shader*>(object);
+
+    auto shader = renderSystem_.CreateShader(desc);
+    Insert(shaders_, hash, std::move(writer.GetKey()), shader, statistics_.shaders);
+    return shader;
+}
+
+ShaderProgram* ObjectCache::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    Shader* shaders[] =
+    {
+        desc.vertexShader,
+        desc.tessControlShader,
+        desc.tessEvaluationShader,
+        desc.geometryShader,
+        desc.fragmentShader,
+        desc.computeShader,
+    };
+
+    DescriptorKeyWriter writer;
+
+    /* Write shaders that were created by this cache by their hash, and all other shaders by identity */
+    for (auto shader : shaders)
+    {
+        auto hashIt = objectHashes_.find(shader);
+        if (shader != nullptr && hashIt != objectHashes_.end())
+        {
+            writer.Write(true);
+            writer.Write(hashIt->second);
+        }
+        else
+        {
+            writer.Write(false);
+            writer.Write(shader);
+        }
+    }
+
+    writer.Write(static_cast<std::uint64_t>(desc.vertexFormats.size()));
+    for (const auto& vertexFormat : desc.vertexFormats)
+        WriteKey(writer, vertexFormat);
+
+    auto hash = writer.Hash();
+    if (auto object = Find(shaderPrograms_, hash, writer.GetKey(), statistics_.shaderPrograms))
+        return static_cast<ShaderProgram*>(object);
+
+    auto shaderProgram = renderSystem_.CreateShaderProgram(desc);
+    auto& entry = Insert(shaderPrograms_, hash, std::move(writer.GetKey()), shaderProgram, statistics_.shaderPrograms);
+
+    /* Retain cached shaders, so their hashes keep referring to the shaders this program was linked with */
+    for (auto shader : shaders)
+    {
+        if (shader != nullptr && RefShader(shader))
+            entry.shaders.push_back(shader);
+    }
+
+    return shaderProgram;
+}
+
+Sampler* ObjectCache::CreateSampler(const SamplerDescriptor& desc)
+{
+    DescriptorKeyWriter writer;
+    WriteKey(writer, desc);
+
+    auto hash = writer.Hash();
+    if (auto object = Find(samplers_, hash, writer.GetKey(), statistics_.samplers))
+        return static_cast<Sampler*>(object);
+
+    auto sampler = renderSystem_.CreateSampler(desc);
+    Insert(samplers_, hash, std::move(writer.GetKey()), sampler, statistics_.samplers);
+    return sampler;
+}
+
+RenderPass* ObjectCache::CreateRenderPass(const RenderPassDescriptor& desc)
+{
+    DescriptorKeyWriter writer;
+    WriteKey(writer, desc);
+
+    auto hash = writer.Hash();
+    if (auto object = Find(renderPasses_, hash, writer.GetKey(), statistics_.renderPasses))
+        return static_cast<RenderPass*>(object);
+
+    auto renderPass = renderSystem_.CreateRenderPass(desc);
+    Insert(renderPasses_, hash, std::move(writer.GetKey()), renderPass, statistics_.renderPasses);
+    return renderPass;
+}
+
+GraphicsPipeline* ObjectCache::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    DescriptorKeyWriter writer;
+    WriteKey(writer, desc);
+
+    auto hash = writer.Hash();
+    if (auto object = Find(graphicsPipelines_, hash, writer.GetKey(), statistics_.graphicsPipelines))
+        return static_cast<GraphicsPipeline*>(object);
+
+    auto graphicsPipeline = renderSystem_.CreateGraphicsPipeline(desc);
+    Insert(graphicsPipelines_, hash, std::move(writer.GetKey()), graphicsPipeline, statistics_.graphicsPipelines);
+    return graphicsPipeline;
+}
+
+void ObjectCache::Release(Shader& shader)
+{
+    if (Unref(shaders_, &shader, statistics_.shaders))
+        renderSystem_.Release(shader);
+}
+
+void ObjectCache::Release(ShaderProgram& shaderProgram)
+{
+    std::vector<Shader*> retainedShaders;
+    if (Unref(shaderPrograms_, &shaderProgram, statistics_.shaderPrograms, &retainedShaders))
+    {
+        renderSystem_.Release(shaderProgram);
+        for (auto shader : retainedShaders)
+            Release(*shader);
+    }
+}
+
+void ObjectCache::Release(Sampler& sampler)
+{
+    if (Unref(samplers_, &sampler, statistics_.samplers))
+        renderSystem_.Release(sampler);
+}
+
+void ObjectCache::Release(RenderPass& renderPass)
+{
+    if (Unref(renderPasses_, &renderPass, statistics_.renderPasses))
+        renderSystem_.Release(renderPass);
+}
+
+void ObjectCache::Release(GraphicsPipeline& graphicsPipeline)
+{
+    if (Unref(graphicsPipelines_, &graphicsPipeline, statistics_.graphicsPipelines))
+        renderSystem_.Release(graphicsPipeline);
+}
+
+void ObjectCache::Clear()
+{
+    /* Release pipelines first, since they might refer to shader programs and render passes */
+    for (auto& entry : graphicsPipelines_)
+        renderSystem_.Release(*static_cast<GraphicsPipeline*>(entry.second.object));
+    for (auto& entry : shaderPrograms_)
+        renderSystem_.Release(*static_cast<ShaderProgram*>(entry.second.object));
+    for (auto& entry : renderPasses_)
+        renderSystem_.Release(*static_cast<RenderPass*>(entry.second.object));
+    for (auto& entry : samplers_)
+        renderSystem_.Release(*static_cast<Sampler*>(entry.second.object));
+    for (auto& entry : shaders_)
+        renderSystem_.Release(*static_cast<Shader*>(entry.second.object));
+
+    graphicsPipelines_.clear();
+    shaderPrograms_.clear();
+    renderPasses_.clear();
+    samplers_.clear();
+    shaders_.clear();
+    objectHashes_.clear();
+    shaderFileHashes_.clear();
+
+    statistics_.shaders.objects             = 0;
+    statistics_.shaderPrograms.objects      = 0;
+    statistics_.samplers.objects            = 0;
+    statistics_.renderPasses.objects        = 0;
+    statistics_.graphicsPipelines.objects   = 0;
+}
+
+void ObjectCache::ResetStatistics()
+{
+    for (auto counter : { &statistics_.shaders, &statistics_.shaderPrograms, &statistics_.samplers, &statistics_.renderPasses, &statistics_.graphicsPipelines })
+    {
+        counter->hits   = 0;
+        counter->misses = 0;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void* ObjectCache::Find(CacheMap& cache, std::uint64_t hash, const std::vector<char>& key, ObjectCacheStatistics::Counter& counter)
+{
+    auto range = cache.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto& entry = it->second;
+        if (entry.key == key)
+        {
+            ++entry.refCount;
+            ++counter.hits;
+            return entry.object;
+        }
+    }
+    return nullptr;
+}
+
+ObjectCache::CacheEntry& ObjectCache::Insert(CacheMap& cache, std::uint64_t hash, std::vector<char>&& key, void* object, ObjectCacheStatistics::Counter& counter)
+{
+    CacheEntry entry;
+    {
+        entry.key       = std::move(key);
+        entry.object    = object;
+        entry.refCount  = 1;
+    }
+    auto it = cache.emplace(hash, std::move(entry));
+    objectHashes_[object] = hash;
+
+    ++counter.misses;
+    ++counter.objects;
+
+    return it->second;
+}
+
+bool ObjectCache::Unref(CacheMap& cache, const void* object, ObjectCacheStatistics::Counter& counter, std::vector<Shader*>* retainedShaders)
+{
+    /* Objects that were not created by this cache are released immediately */
+    auto hashIt = objectHashes_.find(object);
+    if (hashIt == objectHashes_.end())
+        return true;
+
+    auto range = cache.equal_range(hashIt->second);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.object == object)
+        {
+            if (--it->second.refCount > 0)
+                return false;
+
+            if (retainedShaders != nullptr)
+                *retainedShaders = std::move(it->second.shaders);
+
+            cache.erase(it);
+            objectHashes_.erase(hashIt);
+            --counter.objects;
+            return true;
+        }
+    }
+
+    return true;
+}
+
+bool ObjectCache::RefShader(Shader* shader)
+{
+    auto hashIt = objectHashes_.find(shader);
+    if (hashIt == objectHashes_.end())
+        return false;
+
+    auto range = shaders_.equal_range(hashIt->second);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.object == shader)
+        {
+            ++it->second.refCount;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::uint64_t ObjectCache::HashShaderFile(const char* filename)
+{
+    /* Query modification time and size of the file; if this fails, the file is read below which reports the error */
+    ShaderFileHash fileHash;
+
+    struct stat fileStatus;
+    if (::stat(filename, &fileStatus) == 0)
+    {
+        fileHash.modificationTime   = static_cast<std::int64_t>(fileStatus.st_mtime);
+        fileHash.fileSize           = static_cast<std::uint64_t>(fileStatus.st_size);
+
+        /* Return previous content hash if the file has not changed since the last lookup */
+        auto it = shaderFileHashes_.find(filename);
+        if (it != shaderFileHashes_.end() &&
+            it->second.modificationTime == fileHash.modificationTime &&
+            it->second.fileSize         == fileHash.fileSize)
+        {
+            return it->second.contentHash;
+        }
+    }
+
+    /* Read and hash file content once */
+    auto content = ReadFileBuffer(filename);
+    fileHash.contentHash = HashFNV1a(content.data(), content.size());
+
+    shaderFileHashes_[filename] = fileHash;
+
+    return fileHash.contentHash;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,154 @@
+/*
+ * GLVertexArrayCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLVertexArrayCache.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Minimal value of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET guaranteed by the GL specification.
+Vertex formats with larger attribute offsets use the standard VAO path.
+*/
+static const std::uint32_t g_minMaxVertexAttribRelativeOffset = 2047;
+
+bool GLVertexArrayCache::IsSeparateFormatSupported(const VertexFormat& vertexFormat)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    if (!HasExtension(GLExt::ARB_vertex_attrib_binding) || vertexFormat.attributes.empty())
+        return false;
+
+    /* Instance divisor is a state of the binding point, so all attributes of a vertex buffer must share the same divisor */
+    const auto instanceDivisor = vertexFormat.attributes.front().instanceDivisor;
+
+    for (const auto& attrib : vertexFormat.attributes)
+    {
+        if (attrib.instanceDivisor != instanceDivisor || attrib.offset > g_minMaxVertexAttribRelativeOffset)
+            return false;
+    }
+
+    return true;
+
+    #else
+
+    return false;
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+GLuint GLVertexArrayCache::GetOrCreateVertexArray(std::size_t numVertexFormats, const VertexFormat* const * vertexFormats)
+{
+    /* Gather attribute formats (ignore names and strides, since they are not part of the VAO state) */
+    std::vector<GLVertexAttribFormat> attribFormats;
+
+    for (std::size_t i = 0; i < numVertexFormats; ++i)
+    {
+        for (const auto& attrib : vertexFormats[i]->attributes)
+        {
+            attribFormats.push_back(
+                {
+                    attrib.format,
+                    attrib.offset,
+                    attrib.instanceDivisor,
+                    static_cast<std::uint32_t>(i)
+                }
+            );
+        }
+    }
+
+    /* Find VAO with the same attribute formats */
+    auto& bucket = entries_[HashAttribFormats(attribFormats)];
+
+    for (const auto& entry : bucket)
+    {
+        if (CompareAttribFormats(entry.attribFormats, attribFormats))
+            return entry.vao->GetID();
+    }
+
+    /* Create new VAO and build all attribute formats */
+    auto vao = MakeUnique<GLVertexArrayObject>();
+
+    GLStateManager::active->BindVertexArray(vao->GetID());
+    {
+        for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(attribFormats.size()); i < n; ++i)
+        {
+            VertexAttribute attrib;
+            {
+                attrib.format           = attribFormats[i].format;
+                attrib.offset           = attribFormats[i].offset;
+                attrib.instanceDivisor  = attribFormats[i].instanceDivisor;
+            }
+            vao->BuildVertexAttributeFormat(attrib, attribFormats[i].bindingIndex, i);
+        }
+    }
+    GLStateManager::active->BindVertexArray(0);
+
+    /* Store new entry */
+    auto vaoID = vao->GetID();
+    bucket.push_back({ std::move(attribFormats), std::move(vao) });
+    ++numVertexArrays_;
+
+    return vaoID;
+}
+
+void GLVertexArrayCache::Clear()
+{
+    entries_.clear();
+    numVertexArrays_ = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLVertexArrayCache::CompareAttribFormats(const std::vector<GLVertexAttribFormat>& lhs, const std::vector<GLVertexAttribFormat>& rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    for (std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        if ( lhs[i].format          != rhs[i].format          ||
+             lhs[i].offset          != rhs[i].offset          ||
+             lhs[i].instanceDivisor != rhs[i].instanceDivisor ||
+             lhs[i].bindingIndex    != rhs[i].bindingIndex )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::size_t GLVertexArrayCache::HashAttribFormats(const std::vector<GLVertexAttribFormat>& attribFormats)
+{
+    std::size_t seed = 0;
+
+    for (const auto& attrib : attribFormats)
+    {
+        HashCombine(seed, static_cast<std::uint32_t>(attrib.format));
+        HashCombine(seed, attrib.offset);
+        HashCombine(seed, attrib.instanceDivisor);
+        HashCombine(seed, attrib.bindingIndex);
+    }
+
+    return seed;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
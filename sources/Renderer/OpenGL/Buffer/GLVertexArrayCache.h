@@ -0,0 +1,90 @@
+/*
+ * GLVertexArrayCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include <LLGL/VertexFormat.h>
+#include "GLVertexArrayObject.h"
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache of shared vertex-array-objects (VAO) for the separate vertex format path (GL_ARB_vertex_attrib_binding).
+Each VAO only stores the vertex attribute formats, so all vertex buffers with the same layout share the same VAO,
+and the vertex buffers themselves are bound with GLStateManager::BindVertexBuffers.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache() = default;
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        // Returns true if the specified vertex format can be used with a shared VAO.
+        static bool IsSeparateFormatSupported(const VertexFormat& vertexFormat);
+
+        /*
+        Returns the ID of the shared VAO for the specified list of vertex formats, and creates it if it does not exist yet.
+        Each vertex format is assigned to the binding point that equals its index in the list.
+        */
+        GLuint GetOrCreateVertexArray(std::size_t numVertexFormats, const VertexFormat* const * vertexFormats);
+
+        // Releases all shared VAOs.
+        void Clear();
+
+        // Returns the number of shared VAOs in this cache.
+        inline std::size_t GetNumVertexArrays() const
+        {
+            return numVertexArrays_;
+        }
+
+    private:
+
+        // Vertex attribute format independent of the attribute name and the vertex buffer stride.
+        struct GLVertexAttribFormat
+        {
+            Format          format;
+            std::uint32_t   offset;
+            std::uint32_t   instanceDivisor;
+            std::uint32_t   bindingIndex;
+        };
+
+        struct GLVertexArrayEntry
+        {
+            std::vector<GLVertexAttribFormat>       attribFormats;
+            std::unique_ptr<GLVertexArrayObject>    vao;
+        };
+
+        static bool CompareAttribFormats(const std::vector<GLVertexAttribFormat>& lhs, const std::vector<GLVertexAttribFormat>& rhs);
+        static std::size_t HashAttribFormats(const std::vector<GLVertexAttribFormat>& attribFormats);
+
+        // Hash-map of VAO entries; each bucket stores a list to resolve hash collisions.
+        std::unordered_map<std::size_t, std::vector<GLVertexArrayEntry>>   entries_;
+        std::size_t                                                         numVertexArrays_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -78,6 +78,53 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute,
     }
 }
 
+void GLVertexArrayObject::BuildVertexAttributeFormat(const VertexAttribute& attribute, std::uint32_t bindingIndex, std::uint32_t index)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    /* Enable array index in currently bound VAO */
+    glEnableVertexAttribArray(index);
+
+    /* Get data type and components of vector type */
+    DataType        dataType    = DataType::Float32;
+    std::uint32_t   components  = 0;
+    SplitFormat(attribute.format, dataType, components);
+
+    auto isNormalizedFormat = IsNormalizedFormat(attribute.format);
+    auto isFloatFormat      = IsFloatFormat(attribute.format);
+
+    /* Specify attribute format relative to the vertex buffer binding point (no VBO required) */
+    if (!isNormalizedFormat && !isFloatFormat)
+    {
+        glVertexAttribIFormat(
+            index,
+            components,
+            GLTypes::Map(dataType),
+            attribute.offset
+        );
+    }
+    else
+    {
+        glVertexAttribFormat(
+            index,
+            components,
+            GLTypes::Map(dataType),
+            GLBoolean(isNormalizedFormat),
+            attribute.offset
+        );
+    }
+
+    /* Associate attribute with vertex buffer binding point and set its instance divisor */
+    glVertexAttribBinding(index, bindingIndex);
+    glVertexBindingDivisor(bindingIndex, attribute.instanceDivisor);
+
+    #else
+
+    ThrowNotSupportedExcept(__FUNCTION__, "GL_ARB_vertex_attrib_binding");
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
 
 } // /namespace LLGL
 
@@ -25,8 +25,15 @@ class GLVertexArrayObject
         GLVertexArrayObject();
         ~GLVertexArrayObject();
 
+        // Builds the specified vertex attribute with the currently bound VBO (via glVertexAttribPointer).
         void BuildVertexAttribute(const VertexAttribute& attribute, std::uint32_t stride, std::uint32_t index);
 
+        /*
+        Builds the specified vertex attribute format independently of any VBO (via GL_ARB_vertex_attrib_binding).
+        The vertex buffer is bound separately to 'bindingIndex' with GLStateManager::BindVertexBuffers.
+        */
+        void BuildVertexAttributeFormat(const VertexAttribute& attribute, std::uint32_t bindingIndex, std::uint32_t index);
+
         //! Returns the ID of the hardware vertex-array-object (VAO)
         inline GLuint GetID() const
         {
@@ -6,7 +6,9 @@
  */
 
 #include "GLVertexBuffer.h"
+#include "GLVertexArrayCache.h"
 #include "../RenderState/GLStateManager.h"
+#include "../../../Core/Helper.h"
 
 
 namespace LLGL
@@ -18,24 +20,53 @@ GLVertexBuffer::GLVertexBuffer() :
 {
 }
 
-void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat)
+void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat, GLVertexArrayCache& vertexArrayCache)
 {
-    /* Bind VAO */
-    GLStateManager::active->BindVertexArray(GetVaoID());
+    if (GLVertexArrayCache::IsSeparateFormatSupported(vertexFormat))
+    {
+        /* Get shared VAO with separate vertex format (VBO is bound when the buffer is used) */
+        const VertexFormat* vertexFormats[] = { &vertexFormat };
+        vaoID_ = vertexArrayCache.GetOrCreateVertexArray(1, vertexFormats);
+        vao_.reset();
+    }
+    else
     {
-        /* Bind VBO */
-        GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
+        /* Create dedicated VAO */
+        vao_    = MakeUnique<GLVertexArrayObject>();
+        vaoID_  = vao_->GetID();
 
-        /* Build each vertex attribute */
-        for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(vertexFormat.attributes.size()); i < n; ++i)
-            vao_.BuildVertexAttribute(vertexFormat.attributes[i], vertexFormat.stride, i);
+        /* Bind VAO */
+        GLStateManager::active->BindVertexArray(vaoID_);
+        {
+            /* Bind VBO */
+            GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
+
+            /* Build each vertex attribute */
+            for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(vertexFormat.attributes.size()); i < n; ++i)
+                vao_->BuildVertexAttribute(vertexFormat.attributes[i], vertexFormat.stride, i);
+        }
+        GLStateManager::active->BindVertexArray(0);
     }
-    GLStateManager::active->BindVertexArray(0);
 
     /* Store vertex format (required if this buffer is used in a buffer array) */
     vertexFormat_ = vertexFormat;
 }
 
+void GLVertexBuffer::Bind(GLStateManager& stateMngr) const
+{
+    /* Bind VAO */
+    stateMngr.BindVertexArray(vaoID_);
+
+    /* Bind VBO to the first binding point of the shared VAO */
+    if (HasSeparateVertexFormat())
+    {
+        const GLuint    buffer  = GetID();
+        const GLintptr  offset  = 0;
+        const GLsizei   stride  = static_cast<GLsizei>(vertexFormat_.stride);
+        stateMngr.BindVertexBuffers(0, 1, &buffer, &offset, &stride);
+    }
+}
+
 
 } // /namespace LLGL
 
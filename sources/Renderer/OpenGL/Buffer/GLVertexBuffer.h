@@ -11,12 +11,16 @@
 
 #include "GLBuffer.h"
 #include "GLVertexArrayObject.h"
+#include <memory>
 
 
 namespace LLGL
 {
 
 
+class GLStateManager;
+class GLVertexArrayCache;
+
 class GLVertexBuffer final : public GLBuffer
 {
 
@@ -24,12 +28,26 @@ class GLVertexBuffer final : public GLBuffer
 
         GLVertexBuffer();
 
-        void BuildVertexArray(const VertexFormat& vertexFormat);
+        /*
+        Builds the vertex array for the specified vertex format.
+        If the vertex format supports GL_ARB_vertex_attrib_binding, a shared VAO is taken from the cache,
+        otherwise a dedicated VAO is built for this buffer with glVertexAttribPointer.
+        */
+        void BuildVertexArray(const VertexFormat& vertexFormat, GLVertexArrayCache& vertexArrayCache);
+
+        // Binds the VAO and, if the VAO is shared, this buffer to its vertex buffer binding point.
+        void Bind(GLStateManager& stateMngr) const;
 
         //! Returns the ID of the vertex-array-object (VAO)
         inline GLuint GetVaoID() const
         {
-            return vao_.GetID();
+            return vaoID_;
+        }
+
+        //! Returns true if this buffer uses a shared VAO with separate vertex format.
+        inline bool HasSeparateVertexFormat() const
+        {
+            return (vao_ == nullptr);
         }
 
         //! Returns the vertex format.
@@ -40,8 +58,9 @@ class GLVertexBuffer final : public GLBuffer
 
     private:
 
-        GLVertexArrayObject vao_;
-        VertexFormat        vertexFormat_;
+        std::unique_ptr<GLVertexArrayObject>    vao_;
+        GLuint                                  vaoID_          = 0;
+        VertexFormat                            vertexFormat_;
 
 };
 
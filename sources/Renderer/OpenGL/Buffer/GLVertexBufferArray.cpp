@@ -7,8 +7,10 @@
 
 #include "GLVertexBufferArray.h"
 #include "GLVertexBuffer.h"
+#include "GLVertexArrayCache.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/Helper.h"
 
 
 namespace LLGL
@@ -20,10 +22,68 @@ GLVertexBufferArray::GLVertexBufferArray() :
 {
 }
 
-void GLVertexBufferArray::BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+void GLVertexBufferArray::BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray, GLVertexArrayCache& vertexArrayCache)
 {
+    /* Gather vertex formats of all vertex buffers */
+    std::vector<const VertexFormat*> vertexFormats;
+    vertexFormats.reserve(numBuffers);
+
+    bool separateFormatSupported = true;
+
+    for (std::uint32_t i = 0; i < numBuffers; ++i)
+    {
+        auto vertexBufferGL = LLGL_CAST(GLVertexBuffer*, bufferArray[i]);
+        const auto& vertexFormat = vertexBufferGL->GetVertexFormat();
+        if (!GLVertexArrayCache::IsSeparateFormatSupported(vertexFormat))
+            separateFormatSupported = false;
+        vertexFormats.push_back(&vertexFormat);
+    }
+
+    if (separateFormatSupported)
+    {
+        /* Get shared VAO with separate vertex formats and store buffer bindings */
+        vaoID_ = vertexArrayCache.GetOrCreateVertexArray(vertexFormats.size(), vertexFormats.data());
+        vao_.reset();
+
+        BuildArray(numBuffers, bufferArray);
+
+        offsets_.resize(numBuffers, 0);
+        strides_.resize(numBuffers);
+        for (std::uint32_t i = 0; i < numBuffers; ++i)
+            strides_[i] = static_cast<GLsizei>(vertexFormats[i]->stride);
+    }
+    else
+    {
+        /* Create dedicated VAO with all VBOs */
+        BuildVertexArrayWithVBOs(numBuffers, bufferArray);
+    }
+}
+
+void GLVertexBufferArray::Bind(GLStateManager& stateMngr) const
+{
+    /* Bind VAO */
+    stateMngr.BindVertexArray(vaoID_);
+
+    /* Bind VBOs to the binding points of the shared VAO */
+    if (HasSeparateVertexFormat())
+    {
+        const auto& idArray = GetIDArray();
+        stateMngr.BindVertexBuffers(0, static_cast<GLsizei>(idArray.size()), idArray.data(), offsets_.data(), strides_.data());
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexBufferArray::BuildVertexArrayWithVBOs(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    vao_    = MakeUnique<GLVertexArrayObject>();
+    vaoID_  = vao_->GetID();
+
     /* Bind VAO */
-    GLStateManager::active->BindVertexArray(GetVaoID());
+    GLStateManager::active->BindVertexArray(vaoID_);
     {
         for (std::uint32_t i = 0; numBuffers > 0; --numBuffers)
         {
@@ -36,7 +96,7 @@ void GLVertexBufferArray::BuildVertexArray(std::uint32_t numBuffers, Buffer* con
 
                 /* Build each vertex attribute */
                 for (std::uint32_t j = 0, n = static_cast<std::uint32_t>(vertexFormat.attributes.size()); j < n; ++j, ++i)
-                    vao_.BuildVertexAttribute(vertexFormat.attributes[j], vertexFormat.stride, i);
+                    vao_->BuildVertexAttribute(vertexFormat.attributes[j], vertexFormat.stride, i);
             }
             ++bufferArray;
         }
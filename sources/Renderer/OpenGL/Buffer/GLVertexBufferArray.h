@@ -11,12 +11,17 @@
 
 #include "GLBufferArray.h"
 #include "GLVertexArrayObject.h"
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class GLStateManager;
+class GLVertexArrayCache;
+
 class GLVertexBufferArray final : public GLBufferArray
 {
 
@@ -24,17 +29,36 @@ class GLVertexBufferArray final : public GLBufferArray
 
         GLVertexBufferArray();
 
-        void BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
+        /*
+        Builds the vertex array for all vertex formats of the specified vertex buffers.
+        If all vertex formats support GL_ARB_vertex_attrib_binding, a shared VAO is taken from the cache,
+        and each vertex buffer is assigned to the binding point that equals its index in the array.
+        */
+        void BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray, GLVertexArrayCache& vertexArrayCache);
+
+        // Binds the VAO and, if the VAO is shared, all buffers to their vertex buffer binding points.
+        void Bind(GLStateManager& stateMngr) const;
 
         //! Returns the ID of the vertex-array-object (VAO)
         inline GLuint GetVaoID() const
         {
-            return vao_.GetID();
+            return vaoID_;
+        }
+
+        //! Returns true if this buffer array uses a shared VAO with separate vertex formats.
+        inline bool HasSeparateVertexFormat() const
+        {
+            return (vao_ == nullptr);
         }
 
     private:
 
-        GLVertexArrayObject vao_;
+        void BuildVertexArrayWithVBOs(std::uint32_t numBuffers, Buffer* const * bufferArray);
+
+        std::unique_ptr<GLVertexArrayObject>    vao_;
+        GLuint                                  vaoID_      = 0;
+        std::vector<GLintptr>                   offsets_;
+        std::vector<GLsizei>                    strides_;
 
 };
 
@@ -11,6 +11,10 @@
 #include <LLGL/Log.h>
 #include <functional>
 
+#ifdef LLGL_GL_ENABLE_EGL
+#   include <EGL/egl.h>
+#endif
+
 
 namespace LLGL
 {
@@ -28,6 +32,12 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #ifdef LLGL_GL_ENABLE_EGL
+    /* Headless contexts are created with EGL, whose procedures must not be loaded via GLX */
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #endif // /LLGL_GL_ENABLE_EGL
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     Log::StdErr() << "OS not supported for loading OpenGL extensions" << std::endl;
@@ -559,6 +569,24 @@ static bool Load_GL_ARB_buffer_storage(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_map_buffer_range(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMapBufferRange         );
+    LOAD_GLPROC( glFlushMappedBufferRange );
+    return true;
+}
+
+static bool Load_GL_ARB_invalidate_subdata(bool usePlaceholder)
+{
+    LOAD_GLPROC( glInvalidateTexSubImage    );
+    LOAD_GLPROC( glInvalidateTexImage       );
+    LOAD_GLPROC( glInvalidateBufferSubData  );
+    LOAD_GLPROC( glInvalidateBufferData     );
+    LOAD_GLPROC( glInvalidateFramebuffer    );
+    LOAD_GLPROC( glInvalidateSubFramebuffer );
+    return true;
+}
+
 static bool Load_GL_ARB_polygon_offset_clamp(bool usePlaceholder)
 {
     LOAD_GLPROC( glPolygonOffsetClamp );
@@ -585,6 +613,47 @@ static bool Load_GL_ARB_framebuffer_no_attachments(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_vertex_attrib_binding(bool usePlaceholder)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribLFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
+static bool Load_GL_ARB_separate_shader_objects(bool usePlaceholder)
+{
+    LOAD_GLPROC( glProgramUniform1i        );
+    LOAD_GLPROC( glProgramUniform2i        );
+    LOAD_GLPROC( glProgramUniform3i        );
+    LOAD_GLPROC( glProgramUniform4i        );
+    LOAD_GLPROC( glProgramUniform1f        );
+    LOAD_GLPROC( glProgramUniform2f        );
+    LOAD_GLPROC( glProgramUniform3f        );
+    LOAD_GLPROC( glProgramUniform4f        );
+    LOAD_GLPROC( glProgramUniform1iv       );
+    LOAD_GLPROC( glProgramUniform2iv       );
+    LOAD_GLPROC( glProgramUniform3iv       );
+    LOAD_GLPROC( glProgramUniform4iv       );
+    LOAD_GLPROC( glProgramUniform1fv       );
+    LOAD_GLPROC( glProgramUniform2fv       );
+    LOAD_GLPROC( glProgramUniform3fv       );
+    LOAD_GLPROC( glProgramUniform4fv       );
+    LOAD_GLPROC( glProgramUniformMatrix2fv );
+    LOAD_GLPROC( glProgramUniformMatrix3fv );
+    LOAD_GLPROC( glProgramUniformMatrix4fv );
+    return true;
+}
+
+static bool Load_GL_KHR_parallel_shader_compile(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool Load_GL_ARB_direct_state_access(bool usePlaceholder)
 {
     LOAD_GLPROC( glCreateTransformFeedbacks                 );
@@ -768,6 +837,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( ARB_vertex_array_object          );
     ENABLE_GLEXT( ARB_framebuffer_object           );
     ENABLE_GLEXT( ARB_uniform_buffer_object        );
+    ENABLE_GLEXT( ARB_map_buffer_range             );
 
     /* Enable drawing extensions */
     ENABLE_GLEXT( ARB_draw_instanced               );
@@ -923,10 +993,15 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_storage              );
     LOAD_GLEXT( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_buffer_storage               );
+    LOAD_GLEXT( ARB_map_buffer_range             );
+    LOAD_GLEXT( ARB_invalidate_subdata           );
     LOAD_GLEXT( ARB_polygon_offset_clamp         );
     LOAD_GLEXT( ARB_texture_view                 );
     LOAD_GLEXT( ARB_shader_image_load_store      );
     LOAD_GLEXT( ARB_framebuffer_no_attachments   );
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
+    LOAD_GLEXT( ARB_separate_shader_objects      );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
@@ -385,6 +385,20 @@ PFNGLTEXSTORAGE3DMULTISAMPLEPROC                        glTexStorage3DMultisampl
 
 PFNGLBUFFERSTORAGEPROC                                  glBufferStorage                                 = nullptr;
 
+/* GL_ARB_map_buffer_range */
+
+PFNGLMAPBUFFERRANGEPROC                                 glMapBufferRange                                = nullptr;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC                         glFlushMappedBufferRange                        = nullptr;
+
+/* GL_ARB_invalidate_subdata */
+
+PFNGLINVALIDATETEXSUBIMAGEPROC                          glInvalidateTexSubImage                         = nullptr;
+PFNGLINVALIDATETEXIMAGEPROC                             glInvalidateTexImage                            = nullptr;
+PFNGLINVALIDATEBUFFERSUBDATAPROC                        glInvalidateBufferSubData                       = nullptr;
+PFNGLINVALIDATEBUFFERDATAPROC                           glInvalidateBufferData                          = nullptr;
+PFNGLINVALIDATEFRAMEBUFFERPROC                          glInvalidateFramebuffer                         = nullptr;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC                       glInvalidateSubFramebuffer                      = nullptr;
+
 /* GL_ARB_polygon_offset_clamp */
 
 PFNGLPOLYGONOFFSETCLAMPPROC                             glPolygonOffsetClamp                            = nullptr;
@@ -403,6 +417,41 @@ PFNGLMEMORYBARRIERPROC                                  glMemoryBarrier
 PFNGLFRAMEBUFFERPARAMETERIPROC                          glFramebufferParameteri                         = nullptr;
 PFNGLGETFRAMEBUFFERPARAMETERIVPROC                      glGetFramebufferParameteriv                     = nullptr;
 
+/* GL_ARB_vertex_attrib_binding */
+
+PFNGLBINDVERTEXBUFFERPROC                               glBindVertexBuffer                              = nullptr;
+PFNGLVERTEXATTRIBFORMATPROC                             glVertexAttribFormat                            = nullptr;
+PFNGLVERTEXATTRIBIFORMATPROC                            glVertexAttribIFormat                           = nullptr;
+PFNGLVERTEXATTRIBLFORMATPROC                            glVertexAttribLFormat                           = nullptr;
+PFNGLVERTEXATTRIBBINDINGPROC                            glVertexAttribBinding                           = nullptr;
+PFNGLVERTEXBINDINGDIVISORPROC                           glVertexBindingDivisor                          = nullptr;
+
+/* GL_ARB_separate_shader_objects */
+
+PFNGLPROGRAMUNIFORM1IPROC                               glProgramUniform1i                              = nullptr;
+PFNGLPROGRAMUNIFORM2IPROC                               glProgramUniform2i                              = nullptr;
+PFNGLPROGRAMUNIFORM3IPROC                               glProgramUniform3i                              = nullptr;
+PFNGLPROGRAMUNIFORM4IPROC                               glProgramUniform4i                              = nullptr;
+PFNGLPROGRAMUNIFORM1FPROC                               glProgramUniform1f                              = nullptr;
+PFNGLPROGRAMUNIFORM2FPROC                               glProgramUniform2f                              = nullptr;
+PFNGLPROGRAMUNIFORM3FPROC                               glProgramUniform3f                              = nullptr;
+PFNGLPROGRAMUNIFORM4FPROC                               glProgramUniform4f                              = nullptr;
+PFNGLPROGRAMUNIFORM1IVPROC                              glProgramUniform1iv                             = nullptr;
+PFNGLPROGRAMUNIFORM2IVPROC                              glProgramUniform2iv                             = nullptr;
+PFNGLPROGRAMUNIFORM3IVPROC                              glProgramUniform3iv                             = nullptr;
+PFNGLPROGRAMUNIFORM4IVPROC                              glProgramUniform4iv                             = nullptr;
+PFNGLPROGRAMUNIFORM1FVPROC                              glProgramUniform1fv                             = nullptr;
+PFNGLPROGRAMUNIFORM2FVPROC                              glProgramUniform2fv                             = nullptr;
+PFNGLPROGRAMUNIFORM3FVPROC                              glProgramUniform3fv                             = nullptr;
+PFNGLPROGRAMUNIFORM4FVPROC                              glProgramUniform4fv                             = nullptr;
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC                        glProgramUniformMatrix2fv                       = nullptr;
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC                        glProgramUniformMatrix3fv                       = nullptr;
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC                        glProgramUniformMatrix4fv                       = nullptr;
+
+/* GL_KHR_parallel_shader_compile */
+
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC                    glMaxShaderCompilerThreadsKHR                   = nullptr;
+
 /* GL_ARB_direct_state_access */
 
 PFNGLCREATETRANSFORMFEEDBACKSPROC                       glCreateTransformFeedbacks                      = nullptr;
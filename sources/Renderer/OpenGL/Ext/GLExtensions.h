@@ -388,6 +388,20 @@ extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC                     glTexStorage3DMultis
 
 extern PFNGLBUFFERSTORAGEPROC                               glBufferStorage;
 
+/* GL_ARB_map_buffer_range */
+
+extern PFNGLMAPBUFFERRANGEPROC                              glMapBufferRange;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC                      glFlushMappedBufferRange;
+
+/* GL_ARB_invalidate_subdata */
+
+extern PFNGLINVALIDATETEXSUBIMAGEPROC                       glInvalidateTexSubImage;
+extern PFNGLINVALIDATETEXIMAGEPROC                          glInvalidateTexImage;
+extern PFNGLINVALIDATEBUFFERSUBDATAPROC                     glInvalidateBufferSubData;
+extern PFNGLINVALIDATEBUFFERDATAPROC                        glInvalidateBufferData;
+extern PFNGLINVALIDATEFRAMEBUFFERPROC                       glInvalidateFramebuffer;
+extern PFNGLINVALIDATESUBFRAMEBUFFERPROC                    glInvalidateSubFramebuffer;
+
 /* GL_ARB_polygon_offset_clamp */
 
 extern PFNGLPOLYGONOFFSETCLAMPPROC                          glPolygonOffsetClamp;
@@ -406,6 +420,41 @@ extern PFNGLMEMORYBARRIERPROC                               glMemoryBarrier;
 extern PFNGLFRAMEBUFFERPARAMETERIPROC                       glFramebufferParameteri;
 extern PFNGLGETFRAMEBUFFERPARAMETERIVPROC                   glGetFramebufferParameteriv;
 
+/* GL_ARB_vertex_attrib_binding */
+
+extern PFNGLBINDVERTEXBUFFERPROC                            glBindVertexBuffer;
+extern PFNGLVERTEXATTRIBFORMATPROC                          glVertexAttribFormat;
+extern PFNGLVERTEXATTRIBIFORMATPROC                         glVertexAttribIFormat;
+extern PFNGLVERTEXATTRIBLFORMATPROC                         glVertexAttribLFormat;
+extern PFNGLVERTEXATTRIBBINDINGPROC                         glVertexAttribBinding;
+extern PFNGLVERTEXBINDINGDIVISORPROC                        glVertexBindingDivisor;
+
+/* GL_ARB_separate_shader_objects */
+
+extern PFNGLPROGRAMUNIFORM1IPROC                           glProgramUniform1i;
+extern PFNGLPROGRAMUNIFORM2IPROC                           glProgramUniform2i;
+extern PFNGLPROGRAMUNIFORM3IPROC                           glProgramUniform3i;
+extern PFNGLPROGRAMUNIFORM4IPROC                           glProgramUniform4i;
+extern PFNGLPROGRAMUNIFORM1FPROC                           glProgramUniform1f;
+extern PFNGLPROGRAMUNIFORM2FPROC                           glProgramUniform2f;
+extern PFNGLPROGRAMUNIFORM3FPROC                           glProgramUniform3f;
+extern PFNGLPROGRAMUNIFORM4FPROC                           glProgramUniform4f;
+extern PFNGLPROGRAMUNIFORM1IVPROC                          glProgramUniform1iv;
+extern PFNGLPROGRAMUNIFORM2IVPROC                          glProgramUniform2iv;
+extern PFNGLPROGRAMUNIFORM3IVPROC                          glProgramUniform3iv;
+extern PFNGLPROGRAMUNIFORM4IVPROC                          glProgramUniform4iv;
+extern PFNGLPROGRAMUNIFORM1FVPROC                          glProgramUniform1fv;
+extern PFNGLPROGRAMUNIFORM2FVPROC                          glProgramUniform2fv;
+extern PFNGLPROGRAMUNIFORM3FVPROC                          glProgramUniform3fv;
+extern PFNGLPROGRAMUNIFORM4FVPROC                          glProgramUniform4fv;
+extern PFNGLPROGRAMUNIFORMMATRIX2FVPROC                    glProgramUniformMatrix2fv;
+extern PFNGLPROGRAMUNIFORMMATRIX3FVPROC                    glProgramUniformMatrix3fv;
+extern PFNGLPROGRAMUNIFORMMATRIX4FVPROC                    glProgramUniformMatrix4fv;
+
+/* GL_KHR_parallel_shader_compile */
+
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC                 glMaxShaderCompilerThreadsKHR;
+
 /* GL_ARB_direct_state_access */
 
 extern PFNGLCREATETRANSFORMFEEDBACKSPROC                    glCreateTransformFeedbacks;
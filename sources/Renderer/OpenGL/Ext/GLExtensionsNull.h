@@ -415,6 +415,20 @@ DECL_GLPROC(void, glTexStorage3DMultisample, (GLenum, GLsizei, GLenum, GLsizei,
 
 DECL_GLPROC(void, glBufferStorage, (GLenum, GLsizeiptr, const void*, GLbitfield));
 
+/* GL_ARB_map_buffer_range */
+
+DECL_GLPROC(void*, glMapBufferRange, (GLenum, GLintptr, GLsizeiptr, GLbitfield));
+DECL_GLPROC(void, glFlushMappedBufferRange, (GLenum, GLintptr, GLsizeiptr));
+
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(void, glInvalidateTexSubImage, (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei));
+DECL_GLPROC(void, glInvalidateTexImage, (GLuint, GLint));
+DECL_GLPROC(void, glInvalidateBufferSubData, (GLuint, GLintptr, GLsizeiptr));
+DECL_GLPROC(void, glInvalidateBufferData, (GLuint));
+DECL_GLPROC(void, glInvalidateFramebuffer, (GLenum, GLsizei, const GLenum*));
+DECL_GLPROC(void, glInvalidateSubFramebuffer, (GLenum, GLsizei, const GLenum*, GLint, GLint, GLsizei, GLsizei));
+
 /* GL_ARB_polygon_offset_clamp */
 
 DECL_GLPROC(void, glPolygonOffsetClamp, (GLfloat, GLfloat, GLfloat));
@@ -433,6 +447,41 @@ DECL_GLPROC(void, glMemoryBarrier, (GLbitfield));
 DECL_GLPROC(void, glFramebufferParameteri, (GLenum, GLenum, GLint));
 DECL_GLPROC(void, glGetFramebufferParameteriv, (GLenum, GLenum, GLint*));
 
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(void, glBindVertexBuffer, (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(void, glVertexAttribFormat, (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(void, glVertexAttribIFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribLFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribBinding, (GLuint, GLuint));
+DECL_GLPROC(void, glVertexBindingDivisor, (GLuint, GLuint));
+
+/* GL_ARB_separate_shader_objects */
+
+DECL_GLPROC(void, glProgramUniform1i, (GLuint, GLint, GLint));
+DECL_GLPROC(void, glProgramUniform2i, (GLuint, GLint, GLint, GLint));
+DECL_GLPROC(void, glProgramUniform3i, (GLuint, GLint, GLint, GLint, GLint));
+DECL_GLPROC(void, glProgramUniform4i, (GLuint, GLint, GLint, GLint, GLint, GLint));
+DECL_GLPROC(void, glProgramUniform1f, (GLuint, GLint, GLfloat));
+DECL_GLPROC(void, glProgramUniform2f, (GLuint, GLint, GLfloat, GLfloat));
+DECL_GLPROC(void, glProgramUniform3f, (GLuint, GLint, GLfloat, GLfloat, GLfloat));
+DECL_GLPROC(void, glProgramUniform4f, (GLuint, GLint, GLfloat, GLfloat, GLfloat, GLfloat));
+DECL_GLPROC(void, glProgramUniform1iv, (GLuint, GLint, GLsizei, const GLint*));
+DECL_GLPROC(void, glProgramUniform2iv, (GLuint, GLint, GLsizei, const GLint*));
+DECL_GLPROC(void, glProgramUniform3iv, (GLuint, GLint, GLsizei, const GLint*));
+DECL_GLPROC(void, glProgramUniform4iv, (GLuint, GLint, GLsizei, const GLint*));
+DECL_GLPROC(void, glProgramUniform1fv, (GLuint, GLint, GLsizei, const GLfloat*));
+DECL_GLPROC(void, glProgramUniform2fv, (GLuint, GLint, GLsizei, const GLfloat*));
+DECL_GLPROC(void, glProgramUniform3fv, (GLuint, GLint, GLsizei, const GLfloat*));
+DECL_GLPROC(void, glProgramUniform4fv, (GLuint, GLint, GLsizei, const GLfloat*));
+DECL_GLPROC(void, glProgramUniformMatrix2fv, (GLuint, GLint, GLsizei, GLboolean, const GLfloat*));
+DECL_GLPROC(void, glProgramUniformMatrix3fv, (GLuint, GLint, GLsizei, GLboolean, const GLfloat*));
+DECL_GLPROC(void, glProgramUniformMatrix4fv, (GLuint, GLint, GLsizei, GLboolean, const GLfloat*));
+
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(void, glMaxShaderCompilerThreadsKHR, (GLuint));
+
 /* GL_ARB_direct_state_access */
 
 DECL_GLPROC(void, glCreateTransformFeedbacks, (GLsizei, GLuint*));
@@ -31,6 +31,8 @@
 #include "RenderState/GLRenderPass.h"
 #include "RenderState/GLQuery.h"
 
+#include <stdexcept>
+
 
 namespace LLGL
 {
@@ -39,8 +41,9 @@ namespace LLGL
 // Maximal number of viewports for the GL renderer.
 static const std::uint32_t g_maxNumViewportsGL = 16;
 
-GLCommandBuffer::GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateMngr) :
-    stateMngr_ { stateMngr }
+GLCommandBuffer::GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateMngr, const CommandBufferDescriptor& desc) :
+    stateMngr_              { stateMngr                  },
+    pendingPipelinePolicy_  { desc.pendingPipelinePolicy }
 {
 }
 
@@ -246,14 +249,14 @@ void GLCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     /* Bind vertex buffer */
     auto& vertexBufferGL = LLGL_CAST(GLVertexBuffer&, buffer);
-    stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
+    vertexBufferGL.Bind(*stateMngr_);
 }
 
 void GLCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     /* Bind vertex buffer */
     auto& vertexBufferArrayGL = LLGL_CAST(GLVertexBufferArray&, bufferArray);
-    stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
+    vertexBufferArrayGL.Bind(*stateMngr_);
 }
 
 void GLCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -376,17 +379,45 @@ void GLCommandBuffer::BeginRenderPass(
     else
         BindRenderTarget(LLGL_CAST(GLRenderTarget&, renderTarget));
 
-    /* Clear attachments */
     if (renderPass)
     {
         auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
+
+        /* Invalidate attachments whose previous content is undefined */
+        const auto& invalidateOnBegin = renderPassGL->GetInvalidateOnBegin();
+        InvalidateAttachments(invalidateOnBegin.numAttachments, invalidateOnBegin.attachments);
+
+        /* Clear attachments */
         ClearAttachmentsWithRenderPass(*renderPassGL, numClearValues, clearValues);
+
+        boundRenderPass_ = renderPassGL;
     }
+    else
+        boundRenderPass_ = nullptr;
 }
 
 void GLCommandBuffer::EndRenderPass()
 {
-    // dummy
+    if (boundRenderPass_)
+    {
+        const auto& invalidateOnEnd = boundRenderPass_->GetInvalidateOnEnd();
+        if (invalidateOnEnd.numAttachments > 0)
+        {
+            if (boundRenderTarget_)
+            {
+                /* Resolve multi-sampled render target first, then rebind its framebuffer to invalidate the multi-sampled attachments */
+                BlitBoundRenderTarget();
+                stateMngr_->BindFramebuffer(GLFramebufferTarget::DRAW_FRAMEBUFFER, boundRenderTarget_->GetFramebuffer().GetID());
+            }
+
+            /* Invalidate attachments whose outcome is not stored (while the render target is still bound) */
+            InvalidateAttachments(invalidateOnEnd.numAttachments, invalidateOnEnd.attachments);
+
+            /* Render target has already been resolved, so it must not be blitted again on the next binding */
+            boundRenderTarget_ = nullptr;
+        }
+        boundRenderPass_ = nullptr;
+    }
 }
 
 /* ----- Pipeline States ----- */
@@ -395,6 +426,12 @@ void GLCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 {
     /* Set graphics pipeline render states */
     auto& graphicsPipelineGL = LLGL_CAST(GLGraphicsPipeline&, graphicsPipeline);
+
+    /* Skip all draw commands until the next pipeline is bound (otherwise, GL blocks implicitly when the pending shader program is used) */
+    skipDrawCommands_ = (pendingPipelinePolicy_ == PendingPipelinePolicy::Skip && !graphicsPipelineGL.IsReady());
+    if (skipDrawCommands_)
+        return;
+
     graphicsPipelineGL.Bind(*stateMngr_);
 
     /* Store draw modes */
@@ -404,6 +441,12 @@ void GLCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 void GLCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
     auto& computePipelineGL = LLGL_CAST(GLComputePipeline&, computePipeline);
+
+    /* Skip all dispatch commands until the next pipeline is bound (otherwise, GL blocks implicitly when the pending shader program is used) */
+    skipDispatchCommands_ = (pendingPipelinePolicy_ == PendingPipelinePolicy::Skip && !computePipelineGL.IsReady());
+    if (skipDispatchCommands_)
+        return;
+
     computePipelineGL.Bind(*stateMngr_);
 }
 
@@ -545,6 +588,9 @@ The indices actually store the index start offset, but must be passed to GL as a
 
 void GLCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    if (skipDrawCommands_)
+        return;
+
     glDrawArrays(
         renderState_.drawMode,
         static_cast<GLint>(firstVertex),
@@ -554,6 +600,9 @@ void GLCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 
 void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    if (skipDrawCommands_)
+        return;
+
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
     glDrawElements(
         renderState_.drawMode,
@@ -565,6 +614,9 @@ void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstI
 
 void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    if (skipDrawCommands_)
+        return;
+
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
     glDrawElementsBaseVertex(
         renderState_.drawMode,
@@ -577,6 +629,9 @@ void GLCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstI
 
 void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    if (skipDrawCommands_)
+        return;
+
     glDrawArraysInstanced(
         renderState_.drawMode,
         static_cast<GLint>(firstVertex),
@@ -587,6 +642,9 @@ void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fir
 
 void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    if (skipDrawCommands_)
+        return;
+
     #ifndef __APPLE__
     glDrawArraysInstancedBaseInstance(
         renderState_.drawMode,
@@ -602,6 +660,9 @@ void GLCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fir
 
 void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    if (skipDrawCommands_)
+        return;
+
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
     glDrawElementsInstanced(
         renderState_.drawMode,
@@ -614,6 +675,9 @@ void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
 
 void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    if (skipDrawCommands_)
+        return;
+
     auto indices = static_cast<GLsizeiptr>(firstIndex * renderState_.indexBufferStride);
     glDrawElementsInstancedBaseVertex(
         renderState_.drawMode,
@@ -627,6 +691,9 @@ void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
 
 void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    if (skipDrawCommands_)
+        return;
+
     #ifndef __APPLE__
     const GLsizeiptr indices = firstIndex * renderState_.indexBufferStride;
     glDrawElementsInstancedBaseVertexBaseInstance(
@@ -647,11 +714,21 @@ void GLCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
 
 void GLCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
 {
+    if (skipDispatchCommands_)
+        return;
+
     #ifndef __APPLE__
     glDispatchCompute(groupSizeX, groupSizeY, groupSizeZ);
     #endif
 }
 
+/* ----- Secondary Command Buffers ----- */
+
+void GLCommandBuffer::Execute(CommandBuffer& /*secondaryCommandBuffer*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by OpenGL renderer");
+}
+
 
 /*
  * ======= Private: =======
@@ -778,6 +855,55 @@ void GLCommandBuffer::ClearAttachmentsWithRenderPass(
     }
 }
 
+// Maps the specified framebuffer attachment to the respective attachments of the default framebuffer
+static GLsizei MapDefaultFramebufferAttachment(GLenum attachment, GLenum* defaultAttachments)
+{
+    switch (attachment)
+    {
+        case GL_COLOR_ATTACHMENT0:
+            defaultAttachments[0] = GL_COLOR;
+            return 1;
+        case GL_DEPTH_ATTACHMENT:
+            defaultAttachments[0] = GL_DEPTH;
+            return 1;
+        case GL_STENCIL_ATTACHMENT:
+            defaultAttachments[0] = GL_STENCIL;
+            return 1;
+        case GL_DEPTH_STENCIL_ATTACHMENT:
+            defaultAttachments[0] = GL_DEPTH;
+            defaultAttachments[1] = GL_STENCIL;
+            return 2;
+        default:
+            return 0; // default framebuffer has only a single color buffer
+    }
+}
+
+void GLCommandBuffer::InvalidateAttachments(GLsizei numAttachments, const GLenum* attachments)
+{
+    #ifdef GL_ARB_invalidate_subdata
+    if (numAttachments > 0 && HasExtension(GLExt::ARB_invalidate_subdata))
+    {
+        if (boundRenderTarget_)
+        {
+            /* Invalidate attachments of framebuffer object */
+            glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numAttachments, attachments);
+        }
+        else
+        {
+            /* Invalidate attachments of default framebuffer */
+            GLenum defaultAttachments[3];
+            GLsizei numDefaultAttachments = 0;
+
+            for (GLsizei i = 0; i < numAttachments; ++i)
+                numDefaultAttachments += MapDefaultFramebufferAttachment(attachments[i], &defaultAttachments[numDefaultAttachments]);
+
+            if (numDefaultAttachments > 0)
+                glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numDefaultAttachments, defaultAttachments);
+        }
+    }
+    #endif // /GL_ARB_invalidate_subdata
+}
+
 void GLCommandBuffer::ClearColorBuffers(
     const std::uint8_t* colorBuffers,
     std::uint32_t       numClearValues,
@@ -30,7 +30,7 @@ class GLCommandBuffer final : public CommandBufferExt
 
         /* ----- Common ----- */
 
-        GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateManager);
+        GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateManager, const CommandBufferDescriptor& desc);
 
         /* ----- Configuration ----- */
 
@@ -134,6 +134,10 @@ class GLCommandBuffer final : public CommandBufferExt
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
 
+        /* ----- Secondary Command Buffers ----- */
+
+        void Execute(CommandBuffer& secondaryCommandBuffer) override;
+
     private:
 
         struct RenderState
@@ -174,13 +178,21 @@ class GLCommandBuffer final : public CommandBufferExt
             std::uint32_t&      idx
         );
 
+        // Invalidates the specified attachments of the bound framebuffer (GL_COLOR_ATTACHMENTi, GL_DEPTH_ATTACHMENT etc.).
+        void InvalidateAttachments(GLsizei numAttachments, const GLenum* attachments);
+
         std::shared_ptr<GLStateManager> stateMngr_;
         RenderState                     renderState_;
 
         GLRenderTarget*                 boundRenderTarget_  = nullptr;
+        const GLRenderPass*             boundRenderPass_    = nullptr;
 
         GLClearValue                    clearValue_;
 
+        PendingPipelinePolicy           pendingPipelinePolicy_  = PendingPipelinePolicy::Wait;
+        bool                            skipDrawCommands_       = false;    // Set while a pending graphics pipeline has been skipped
+        bool                            skipDispatchCommands_   = false;    // Set while a pending compute pipeline has been skipped
+
 };
 
 
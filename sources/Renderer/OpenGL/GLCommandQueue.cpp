@@ -8,12 +8,20 @@
 #include "GLCommandQueue.h"
 #include "../CheckedCast.h"
 #include "RenderState/GLFence.h"
+#include "Ext/GLExtensions.h"
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 
 namespace LLGL
 {
 
 
+// Maximal time (in nanoseconds) to block on a single sync object while waiting for any of several fences
+static const std::uint64_t g_waitAnySlice = 1000000;
+
 /* ----- Command Buffers ----- */
 
 void GLCommandQueue::Begin(CommandBuffer& /*commandBuffer*/, long /*flags*/)
@@ -21,6 +29,11 @@ void GLCommandQueue::Begin(CommandBuffer& /*commandBuffer*/, long /*flags*/)
     // dummy
 }
 
+void GLCommandQueue::BeginSecondary(CommandBuffer& /*commandBuffer*/, RenderTarget& /*renderTarget*/, const RenderPass* /*renderPass*/, long /*flags*/)
+{
+    throw std::runtime_error("secondary command buffers are not supported by OpenGL renderer");
+}
+
 void GLCommandQueue::End(CommandBuffer& /*commandBuffer*/)
 {
     // dummy
@@ -31,6 +44,11 @@ void GLCommandQueue::Submit(CommandBuffer& /*commandBuffer*/)
     // dummy
 }
 
+void GLCommandQueue::Submit(std::uint32_t /*numCommandBuffers*/, CommandBuffer* const * /*commandBuffers*/)
+{
+    // dummy
+}
+
 /* ----- Fences ----- */
 
 void GLCommandQueue::Submit(Fence& fence)
@@ -50,6 +68,91 @@ void GLCommandQueue::WaitIdle()
     glFinish();
 }
 
+void GLCommandQueue::Signal(Fence& fence, std::uint64_t value)
+{
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    if (!fenceGL.IsTimeline())
+        throw std::invalid_argument("cannot signal value for binary fence");
+    fenceGL.Signal(value);
+}
+
+std::uint64_t GLCommandQueue::GetCompletedValue(Fence& fence)
+{
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    if (fenceGL.IsTimeline())
+        return fenceGL.GetCompletedValue();
+    else
+        return (fenceGL.Wait(0) ? 1 : 0);
+}
+
+// Returns true if all fences are timeline fences, or false if all fences are binary fences.
+static bool AreTimelineFences(std::uint32_t numFences, Fence* const * fences)
+{
+    const bool timeline = LLGL_CAST(GLFence*, fences[0])->IsTimeline();
+    for (std::uint32_t i = 1; i < numFences; ++i)
+    {
+        if (LLGL_CAST(GLFence*, fences[i])->IsTimeline() != timeline)
+            throw std::invalid_argument("cannot wait for binary and timeline fences at the same time");
+    }
+    return timeline;
+}
+
+bool GLCommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, bool waitAll, std::uint64_t timeout)
+{
+    if (numFences == 0 || !AreTimelineFences(numFences, fences))
+        return CommandQueue::WaitFences(numFences, fences, values, waitAll, timeout);
+
+    if (waitAll)
+    {
+        /* Wait for each timeline fence in order */
+        for (std::uint32_t i = 0; i < numFences; ++i)
+        {
+            auto fenceGL = LLGL_CAST(GLFence*, fences[i]);
+            if (!fenceGL->WaitValue(values[i], timeout))
+                return false;
+        }
+        return true;
+    }
+
+    /* Sync objects can only be waited for individually, so poll all fences after the command stream has been flushed */
+    glFlush();
+
+    const auto startTime = std::chrono::steady_clock::now();
+    while (true)
+    {
+        /* Return if any fence has reached its value, otherwise find the sync object that was created first */
+        GLsync          earliestSync    = nullptr;
+        std::uint64_t   earliestOrder   = 0;
+
+        for (std::uint32_t i = 0; i < numFences; ++i)
+        {
+            auto fenceGL = LLGL_CAST(GLFence*, fences[i]);
+            if (fenceGL->GetCompletedValue() >= values[i])
+                return true;
+
+            std::uint64_t order = 0;
+            if (auto sync = fenceGL->FindPendingSync(values[i], order))
+            {
+                if (earliestSync == nullptr || order < earliestOrder)
+                {
+                    earliestSync    = sync;
+                    earliestOrder   = order;
+                }
+            }
+        }
+
+        const auto elapsedTime = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+        if (elapsedTime >= timeout)
+            return false;
+
+        /* Block on the earliest sync object for a bounded time slice, since values of other fences may be signaled on another context */
+        const auto slice = std::min(g_waitAnySlice, timeout - elapsedTime);
+        if (earliestSync != nullptr)
+            glClientWaitSync(earliestSync, 0, slice);
+        else
+            std::this_thread::sleep_for(std::chrono::nanoseconds(slice));
+    }
+}
 
 } // /namespace LLGL
 
@@ -6,6 +6,7 @@
  */
 
 #include "GLRenderContext.h"
+#include <stdexcept>
 
 
 namespace LLGL
@@ -16,26 +17,43 @@ GLRenderContext::GLRenderContext(RenderContextDescriptor desc, const std::shared
     RenderContext  { desc.videoMode, desc.vsync                           },
     contextHeight_ { static_cast<GLint>(desc.videoMode.resolution.height) }
 {
-    #ifdef __linux__
+    /* Headless render contexts are only created if no surface is specified */
+    const bool headless = (desc.headless && !surface);
 
-    /* Setup surface for the render context and pass native context handle */
-    NativeContextHandle windowContext;
-    GetNativeContextHandle(windowContext, desc.videoMode, desc.multiSampling);
-    SetOrCreateSurface(surface, desc.videoMode, &windowContext);
+    if (sharedRenderContext != nullptr && sharedRenderContext->HasSurface() == headless)
+        throw std::invalid_argument("cannot share OpenGL render context between headless and non-headless render contexts");
 
-    #else
+    if (headless)
+    {
+        /* Setup render context without surface */
+        SetHeadlessVideoMode(desc.videoMode);
+    }
+    else
+    {
+        #ifdef __linux__
 
-    /* Setup surface for the render context */
-    SetOrCreateSurface(surface, desc.videoMode, nullptr);
+        /* Setup surface for the render context and pass native context handle */
+        NativeContextHandle windowContext;
+        GetNativeContextHandle(windowContext, desc.videoMode, desc.multiSampling);
+        SetOrCreateSurface(surface, desc.videoMode, &windowContext);
 
-    #endif
+        #else
+
+        /* Setup surface for the render context */
+        SetOrCreateSurface(surface, desc.videoMode, nullptr);
+
+        #endif
+    }
 
     /* Update video mode of descriptor after surface has been set or created */
     desc.videoMode = GetVideoMode();
 
     /* Create platform dependent OpenGL context */
     GLContext* sharedGLContext = (sharedRenderContext != nullptr ? sharedRenderContext->context_.get() : nullptr);
-    context_ = GLContext::Create(desc, GetSurface(), sharedGLContext);
+    if (headless)
+        context_ = GLContext::CreateHeadless(desc, sharedGLContext);
+    else
+        context_ = GLContext::Create(desc, GetSurface(), sharedGLContext);
 
     /* Setup swap interval (for v-sync) */
     OnSetVsync(desc.vsync);
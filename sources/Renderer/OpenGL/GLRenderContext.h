@@ -52,6 +52,12 @@ class GLRenderContext final : public RenderContext
             return stateMngr_;
         }
 
+        // Returns the platform specific GL context.
+        inline GLContext& GetGLContext() const
+        {
+            return *context_;
+        }
+
     private:
 
         struct RenderState
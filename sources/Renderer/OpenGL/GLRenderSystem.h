@@ -16,9 +16,11 @@
 #include "GLCommandQueue.h"
 #include "GLCommandBuffer.h"
 #include "GLRenderContext.h"
+#include "GLUploadWorker.h"
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
+#include "Buffer/GLVertexArrayCache.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
@@ -26,6 +28,8 @@
 #include "Texture/GLTexture.h"
 #include "Texture/GLSampler.h"
 #include "Texture/GLRenderTarget.h"
+#include "Texture/GLPixelPackRing.h"
+#include "Texture/GLPixelUnpackRing.h"
 
 #include "RenderState/GLQuery.h"
 #include "RenderState/GLFence.h"
@@ -77,6 +81,7 @@ class GLRenderSystem final : public RenderSystem
         /* ----- Buffers ------ */
 
         Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) override;
+        Buffer* CreateBufferAsync(const BufferDescriptor& desc, const void* initialData, Fence& fence) override;
         BufferArray* CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray) override;
 
         void Release(Buffer& buffer) override;
@@ -90,14 +95,20 @@ class GLRenderSystem final : public RenderSystem
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+        Texture* CreateTextureAsync(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc, Fence& fence) override;
 
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) override;
+        void WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc, Fence& fence) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        TextureReadHandle ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence) override;
+        void ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
+        void GenerateMipsAsync(Texture& texture, Fence& fence) override;
 
         /* ----- Sampler States ---- */
 
@@ -142,6 +153,9 @@ class GLRenderSystem final : public RenderSystem
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
         ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
 
+        GraphicsPipeline* CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipelineAsync(const ComputePipelineDescriptor& desc) override;
+
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
@@ -154,6 +168,7 @@ class GLRenderSystem final : public RenderSystem
         /* ----- Fences ----- */
 
         Fence* CreateFence() override;
+        Fence* CreateTimelineFence(std::uint64_t initialValue = 0) override;
 
         void Release(Fence& fence) override;
 
@@ -171,6 +186,14 @@ class GLRenderSystem final : public RenderSystem
 
         GLRenderContext* GetSharedRenderContext() const;
 
+        // Returns the upload worker, or null if background uploads are disabled or not supported.
+        GLUploadWorker* GetUploadWorker();
+
+        std::unique_ptr<GLBuffer> MakeBufferObject(const BufferDescriptor& desc);
+
+        void ValidateTextureType(const TextureType type);
+        void WriteTextureSubImage(GLTexture& textureGL, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc);
+
         void GenerateMipsPrimary(GLuint texID, const TextureType texType);
         void GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D& extent, GLint baseMipLevel, GLint numMipLevels, GLint baseArrayLayer, GLint numArrayLayers);
         void GenerateSubMipsWithTextureView(GLTexture& textureGL, GLuint baseMipLevel, GLuint numMipLevels, GLuint baseArrayLayer, GLuint numArrayLayers);
@@ -207,12 +230,20 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLQuery>              queries_;
         HWObjectContainer<GLFence>              fences_;
 
+        GLVertexArrayCache                      vertexArrayCache_;
+
         DebugCallback                           debugCallback_;
 
         #ifdef LLGL_ENABLE_CUSTOM_SUB_MIPGEN
         MipGenerationFBOPair                    mipGenerationFBOPair_;
         #endif // /LLGL_ENABLE_CUSTOM_SUB_MIPGEN
 
+        GLPixelPackRing                         pixelPackRing_;
+        GLPixelUnpackRing                       pixelUnpackRing_;
+
+        // Must be the last member, so the worker thread is stopped before any other resource is released.
+        GLUploadWorker                          uploadWorker_;
+
 };
 
 
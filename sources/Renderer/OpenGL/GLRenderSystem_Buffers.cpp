@@ -80,42 +80,47 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
 {
     AssertCreateBuffer(desc, static_cast<uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
-    /* Create either base of sub-class GLBuffer object */
-    switch (desc.type)
+    /* Create buffer object and allocate its storage */
+    auto bufferGL = MakeBufferObject(desc);
+    GLBufferStorage(*bufferGL, desc, initialData);
+
+    return TakeOwnership(buffers_, std::move(bufferGL));
+}
+
+Buffer* GLRenderSystem::CreateBufferAsync(const BufferDescriptor& desc, const void* initialData, Fence& fence)
+{
+    auto uploadWorker = GetUploadWorker();
+    if (!uploadWorker)
+        return RenderSystem::CreateBufferAsync(desc, initialData, fence);
+
+    AssertCreateBuffer(desc, static_cast<uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
+
+    /* Create buffer object on this thread, since vertex array objects are not shared between GL contexts */
+    auto bufferGL = MakeBufferObject(desc);
+    auto bufferRef = bufferGL.get();
+
+    /* Copy initial data, since the caller may release it before the worker has uploaded it */
+    std::shared_ptr<std::vector<char>> data;
+    if (initialData != nullptr)
     {
-        case BufferType::Vertex:
-        {
-            /* Create vertex buffer and build vertex array */
-            auto bufferGL = MakeUnique<GLVertexBuffer>();
-            {
-                GLBufferStorage(*bufferGL, desc, initialData);
-                bufferGL->BuildVertexArray(desc.vertexBuffer.format);
-            }
-            return TakeOwnership(buffers_, std::move(bufferGL));
-        }
-        break;
+        auto initialBytes = reinterpret_cast<const char*>(initialData);
+        data = std::make_shared<std::vector<char>>(initialBytes, initialBytes + desc.size);
+    }
 
-        case BufferType::Index:
+    /* Allocate buffer storage on the worker thread and restore its buffer binding afterwards */
+    uploadWorker->Enqueue(
+        [bufferRef, desc, data]()
         {
-            /* Create index buffer and store index format */
-            auto bufferGL = MakeUnique<GLIndexBuffer>(desc.indexBuffer.format);
+            GLStateManager::active->PushBoundBuffer(GLStateManager::GetBufferTarget(bufferRef->GetType()));
             {
-                GLBufferStorage(*bufferGL, desc, initialData);
+                GLBufferStorage(*bufferRef, desc, (data ? data->data() : nullptr));
             }
-            return TakeOwnership(buffers_, std::move(bufferGL));
-        }
-        break;
+            GLStateManager::active->PopBoundBuffer();
+        },
+        LLGL_CAST(GLFence&, fence)
+    );
 
-        default:
-        {
-            /* Create generic buffer */
-            auto bufferGL = MakeUnique<GLBuffer>(desc.type);
-            {
-                GLBufferStorage(*bufferGL, desc, initialData);
-            }
-            return TakeOwnership(buffers_, std::move(bufferGL));
-        }
-    }
+    return TakeOwnership(buffers_, std::move(bufferGL));
 }
 
 BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -127,7 +132,7 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
     {
         /* Create vertex buffer array and build VAO */
         auto vertexBufferArray = MakeUnique<GLVertexBufferArray>();
-        vertexBufferArray->BuildVertexArray(numBuffers, bufferArray);
+        vertexBufferArray->BuildVertexArray(numBuffers, bufferArray, vertexArrayCache_);
         return TakeOwnership(bufferArrays_, std::move(vertexBufferArray));
     }
 
@@ -206,6 +211,38 @@ void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+std::unique_ptr<GLBuffer> GLRenderSystem::MakeBufferObject(const BufferDescriptor& desc)
+{
+    /* Create either base of sub-class GLBuffer object */
+    switch (desc.type)
+    {
+        case BufferType::Vertex:
+        {
+            /* Create vertex buffer and build vertex array */
+            auto bufferGL = MakeUnique<GLVertexBuffer>();
+            bufferGL->BuildVertexArray(desc.vertexBuffer.format, vertexArrayCache_);
+            return bufferGL;
+        }
+
+        case BufferType::Index:
+        {
+            /* Create index buffer and store index format */
+            return MakeUnique<GLIndexBuffer>(desc.indexBuffer.format);
+        }
+
+        default:
+        {
+            /* Create generic buffer */
+            return MakeUnique<GLBuffer>(desc.type);
+        }
+    }
+}
+
+
 } // /namespace LLGL
 
 
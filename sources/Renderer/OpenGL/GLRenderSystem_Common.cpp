@@ -36,6 +36,21 @@ GLRenderContext* GLRenderSystem::GetSharedRenderContext() const
     return (!renderContexts_.empty() ? renderContexts_.begin()->get() : nullptr);
 }
 
+// private
+GLUploadWorker* GLRenderSystem::GetUploadWorker()
+{
+    /* Start upload worker with a context that is shared with the primary render context on first use */
+    if (GetConfiguration().backgroundUploads)
+    {
+        if (auto sharedRenderContext = GetSharedRenderContext())
+        {
+            if (uploadWorker_.Start(sharedRenderContext->GetGLContext()))
+                return (&uploadWorker_);
+        }
+    }
+    return nullptr;
+}
+
 RenderContext* GLRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
 {
     return AddRenderContext(MakeUnique<GLRenderContext>(desc, surface, GetSharedRenderContext()), desc);
@@ -55,16 +70,16 @@ CommandQueue* GLRenderSystem::GetCommandQueue()
 
 /* ----- Command buffers ----- */
 
-CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& /*desc*/)
+CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
-    return CreateCommandBufferExt();
+    return CreateCommandBufferExt(desc);
 }
 
-CommandBufferExt* GLRenderSystem::CreateCommandBufferExt(const CommandBufferDescriptor& /*desc*/)
+CommandBufferExt* GLRenderSystem::CreateCommandBufferExt(const CommandBufferDescriptor& desc)
 {
     /* Get state manager from shared render context */
     if (auto sharedContext = GetSharedRenderContext())
-        return TakeOwnership(commandBuffers_, MakeUnique<GLCommandBuffer>(sharedContext->GetStateManager()));
+        return TakeOwnership(commandBuffers_, MakeUnique<GLCommandBuffer>(sharedContext->GetStateManager(), desc));
     else
         throw std::runtime_error("cannot create OpenGL command buffer without active render context");
 }
@@ -203,6 +218,20 @@ ComputePipeline* GLRenderSystem::CreateComputePipeline(const ComputePipelineDesc
     return TakeOwnership(computePipelines_, MakeUnique<GLComputePipeline>(desc));
 }
 
+/*
+Shaders are already compiled and linked in the background by the GL driver if GL_KHR_parallel_shader_compile is supported,
+so asynchronous pipelines only need to poll the completion status of their shader program instead of blocking on first use.
+*/
+GraphicsPipeline* GLRenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    return TakeOwnership(graphicsPipelines_, MakeUnique<GLGraphicsPipeline>(desc, GetRenderingCaps().limits, true));
+}
+
+ComputePipeline* GLRenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    return TakeOwnership(computePipelines_, MakeUnique<GLComputePipeline>(desc, true));
+}
+
 void GLRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
     RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
@@ -232,6 +261,14 @@ Fence* GLRenderSystem::CreateFence()
     return TakeOwnership(fences_, MakeUnique<GLFence>());
 }
 
+Fence* GLRenderSystem::CreateTimelineFence(std::uint64_t initialValue)
+{
+    /* Timeline fences are emulated with a ring of sync objects */
+    if (!HasExtension(GLExt::ARB_sync))
+        throw std::runtime_error("timeline fences are not supported, because GL_ARB_sync is not available");
+    return TakeOwnership(fences_, MakeUnique<GLFence>(initialValue));
+}
+
 void GLRenderSystem::Release(Fence& fence)
 {
     RemoveFromUniqueSet(fences_, &fence);
@@ -276,6 +313,12 @@ void GLRenderSystem::LoadGLExtensions(const ProfileOpenGLDescriptor& profileDesc
         auto extensions = QueryExtensions(coreProfile);
         LoadAllExtensions(extensions, coreProfile);
 
+        #ifdef GL_KHR_parallel_shader_compile
+        /* Let the driver compile and link shaders with as many background threads as it supports */
+        if (HasExtension(GLExt::KHR_parallel_shader_compile))
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        #endif
+
         /* Query and store all renderer information and capabilities */
         QueryRendererInfo();
         QueryRenderingCaps();
@@ -13,6 +13,8 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include "../../Core/Assertion.h"
+#include <LLGL/ImageFlags.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -29,12 +31,10 @@ static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
         return GL_LINEAR;
 }
 
-Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+static void GLTexStorage(GLTexture& textureGL, const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
-    auto texture = MakeUnique<GLTexture>(textureDesc.type);
-
     /* Bind texture */
-    GLStateManager::active->BindTexture(*texture);
+    GLStateManager::active->BindTexture(textureGL);
 
     /* Initialize texture parameters for the first time */
     auto target = GLTypes::Map(textureDesc.type);
@@ -54,44 +54,188 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             break;
 
         case TextureType::Texture3D:
-            LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
             GLTexImage3D(textureDesc, imageDesc);
             break;
 
         case TextureType::TextureCube:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
             GLTexImageCube(textureDesc, imageDesc);
             break;
 
         case TextureType::Texture1DArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
             GLTexImage1DArray(textureDesc, imageDesc);
             break;
 
         case TextureType::Texture2DArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
             GLTexImage2DArray(textureDesc, imageDesc);
             break;
 
         case TextureType::TextureCubeArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
             GLTexImageCubeArray(textureDesc, imageDesc);
             break;
 
         case TextureType::Texture2DMS:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasMultiSampleTextures);
             GLTexImage2DMS(textureDesc);
             break;
 
         case TextureType::Texture2DMSArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasMultiSampleTextures);
             GLTexImage2DMSArray(textureDesc);
             break;
 
         default:
-            throw std::invalid_argument("failed to create texture with invalid texture type");
             break;
     }
+}
+
+static bool IsBCnDecompressibleFormat(const Format format)
+{
+    switch (format)
+    {
+        case Format::BC1RGB:
+        case Format::BC1RGBA:
+        case Format::BC2RGBA:
+        case Format::BC3RGBA:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool IsBCnDecompressibleTextureType(const TextureType type)
+{
+    switch (type)
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture3D:
+        case TextureType::TextureCube:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCubeArray:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/*
+Substitutes a block compressed texture format that is not supported by the GL implementation with Format::RGBA8UNorm,
+and decompresses the initial image data into 'imageData' if there is any. Returns true if the format has been substituted.
+*/
+static bool SubstituteUnsupportedCompressedFormat(
+    const RenderingCapabilities&    caps,
+    std::size_t                     threadCount,
+    TextureDescriptor&              textureDesc,
+    SrcImageDescriptor&             imageDesc,
+    ByteBuffer&                     imageData)
+{
+    if (!IsBCnDecompressibleFormat(textureDesc.format) || !IsBCnDecompressibleTextureType(textureDesc.type))
+        return false;
+
+    const auto& formats = caps.textureFormats;
+    if (std::find(formats.begin(), formats.end(), textureDesc.format) != formats.end())
+        return false;
+
+    if (imageDesc.data != nullptr)
+    {
+        /* Decompress all slices of the first MIP-map at once */
+        const auto& extent      = textureDesc.extent;
+        const auto  numSlices   = TextureSize(textureDesc) / (extent.width * extent.height);
+
+        imageData = DecompressImageBuffer(imageDesc, textureDesc.format, { extent.width, extent.height, numSlices }, threadCount);
+
+        imageDesc.format    = ImageFormat::RGBA;
+        imageDesc.dataType  = DataType::UInt8;
+        imageDesc.data      = imageData.get();
+        imageDesc.dataSize  = static_cast<std::size_t>(TextureSize(textureDesc)) * 4;
+    }
+
+    textureDesc.format = Format::RGBA8UNorm;
+
+    return true;
+}
+
+Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    /* Validate texture type against rendering capabilities */
+    ValidateTextureType(textureDesc.type);
+
+    /* Decompress image data if its block compression format is not supported */
+    TextureDescriptor   substTextureDesc    = textureDesc;
+    SrcImageDescriptor  substImageDesc;
+    ByteBuffer          substImageData;
+
+    if (imageDesc != nullptr)
+        substImageDesc = *imageDesc;
+
+    if (SubstituteUnsupportedCompressedFormat(GetRenderingCaps(), GetConfiguration().threadCount, substTextureDesc, substImageDesc, substImageData))
+    {
+        /* Remember original format, so subsequent texture writes are decompressed as well */
+        auto texture = CreateTexture(substTextureDesc, (imageDesc != nullptr ? &substImageDesc : nullptr));
+        LLGL_CAST(GLTexture*, texture)->SetSubstitutedFormat(textureDesc.format);
+        return texture;
+    }
+
+    /* Create texture object and build its storage */
+    auto texture = MakeUnique<GLTexture>(textureDesc.type);
+    GLTexStorage(*texture, textureDesc, imageDesc);
+
+    return TakeOwnership(textures_, std::move(texture));
+}
+
+// Returns a copy of the specified image data, which is owned by the returned container
+static std::shared_ptr<std::vector<char>> CopyImageData(const SrcImageDescriptor& imageDesc)
+{
+    auto imageBytes = reinterpret_cast<const char*>(imageDesc.data);
+    return std::make_shared<std::vector<char>>(imageBytes, imageBytes + imageDesc.dataSize);
+}
+
+Texture* GLRenderSystem::CreateTextureAsync(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc, Fence& fence)
+{
+    auto uploadWorker = GetUploadWorker();
+    if (!uploadWorker)
+        return RenderSystem::CreateTextureAsync(textureDesc, imageDesc, fence);
+
+    /* Validate texture type on this thread, so the exception is thrown to the caller */
+    ValidateTextureType(textureDesc.type);
+
+    auto texture = MakeUnique<GLTexture>(textureDesc.type);
+    auto textureRef = texture.get();
+
+    /* Decompress image data if its block compression format is not supported */
+    TextureDescriptor   substTextureDesc    = textureDesc;
+    SrcImageDescriptor  substImageDesc;
+    ByteBuffer          substImageData;
+
+    if (imageDesc != nullptr)
+        substImageDesc = *imageDesc;
+
+    if (SubstituteUnsupportedCompressedFormat(GetRenderingCaps(), GetConfiguration().threadCount, substTextureDesc, substImageDesc, substImageData))
+    {
+        imageDesc = (imageDesc != nullptr ? &substImageDesc : nullptr);
+        texture->SetSubstitutedFormat(textureDesc.format);
+    }
+
+    /* Copy image data, since the caller may release it before the worker has uploaded it */
+    std::shared_ptr<std::vector<char>> data;
+    SrcImageDescriptor dataImageDesc;
+
+    if (imageDesc != nullptr && imageDesc->data != nullptr)
+    {
+        data                    = CopyImageData(*imageDesc);
+        dataImageDesc           = *imageDesc;
+        dataImageDesc.data      = data->data();
+    }
+
+    /* Build texture storage on the worker thread and restore its texture binding afterwards */
+    uploadWorker->Enqueue(
+        [textureRef, substTextureDesc, data, dataImageDesc]()
+        {
+            GLStateManager::active->PushBoundTexture(GLStateManager::GetTextureTarget(substTextureDesc.type));
+            {
+                GLTexStorage(*textureRef, substTextureDesc, (data ? &dataImageDesc : nullptr));
+            }
+            GLStateManager::active->PopBoundTexture();
+        },
+        LLGL_CAST(GLFence&, fence)
+    );
 
     return TakeOwnership(textures_, std::move(texture));
 }
@@ -103,51 +247,108 @@ void GLRenderSystem::Release(Texture& texture)
 
 /* ----- "WriteTexture..." functions ----- */
 
-void GLRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc)
+/*
+Decompresses the image data of a texture write into 'imageData', if the texture format has been substituted (see SubstituteUnsupportedCompressedFormat).
+Returns the image descriptor that must be used to write the texture.
+*/
+static SrcImageDescriptor DecompressSubstitutedImageData(
+    const GLTexture&            textureGL,
+    const SubTextureDescriptor& subTextureDesc,
+    const SrcImageDescriptor&   imageDesc,
+    std::size_t                 threadCount,
+    ByteBuffer&                 imageData)
 {
-    /* Bind texture and write texture sub data */
-    auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    GLStateManager::active->BindTexture(textureGL);
+    const auto format = textureGL.GetSubstitutedFormat();
+    if (format == Format::Undefined || imageDesc.data == nullptr)
+        return imageDesc;
 
-    /* Write data into specific texture type */
-    switch (texture.GetType())
+    /* Decompress all slices of the sub-texture at once */
+    const auto& extent = subTextureDesc.extent;
+    imageData = DecompressImageBuffer(imageDesc, format, extent, threadCount);
+
+    SrcImageDescriptor decompressedImageDesc;
     {
-        case TextureType::Texture1D:
-            GLTexSubImage1D(subTextureDesc, imageDesc);
-            break;
+        decompressedImageDesc.format    = ImageFormat::RGBA;
+        decompressedImageDesc.dataType  = DataType::UInt8;
+        decompressedImageDesc.data      = imageData.get();
+        decompressedImageDesc.dataSize  = static_cast<std::size_t>(extent.width) * extent.height * extent.depth * 4;
+    }
+    return decompressedImageDesc;
+}
 
-        case TextureType::Texture2D:
-            GLTexSubImage2D(subTextureDesc, imageDesc);
-            break;
+void GLRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& srcImageDesc)
+{
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
 
-        case TextureType::Texture3D:
-            LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
-            GLTexSubImage3D(subTextureDesc, imageDesc);
-            break;
+    /* Validate texture type against rendering capabilities */
+    ValidateTextureType(texture.GetType());
 
-        case TextureType::TextureCube:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
-            GLTexSubImageCube(subTextureDesc, imageDesc);
-            break;
+    /* Decompress image data if the texture format has been substituted */
+    ByteBuffer decompressedData;
+    const auto imageDesc = DecompressSubstitutedImageData(textureGL, subTextureDesc, srcImageDesc, GetConfiguration().threadCount, decompressedData);
 
-        case TextureType::Texture1DArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage1DArray(subTextureDesc, imageDesc);
-            break;
+    /* Stream image data through the pixel unpack ring, so the driver does not copy the client memory synchronously */
+    if (GLPixelUnpackRing::IsSupported())
+    {
+        GLintptr offset = 0;
 
-        case TextureType::Texture2DArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage2DArray(subTextureDesc, imageDesc);
-            break;
+        GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER);
+        if (pixelUnpackRing_.Write(imageDesc.data, imageDesc.dataSize, offset))
+        {
+            /* Write texture sub data from PBO, where the data pointer specifies the offset within the PBO */
+            auto pboImageDesc = imageDesc;
+            pboImageDesc.data = reinterpret_cast<const void*>(offset);
+            WriteTextureSubImage(textureGL, subTextureDesc, pboImageDesc);
+
+            GLStateManager::active->PopBoundBuffer();
+            pixelUnpackRing_.Fence();
+            return;
+        }
+        GLStateManager::active->PopBoundBuffer();
+    }
 
-        case TextureType::TextureCubeArray:
-            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
-            GLTexSubImageCubeArray(subTextureDesc, imageDesc);
-            break;
+    /* Write texture sub data directly from client memory */
+    WriteTextureSubImage(textureGL, subTextureDesc, imageDesc);
+}
 
-        default:
-            break;
+void GLRenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc, Fence& fence)
+{
+    auto uploadWorker = GetUploadWorker();
+    if (!uploadWorker)
+    {
+        RenderSystem::WriteTextureAsync(texture, subTextureDesc, imageDesc, fence);
+        return;
     }
+
+    LLGL_ASSERT_PTR(imageDesc.data);
+
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    auto textureRef = (&textureGL);
+
+    /* Validate texture type on this thread, so the exception is thrown to the caller */
+    ValidateTextureType(texture.GetType());
+
+    /* Decompress image data if the texture format has been substituted */
+    ByteBuffer decompressedData;
+    const auto substImageDesc = DecompressSubstitutedImageData(textureGL, subTextureDesc, imageDesc, GetConfiguration().threadCount, decompressedData);
+
+    /* Copy image data, since the caller may release it before the worker has uploaded it */
+    auto data = CopyImageData(substImageDesc);
+    auto dataImageDesc = substImageDesc;
+    dataImageDesc.data = data->data();
+
+    /* Write texture sub data on the worker thread and restore its texture binding afterwards */
+    uploadWorker->Enqueue(
+        [this, textureRef, subTextureDesc, data, dataImageDesc]()
+        {
+            GLStateManager::active->PushBoundTexture(GLStateManager::GetTextureTarget(textureRef->GetType()));
+            {
+                WriteTextureSubImage(*textureRef, subTextureDesc, dataImageDesc);
+            }
+            GLStateManager::active->PopBoundTexture();
+        },
+        LLGL_CAST(GLFence&, fence)
+    );
 }
 
 void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
@@ -184,6 +385,53 @@ void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel,
     }
 }
 
+TextureReadHandle GLRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence)
+{
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+
+    /* Determine native image format and required size of the texture data */
+    ImageFormat format;
+    DataType    dataType;
+    GetTextureReadFormat(textureGL.QueryDesc().format, format, dataType);
+
+    const auto extent   = textureGL.QueryMipExtent(mipLevel);
+    const auto dataSize = ImageDataSize(format, dataType, extent.width * extent.height * extent.depth);
+
+    /* Read texture data into pixel pack buffer and signal fence once the copy has finished */
+    TextureReadHandle handle;
+    handle.id = pixelPackRing_.ReadTexture(textureGL, static_cast<GLint>(mipLevel), format, dataType, dataSize);
+
+    commandQueue_->Submit(fence);
+
+    return handle;
+}
+
+void GLRenderSystem::ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc)
+{
+    if (imageDesc.data != nullptr)
+    {
+        /* Map pixel pack buffer and copy image data into output buffer */
+        SrcImageDescriptor srcImageDesc;
+        if (!pixelPackRing_.Map(handle.id, srcImageDesc))
+        {
+            pixelPackRing_.Release(handle.id);
+            throw std::invalid_argument("cannot resolve texture read with invalid handle");
+        }
+
+        try
+        {
+            CopyTextureReadData(srcImageDesc, imageDesc);
+        }
+        catch (...)
+        {
+            pixelPackRing_.Release(handle.id);
+            throw;
+        }
+    }
+
+    pixelPackRing_.Release(handle.id);
+}
+
 void GLRenderSystem::GenerateMips(Texture& texture)
 {
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
@@ -244,11 +492,115 @@ void GLRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
     }
 }
 
+void GLRenderSystem::GenerateMipsAsync(Texture& texture, Fence& fence)
+{
+    auto uploadWorker = GetUploadWorker();
+    if (!uploadWorker)
+    {
+        RenderSystem::GenerateMipsAsync(texture, fence);
+        return;
+    }
+
+    /* Generate MIP-maps on the worker thread (GenerateMipsPrimary restores the texture binding) */
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    auto texID      = textureGL.GetID();
+    auto texType    = textureGL.GetType();
+
+    uploadWorker->Enqueue(
+        [this, texID, texType]()
+        {
+            GenerateMipsPrimary(texID, texType);
+        },
+        LLGL_CAST(GLFence&, fence)
+    );
+}
+
 
 /*
  * ======= Private: =======
  */
 
+void GLRenderSystem::ValidateTextureType(const TextureType type)
+{
+    /* Validate texture type against rendering capabilities */
+    switch (type)
+    {
+        case TextureType::Texture1D:
+        case TextureType::Texture2D:
+            break;
+        case TextureType::Texture3D:
+            LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
+            break;
+        case TextureType::TextureCube:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
+            break;
+        case TextureType::Texture1DArray:
+        case TextureType::Texture2DArray:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
+            break;
+        case TextureType::TextureCubeArray:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
+            break;
+        case TextureType::Texture2DMS:
+        case TextureType::Texture2DMSArray:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasMultiSampleTextures);
+            break;
+        default:
+            throw std::invalid_argument("failed to create texture with invalid texture type");
+            break;
+    }
+}
+
+void GLRenderSystem::WriteTextureSubImage(GLTexture& textureGL, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Write texture sub data directly using DSA */
+        GLTextureSubImage(textureGL.GetID(), textureGL.GetType(), subTextureDesc, imageDesc);
+        return;
+    }
+    #endif
+
+    /* Bind texture and write texture sub data */
+    GLStateManager::active->BindTexture(textureGL);
+
+    /* Write data into specific texture type */
+    switch (textureGL.GetType())
+    {
+        case TextureType::Texture1D:
+            GLTexSubImage1D(subTextureDesc, imageDesc);
+            break;
+
+        case TextureType::Texture2D:
+            GLTexSubImage2D(subTextureDesc, imageDesc);
+            break;
+
+        case TextureType::Texture3D:
+            GLTexSubImage3D(subTextureDesc, imageDesc);
+            break;
+
+        case TextureType::TextureCube:
+            GLTexSubImageCube(subTextureDesc, imageDesc);
+            break;
+
+        case TextureType::Texture1DArray:
+            GLTexSubImage1DArray(subTextureDesc, imageDesc);
+            break;
+
+        case TextureType::Texture2DArray:
+            GLTexSubImage2DArray(subTextureDesc, imageDesc);
+            break;
+
+        case TextureType::TextureCubeArray:
+            GLTexSubImageCubeArray(subTextureDesc, imageDesc);
+            break;
+
+        default:
+            break;
+    }
+}
+
 void GLRenderSystem::GenerateMipsPrimary(GLuint texID, const TextureType texType)
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
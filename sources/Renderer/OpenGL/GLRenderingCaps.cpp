@@ -250,6 +250,7 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasConservativeRasterization   = ( HasExtension(GLExt::NV_conservative_raster) || HasExtension(GLExt::INTEL_conservative_rasterization) );
     features.hasStreamOutputs               = ( HasExtension(GLExt::EXT_transform_feedback) || HasExtension(GLExt::NV_transform_feedback) );
     features.hasLogicOp                     = true;
+    features.hasTimelineFences              = HasExtension(GLExt::ARB_sync);
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits)
@@ -0,0 +1,140 @@
+/*
+ * GLUploadWorker.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLUploadWorker.h"
+#include "Ext/GLExtensions.h"
+#include "../GLCommon/GLExtensionRegistry.h"
+#include <LLGL/Log.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+GLUploadWorker::~GLUploadWorker()
+{
+    Stop();
+}
+
+bool GLUploadWorker::Start(GLContext& sharedContext)
+{
+    if (started_)
+        return IsRunning();
+
+    started_ = true;
+
+    /* Create shared context on the calling thread, but keep its state manager from becoming active here */
+    auto prevStateMngr = GLStateManager::active;
+    {
+        try
+        {
+            context_ = sharedContext.CreateSharedContext();
+        }
+        catch (const std::exception& e)
+        {
+            Log::StdErr() << e.what() << std::endl;
+        }
+    }
+    GLStateManager::active = prevStateMngr;
+
+    if (!context_)
+        return false;
+
+    /* Start worker thread */
+    quit_   = false;
+    thread_ = std::thread(&GLUploadWorker::Run, this);
+
+    return true;
+}
+
+void GLUploadWorker::Stop()
+{
+    if (IsRunning())
+    {
+        /* Signal worker thread to quit after all remaining jobs have been executed */
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            quit_ = true;
+        }
+        cond_.notify_one();
+        thread_.join();
+    }
+    context_.reset();
+}
+
+void GLUploadWorker::Enqueue(const Job& job, GLFence& fence)
+{
+    /* Mark fence as pending, so waiting for it blocks until the worker has submitted it */
+    fence.Reset();
+
+    /* Append job to queue and wake up worker thread */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        tasks_.push_back({ job, &fence });
+    }
+    cond_.notify_one();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLUploadWorker::Run()
+{
+    /* Make shared context current on this thread; this also activates its own state manager */
+    if (!GLContext::MakeCurrent(context_.get()))
+        Log::StdErr() << "failed to make shared OpenGL context current on upload worker thread" << std::endl;
+
+    GLStateManager::active->DetermineExtensionsAndLimits();
+
+    /* Use the same pixel storage as the render contexts */
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    while (true)
+    {
+        /* Wait for next job */
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock { mutex_ };
+            cond_.wait(lock, [this]() { return (quit_ || !tasks_.empty()); });
+
+            if (tasks_.empty())
+                break;
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        /* Execute job; errors cannot be reported to the render thread, so print them to the log */
+        try
+        {
+            task.job();
+        }
+        catch (const std::exception& e)
+        {
+            Log::StdErr() << e.what() << std::endl;
+        }
+
+        /* Publish completion to the render thread and flush, so the sync object can be signaled */
+        if (!HasExtension(GLExt::ARB_sync))
+            glFinish();
+
+        task.fence->Submit();
+        glFlush();
+    }
+
+    GLContext::MakeCurrent(nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
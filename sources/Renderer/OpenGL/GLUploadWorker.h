@@ -0,0 +1,93 @@
+/*
+ * GLUploadWorker.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_UPLOAD_WORKER_H
+#define LLGL_GL_UPLOAD_WORKER_H
+
+
+#include "Platform/GLContext.h"
+#include "RenderState/GLFence.h"
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/*
+Background thread that executes resource upload jobs with its own GL context.
+The context shares all GL objects with the render context, but has its own state manager.
+Completion of each job is published to the render thread by submitting a GLFence on the worker's context.
+*/
+class GLUploadWorker
+{
+
+    public:
+
+        using Job = std::function<void()>;
+
+        GLUploadWorker() = default;
+        ~GLUploadWorker();
+
+        GLUploadWorker(const GLUploadWorker&) = delete;
+        GLUploadWorker& operator = (const GLUploadWorker&) = delete;
+
+        /*
+        Creates a context that is shared with the specified context and starts the worker thread.
+        Only the first call has an effect. Returns false if the platform does not support shared contexts for multi-threading.
+        */
+        bool Start(GLContext& sharedContext);
+
+        // Executes all remaining jobs, then stops the worker thread and releases its GL context.
+        void Stop();
+
+        // Enqueues the specified job. The fence is reset immediately and submitted after the job has been executed.
+        void Enqueue(const Job& job, GLFence& fence);
+
+        // Returns true if the worker thread is running.
+        inline bool IsRunning() const
+        {
+            return thread_.joinable();
+        }
+
+    private:
+
+        struct Task
+        {
+            Job         job;
+            GLFence*    fence = nullptr;
+        };
+
+        void Run();
+
+    private:
+
+        std::unique_ptr<GLContext>  context_;
+        bool                        started_    = false;
+
+        std::thread                 thread_;
+        std::mutex                  mutex_;
+        std::condition_variable     cond_;
+        std::deque<Task>            tasks_;
+        bool                        quit_       = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
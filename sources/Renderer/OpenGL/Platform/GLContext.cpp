@@ -6,13 +6,15 @@
  */
 
 #include "GLContext.h"
+#include <stdexcept>
 
 
 namespace LLGL
 {
 
 
-static GLContext* g_activeGLContext = nullptr;
+// Each thread has its own current GL context
+static thread_local GLContext* g_activeGLContext = nullptr;
 
 GLContext::GLContext(GLContext* sharedContext)
 {
@@ -27,6 +29,20 @@ GLContext::~GLContext()
     // dummy
 }
 
+#ifndef LLGL_GL_ENABLE_EGL
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RenderContextDescriptor& /*desc*/, GLContext* /*sharedContext*/)
+{
+    throw std::runtime_error("headless OpenGL contexts are not supported (requires LLGL_GL_ENABLE_EGL on Linux)");
+}
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+std::unique_ptr<GLContext> GLContext::CreateSharedContext()
+{
+    return nullptr; // dummy
+}
+
 bool GLContext::MakeCurrent(GLContext* context)
 {
     bool result = true;
@@ -30,6 +30,12 @@ class GLContext
         // Creates a platform specific GLContext instance.
         static std::unique_ptr<GLContext> Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext);
 
+        /*
+        Creates a platform specific GLContext instance without any surface (Linux: EGL with surfaceless or pbuffer context).
+        Throws std::runtime_error if headless contexts are not supported on the current platform.
+        */
+        static std::unique_ptr<GLContext> CreateHeadless(const RenderContextDescriptor& desc, GLContext* sharedContext);
+
         // Makes the specified GLContext current. If null, the current context will be deactivated.
         static bool MakeCurrent(GLContext* context);
 
@@ -45,6 +51,13 @@ class GLContext
         // Resizes the GL context. This is called after the context surface has been resized.
         virtual void Resize(const Extent2D& resolution) = 0;
 
+        /*
+        Creates a new GL context that shares all GL objects with this context but has its own state manager,
+        e.g. to upload resources from a worker thread. The new context is not made current.
+        Returns null if the platform does not support shared contexts for multi-threading.
+        */
+        virtual std::unique_ptr<GLContext> CreateSharedContext();
+
         inline const std::shared_ptr<GLStateManager>& GetStateManager() const
         {
             return stateMngr_;
@@ -52,6 +65,7 @@ class GLContext
 
     protected:
 
+        // Constructs the context and shares the state manager with the specified context (if not null).
         GLContext(GLContext* sharedContext);
 
         // Activates or deactivates this GLContext (Win32: wglMakeCurrent, X11: glXMakeCurrent).
@@ -0,0 +1,317 @@
+/*
+ * LinuxEGLContext.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+
+#include "LinuxEGLContext.h"
+#include "../../../CheckedCast.h"
+#include "../../../../Core/Helper.h"
+#include <LLGL/Log.h>
+#include <cstring>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Returns true if the specified space separated list of EGL extensions contains the specified extension name.
+static bool HasEGLExtension(const char* extensions, const char* name)
+{
+    if (extensions != nullptr)
+    {
+        const auto nameLen = std::strlen(name);
+        for (auto s = std::strstr(extensions, name); s != nullptr; s = std::strstr(s + nameLen, name))
+        {
+            /* Only accept whole names, e.g. "EGL_KHR_create_context" must not match "EGL_KHR_create_context_no_error" */
+            if ((s == extensions || s[-1] == ' ') && (s[nameLen] == '\0' || s[nameLen] == ' '))
+                return true;
+        }
+    }
+    return false;
+}
+
+// Returns the EGL display of the surfaceless platform (EGL_MESA_platform_surfaceless), or EGL_NO_DISPLAY if it's not supported.
+static EGLDisplay GetSurfacelessPlatformDisplay()
+{
+    /* Client extensions can be queried without display (EGL_EXT_client_extensions) */
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    if (HasEGLExtension(clientExtensions, "EGL_EXT_platform_base") &&
+        HasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+    {
+        auto eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (eglGetPlatformDisplayEXT != nullptr)
+            return eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+
+    return EGL_NO_DISPLAY;
+}
+
+
+/*
+ * GLContext class
+ */
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(const RenderContextDescriptor& desc, GLContext* sharedContext)
+{
+    LinuxEGLContext* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxEGLContext*, sharedContext) : nullptr);
+    return MakeUnique<LinuxEGLContext>(desc, sharedContextEGL);
+}
+
+
+/*
+ * LinuxEGLContext class
+ */
+
+LinuxEGLContext::LinuxEGLContext(const RenderContextDescriptor& desc, LinuxEGLContext* sharedContext) :
+    GLContext { sharedContext }
+{
+    EGLContext eglcShared = EGL_NO_CONTEXT;
+
+    /* Share EGL display connection with the shared context or create a new one */
+    if (sharedContext != nullptr)
+    {
+        connection_ = sharedContext->connection_;
+        eglcShared  = sharedContext->eglc_;
+    }
+    else
+        CreateDisplayConnection(desc.videoMode);
+
+    /* Create OpenGL context with EGL */
+    if (!connection_->surfaceless)
+        CreatePbufferSurface();
+
+    CreateEGLContext(desc.profileOpenGL, eglcShared);
+
+    if (eglc_ == EGL_NO_CONTEXT)
+    {
+        DeleteContext();
+        throw std::runtime_error("failed to create headless OpenGL context (eglCreateContext)");
+    }
+
+    /* Make new OpenGL context current */
+    if (eglMakeCurrent(connection_->display, surface_, surface_, eglc_) != EGL_TRUE)
+        Log::StdErr() << "failed to make OpenGL render context current (eglMakeCurrent)" << std::endl;
+}
+
+LinuxEGLContext::LinuxEGLContext(const LinuxEGLContext& sharedContext, const ProfileOpenGLDescriptor& profileDesc) :
+    GLContext   { nullptr                   },
+    connection_ { sharedContext.connection_ }
+{
+    if (!connection_->surfaceless)
+        CreatePbufferSurface();
+
+    CreateEGLContext(profileDesc, sharedContext.eglc_);
+
+    if (eglc_ == EGL_NO_CONTEXT)
+    {
+        DeleteContext();
+        throw std::runtime_error("failed to create shared headless OpenGL context (eglCreateContext)");
+    }
+}
+
+LinuxEGLContext::~LinuxEGLContext()
+{
+    DeleteContext();
+}
+
+bool LinuxEGLContext::SetSwapInterval(int /*interval*/)
+{
+    /* Headless contexts never present anything, so there is no swap interval */
+    return true;
+}
+
+bool LinuxEGLContext::SwapBuffers()
+{
+    /* Headless contexts have no back buffer to present */
+    return true;
+}
+
+void LinuxEGLContext::Resize(const Extent2D& /*resolution*/)
+{
+    // dummy
+}
+
+std::unique_ptr<GLContext> LinuxEGLContext::CreateSharedContext()
+{
+    /* Create context with the same profile and display, which can be made current on another thread */
+    return std::unique_ptr<GLContext>(new LinuxEGLContext(*this, profile_));
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+LinuxEGLContext::DisplayConnection::~DisplayConnection()
+{
+    if (display != EGL_NO_DISPLAY)
+        eglTerminate(display);
+}
+
+bool LinuxEGLContext::Activate(bool activate)
+{
+    /* Bind rendering API on this thread, since it also determines which context is released */
+    eglBindAPI(EGL_OPENGL_API);
+
+    if (activate)
+        return (eglMakeCurrent(connection_->display, surface_, surface_, eglc_) == EGL_TRUE);
+    else
+        return (eglMakeCurrent(connection_->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+}
+
+void LinuxEGLContext::CreateDisplayConnection(const VideoModeDescriptor& videoModeDesc)
+{
+    connection_ = std::make_shared<DisplayConnection>();
+
+    /* Initialize EGL display of the surfaceless platform, or fall back to the default display */
+    EGLint versionMajor = 0, versionMinor = 0;
+
+    connection_->display = GetSurfacelessPlatformDisplay();
+    if (connection_->display == EGL_NO_DISPLAY || eglInitialize(connection_->display, &versionMajor, &versionMinor) != EGL_TRUE)
+    {
+        connection_->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (connection_->display == EGL_NO_DISPLAY || eglInitialize(connection_->display, &versionMajor, &versionMinor) != EGL_TRUE)
+        {
+            connection_->display = EGL_NO_DISPLAY;
+            throw std::runtime_error("failed to initialize EGL display for headless OpenGL context");
+        }
+    }
+
+    /* Without EGL_KHR_surfaceless_context, each context needs a pbuffer to be made current */
+    const char* displayExtensions = eglQueryString(connection_->display, EGL_EXTENSIONS);
+    connection_->surfaceless = HasEGLExtension(displayExtensions, "EGL_KHR_surfaceless_context");
+
+    /* Context versions and profiles require EGL 1.5 or EGL_KHR_create_context (both use the same tokens) */
+    connection_->createContext =
+    (
+        (versionMajor > 1 || (versionMajor == 1 && versionMinor >= 5)) ||
+        HasEGLExtension(displayExtensions, "EGL_KHR_create_context")
+    );
+
+    /* Choose EGL configuration; the surface type mask 0 matches all configurations */
+    const EGLint configAttribs[] =
+    {
+        EGL_SURFACE_TYPE,       (connection_->surfaceless ? 0 : EGL_PBUFFER_BIT),
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_ALPHA_SIZE,         (videoModeDesc.colorBits == 32 ? 8 : 0),
+        EGL_DEPTH_SIZE,         videoModeDesc.depthBits,
+        EGL_STENCIL_SIZE,       videoModeDesc.stencilBits,
+        EGL_NONE
+    };
+
+    EGLint numConfigs = 0;
+    if (eglChooseConfig(connection_->display, configAttribs, &connection_->config, 1, &numConfigs) != EGL_TRUE || numConfigs < 1)
+        throw std::runtime_error("failed to choose EGL configuration for headless OpenGL context");
+}
+
+void LinuxEGLContext::CreateEGLContext(const ProfileOpenGLDescriptor& profileDesc, EGLContext eglcShared)
+{
+    /* Store profile for shared contexts */
+    profile_ = profileDesc;
+
+    /* The current rendering API is a per-thread state (the default is OpenGL ES) */
+    if (eglBindAPI(EGL_OPENGL_API) != EGL_TRUE)
+        throw std::runtime_error("failed to bind OpenGL API for EGL context");
+
+    if (profileDesc.contextProfile == OpenGLContextProfile::CoreProfile)
+    {
+        /* Create core profile */
+        eglc_ = CreateContextCoreProfile(eglcShared, profileDesc.majorVersion, profileDesc.minorVersion);
+    }
+
+    if (eglc_ == EGL_NO_CONTEXT)
+    {
+        /* Create compatibility profile */
+        eglc_ = CreateContextCompatibilityProfile(eglcShared);
+    }
+}
+
+void LinuxEGLContext::CreatePbufferSurface()
+{
+    /* Create smallest possible pbuffer, since all rendering goes into render targets */
+    const EGLint pbufferAttribs[] =
+    {
+        EGL_WIDTH,  1,
+        EGL_HEIGHT, 1,
+        EGL_NONE
+    };
+
+    surface_ = eglCreatePbufferSurface(connection_->display, connection_->config, pbufferAttribs);
+    if (surface_ == EGL_NO_SURFACE)
+        throw std::runtime_error("failed to create EGL pbuffer surface for headless OpenGL context");
+}
+
+void LinuxEGLContext::DeleteContext()
+{
+    if (eglc_ != EGL_NO_CONTEXT)
+    {
+        /* Release context first if it's current on this thread, otherwise its deletion would be deferred */
+        if (eglGetCurrentContext() == eglc_)
+            eglMakeCurrent(connection_->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(connection_->display, eglc_);
+        eglc_ = EGL_NO_CONTEXT;
+    }
+    if (surface_ != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(connection_->display, surface_);
+        surface_ = EGL_NO_SURFACE;
+    }
+}
+
+EGLContext LinuxEGLContext::CreateContextCoreProfile(EGLContext eglcShared, int major, int minor)
+{
+    /* Check if highest version possible shall be used */
+    if (major < 0 || minor < 0)
+    {
+        /* Set to fixed value since 'glGetIntegerv' can not be used until a valid GL context has been created */
+        major = 3;
+        minor = 2;
+    }
+
+    if (connection_->createContext)
+    {
+        /* Create core profile */
+        const EGLint contextAttribs[] =
+        {
+            EGL_CONTEXT_MAJOR_VERSION_KHR,          major,
+            EGL_CONTEXT_MINOR_VERSION_KHR,          minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+            EGL_NONE
+        };
+
+        auto eglc = eglCreateContext(connection_->display, connection_->config, eglcShared, contextAttribs);
+        if (eglc != EGL_NO_CONTEXT)
+            return eglc;
+    }
+
+    /* Context creation failed */
+    Log::StdErr() << "failed to create OpenGL core profile" << std::endl;
+
+    return EGL_NO_CONTEXT;
+}
+
+EGLContext LinuxEGLContext::CreateContextCompatibilityProfile(EGLContext eglcShared)
+{
+    /* Create compatibility profile */
+    return eglCreateContext(connection_->display, connection_->config, eglcShared, nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+
+
+// ================================================================================
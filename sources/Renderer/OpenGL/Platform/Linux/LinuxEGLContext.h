@@ -0,0 +1,87 @@
+/*
+ * LinuxEGLContext.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_LINUX_EGL_CONTEXT_H
+#define LLGL_LINUX_EGL_CONTEXT_H
+
+
+#ifdef LLGL_GL_ENABLE_EGL
+
+
+#include "../GLContext.h"
+#include "../../OpenGL.h"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+
+namespace LLGL
+{
+
+
+// Headless GL context via EGL, which requires neither an X11 display nor a window (see RenderContextDescriptor::headless).
+class LinuxEGLContext : public GLContext
+{
+
+    public:
+
+        LinuxEGLContext(const RenderContextDescriptor& desc, LinuxEGLContext* sharedContext);
+        ~LinuxEGLContext();
+
+        bool SetSwapInterval(int interval) override;
+        bool SwapBuffers() override;
+        void Resize(const Extent2D& resolution) override;
+
+        std::unique_ptr<GLContext> CreateSharedContext() override;
+
+    private:
+
+        // EGL display connection that is shared between all contexts and terminated with the last one.
+        struct DisplayConnection
+        {
+            ~DisplayConnection();
+
+            EGLDisplay  display         = EGL_NO_DISPLAY;
+            EGLConfig   config          = nullptr;
+            bool        surfaceless     = false;    // EGL_KHR_surfaceless_context; otherwise each context has a 1x1 pbuffer
+            bool        createContext   = false;    // EGL 1.5 or EGL_KHR_create_context for core profiles
+        };
+
+    private:
+
+        // Constructs a context that shares all GL objects with the specified context but not its state manager.
+        LinuxEGLContext(const LinuxEGLContext& sharedContext, const ProfileOpenGLDescriptor& profileDesc);
+
+        bool Activate(bool activate) override;
+
+        void CreateDisplayConnection(const VideoModeDescriptor& videoModeDesc);
+        void CreateEGLContext(const ProfileOpenGLDescriptor& profileDesc, EGLContext eglcShared);
+        void CreatePbufferSurface();
+        void DeleteContext();
+
+        EGLContext CreateContextCoreProfile(EGLContext eglcShared, int major, int minor);
+        EGLContext CreateContextCompatibilityProfile(EGLContext eglcShared);
+
+        std::shared_ptr<DisplayConnection>  connection_;
+        EGLContext                          eglc_       = EGL_NO_CONTEXT;
+        EGLSurface                          surface_    = EGL_NO_SURFACE;
+
+        ProfileOpenGLDescriptor             profile_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -52,9 +52,33 @@ LinuxGLContext::LinuxGLContext(const RenderContextDescriptor& desc, Surface& sur
     CreateContext(desc, nativeHandle, sharedContext);
 }
 
+LinuxGLContext::LinuxGLContext(const LinuxGLContext& sharedContext, const ProfileOpenGLDescriptor& profileDesc) :
+    GLContext { nullptr                },
+    wnd_      { sharedContext.wnd_     },
+    visual_   { sharedContext.visual_  }
+{
+    /*
+    Open a separate connection to the same X server, since this context is made current on another thread
+    and Xlib is not thread-safe for a single display connection unless XInitThreads has been called before.
+    */
+    display_ = XOpenDisplay(DisplayString(sharedContext.display_));
+    if (!display_)
+        throw std::runtime_error("failed to open X11 display for shared OpenGL context");
+    ownsDisplay_ = true;
+
+    CreateGLXContext(profileDesc, sharedContext.glc_);
+    if (!glc_)
+    {
+        XCloseDisplay(display_);
+        throw std::runtime_error("failed to create shared OpenGL context on X11 client");
+    }
+}
+
 LinuxGLContext::~LinuxGLContext()
 {
     DeleteContext();
+    if (ownsDisplay_)
+        XCloseDisplay(display_);
 }
 
 bool LinuxGLContext::SetSwapInterval(int interval)
@@ -77,6 +101,12 @@ void LinuxGLContext::Resize(const Extent2D& resolution)
     //TODO...
 }
 
+std::unique_ptr<GLContext> LinuxGLContext::CreateSharedContext()
+{
+    /* Create context with the same profile and window, which can be made current on another thread */
+    return std::unique_ptr<GLContext>(new LinuxGLContext(*this, profile_));
+}
+
 
 /*
  * ======= Private: =======
@@ -87,7 +117,7 @@ bool LinuxGLContext::Activate(bool activate)
     if (activate)
         return glXMakeCurrent(display_, wnd_, glc_);
     else
-        return glXMakeCurrent(nullptr, 0, 0);
+        return glXMakeCurrent(display_, None, nullptr);
 }
 
 void LinuxGLContext::CreateContext(const RenderContextDescriptor& contextDesc, const NativeHandle& nativeHandle, LinuxGLContext* sharedContext)
@@ -103,7 +133,17 @@ void LinuxGLContext::CreateContext(const RenderContextDescriptor& contextDesc, c
         throw std::invalid_argument("failed to create OpenGL context on X11 client, due to missing arguments");
 
     /* Create OpenGL context with X11 lib */
-    const auto& profileDesc = contextDesc.profileOpenGL;
+    CreateGLXContext(contextDesc.profileOpenGL, glcShared);
+
+    /* Make new OpenGL context current */
+    if (glXMakeCurrent(display_, wnd_, glc_) != True)
+        Log::StdErr() << "failed to make OpenGL render context current (glXMakeCurrent)" << std::endl;
+}
+
+void LinuxGLContext::CreateGLXContext(const ProfileOpenGLDescriptor& profileDesc, GLXContext glcShared)
+{
+    /* Store profile for shared contexts */
+    profile_ = profileDesc;
 
     if (profileDesc.contextProfile == OpenGLContextProfile::CoreProfile)
     {
@@ -116,10 +156,6 @@ void LinuxGLContext::CreateContext(const RenderContextDescriptor& contextDesc, c
         /* Create compatibility profile */
         glc_ = CreateContextCompatibilityProfile(glcShared);
     }
-
-    /* Make new OpenGL context current */
-    if (glXMakeCurrent(display_, wnd_, glc_) != True)
-        Log::StdErr() << "failed to make OpenGL render context current (glXMakeCurrent)" << std::endl;
 }
 
 void LinuxGLContext::DeleteContext()
@@ -181,7 +217,7 @@ GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int ma
                 None
             };
 
-            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], nullptr, True, contextAttribs);
+            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], glcShared, True, contextAttribs);
 
             XFree(fbcList);
 
@@ -31,20 +31,29 @@ class LinuxGLContext : public GLContext
         bool SwapBuffers() override;
         void Resize(const Extent2D& resolution) override;
 
+        std::unique_ptr<GLContext> CreateSharedContext() override;
+
     private:
 
+        // Constructs a context that shares all GL objects with the specified context but not its state manager.
+        LinuxGLContext(const LinuxGLContext& sharedContext, const ProfileOpenGLDescriptor& profileDesc);
+
         bool Activate(bool activate) override;
 
         void CreateContext(const RenderContextDescriptor& contextDesc, const NativeHandle& nativeHandle, LinuxGLContext* sharedContext);
+        void CreateGLXContext(const ProfileOpenGLDescriptor& profileDesc, GLXContext glcShared);
         void DeleteContext();
 
         GLXContext CreateContextCoreProfile(GLXContext glcShared, int major, int minor);
         GLXContext CreateContextCompatibilityProfile(GLXContext glcShared);
 
-        ::Display*      display_    = nullptr;
-        ::Window        wnd_        = 0;
-        XVisualInfo*    visual_     = nullptr;
-        GLXContext      glc_        = nullptr;
+        ::Display*      display_        = nullptr;
+        ::Window        wnd_            = 0;
+        XVisualInfo*    visual_         = nullptr;
+        GLXContext      glc_            = nullptr;
+        bool            ownsDisplay_    = false; // Shared contexts for other threads have their own display connection
+
+        ProfileOpenGLDescriptor profile_;
 
 };
 
@@ -48,6 +48,16 @@ Win32GLContext::Win32GLContext(const RenderContextDescriptor& desc, Surface& sur
         CreateContext(nullptr);
 }
 
+Win32GLContext::Win32GLContext(const Win32GLContext& sharedContext) :
+    GLContext    { nullptr                    },
+    pixelFormat_ { sharedContext.pixelFormat_ },
+    hDC_         { sharedContext.hDC_         },
+    desc_        { sharedContext.desc_        },
+    surface_     { sharedContext.surface_     }
+{
+    CreateSharedHardwareContext(sharedContext.hGLRC_);
+}
+
 Win32GLContext::~Win32GLContext()
 {
     DeleteContext();
@@ -72,6 +82,12 @@ void Win32GLContext::Resize(const Extent2D& resolution)
     // do nothing (WGL context does not need to be resized)
 }
 
+std::unique_ptr<GLContext> Win32GLContext::CreateSharedContext()
+{
+    /* Create context with the same device context and pixel format, which can be made current on another thread */
+    return std::unique_ptr<GLContext>(new Win32GLContext(*this));
+}
+
 
 /*
  * ======= Private: =======
@@ -198,6 +214,26 @@ void Win32GLContext::CreateContext(Win32GLContext* sharedContext)
     //QueryGLVersion();
 }
 
+void Win32GLContext::CreateSharedHardwareContext(HGLRC sharedGLRC)
+{
+    /* Create own hardware context, which must not be made current on this thread */
+    if (desc_.profileOpenGL.contextProfile != OpenGLContextProfile::CompatibilityProfile && wglCreateContextAttribsARB != nullptr)
+    {
+        /* Create extended profile and share resources with the specified context */
+        hGLRC_ = CreateExtContextProfile(sharedGLRC);
+    }
+    else
+    {
+        /* Create standard profile and share resources with the specified context */
+        hGLRC_ = CreateStdContextProfile();
+        if (hGLRC_ && !wglShareLists(sharedGLRC, hGLRC_))
+            DeleteGLContext(hGLRC_);
+    }
+
+    if (!hGLRC_)
+        throw std::runtime_error("failed to create shared OpenGL render context");
+}
+
 void Win32GLContext::DeleteContext()
 {
     if (!hasSharedContext_)
@@ -31,11 +31,17 @@ class Win32GLContext : public GLContext
         bool SwapBuffers() override;
         void Resize(const Extent2D& resolution) override;
 
+        std::unique_ptr<GLContext> CreateSharedContext() override;
+
     private:
 
+        // Constructs a context that shares all GL objects with the specified context but not its state manager.
+        Win32GLContext(const Win32GLContext& sharedContext);
+
         bool Activate(bool activate) override;
 
         void CreateContext(Win32GLContext* sharedContext);
+        void CreateSharedHardwareContext(HGLRC sharedGLRC);
         void DeleteContext();
 
         void DeleteGLContext(HGLRC& renderContext);
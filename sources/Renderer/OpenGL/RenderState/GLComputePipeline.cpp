@@ -15,7 +15,8 @@ namespace LLGL
 {
 
 
-GLComputePipeline::GLComputePipeline(const ComputePipelineDescriptor& desc)
+GLComputePipeline::GLComputePipeline(const ComputePipelineDescriptor& desc, bool asyncLink) :
+    asyncLink_ { asyncLink }
 {
     /* Convert shader state */
     shaderProgram_ = LLGL_CAST(GLShaderProgram*, desc.shaderProgram);
@@ -23,6 +24,17 @@ GLComputePipeline::GLComputePipeline(const ComputePipelineDescriptor& desc)
         throw std::invalid_argument("failed to create compute pipeline due to missing shader program");
 }
 
+bool GLComputePipeline::IsReady() const
+{
+    return (!asyncLink_ || shaderProgram_->IsLinkComplete());
+}
+
+void GLComputePipeline::WaitReady()
+{
+    if (asyncLink_)
+        shaderProgram_->WaitLinkComplete();
+}
+
 void GLComputePipeline::Bind(GLStateManager& stateMngr)
 {
     /* Setup shader state */
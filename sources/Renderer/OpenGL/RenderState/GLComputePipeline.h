@@ -24,13 +24,17 @@ class GLComputePipeline final : public ComputePipeline
 
     public:
 
-        GLComputePipeline(const ComputePipelineDescriptor& desc);
+        GLComputePipeline(const ComputePipelineDescriptor& desc, bool asyncLink = false);
+
+        bool IsReady() const override;
+        void WaitReady() override;
 
         void Bind(GLStateManager& stateMngr);
 
     private:
 
-        GLShaderProgram* shaderProgram_ = nullptr;
+        GLShaderProgram*    shaderProgram_  = nullptr;
+        bool                asyncLink_      = false;    // Poll link completion of the shader program (see RenderSystem::CreateComputePipelineAsync)
 
 };
 
@@ -8,12 +8,32 @@
 #include "GLFence.h"
 #include "../Ext/GLExtensions.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
+#include <chrono>
+#include <limits>
+#include <stdexcept>
 
 
 namespace LLGL
 {
 
 
+/*
+Maximal number of values a timeline fence can have in flight.
+If the ring buffer is full, signaling another value first waits for the oldest one.
+*/
+static const std::size_t g_maxNumPendingValues = 16;
+
+// Creation order of all sync objects of timeline fences; sync objects of the same context are signaled in this order.
+static std::atomic<std::uint64_t> g_syncOrderCounter { 0 };
+
+GLFence::GLFence(std::uint64_t initialValue) :
+    timeline_       { true                  },
+    pendingValues_  { g_maxNumPendingValues },
+    completedValue_ { initialValue          },
+    signaledValue_  { initialValue          }
+{
+}
+
 GLFence::~GLFence()
 {
     Release();
@@ -21,19 +41,49 @@ GLFence::~GLFence()
 
 void GLFence::Submit()
 {
-    if (HasExtension(GLExt::ARB_sync))
+    if (timeline_)
+        Signal(signaledValue_ + 1);
+    else if (HasExtension(GLExt::ARB_sync))
     {
-        Release();
-        sync_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        /* Replace previous sync object, which might have been submitted on another thread */
+        if (auto prevSync = sync_.exchange(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)))
+            glDeleteSync(prevSync);
     }
+
+    /* Wake up threads that wait for this fence to be submitted */
+    {
+        std::lock_guard<std::mutex> guard { pendingMutex_ };
+        pending_ = false;
+    }
+    pendingCond_.notify_all();
 }
 
 bool GLFence::Wait(GLuint64 timeout)
 {
+    if (timeline_)
+        return WaitValue(signaledValue_, timeout);
+
+    /* Wait until the fence has been submitted, if it was reset for another thread */
+    {
+        std::unique_lock<std::mutex> lock { pendingMutex_ };
+        auto isSubmitted = [this]() { return !pending_; };
+        if (timeout > static_cast<GLuint64>(std::numeric_limits<std::int64_t>::max() / 2))
+        {
+            /* Treat very large timeouts (e.g. GL_TIMEOUT_IGNORED) as infinite to avoid overflow of the deadline */
+            pendingCond_.wait(lock, isSubmitted);
+        }
+        else if (!pendingCond_.wait_for(lock, std::chrono::nanoseconds(static_cast<std::int64_t>(timeout)), isSubmitted))
+            return false;
+    }
+
     if (HasExtension(GLExt::ARB_sync))
     {
-        GLenum result = glClientWaitSync(sync_, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
-        return (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED);
+        if (auto sync = sync_.load())
+        {
+            GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+            return (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED);
+        }
+        return true;
     }
     else
     {
@@ -42,6 +92,94 @@ bool GLFence::Wait(GLuint64 timeout)
     }
 }
 
+void GLFence::Reset()
+{
+    Release();
+    std::lock_guard<std::mutex> guard { pendingMutex_ };
+    pending_ = true;
+}
+
+/* ----- Timeline fences ----- */
+
+void GLFence::Signal(std::uint64_t value)
+{
+    if (value <= signaledValue_)
+        throw std::invalid_argument("cannot signal timeline fence with a value that is not greater than its previously signaled value");
+
+    /* Wait for the oldest pending value if the ring buffer is full */
+    if (numPending_ == pendingValues_.size())
+    {
+        glClientWaitSync(pendingValues_[pendingBegin_].sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        RetirePendingValue();
+    }
+
+    /* Append new sync object to the ring buffer */
+    auto& entry = pendingValues_[(pendingBegin_ + numPending_) % pendingValues_.size()];
+    {
+        entry.sync  = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        entry.value = value;
+        entry.order = ++g_syncOrderCounter;
+    }
+    ++numPending_;
+
+    signaledValue_ = value;
+}
+
+std::uint64_t GLFence::GetCompletedValue()
+{
+    /* Retire all pending values in order until the first one that has not been signaled yet */
+    while (numPending_ > 0)
+    {
+        GLint status = GL_UNSIGNALED;
+        glGetSynciv(pendingValues_[pendingBegin_].sync, GL_SYNC_STATUS, 1, nullptr, &status);
+        if (status != GL_SIGNALED)
+            break;
+        RetirePendingValue();
+    }
+    return completedValue_;
+}
+
+bool GLFence::WaitValue(std::uint64_t value, GLuint64 timeout)
+{
+    if (completedValue_ >= value)
+        return true;
+
+    /* Wait for the first pending value that reaches the requested value (sync objects are signaled in order) */
+    for (std::size_t i = 0; i < numPending_; ++i)
+    {
+        const auto& entry = pendingValues_[(pendingBegin_ + i) % pendingValues_.size()];
+        if (entry.value >= value)
+        {
+            GLenum result = glClientWaitSync(entry.sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+            if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+                return false;
+
+            /* All previous sync objects have been signaled as well */
+            for (std::size_t n = 0; n <= i; ++n)
+                RetirePendingValue();
+
+            return true;
+        }
+    }
+
+    /* Requested value has not been signaled yet */
+    return false;
+}
+
+GLsync GLFence::FindPendingSync(std::uint64_t value, std::uint64_t& order) const
+{
+    for (std::size_t i = 0; i < numPending_; ++i)
+    {
+        const auto& entry = pendingValues_[(pendingBegin_ + i) % pendingValues_.size()];
+        if (entry.value >= value)
+        {
+            order = entry.order;
+            return entry.sync;
+        }
+    }
+    return nullptr;
+}
+
 
 /*
  * ======= Private: =======
@@ -49,11 +187,28 @@ bool GLFence::Wait(GLuint64 timeout)
 
 void GLFence::Release()
 {
-    if (sync_)
+    if (auto sync = sync_.exchange(nullptr))
+        glDeleteSync(sync);
+
+    while (numPending_ > 0)
+    {
+        glDeleteSync(pendingValues_[pendingBegin_].sync);
+        pendingValues_[pendingBegin_].sync = nullptr;
+        pendingBegin_ = (pendingBegin_ + 1) % pendingValues_.size();
+        --numPending_;
+    }
+}
+
+void GLFence::RetirePendingValue()
+{
+    auto& entry = pendingValues_[pendingBegin_];
     {
-        glDeleteSync(sync_);
-        sync_ = 0;
+        completedValue_ = entry.value;
+        glDeleteSync(entry.sync);
+        entry.sync = nullptr;
     }
+    pendingBegin_ = (pendingBegin_ + 1) % pendingValues_.size();
+    --numPending_;
 }
 
 
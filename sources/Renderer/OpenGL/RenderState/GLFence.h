@@ -11,6 +11,11 @@
 
 #include <LLGL/Fence.h>
 #include "../OpenGL.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <cstdint>
 
 
 namespace LLGL
@@ -22,16 +27,87 @@ class GLFence final : public Fence
 
     public:
 
+        GLFence() = default;
+
+        // Creates a timeline fence with the specified initial value.
+        explicit GLFence(std::uint64_t initialValue);
+
         ~GLFence();
 
+        // Inserts a new sync object into the GL command stream of the calling thread's context.
         void Submit();
+
+        // Waits until the fence has been signaled or the timeout (in nanoseconds) has expired.
         bool Wait(GLuint64 timeout);
 
+        /*
+        Releases the current sync object and marks the fence as pending, i.e. Wait blocks until Submit has been called.
+        This is used when the fence is submitted from another thread (e.g. from the upload worker).
+        */
+        void Reset();
+
+        /* ----- Timeline fences ----- */
+
+        // Returns true if this is a timeline fence.
+        inline bool IsTimeline() const
+        {
+            return timeline_;
+        }
+
+        // Inserts a new sync object for the specified value into the ring of pending values. Throws std::invalid_argument if the value does not increase.
+        void Signal(std::uint64_t value);
+
+        // Returns the highest value whose sync object has been signaled, without blocking.
+        std::uint64_t GetCompletedValue();
+
+        // Waits until the fence has reached the specified value or the timeout (in nanoseconds) has expired.
+        bool WaitValue(std::uint64_t value, GLuint64 timeout);
+
+        /*
+        Returns the sync object that reaches the specified value, or null if the value has not been signaled yet.
+        The output parameter receives the creation order of the sync object, which is global across all timeline fences.
+        */
+        GLsync FindPendingSync(std::uint64_t value, std::uint64_t& order) const;
+
+        // Returns the highest value that has been signaled so far.
+        inline std::uint64_t GetSignaledValue() const
+        {
+            return signaledValue_;
+        }
+
+    private:
+
+        // Sync object that has been inserted into the GL command stream for a timeline value.
+        struct PendingValue
+        {
+            GLsync          sync    = nullptr;
+            std::uint64_t   value   = 0;
+            std::uint64_t   order   = 0;
+        };
+
     private:
 
         void Release();
 
-        GLsync sync_ = 0;
+        // Removes the oldest pending value and updates the completed value.
+        void RetirePendingValue();
+
+    private:
+
+        std::atomic<GLsync>         sync_           { nullptr };
+
+        /* Pending state for fences that are submitted from another thread */
+        std::mutex                  pendingMutex_;
+        std::condition_variable     pendingCond_;
+        bool                        pending_        = false;
+
+        /* Fixed ring buffer of pending values for timeline fences; sync objects are only created on demand */
+        bool                        timeline_       = false;
+        std::vector<PendingValue>   pendingValues_;
+        std::size_t                 pendingBegin_   = 0;
+        std::size_t                 numPending_     = 0;
+        std::uint64_t               completedValue_ = 0;
+        std::uint64_t               signaledValue_  = 0;
 
 };
 
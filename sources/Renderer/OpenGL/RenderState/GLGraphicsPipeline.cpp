@@ -97,7 +97,8 @@ static bool IsPolygonOffsetEnabled(const DepthBiasDescriptor& desc)
 
 /* ----- GLGraphicsPipeline class ----- */
 
-GLGraphicsPipeline::GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits)
+GLGraphicsPipeline::GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits, bool asyncLink) :
+    asyncLink_ { asyncLink }
 {
     /* Convert shader state */
     shaderProgram_ = LLGL_CAST(const GLShaderProgram*, desc.shaderProgram);
@@ -168,6 +169,17 @@ GLGraphicsPipeline::GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, c
     }
 }
 
+bool GLGraphicsPipeline::IsReady() const
+{
+    return (!asyncLink_ || shaderProgram_->IsLinkComplete());
+}
+
+void GLGraphicsPipeline::WaitReady()
+{
+    if (asyncLink_)
+        shaderProgram_->WaitLinkComplete();
+}
+
 void GLGraphicsPipeline::Bind(GLStateManager& stateMngr)
 {
     /* Bind shader program and discard rasterizer if there is no fragment shader */
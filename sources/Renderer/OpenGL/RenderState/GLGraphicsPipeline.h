@@ -28,7 +28,10 @@ class GLGraphicsPipeline final : public GraphicsPipeline
 
     public:
 
-        GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits);
+        GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits, bool asyncLink = false);
+
+        bool IsReady() const override;
+        void WaitReady() override;
 
         // Binds this graphics pipeline state with the specified GL state manager.
         void Bind(GLStateManager& stateMngr);
@@ -43,6 +46,7 @@ class GLGraphicsPipeline final : public GraphicsPipeline
 
         // shader state
         const GLShaderProgram*  shaderProgram_          = nullptr;
+        bool                    asyncLink_              = false;    // Poll link completion of the shader program (see RenderSystem::CreateGraphicsPipelineAsync)
 
         // input-assembler state
         GLenum                  drawMode_               = GL_TRIANGLES;
@@ -14,6 +14,31 @@ namespace LLGL
 {
 
 
+// Fills the attachment list with all attachments in use whose load or store operation is undefined
+template <typename TPredicate>
+static void FillInvalidateAttachments(GLRenderPass::AttachmentList& list, const RenderPassDescriptor& desc, TPredicate isUndefined)
+{
+    /* Append color attachments */
+    GLenum colorAttachment = GL_COLOR_ATTACHMENT0;
+    for (const auto& attachment : desc.colorAttachments)
+    {
+        if (attachment.format != Format::Undefined && isUndefined(attachment) && list.numAttachments < static_cast<GLsizei>(LLGL_MAX_NUM_COLOR_ATTACHMENTS))
+            list.attachments[list.numAttachments++] = colorAttachment;
+        ++colorAttachment;
+    }
+
+    /* Append depth-stencil attachment */
+    const bool depth    = (desc.depthAttachment.format != Format::Undefined && isUndefined(desc.depthAttachment));
+    const bool stencil  = (desc.stencilAttachment.format != Format::Undefined && isUndefined(desc.stencilAttachment));
+
+    if (depth && stencil)
+        list.attachments[list.numAttachments++] = GL_DEPTH_STENCIL_ATTACHMENT;
+    else if (depth)
+        list.attachments[list.numAttachments++] = GL_DEPTH_ATTACHMENT;
+    else if (stencil)
+        list.attachments[list.numAttachments++] = GL_STENCIL_ATTACHMENT;
+}
+
 GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc)
 {
     /* Check which color attachment must be cleared */
@@ -27,6 +52,24 @@ GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc)
     /* Check if stencil attachment must be cleared */
     if (desc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
         clearMask_ |= GL_STENCIL_BUFFER_BIT;
+
+    /* Determine which attachments can be invalidated when the render pass begins and ends */
+    FillInvalidateAttachments(
+        invalidateOnBegin_,
+        desc,
+        [](const AttachmentFormatDescriptor& attachment)
+        {
+            return (attachment.loadOp == AttachmentLoadOp::Undefined);
+        }
+    );
+    FillInvalidateAttachments(
+        invalidateOnEnd_,
+        desc,
+        [](const AttachmentFormatDescriptor& attachment)
+        {
+            return (attachment.storeOp == AttachmentStoreOp::Undefined);
+        }
+    );
 }
 
 
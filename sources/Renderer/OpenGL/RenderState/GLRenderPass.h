@@ -23,6 +23,15 @@ namespace LLGL
 class GLRenderPass final : public RenderPass
 {
 
+    public:
+
+        // List of framebuffer attachments (GL_COLOR_ATTACHMENTi, GL_DEPTH_ATTACHMENT, GL_STENCIL_ATTACHMENT, or GL_DEPTH_STENCIL_ATTACHMENT).
+        struct AttachmentList
+        {
+            GLsizei numAttachments                                      = 0;
+            GLenum  attachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS + 1]     = {};
+        };
+
     public:
 
         GLRenderPass(const RenderPassDescriptor& desc);
@@ -39,11 +48,26 @@ class GLRenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Returns the attachments whose previous content can be discarded when a render pass begins (see AttachmentLoadOp::Undefined).
+        inline const AttachmentList& GetInvalidateOnBegin() const
+        {
+            return invalidateOnBegin_;
+        }
+
+        // Returns the attachments whose outcome can be discarded when a render pass ends (see AttachmentStoreOp::Undefined).
+        inline const AttachmentList& GetInvalidateOnEnd() const
+        {
+            return invalidateOnEnd_;
+        }
+
     private:
 
         GLbitfield      clearMask_                                              = 0;
         std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
 
+        AttachmentList  invalidateOnBegin_;
+        AttachmentList  invalidateOnEnd_;
+
 };
 
 
@@ -11,6 +11,7 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Helper.h"
 #include "../../../Core/Assertion.h"
+#include <mutex>
 
 
 namespace LLGL
@@ -122,8 +123,9 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
 /* ----- Common ----- */
 
 static std::vector<GLStateManager*> g_GLStateManagerList;
+static std::mutex                   g_GLStateManagerListMutex;
 
-GLStateManager* GLStateManager::active = nullptr;
+thread_local GLStateManager* GLStateManager::active = nullptr;
 
 GLStateManager::GLStateManager()
 {
@@ -132,6 +134,7 @@ GLStateManager::GLStateManager()
     Fill(bufferState_.boundBuffers, 0);
     Fill(framebufferState_.boundFramebuffers, 0);
     Fill(samplerState_.boundSamplers, 0);
+    Fill(vertexArrayState_.boundVertexBuffers, GLVertexBufferBinding { 0, 0, 0 });
 
     for (auto& layer : textureState_.layers)
         Fill(layer.boundTextures, 0);
@@ -142,11 +145,13 @@ GLStateManager::GLStateManager()
     GLStateManager::active = this;
 
     /* Store state manager in global list */
+    std::lock_guard<std::mutex> guard { g_GLStateManagerListMutex };
     g_GLStateManagerList.push_back(this);
 }
 
 GLStateManager::~GLStateManager()
 {
+    std::lock_guard<std::mutex> guard { g_GLStateManagerListMutex };
     RemoveFromList(g_GLStateManagerList, this);
 }
 
@@ -754,6 +759,9 @@ void GLStateManager::BindVertexArray(GLuint vertexArray)
         */
         bufferState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::ELEMENT_ARRAY_BUFFER)] = 0;
 
+        /* Vertex buffer bindings are part of the VAO state */
+        Fill(vertexArrayState_.boundVertexBuffers, GLVertexBufferBinding { 0, 0, 0 });
+
         /* Bind deferred index buffer */
         if (vertexArray != 0 && vertexArrayState_.boundElementArrayBuffer != 0)
         {
@@ -765,6 +773,46 @@ void GLStateManager::BindVertexArray(GLuint vertexArray)
     }
 }
 
+void GLStateManager::BindVertexBuffers(GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    /* Only bind vertex buffers if any binding of the current VAO has changed */
+    if (first + static_cast<GLuint>(count) <= numVertexBufferBindings)
+    {
+        bool changed = false;
+
+        for (GLsizei i = 0; i < count; ++i)
+        {
+            auto& binding = vertexArrayState_.boundVertexBuffers[first + i];
+            if (binding.buffer != buffers[i] || binding.offset != offsets[i] || binding.stride != strides[i])
+            {
+                binding = { buffers[i], offsets[i], strides[i] };
+                changed = true;
+            }
+        }
+
+        if (!changed)
+            return;
+    }
+
+    #ifdef GL_ARB_multi_bind
+    if (count > 1 && HasExtension(GLExt::ARB_multi_bind))
+    {
+        /* Bind all vertex buffers at once */
+        glBindVertexBuffers(first, count, buffers, offsets, strides);
+    }
+    else
+    #endif // /GL_ARB_multi_bind
+    {
+        /* Bind each individual vertex buffer */
+        for (GLsizei i = 0; i < count; ++i)
+            glBindVertexBuffer(first + i, buffers[i], offsets[i], strides[i]);
+    }
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
 void GLStateManager::NotifyVertexArrayRelease(GLuint vertexArray)
 {
     InvalidateBoundGLObject(vertexArrayState_.boundVertexArray, vertexArray);
@@ -808,6 +856,13 @@ void GLStateManager::NotifyBufferRelease(GLuint buffer, GLBufferTarget target)
 {
     auto targetIdx = static_cast<std::size_t>(target);
     InvalidateBoundGLObject(bufferState_.boundBuffers[targetIdx], buffer);
+
+    /* Invalidate vertex buffer bindings of the current VAO */
+    if (target == GLBufferTarget::ARRAY_BUFFER)
+    {
+        for (auto& binding : vertexArrayState_.boundVertexBuffers)
+            InvalidateBoundGLObject(binding.buffer, buffer);
+    }
 }
 
 /* ----- Framebuffer ----- */
@@ -34,8 +34,8 @@ class GLStateManager
         GLStateManager();
         ~GLStateManager();
 
-        // Active state manager. Each GL context has its own states, thus its own state manager.
-        static GLStateManager* active;
+        // Active state manager of the calling thread. Each GL context has its own states, thus its own state manager.
+        static thread_local GLStateManager* active;
 
         // Queries all supported and available GL extensions and limitations, then stores it internally (must be called once a GL context has been created).
         void DetermineExtensionsAndLimits();
@@ -114,6 +114,13 @@ class GLStateManager
 
         void BindVertexArray(GLuint vertexArray);
 
+        /**
+        \brief Binds the specified buffers to the vertex buffer binding points of the currently bound VAO (requires GL_ARB_vertex_attrib_binding).
+        \remarks Redundant bindings are skipped until the next VAO is bound.
+        \see BindVertexArray
+        */
+        void BindVertexBuffers(GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides);
+
         void NotifyVertexArrayRelease(GLuint vertexArray);
 
         /**
@@ -203,6 +210,7 @@ class GLStateManager
         static const std::uint32_t numBufferTargets         = (static_cast<std::uint32_t>(GLBufferTarget::UNIFORM_BUFFER) + 1);
         static const std::uint32_t numFramebufferTargets    = (static_cast<std::uint32_t>(GLFramebufferTarget::READ_FRAMEBUFFER) + 1);
         static const std::uint32_t numTextureTargets        = (static_cast<std::uint32_t>(GLTextureTarget::TEXTURE_2D_MULTISAMPLE_ARRAY) + 1);
+        static const std::uint32_t numVertexBufferBindings  = 16; // minimum of GL_MAX_VERTEX_ATTRIB_BINDINGS
 
         #ifdef LLGL_GL_ENABLE_VENDOR_EXT
         static const std::uint32_t numStatesExt             = (static_cast<std::uint32_t>(GLStateExt::CONSERVATIVE_RASTERIZATION) + 1);
@@ -318,10 +326,18 @@ class GLStateManager
             std::stack<StackEntry>                          boundTextureStack;
         };
 
+        struct GLVertexBufferBinding
+        {
+            GLuint      buffer;
+            GLintptr    offset;
+            GLsizei     stride;
+        };
+
         struct GLVertexArrayState
         {
-            GLuint boundVertexArray         = 0;
-            GLuint boundElementArrayBuffer  = 0;
+            GLuint                                                      boundVertexArray        = 0;
+            GLuint                                                      boundElementArrayBuffer = 0;
+            std::array<GLVertexBufferBinding, numVertexBufferBindings>  boundVertexBuffers;
         };
 
         struct GLShaderState
@@ -13,6 +13,8 @@
 #include "../../../Core/Exception.h"
 #include <vector>
 #include <sstream>
+#include <iomanip>
+#include <limits>
 #include <stdexcept>
 
 
@@ -95,6 +97,91 @@ void GLShader::Build(const ShaderDescriptor& shaderDesc)
         LoadBinary(shaderDesc);
 }
 
+static void WriteSpecializationConstantValue(std::ostream& s, const SpecializationConstant& constant)
+{
+    switch (constant.type)
+    {
+        case UniformType::Float1:
+        {
+            /* Write float literal with full precision and ensure it is not parsed as integer literal */
+            std::ostringstream f;
+            f << std::setprecision(std::numeric_limits<float>::max_digits10) << constant.value.f32;
+            auto literal = f.str();
+            if (literal.find_first_of(".eEn") == std::string::npos)
+                literal += ".0";
+            s << literal;
+        }
+        break;
+
+        case UniformType::Double1:
+        {
+            std::ostringstream f;
+            f << std::setprecision(std::numeric_limits<double>::max_digits10) << constant.value.f64;
+            auto literal = f.str();
+            if (literal.find_first_of(".eEn") == std::string::npos)
+                literal += ".0";
+            s << literal << "lf";
+        }
+        break;
+
+        case UniformType::Int1:
+            s << constant.value.i32;
+            break;
+
+        case UniformType::UInt1:
+            s << constant.value.u32 << 'u';
+            break;
+
+        case UniformType::Bool1:
+            s << (constant.value.u32 != 0 ? "true" : "false");
+            break;
+
+        default:
+            throw std::invalid_argument("invalid type of specialization constant " + std::to_string(constant.constantID));
+    }
+}
+
+// Returns the specified GLSL source with a macro definition for each named specialization constant after the '#version' directive
+static std::string InjectSpecializationConstants(const char* source, const std::vector<SpecializationConstant>& constants)
+{
+    std::string sourceStr = source;
+
+    /* Find insertion point after the '#version' directive (if there is one) and count its line number */
+    std::size_t insertPos   = 0;
+    std::size_t lineNumber  = 1;
+
+    auto versionPos = sourceStr.find("#version");
+    if (versionPos != std::string::npos)
+    {
+        auto lineEnd = sourceStr.find('\n', versionPos);
+        insertPos = (lineEnd != std::string::npos ? lineEnd + 1 : sourceStr.size());
+        for (std::size_t i = 0; i < insertPos; ++i)
+        {
+            if (sourceStr[i] == '\n')
+                ++lineNumber;
+        }
+        if (lineEnd == std::string::npos)
+            sourceStr += '\n';
+    }
+
+    /* Write macro definitions, followed by a '#line' directive to keep line numbers of compiler errors intact */
+    std::ostringstream s;
+    for (const auto& constant : constants)
+    {
+        if (constant.name != nullptr && *constant.name != '\0')
+        {
+            s << "#define " << constant.name << ' ';
+            WriteSpecializationConstantValue(s, constant);
+            s << '\n';
+        }
+    }
+    s << "#line " << lineNumber << '\n';
+
+    sourceStr.insert(insertPos, s.str());
+
+    return sourceStr;
+}
+
 void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
     /* Get source code */
@@ -111,6 +198,14 @@ void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
         strings[0] = shaderDesc.source;
     }
 
+    /* Inject specialization constants as macro definitions */
+    std::string specializedSource;
+    if (!shaderDesc.specializationConstants.empty())
+    {
+        specializedSource   = InjectSpecializationConstants(strings[0], shaderDesc.specializationConstants);
+        strings[0]          = specializedSource.c_str();
+    }
+
     /* Load shader source code, then compile shader */
     glShaderSource(id_, 1, strings, nullptr);
     glCompileShader(id_);
@@ -146,9 +241,28 @@ void GLShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         /* Load shader binary */
         glShaderBinary(1, &id_, GL_SHADER_BINARY_FORMAT_SPIR_V, binaryBuffer, binaryLength);
 
+        /* Gather 32-bit specialization constants (64-bit constants are not supported by glSpecializeShader) */
+        std::vector<GLuint> constantIndices, constantValues;
+        constantIndices.reserve(shaderDesc.specializationConstants.size());
+        constantValues.reserve(shaderDesc.specializationConstants.size());
+
+        for (const auto& constant : shaderDesc.specializationConstants)
+        {
+            if (constant.type == UniformType::Double1)
+                throw std::invalid_argument("specialization constants of type Double1 are not supported for SPIR-V modules with OpenGL");
+            constantIndices.push_back(constant.constantID);
+            constantValues.push_back(constant.type == UniformType::Bool1 ? (constant.value.u32 != 0 ? 1u : 0u) : constant.value.u32);
+        }
+
         /* Specialize for the default "main" function in a SPIR-V module  */
         const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
-        glSpecializeShader(id_, entryPoint, 0, nullptr, nullptr);
+        glSpecializeShader(
+            id_,
+            entryPoint,
+            static_cast<GLuint>(constantIndices.size()),
+            (constantIndices.empty() ? nullptr : constantIndices.data()),
+            (constantValues.empty() ? nullptr : constantValues.data())
+        );
 
         /* Store stream-output format */
         streamOutputFormat_ = shaderDesc.streamOutput.format;
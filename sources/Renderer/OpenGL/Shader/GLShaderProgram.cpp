@@ -50,11 +50,12 @@ bool GLShaderProgram::HasErrors() const
     return (status == GL_FALSE);
 }
 
-std::string GLShaderProgram::QueryInfoLog()
+// Returns the info log of the specified GL shader program
+static std::string GetGLProgramInfoLog(GLuint id)
 {
     /* Query info log length */
     GLint infoLogLength = 0;
-    glGetProgramiv(id_, GL_INFO_LOG_LENGTH, &infoLogLength);
+    glGetProgramiv(id, GL_INFO_LOG_LENGTH, &infoLogLength);
 
     if (infoLogLength > 0)
     {
@@ -64,7 +65,7 @@ std::string GLShaderProgram::QueryInfoLog()
 
         /* Query info log output */
         GLsizei charsWritten = 0;
-        glGetProgramInfoLog(id_, infoLogLength, &charsWritten, infoLog.data());
+        glGetProgramInfoLog(id, infoLogLength, &charsWritten, infoLog.data());
 
         /* Convert byte buffer to string */
         return std::string(infoLog.data());
@@ -73,16 +74,15 @@ std::string GLShaderProgram::QueryInfoLog()
     return "";
 }
 
+std::string GLShaderProgram::QueryInfoLog()
+{
+    return GetGLProgramInfoLog(id_);
+}
+
 ShaderReflectionDescriptor GLShaderProgram::QueryReflectionDesc() const
 {
     ShaderReflectionDescriptor reflection;
-
-    /* Reflect shader program */
-    Reflect(reflection);
-
-    /* Sort output to meet the interface requirements */
-    ShaderProgram::FinalizeShaderReflection(reflection);
-
+    GetReflection()->GetDesc(reflection);
     return reflection;
 }
 
@@ -110,16 +110,63 @@ void GLShaderProgram::BindStorageBuffer(const std::string& name, std::uint32_t b
     #endif
 }
 
+bool GLShaderProgram::IsLinkComplete() const
+{
+    #ifdef GL_KHR_parallel_shader_compile
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+    {
+        GLint status = GL_TRUE;
+        glGetProgramiv(id_, GL_COMPLETION_STATUS_KHR, &status);
+        return (status != GL_FALSE);
+    }
+    #endif
+    return true;
+}
+
+void GLShaderProgram::WaitLinkComplete() const
+{
+    /* Querying the link status blocks until linking has completed */
+    GLint status = 0;
+    glGetProgramiv(id_, GL_LINK_STATUS, &status);
+
+    /* Report link errors of the background compilation to the caller */
+    if (status == GL_FALSE)
+        throw std::runtime_error("failed to link shader program:\n" + GetGLProgramInfoLog(id_));
+}
+
+std::shared_ptr<const GLShaderReflection> GLShaderProgram::GetReflection() const
+{
+    if (!reflection_)
+    {
+        ShaderReflectionDescriptor reflection;
+
+        /* Reflect shader program */
+        Reflect(reflection);
+
+        /* Sort output to meet the interface requirements */
+        ShaderProgram::FinalizeShaderReflection(reflection);
+
+        /* Store reflection in compact form */
+        reflection_ = std::make_shared<GLShaderReflection>(reflection);
+    }
+    return reflection_;
+}
+
 ShaderUniform* GLShaderProgram::LockShaderUniform()
 {
-    GLStateManager::active->PushShaderProgram();
-    GLStateManager::active->BindShaderProgram(id_);
+    /* Only bind shader program if uniforms cannot be set directly to the program */
+    if (!uniform_.HasDirectAccess())
+    {
+        GLStateManager::active->PushShaderProgram();
+        GLStateManager::active->BindShaderProgram(id_);
+    }
     return (&uniform_);
 }
 
 void GLShaderProgram::UnlockShaderUniform()
 {
-    GLStateManager::active->PopShaderProgram();
+    if (!uniform_.HasDirectAccess())
+        GLStateManager::active->PopShaderProgram();
 }
 
 
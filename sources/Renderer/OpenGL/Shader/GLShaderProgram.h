@@ -11,7 +11,9 @@
 
 #include <LLGL/ShaderProgram.h>
 #include "GLShaderUniform.h"
+#include "GLShaderReflection.h"
 #include "../OpenGL.h"
+#include <memory>
 
 
 namespace LLGL
@@ -44,6 +46,15 @@ class GLShaderProgram final : public ShaderProgram
             return id_;
         }
 
+        // Returns true if linking has completed. This never blocks and is always true if GL_KHR_parallel_shader_compile is not supported.
+        bool IsLinkComplete() const;
+
+        // Blocks until linking has completed and throws an std::runtime_error with the info log if linking failed.
+        void WaitLinkComplete() const;
+
+        // Returns the reflection of this shader program. It is queried with the first call (after linking) and shared from then on.
+        std::shared_ptr<const GLShaderReflection> GetReflection() const;
+
         // Returns true if this shader program has a fragment shader.
         inline bool HasFragmentShader() const
         {
@@ -77,10 +88,11 @@ class GLShaderProgram final : public ShaderProgram
         void QueryBufferProperties(ShaderReflectionDescriptor::ResourceView& resourceView, GLenum programInterface, GLuint resourceIndex) const;
         #endif // /GL_ARB_program_interface_query
 
-        GLuint              id_                 = 0;
-        GLShaderUniform     uniform_;
-        bool                hasFragmentShader_  = false;
-        StreamOutputFormat  streamOutputFormat_;
+        GLuint                                              id_                 = 0;
+        GLShaderUniform                                     uniform_;
+        bool                                                hasFragmentShader_  = false;
+        StreamOutputFormat                                  streamOutputFormat_;
+        mutable std::shared_ptr<const GLShaderReflection>   reflection_;
 
 };
 
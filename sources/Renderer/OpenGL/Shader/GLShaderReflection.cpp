@@ -0,0 +1,172 @@
+/*
+ * GLShaderReflection.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLShaderReflection.h"
+
+
+namespace LLGL
+{
+
+
+GLShaderReflection::GLShaderReflection(const ShaderReflectionDescriptor& desc)
+{
+    NameMap nameMap;
+
+    /* Compact vertex attributes */
+    vertexAttributes_.reserve(desc.vertexAttributes.size());
+    for (const auto& src : desc.vertexAttributes)
+    {
+        VertexAttributeRecord dst;
+        {
+            dst.name            = InternName(src.name, nameMap);
+            dst.format          = static_cast<std::uint32_t>(src.format);
+            dst.instanceDivisor = src.instanceDivisor;
+            dst.offset          = src.offset;
+            dst.semanticIndex   = src.semanticIndex;
+        }
+        vertexAttributes_.push_back(dst);
+    }
+
+    /* Compact stream-output attributes */
+    streamOutputAttributes_.reserve(desc.streamOutputAttributes.size());
+    for (const auto& src : desc.streamOutputAttributes)
+    {
+        StreamOutputAttributeRecord dst;
+        {
+            dst.name            = InternName(src.name, nameMap);
+            dst.stream          = src.stream;
+            dst.semanticIndex   = src.semanticIndex;
+            dst.startComponent  = src.startComponent;
+            dst.components      = src.components;
+            dst.outputSlot      = src.outputSlot;
+            dst.reserved        = 0;
+        }
+        streamOutputAttributes_.push_back(dst);
+    }
+
+    /* Compact resource views */
+    resourceViews_.reserve(desc.resourceViews.size());
+    for (const auto& src : desc.resourceViews)
+    {
+        ResourceViewRecord dst;
+        {
+            dst.name                = InternName(src.name, nameMap);
+            dst.type                = static_cast<std::uint8_t>(src.type);
+            dst.storageBufferType   = static_cast<std::uint8_t>(src.storageBufferType);
+            dst.reserved            = 0;
+            dst.stageFlags          = static_cast<std::uint32_t>(src.stageFlags);
+            dst.slot                = src.slot;
+            dst.arraySize           = src.arraySize;
+            dst.constantBufferSize  = src.constantBufferSize;
+        }
+        resourceViews_.push_back(dst);
+    }
+
+    /* Compact uniforms */
+    uniforms_.reserve(desc.uniforms.size());
+    for (const auto& src : desc.uniforms)
+    {
+        UniformRecord dst;
+        {
+            dst.name        = InternName(src.name, nameMap);
+            dst.type        = static_cast<std::uint32_t>(src.type);
+            dst.location    = src.location;
+            dst.size        = src.size;
+        }
+        uniforms_.push_back(dst);
+    }
+
+    names_.shrink_to_fit();
+}
+
+void GLShaderReflection::GetDesc(ShaderReflectionDescriptor& desc) const
+{
+    /* Expand vertex attributes */
+    desc.vertexAttributes.resize(vertexAttributes_.size());
+    for (std::size_t i = 0; i < vertexAttributes_.size(); ++i)
+    {
+        const auto& src = vertexAttributes_[i];
+        auto& dst = desc.vertexAttributes[i];
+        dst.name            = GetName(src.name);
+        dst.format          = static_cast<Format>(src.format);
+        dst.instanceDivisor = src.instanceDivisor;
+        dst.offset          = src.offset;
+        dst.semanticIndex   = src.semanticIndex;
+    }
+
+    /* Expand stream-output attributes */
+    desc.streamOutputAttributes.resize(streamOutputAttributes_.size());
+    for (std::size_t i = 0; i < streamOutputAttributes_.size(); ++i)
+    {
+        const auto& src = streamOutputAttributes_[i];
+        auto& dst = desc.streamOutputAttributes[i];
+        dst.name            = GetName(src.name);
+        dst.stream          = src.stream;
+        dst.semanticIndex   = src.semanticIndex;
+        dst.startComponent  = src.startComponent;
+        dst.components      = src.components;
+        dst.outputSlot      = src.outputSlot;
+    }
+
+    /* Expand resource views (already sorted by the compacted descriptor) */
+    desc.resourceViews.resize(resourceViews_.size());
+    for (std::size_t i = 0; i < resourceViews_.size(); ++i)
+    {
+        const auto& src = resourceViews_[i];
+        auto& dst = desc.resourceViews[i];
+        dst.name                = GetName(src.name);
+        dst.type                = static_cast<ResourceType>(src.type);
+        dst.storageBufferType   = static_cast<StorageBufferType>(src.storageBufferType);
+        dst.stageFlags          = static_cast<long>(src.stageFlags);
+        dst.slot                = src.slot;
+        dst.arraySize           = src.arraySize;
+        dst.constantBufferSize  = src.constantBufferSize;
+    }
+
+    /* Expand uniforms */
+    desc.uniforms.resize(uniforms_.size());
+    for (std::size_t i = 0; i < uniforms_.size(); ++i)
+    {
+        const auto& src = uniforms_[i];
+        auto& dst = desc.uniforms[i];
+        dst.name        = GetName(src.name);
+        dst.type        = static_cast<UniformType>(src.type);
+        dst.location    = src.location;
+        dst.size        = src.size;
+    }
+}
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t GLShaderReflection::InternName(const std::string& name, NameMap& nameMap)
+{
+    /* Resource views of combined texture-samplers share the same name, so each name is only stored once */
+    auto it = nameMap.find(name);
+    if (it != nameMap.end())
+        return it->second;
+
+    const auto offset = static_cast<std::uint32_t>(names_.size());
+    names_.insert(names_.end(), name.begin(), name.end());
+    names_.push_back('\0');
+    nameMap[name] = offset;
+
+    return offset;
+}
+
+std::string GLShaderReflection::GetName(std::uint32_t offset) const
+{
+    return std::string(names_.data() + offset);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
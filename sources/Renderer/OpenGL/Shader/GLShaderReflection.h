@@ -0,0 +1,104 @@
+/*
+ * GLShaderReflection.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_SHADER_REFLECTION_H
+#define LLGL_GL_SHADER_REFLECTION_H
+
+
+#include <LLGL/ShaderProgramFlags.h>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Immutable and compact shader program reflection, which is queried only once per shader program.
+All names are interned in a single character buffer and all other attributes are stored in flat arrays of POD records.
+*/
+class GLShaderReflection
+{
+
+    public:
+
+        // Compacts the specified (already finalized) shader reflection descriptor.
+        GLShaderReflection(const ShaderReflectionDescriptor& desc);
+
+        // Expands this reflection into the specified shader reflection descriptor.
+        void GetDesc(ShaderReflectionDescriptor& desc) const;
+
+    private:
+
+        struct VertexAttributeRecord
+        {
+            std::uint32_t   name;
+            std::uint32_t   format;
+            std::uint32_t   instanceDivisor;
+            std::uint32_t   offset;
+            std::uint32_t   semanticIndex;
+        };
+
+        struct StreamOutputAttributeRecord
+        {
+            std::uint32_t   name;
+            std::uint32_t   stream;
+            std::uint32_t   semanticIndex;
+            std::uint8_t    startComponent;
+            std::uint8_t    components;
+            std::uint8_t    outputSlot;
+            std::uint8_t    reserved;
+        };
+
+        struct ResourceViewRecord
+        {
+            std::uint32_t   name;
+            std::uint8_t    type;
+            std::uint8_t    storageBufferType;
+            std::uint16_t   reserved;
+            std::uint32_t   stageFlags;
+            std::uint32_t   slot;
+            std::uint32_t   arraySize;
+            std::uint32_t   constantBufferSize;
+        };
+
+        struct UniformRecord
+        {
+            std::uint32_t   name;
+            std::uint32_t   type;
+            std::int32_t    location;
+            std::uint32_t   size;
+        };
+
+    private:
+
+        using NameMap = std::unordered_map<std::string, std::uint32_t>;
+
+        std::uint32_t InternName(const std::string& name, NameMap& nameMap);
+        std::string GetName(std::uint32_t offset) const;
+
+        std::vector<VertexAttributeRecord>          vertexAttributes_;
+        std::vector<StreamOutputAttributeRecord>    streamOutputAttributes_;
+        std::vector<ResourceViewRecord>             resourceViews_;
+        std::vector<UniformRecord>                  uniforms_;
+        std::vector<char>                           names_;                     // Interned null-terminated names
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
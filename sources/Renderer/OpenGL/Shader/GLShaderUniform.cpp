@@ -7,205 +7,239 @@
 
 #include "GLShaderUniform.h"
 #include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <stdexcept>
 
 
 namespace LLGL
 {
 
 
+/*
+Sets a uniform either directly to the shader program (GL_ARB_separate_shader_objects),
+or to the currently bound shader program (see GLShaderProgram::LockShaderUniform).
+*/
+#ifdef GL_ARB_separate_shader_objects
+#define LLGL_GL_UNIFORM(NAME, ...)                          \
+    if (directAccess_)                                      \
+        glProgram##NAME(program_, __VA_ARGS__);             \
+    else                                                    \
+        gl##NAME(__VA_ARGS__)
+#else
+#define LLGL_GL_UNIFORM(NAME, ...)                          \
+    gl##NAME(__VA_ARGS__)
+#endif
+
 GLShaderUniform::GLShaderUniform(GLuint program) :
     program_ { program }
 {
+    #ifdef GL_ARB_separate_shader_objects
+    directAccess_ = HasExtension(GLExt::ARB_separate_shader_objects);
+    #endif
+}
+
+UniformLocation GLShaderUniform::GetUniformLocation(const char* name)
+{
+    return static_cast<UniformLocation>(GetLocation(name));
+}
+
+void GLShaderUniform::SetUniforms(std::size_t numUniformValues, const UniformValue* uniformValues)
+{
+    for (std::size_t i = 0; i < numUniformValues; ++i)
+    {
+        if (uniformValues[i].location >= 0)
+            SetUniformValue(uniformValues[i]);
+    }
 }
 
 void GLShaderUniform::SetUniform1i(const UniformLocation location, int value0)
 {
-    glUniform1i(static_cast<GLint>(location), value0);
+    LLGL_GL_UNIFORM(Uniform1i, static_cast<GLint>(location), value0);
 }
 
 void GLShaderUniform::SetUniform2i(const UniformLocation location, int value0, int value1)
 {
-    glUniform2i(static_cast<GLint>(location), value0, value1);
+    LLGL_GL_UNIFORM(Uniform2i, static_cast<GLint>(location), value0, value1);
 }
 
 void GLShaderUniform::SetUniform3i(const UniformLocation location, int value0, int value1, int value2)
 {
-    glUniform3i(static_cast<GLint>(location), value0, value1, value2);
+    LLGL_GL_UNIFORM(Uniform3i, static_cast<GLint>(location), value0, value1, value2);
 }
 
 void GLShaderUniform::SetUniform4i(const UniformLocation location, int value0, int value1, int value2, int value3)
 {
-    glUniform4i(static_cast<GLint>(location), value0, value1, value2, value3);
+    LLGL_GL_UNIFORM(Uniform4i, static_cast<GLint>(location), value0, value1, value2, value3);
 }
 
 void GLShaderUniform::SetUniform1f(const UniformLocation location, float value0)
 {
-    glUniform1f(static_cast<GLint>(location), value0);
+    LLGL_GL_UNIFORM(Uniform1f, static_cast<GLint>(location), value0);
 }
 
 void GLShaderUniform::SetUniform2f(const UniformLocation location, float value0, float value1)
 {
-    glUniform2f(static_cast<GLint>(location), value0, value1);
+    LLGL_GL_UNIFORM(Uniform2f, static_cast<GLint>(location), value0, value1);
 }
 
 void GLShaderUniform::SetUniform3f(const UniformLocation location, float value0, float value1, float value2)
 {
-    glUniform3f(static_cast<GLint>(location), value0, value1, value2);
+    LLGL_GL_UNIFORM(Uniform3f, static_cast<GLint>(location), value0, value1, value2);
 }
 
 void GLShaderUniform::SetUniform4f(const UniformLocation location, float value0, float value1, float value2, float value3)
 {
-    glUniform4f(static_cast<GLint>(location), value0, value1, value2, value3);
+    LLGL_GL_UNIFORM(Uniform4f, static_cast<GLint>(location), value0, value1, value2, value3);
 }
 
 void GLShaderUniform::SetUniform1iv(const UniformLocation location, const int* value, std::size_t count)
 {
-    glUniform1iv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform1iv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform2iv(const UniformLocation location, const int* value, std::size_t count)
 {
-    glUniform2iv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform2iv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform3iv(const UniformLocation location, const int* value, std::size_t count)
 {
-    glUniform3iv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform3iv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform4iv(const UniformLocation location, const int* value, std::size_t count)
 {
-    glUniform4iv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform4iv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform1fv(const UniformLocation location, const float* value, std::size_t count)
 {
-    glUniform1fv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform1fv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform2fv(const UniformLocation location, const float* value, std::size_t count)
 {
-    glUniform2fv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform2fv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform3fv(const UniformLocation location, const float* value, std::size_t count)
 {
-    glUniform3fv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform3fv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform4fv(const UniformLocation location, const float* value, std::size_t count)
 {
-    glUniform4fv(static_cast<GLint>(location), static_cast<GLsizei>(count), value);
+    LLGL_GL_UNIFORM(Uniform4fv, static_cast<GLint>(location), static_cast<GLsizei>(count), value);
 }
 
 void GLShaderUniform::SetUniform2x2fv(const UniformLocation location, const float* value, std::size_t count)
 {
-    glUniformMatrix2fv(static_cast<GLint>(location), static_cast<GLsizei>(count), GL_FALSE, value);
+    LLGL_GL_UNIFORM(UniformMatrix2fv, static_cast<GLint>(location), static_cast<GLsizei>(count), GL_FALSE, value);
 }
 
 void GLShaderUniform::SetUniform3x3fv(const UniformLocation location, const float* value, std::size_t count)
 {
-    glUniformMatrix3fv(static_cast<GLint>(location), static_cast<GLsizei>(count), GL_FALSE, value);
+    LLGL_GL_UNIFORM(UniformMatrix3fv, static_cast<GLint>(location), static_cast<GLsizei>(count), GL_FALSE, value);
 }
 
 void GLShaderUniform::SetUniform4x4fv(const UniformLocation location, const float* value, std::size_t count)
 {
-    glUniformMatrix4fv(static_cast<GLint>(location), static_cast<GLsizei>(count), GL_FALSE, value);
+    LLGL_GL_UNIFORM(UniformMatrix4fv, static_cast<GLint>(location), static_cast<GLsizei>(count), GL_FALSE, value);
 }
 
 void GLShaderUniform::SetUniform1i(const char* name, int value0)
 {
-    glUniform1i(GetLocation(name), value0);
+    SetUniform1i(GetLocation(name), value0);
 }
 
 void GLShaderUniform::SetUniform2i(const char* name, int value0, int value1)
 {
-    glUniform2i(GetLocation(name), value0, value1);
+    SetUniform2i(GetLocation(name), value0, value1);
 }
 
 void GLShaderUniform::SetUniform3i(const char* name, int value0, int value1, int value2)
 {
-    glUniform3i(GetLocation(name), value0, value1, value2);
+    SetUniform3i(GetLocation(name), value0, value1, value2);
 }
 
 void GLShaderUniform::SetUniform4i(const char* name, int value0, int value1, int value2, int value3)
 {
-    glUniform4i(GetLocation(name), value0, value1, value2, value3);
+    SetUniform4i(GetLocation(name), value0, value1, value2, value3);
 }
 
 void GLShaderUniform::SetUniform1f(const char* name, float value0)
 {
-    glUniform1f(GetLocation(name), value0);
+    SetUniform1f(GetLocation(name), value0);
 }
 
 void GLShaderUniform::SetUniform2f(const char* name, float value0, float value1)
 {
-    glUniform2f(GetLocation(name), value0, value1);
+    SetUniform2f(GetLocation(name), value0, value1);
 }
 
 void GLShaderUniform::SetUniform3f(const char* name, float value0, float value1, float value2)
 {
-    glUniform3f(GetLocation(name), value0, value1, value2);
+    SetUniform3f(GetLocation(name), value0, value1, value2);
 }
 
 void GLShaderUniform::SetUniform4f(const char* name, float value0, float value1, float value2, float value3)
 {
-    glUniform4f(GetLocation(name), value0, value1, value2, value3);
+    SetUniform4f(GetLocation(name), value0, value1, value2, value3);
 }
 
 void GLShaderUniform::SetUniform1iv(const char* name, const int* value, std::size_t count)
 {
-    glUniform1iv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform1iv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform2iv(const char* name, const int* value, std::size_t count)
 {
-    glUniform2iv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform2iv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform3iv(const char* name, const int* value, std::size_t count)
 {
-    glUniform3iv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform3iv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform4iv(const char* name, const int* value, std::size_t count)
 {
-    glUniform4iv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform4iv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform1fv(const char* name, const float* value, std::size_t count)
 {
-    glUniform1fv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform1fv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform2fv(const char* name, const float* value, std::size_t count)
 {
-    glUniform2fv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform2fv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform3fv(const char* name, const float* value, std::size_t count)
 {
-    glUniform3fv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform3fv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform4fv(const char* name, const float* value, std::size_t count)
 {
-    glUniform4fv(GetLocation(name), static_cast<GLsizei>(count), value);
+    SetUniform4fv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform2x2fv(const char* name, const float* value, std::size_t count)
 {
-    glUniformMatrix2fv(GetLocation(name), static_cast<GLsizei>(count), GL_FALSE, value);
+    SetUniform2x2fv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform3x3fv(const char* name, const float* value, std::size_t count)
 {
-    glUniformMatrix3fv(GetLocation(name), static_cast<GLsizei>(count), GL_FALSE, value);
+    SetUniform3x3fv(GetLocation(name), value, count);
 }
 
 void GLShaderUniform::SetUniform4x4fv(const char* name, const float* value, std::size_t count)
 {
-    glUniformMatrix4fv(GetLocation(name), static_cast<GLsizei>(count), GL_FALSE, value);
+    SetUniform4x4fv(GetLocation(name), value, count);
 }
 
 
@@ -213,10 +247,44 @@ void GLShaderUniform::SetUniform4x4fv(const char* name, const float* value, std:
  * ======= Private: =======
  */
 
-GLint GLShaderUniform::GetLocation(const char* name) const
-{
-    return glGetUniformLocation(program_, name);
-}
+GLint GLShaderUniform::GetLocation(const char* name)
+{
+    /* Build location table with the first name lookup, so asynchronous program linking is not interrupted */
+    if (!locationTable_.IsBuilt())
+        locationTable_.Build(program_);
+    return locationTable_.Find(name);
+}
+
+void GLShaderUniform::SetUniformValue(const UniformValue& uniformValue)
+{
+    const auto location = static_cast<GLint>(uniformValue.location);
+    const auto count    = static_cast<GLsizei>(uniformValue.count);
+    const auto dataf    = reinterpret_cast<const GLfloat*>(uniformValue.data);
+    const auto datai    = reinterpret_cast<const GLint*>(uniformValue.data);
+
+    switch (uniformValue.type)
+    {
+        case UniformType::Float1:   LLGL_GL_UNIFORM(Uniform1fv, location, count, dataf); break;
+        case UniformType::Float2:   LLGL_GL_UNIFORM(Uniform2fv, location, count, dataf); break;
+        case UniformType::Float3:   LLGL_GL_UNIFORM(Uniform3fv, location, count, dataf); break;
+        case UniformType::Float4:   LLGL_GL_UNIFORM(Uniform4fv, location, count, dataf); break;
+        case UniformType::Int1:
+        case UniformType::Bool1:
+        case UniformType::Sampler:  LLGL_GL_UNIFORM(Uniform1iv, location, count, datai); break;
+        case UniformType::Int2:
+        case UniformType::Bool2:    LLGL_GL_UNIFORM(Uniform2iv, location, count, datai); break;
+        case UniformType::Int3:
+        case UniformType::Bool3:    LLGL_GL_UNIFORM(Uniform3iv, location, count, datai); break;
+        case UniformType::Int4:
+        case UniformType::Bool4:    LLGL_GL_UNIFORM(Uniform4iv, location, count, datai); break;
+        case UniformType::Float2x2: LLGL_GL_UNIFORM(UniformMatrix2fv, location, count, GL_FALSE, dataf); break;
+        case UniformType::Float3x3: LLGL_GL_UNIFORM(UniformMatrix3fv, location, count, GL_FALSE, dataf); break;
+        case UniformType::Float4x4: LLGL_GL_UNIFORM(UniformMatrix4fv, location, count, GL_FALSE, dataf); break;
+        default:                    throw std::invalid_argument("unsupported uniform type for batched uniform update");
+    }
+}
+
+#undef LLGL_GL_UNIFORM
 
 
 } // /namespace LLGL
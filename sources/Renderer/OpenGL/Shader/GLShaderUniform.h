@@ -10,6 +10,7 @@
 
 
 #include <LLGL/ShaderUniform.h>
+#include "GLUniformLocationTable.h"
 #include "../OpenGL.h"
 
 
@@ -24,6 +25,10 @@ class GLShaderUniform final : public ShaderUniform
 
         GLShaderUniform(GLuint program);
 
+        UniformLocation GetUniformLocation(const char* name) override;
+
+        void SetUniforms(std::size_t numUniformValues, const UniformValue* uniformValues) override;
+
         void SetUniform1i(const UniformLocation location, int value0) override;
         void SetUniform2i(const UniformLocation location, int value0, int value1) override;
         void SetUniform3i(const UniformLocation location, int value0, int value1, int value2) override;
@@ -72,11 +77,21 @@ class GLShaderUniform final : public ShaderUniform
         void SetUniform3x3fv(const char* name, const float* value, std::size_t count = 1) override;
         void SetUniform4x4fv(const char* name, const float* value, std::size_t count = 1) override;
 
+        // Returns true if uniforms are set directly to the shader program (GL_ARB_separate_shader_objects), i.e. the program does not need to be bound.
+        inline bool HasDirectAccess() const
+        {
+            return directAccess_;
+        }
+
     private:
 
-        GLint GetLocation(const char* name) const;
+        GLint GetLocation(const char* name);
+
+        void SetUniformValue(const UniformValue& uniformValue);
 
-        GLuint program_ = 0;
+        GLuint                  program_        = 0;
+        bool                    directAccess_   = false;
+        GLUniformLocationTable  locationTable_;
 
 };
 
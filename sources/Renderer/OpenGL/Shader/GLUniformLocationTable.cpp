@@ -0,0 +1,207 @@
+/*
+ * GLUniformLocationTable.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLUniformLocationTable.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <cstring>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+// 32-bit FNV-1a hash of the specified null-terminated string; also returns the string length.
+static std::uint32_t HashUniformName(const char* name, std::size_t& nameLength)
+{
+    std::uint32_t hash = 2166136261u;
+    const char* s = name;
+    for (; *s != '\0'; ++s)
+    {
+        hash ^= static_cast<std::uint8_t>(*s);
+        hash *= 16777619u;
+    }
+    nameLength = static_cast<std::size_t>(s - name);
+    return hash;
+}
+
+void GLUniformLocationTable::Build(GLuint program)
+{
+    entries_.clear();
+    names_.clear();
+    numEntries_ = 0;
+
+    #ifdef GL_ARB_program_interface_query
+    if (HasExtension(GLExt::ARB_program_interface_query))
+    {
+        /* Query number of active uniforms and maximal name length */
+        GLint numUniforms = 0, maxNameLength = 0;
+        glGetProgramInterfaceiv(program, GL_UNIFORM, GL_ACTIVE_RESOURCES, &numUniforms);
+        glGetProgramInterfaceiv(program, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxNameLength);
+
+        if (numUniforms > 0 && maxNameLength > 0)
+        {
+            Reserve(static_cast<std::size_t>(numUniforms));
+            std::vector<char> name(static_cast<std::size_t>(maxNameLength), '\0');
+
+            for (GLuint i = 0; i < static_cast<GLuint>(numUniforms); ++i)
+            {
+                /* Query uniform location and array size; uniforms inside of blocks have location -1 */
+                const GLenum props[] = { GL_LOCATION, GL_ARRAY_SIZE };
+                GLint params[2] = { -1, 1 };
+                glGetProgramResourceiv(program, GL_UNIFORM, i, 2, props, 2, nullptr, params);
+
+                if (params[0] < 0)
+                    continue;
+
+                GLsizei nameLength = 0;
+                glGetProgramResourceName(program, GL_UNIFORM, i, maxNameLength, &nameLength, name.data());
+                InsertArray(program, name.data(), static_cast<std::size_t>(nameLength), params[0], params[1]);
+            }
+        }
+    }
+    else
+    #endif // /GL_ARB_program_interface_query
+    {
+        /* Query number of active uniforms and maximal name length */
+        GLint numUniforms = 0, maxNameLength = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &numUniforms);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+        if (numUniforms > 0 && maxNameLength > 0)
+        {
+            Reserve(static_cast<std::size_t>(numUniforms));
+            std::vector<char> name(static_cast<std::size_t>(maxNameLength), '\0');
+
+            for (GLuint i = 0; i < static_cast<GLuint>(numUniforms); ++i)
+            {
+                GLsizei nameLength  = 0;
+                GLint   size        = 0;
+                GLenum  type        = 0;
+                glGetActiveUniform(program, i, maxNameLength, &nameLength, &size, &type, name.data());
+
+                /* Uniforms inside of blocks have location -1 */
+                auto location = glGetUniformLocation(program, name.data());
+                if (location >= 0)
+                    InsertArray(program, name.data(), static_cast<std::size_t>(nameLength), location, size);
+            }
+        }
+    }
+
+    built_ = true;
+}
+
+GLint GLUniformLocationTable::Find(const char* name) const
+{
+    if (entries_.empty() || name == nullptr)
+        return -1;
+
+    std::size_t nameLength = 0;
+    const auto hash = HashUniformName(name, nameLength);
+    const auto mask = entries_.size() - 1;
+
+    /* Probe entries until the name or an empty entry is found (the table is never full) */
+    for (auto i = static_cast<std::size_t>(hash) & mask;; i = (i + 1) & mask)
+    {
+        const auto& entry = entries_[i];
+        if (entry.nameOffset == invalidOffset)
+            return -1;
+        if (entry.hash == hash && std::strcmp(names_.data() + entry.nameOffset, name) == 0)
+            return entry.location;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLUniformLocationTable::Reserve(std::size_t numNames)
+{
+    /* Keep the load factor at or below 50% */
+    std::size_t numEntries = 16;
+    while (numEntries < numNames * 2)
+        numEntries <<= 1;
+    Rehash(numEntries);
+}
+
+void GLUniformLocationTable::Rehash(std::size_t numEntries)
+{
+    std::vector<Entry> prevEntries(numEntries);
+    prevEntries.swap(entries_);
+
+    /* Move all previous entries into the new table; the interned names remain untouched */
+    const auto mask = entries_.size() - 1;
+    for (const auto& entry : prevEntries)
+    {
+        if (entry.nameOffset != invalidOffset)
+        {
+            auto i = static_cast<std::size_t>(entry.hash) & mask;
+            while (entries_[i].nameOffset != invalidOffset)
+                i = (i + 1) & mask;
+            entries_[i] = entry;
+        }
+    }
+}
+
+void GLUniformLocationTable::Insert(const char* name, GLint location)
+{
+    /* Grow table if it would exceed a load factor of 50% */
+    if ((numEntries_ + 1) * 2 > entries_.size())
+        Rehash(entries_.empty() ? 16 : entries_.size() * 2);
+
+    std::size_t nameLength = 0;
+    const auto hash = HashUniformName(name, nameLength);
+    const auto mask = entries_.size() - 1;
+
+    for (auto i = static_cast<std::size_t>(hash) & mask;; i = (i + 1) & mask)
+    {
+        auto& entry = entries_[i];
+        if (entry.nameOffset == invalidOffset)
+        {
+            /* Intern name and store new entry */
+            entry.hash          = hash;
+            entry.nameOffset    = static_cast<std::uint32_t>(names_.size());
+            entry.location      = location;
+            names_.insert(names_.end(), name, name + nameLength);
+            names_.push_back('\0');
+            ++numEntries_;
+            return;
+        }
+        if (entry.hash == hash && std::strcmp(names_.data() + entry.nameOffset, name) == 0)
+            return;
+    }
+}
+
+void GLUniformLocationTable::InsertArray(GLuint program, const char* name, std::size_t nameLength, GLint location, GLint arraySize)
+{
+    Insert(name, location);
+
+    /* Array uniforms are reported as "name[0]", so also insert their base name and all other elements */
+    if (nameLength > 3 && std::strcmp(name + nameLength - 3, "[0]") == 0)
+    {
+        const std::string baseName(name, nameLength - 3);
+        Insert(baseName.c_str(), location);
+
+        /* Element locations are not guaranteed to be consecutive, so query them once here */
+        for (GLint i = 1; i < arraySize; ++i)
+        {
+            const auto elementName = baseName + "[" + std::to_string(i) + "]";
+            auto elementLocation = glGetUniformLocation(program, elementName.c_str());
+            if (elementLocation >= 0)
+                Insert(elementName.c_str(), elementLocation);
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
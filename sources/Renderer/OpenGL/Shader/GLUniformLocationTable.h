@@ -0,0 +1,75 @@
+/*
+ * GLUniformLocationTable.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_UNIFORM_LOCATION_TABLE_H
+#define LLGL_GL_UNIFORM_LOCATION_TABLE_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Table of all active uniform locations of a shader program, queried once after the program has been linked.
+All names are interned in a single character buffer and looked up with an open-addressing hash table (linear probing).
+*/
+class GLUniformLocationTable
+{
+
+    public:
+
+        // Queries all active uniforms of the specified (linked) shader program and stores their locations.
+        void Build(GLuint program);
+
+        // Returns true if this table has already been built.
+        inline bool IsBuilt() const
+        {
+            return built_;
+        }
+
+        // Returns the location of the specified uniform, or -1 if the program has no active uniform with that name.
+        GLint Find(const char* name) const;
+
+    private:
+
+        static const std::uint32_t invalidOffset = ~0u;
+
+        struct Entry
+        {
+            std::uint32_t   hash        = 0;
+            std::uint32_t   nameOffset  = invalidOffset;    // Offset into the interned names; invalidOffset for empty entries
+            GLint           location    = -1;
+        };
+
+    private:
+
+        void Reserve(std::size_t numNames);
+        void Rehash(std::size_t numEntries);
+        void Insert(const char* name, GLint location);
+        void InsertArray(GLuint program, const char* name, std::size_t nameLength, GLint location, GLint arraySize);
+
+        std::vector<Entry>  entries_;       // Number of entries is always a power of two
+        std::vector<char>   names_;         // Interned null-terminated names
+        std::size_t         numEntries_ = 0;
+        bool                built_      = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,184 @@
+/*
+ * GLPixelPackRing.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLPixelPackRing.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../GLCommon/GLTypes.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../Ext/GLExtensions.h"
+
+
+namespace LLGL
+{
+
+
+GLPixelPackRing::~GLPixelPackRing()
+{
+    Clear();
+}
+
+std::uint64_t GLPixelPackRing::ReadTexture(const GLTexture& textureGL, GLint mipLevel, const ImageFormat format, const DataType dataType, std::size_t dataSize)
+{
+    /* Allocate slot for new read operation */
+    auto& slot = AllocSlot(dataSize);
+
+    slot.id         = ++idCounter_;
+    slot.format     = format;
+    slot.dataType   = dataType;
+    slot.dataSize   = dataSize;
+
+    GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot.pbo);
+
+        /* Grow pixel pack buffer if necessary */
+        if (slot.capacity < static_cast<GLsizeiptr>(dataSize))
+        {
+            slot.capacity = static_cast<GLsizeiptr>(dataSize);
+            glBufferData(GL_PIXEL_PACK_BUFFER, slot.capacity, nullptr, GL_STREAM_READ);
+        }
+
+        /* Read image data from texture into PBO (the destination pointer is an offset into the PBO) */
+        #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+        if (HasExtension(GLExt::ARB_direct_state_access))
+        {
+            glGetTextureImage(
+                textureGL.GetID(),
+                mipLevel,
+                GLTypes::Map(format),
+                GLTypes::Map(dataType),
+                static_cast<GLsizei>(dataSize),
+                nullptr
+            );
+        }
+        else
+        #endif
+        {
+            GLStateManager::active->BindTexture(textureGL);
+            glGetTexImage(
+                GLTypes::Map(textureGL.GetType()),
+                mipLevel,
+                GLTypes::Map(format),
+                GLTypes::Map(dataType),
+                nullptr
+            );
+        }
+    }
+    GLStateManager::active->PopBoundBuffer();
+
+    return slot.id;
+}
+
+bool GLPixelPackRing::Map(std::uint64_t id, SrcImageDescriptor& imageDesc)
+{
+    auto slot = FindSlot(id);
+    if (!slot)
+        return false;
+
+    /* Map pixel pack buffer for reading */
+    void* data = nullptr;
+
+    GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot->pbo);
+        data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    }
+    GLStateManager::active->PopBoundBuffer();
+
+    if (!data)
+        return false;
+
+    slot->mapped = true;
+
+    imageDesc.format    = slot->format;
+    imageDesc.dataType  = slot->dataType;
+    imageDesc.data      = data;
+    imageDesc.dataSize  = slot->dataSize;
+
+    return true;
+}
+
+void GLPixelPackRing::Release(std::uint64_t id)
+{
+    if (auto slot = FindSlot(id))
+    {
+        if (slot->mapped)
+        {
+            GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+            {
+                GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, slot->pbo);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            GLStateManager::active->PopBoundBuffer();
+            slot->mapped = false;
+        }
+        slot->id = 0;
+    }
+}
+
+void GLPixelPackRing::Clear()
+{
+    for (auto& slot : slots_)
+    {
+        glDeleteBuffers(1, &(slot.pbo));
+        GLStateManager::active->NotifyBufferRelease(slot.pbo, GLBufferTarget::PIXEL_PACK_BUFFER);
+    }
+    slots_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+GLPixelPackRing::Slot& GLPixelPackRing::AllocSlot(std::size_t dataSize)
+{
+    /* Find free slot, preferably one that is large enough to avoid reallocation */
+    Slot* freeSlot = nullptr;
+
+    for (auto& slot : slots_)
+    {
+        if (slot.id == 0)
+        {
+            if (slot.capacity >= static_cast<GLsizeiptr>(dataSize))
+                return slot;
+            if (!freeSlot)
+                freeSlot = (&slot);
+        }
+    }
+
+    if (freeSlot)
+        return *freeSlot;
+
+    /* Append new slot with new pixel pack buffer */
+    Slot slot;
+    glGenBuffers(1, &(slot.pbo));
+    slots_.push_back(slot);
+
+    return slots_.back();
+}
+
+GLPixelPackRing::Slot* GLPixelPackRing::FindSlot(std::uint64_t id)
+{
+    if (id != 0)
+    {
+        for (auto& slot : slots_)
+        {
+            if (slot.id == id)
+                return (&slot);
+        }
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,78 @@
+/*
+ * GLPixelPackRing.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PIXEL_PACK_RING_H
+#define LLGL_GL_PIXEL_PACK_RING_H
+
+
+#include "../OpenGL.h"
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ImageFlags.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+
+// Ring of pixel pack buffers (PBO) for asynchronous texture read operations.
+class GLPixelPackRing : public NonCopyable
+{
+
+    public:
+
+        ~GLPixelPackRing();
+
+        // Reads the specified texture MIP-map into a free pixel pack buffer and returns the ID of the read operation.
+        std::uint64_t ReadTexture(const GLTexture& textureGL, GLint mipLevel, const ImageFormat format, const DataType dataType, std::size_t dataSize);
+
+        // Maps the pixel pack buffer of the specified read operation and returns its image descriptor. Returns false if the ID is invalid.
+        bool Map(std::uint64_t id, SrcImageDescriptor& imageDesc);
+
+        // Unmaps the pixel pack buffer of the specified read operation (if mapped) and makes it available for the next read operation.
+        void Release(std::uint64_t id);
+
+        // Deletes all pixel pack buffers.
+        void Clear();
+
+    private:
+
+        struct Slot
+        {
+            GLuint          pbo         = 0;
+            GLsizeiptr      capacity    = 0;
+            std::uint64_t   id          = 0;    // ID of the pending read operation, or 0 if this slot is free
+            ImageFormat     format      = ImageFormat::RGBA;
+            DataType        dataType    = DataType::UInt8;
+            std::size_t     dataSize    = 0;
+            bool            mapped      = false;
+        };
+
+    private:
+
+        Slot& AllocSlot(std::size_t dataSize);
+        Slot* FindSlot(std::uint64_t id);
+
+    private:
+
+        std::vector<Slot>   slots_;
+        std::uint64_t       idCounter_  = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
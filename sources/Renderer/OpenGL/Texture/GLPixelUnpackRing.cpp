@@ -0,0 +1,215 @@
+/*
+ * GLPixelUnpackRing.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLPixelUnpackRing.h"
+#include "../RenderState/GLStateManager.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../Ext/GLExtensions.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Size of the ring buffer (uploads that are larger than this are written directly from client memory)
+static const GLsizeiptr g_pixelUnpackRingSize = (8 * 1024 * 1024);
+
+// Alignment of each range within the ring (large enough for all pixel data types and SIMD copies)
+static const GLintptr g_pixelUnpackAlignment = 16;
+
+GLPixelUnpackRing::GLPixelUnpackRing() :
+    size_ { g_pixelUnpackRingSize }
+{
+}
+
+GLPixelUnpackRing::~GLPixelUnpackRing()
+{
+    Clear();
+}
+
+bool GLPixelUnpackRing::IsSupported()
+{
+    return (HasExtension(GLExt::ARB_sync) && HasExtension(GLExt::ARB_map_buffer_range));
+}
+
+static GLintptr AlignOffset(GLintptr offset)
+{
+    return ((offset + g_pixelUnpackAlignment - 1) / g_pixelUnpackAlignment) * g_pixelUnpackAlignment;
+}
+
+bool GLPixelUnpackRing::Write(const void* data, std::size_t dataSize, GLintptr& offset)
+{
+    #ifdef GL_ARB_map_buffer_range
+
+    const auto size = static_cast<GLsizeiptr>(dataSize);
+    if (data == nullptr || size == 0 || size > size_)
+        return false;
+
+    if (pbo_ == 0)
+        CreatePBO();
+
+    /* Allocate range at the ring head, and wrap around if the range does not fit into the remaining space */
+    RetireSignaledSegments();
+
+    auto begin = AlignOffset(head_);
+    if (begin + size > size_)
+        begin = 0;
+
+    /* Wait until the GPU has consumed all previous uploads within this range */
+    WaitForRange(begin, begin + size);
+
+    GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, pbo_);
+
+    if (mappedData_ != nullptr)
+    {
+        /* Copy data into persistently mapped memory */
+        ::memcpy(reinterpret_cast<char*>(mappedData_) + begin, data, dataSize);
+    }
+    else
+    {
+        /* Map range without implicit synchronization, since the range is guarded by our own fences */
+        auto dst = glMapBufferRange(
+            GL_PIXEL_UNPACK_BUFFER,
+            begin,
+            size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT
+        );
+
+        if (dst == nullptr)
+            return false;
+
+        ::memcpy(dst, data, dataSize);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    head_           = begin + size;
+    pendingBegin_   = begin;
+    pendingEnd_     = begin + size;
+    offset          = begin;
+
+    return true;
+
+    #else
+
+    return false;
+
+    #endif // /GL_ARB_map_buffer_range
+}
+
+void GLPixelUnpackRing::Fence()
+{
+    if (pendingEnd_ > pendingBegin_)
+    {
+        segments_.push_back({ pendingBegin_, pendingEnd_, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) });
+        pendingBegin_   = 0;
+        pendingEnd_     = 0;
+    }
+}
+
+void GLPixelUnpackRing::Clear()
+{
+    if (pbo_ != 0)
+    {
+        /* Wait for all pending uploads before the memory is released */
+        WaitForRange(0, size_);
+
+        if (mappedData_ != nullptr)
+        {
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, pbo_);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            mappedData_ = nullptr;
+        }
+
+        glDeleteBuffers(1, &pbo_);
+        GLStateManager::active->NotifyBufferRelease(pbo_, GLBufferTarget::PIXEL_UNPACK_BUFFER);
+        pbo_ = 0;
+    }
+    head_ = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLPixelUnpackRing::CreatePBO()
+{
+    glGenBuffers(1, &pbo_);
+
+    GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER);
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, pbo_);
+
+        #if defined GL_ARB_buffer_storage && defined GL_ARB_map_buffer_range
+        if (HasExtension(GLExt::ARB_buffer_storage))
+        {
+            /* Allocate immutable storage and map it persistently */
+            const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+            glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size_, nullptr, flags);
+            mappedData_ = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size_, flags);
+        }
+        else
+        #endif
+        {
+            /* Allocate mutable storage, which is mapped for each upload */
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, size_, nullptr, GL_STREAM_DRAW);
+        }
+    }
+    GLStateManager::active->PopBoundBuffer();
+}
+
+static bool RangesOverlap(GLintptr begin0, GLintptr end0, GLintptr begin1, GLintptr end1)
+{
+    return (begin0 < end1 && begin1 < end0);
+}
+
+void GLPixelUnpackRing::WaitForRange(GLintptr begin, GLintptr end)
+{
+    /* Find the most recent segment that overlaps the range (fences are signaled in order, so all previous segments are finished as well) */
+    std::size_t numSegments = 0;
+
+    for (std::size_t i = 0; i < segments_.size(); ++i)
+    {
+        if (RangesOverlap(segments_[i].begin, segments_[i].end, begin, end))
+            numSegments = i + 1;
+    }
+
+    if (numSegments > 0)
+    {
+        auto sync = segments_[numSegments - 1].sync;
+        while (glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, ~0ull) == GL_TIMEOUT_EXPIRED)
+        {
+            /* Continue waiting */
+        }
+
+        for (std::size_t i = 0; i < numSegments; ++i)
+        {
+            glDeleteSync(segments_.front().sync);
+            segments_.pop_front();
+        }
+    }
+}
+
+void GLPixelUnpackRing::RetireSignaledSegments()
+{
+    while (!segments_.empty())
+    {
+        auto result = glClientWaitSync(segments_.front().sync, 0, 0);
+        if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+            break;
+        glDeleteSync(segments_.front().sync);
+        segments_.pop_front();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,88 @@
+/*
+ * GLPixelUnpackRing.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PIXEL_UNPACK_RING_H
+#define LLGL_GL_PIXEL_UNPACK_RING_H
+
+
+#include "../OpenGL.h"
+#include <LLGL/NonCopyable.h>
+#include <deque>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Ring buffer of pixel unpack memory (PBO) for streaming texture uploads.
+Each upload is copied into the next free range of the ring, and the range is guarded by a fence (GL_ARB_sync),
+so it is only overwritten once the GPU has consumed it. The ring is persistently mapped if GL_ARB_buffer_storage is available.
+*/
+class GLPixelUnpackRing : public NonCopyable
+{
+
+    public:
+
+        GLPixelUnpackRing();
+        ~GLPixelUnpackRing();
+
+        // Returns true if the ring can be used with the current GL context.
+        static bool IsSupported();
+
+        /*
+        Copies the specified data into the ring and binds the PBO to GL_PIXEL_UNPACK_BUFFER.
+        Returns false if the data does not fit into the ring. Otherwise, 'offset' receives the offset within the PBO,
+        which must be passed as data pointer to the next glTexSubImage* call, followed by a call to 'Fence'.
+        */
+        bool Write(const void* data, std::size_t dataSize, GLintptr& offset);
+
+        // Inserts a fence for the range of the last 'Write' call.
+        void Fence();
+
+        // Waits for all pending uploads and deletes the PBO.
+        void Clear();
+
+    private:
+
+        struct Segment
+        {
+            GLintptr    begin;
+            GLintptr    end;
+            GLsync      sync;
+        };
+
+    private:
+
+        void CreatePBO();
+        void WaitForRange(GLintptr begin, GLintptr end);
+        void RetireSignaledSegments();
+
+    private:
+
+        GLuint              pbo_            = 0;
+        GLsizeiptr          size_           = 0;
+        GLintptr            head_           = 0;
+        void*               mappedData_     = nullptr;  // Persistently mapped memory (only with GL_ARB_buffer_storage)
+
+        GLintptr            pendingBegin_   = 0;
+        GLintptr            pendingEnd_     = 0;
+
+        std::deque<Segment> segments_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
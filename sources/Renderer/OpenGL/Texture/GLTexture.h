@@ -38,11 +38,24 @@ class GLTexture final : public Texture
             return id_;
         }
 
+        // Sets the block compression format this texture has been created with, if it was substituted by an uncompressed format.
+        inline void SetSubstitutedFormat(const Format format)
+        {
+            substitutedFormat_ = format;
+        }
+
+        // Returns the substituted block compression format, or Format::Undefined if the texture has been created with its original format.
+        inline Format GetSubstitutedFormat() const
+        {
+            return substitutedFormat_;
+        }
+
     private:
 
         void QueryTexParams(GLint* internalFormat, GLint* extent) const;
 
-        GLuint id_ = 0;
+        GLuint id_                  = 0;
+        Format substitutedFormat_   = Format::Undefined;
 
 };
 
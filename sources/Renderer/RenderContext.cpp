@@ -134,6 +134,13 @@ void RenderContext::SetOrCreateSurface(const std::shared_ptr<Surface>& surface,
     }
 }
 
+void RenderContext::SetHeadlessVideoMode(VideoModeDescriptor videoModeDesc)
+{
+    /* Store video mode settings, but without fullscreen mode since there is no surface to display */
+    videoModeDesc.fullscreen = false;
+    videoModeDesc_ = videoModeDesc;
+}
+
 void RenderContext::ShareSurfaceAndConfig(RenderContext& other)
 {
     surface_        = other.surface_;
@@ -176,6 +183,20 @@ bool RenderContext::SetVideoModePrimary(const VideoModeDescriptor& videoModeDesc
 {
     bool result = true;
 
+    /* Render contexts without surface only update their resolution */
+    if (!HasSurface())
+    {
+        auto finalVideoMode = videoModeDesc;
+        finalVideoMode.fullscreen = false;
+
+        if (OnSetVideoMode(finalVideoMode))
+            videoModeDesc_ = finalVideoMode;
+        else
+            result = false;
+
+        return result;
+    }
+
     auto& surface = GetSurface();
 
     /* Store current surface position if the render context is in windowed mode */
@@ -0,0 +1,754 @@
+/*
+ * RenderGraph.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/RenderGraph.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Buffer.h>
+#include <LLGL/RenderPass.h>
+#include <LLGL/RenderTarget.h>
+#include "../Core/Helper.h"
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+RenderGraph::RenderGraph(RenderSystem& renderSystem) :
+    renderSystem_ { renderSystem }
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+    ReleaseAll();
+}
+
+/* ----- Setup ----- */
+
+std::uint32_t RenderGraph::CreateTexture(const std::string& name, const TextureDescriptor& desc)
+{
+    auto id = AddResource(name, ResourceKind::Texture);
+    resources_[id].textureDesc = desc;
+    return id;
+}
+
+std::uint32_t RenderGraph::ImportTexture(const std::string& name, Texture& texture)
+{
+    auto id = AddResource(name, ResourceKind::Texture);
+    {
+        auto& resource = resources_[id];
+        resource.textureDesc    = texture.QueryDesc();
+        resource.texture        = &texture;
+        resource.imported       = true;
+    }
+    return id;
+}
+
+std::uint32_t RenderGraph::CreateBuffer(const std::string& name, const BufferDescriptor& desc)
+{
+    auto id = AddResource(name, ResourceKind::Buffer);
+    resources_[id].bufferDesc = desc;
+    return id;
+}
+
+std::uint32_t RenderGraph::ImportBuffer(const std::string& name, Buffer& buffer)
+{
+    auto id = AddResource(name, ResourceKind::Buffer);
+    {
+        auto& resource = resources_[id];
+        resource.bufferDesc.type    = buffer.GetType();
+        resource.buffer             = &buffer;
+        resource.imported           = true;
+    }
+    return id;
+}
+
+void RenderGraph::AddPass(const RenderGraphPassDescriptor& desc)
+{
+    /* Validate virtual resource IDs */
+    if (desc.renderTarget == nullptr)
+    {
+        for (auto id : desc.colorAttachments)
+            ValidateResourceID(id, ResourceKind::Texture);
+        if (desc.depthStencilAttachment != Constants::invalidGraphResource)
+            ValidateResourceID(desc.depthStencilAttachment, ResourceKind::Texture);
+    }
+
+    for (auto id : desc.reads)
+    {
+        if (id >= resources_.size())
+            throw std::invalid_argument("invalid render graph resource ID in read list of pass: " + desc.name);
+    }
+
+    for (auto id : desc.writes)
+    {
+        if (id >= resources_.size())
+            throw std::invalid_argument("invalid render graph resource ID in write list of pass: " + desc.name);
+    }
+
+    /* Append new pass */
+    Pass pass;
+    pass.desc = desc;
+    passes_.push_back(std::move(pass));
+
+    compiled_ = false;
+}
+
+void RenderGraph::Reset()
+{
+    resources_.clear();
+    passes_.clear();
+    compiled_ = false;
+}
+
+/* ----- Compilation and execution ----- */
+
+void RenderGraph::Compile()
+{
+    BuildDependencies();
+    CullPasses();
+    ComputeLifetimes();
+    AssignPhysicalResources();
+    BuildRenderTargets();
+    TrimPools();
+    compiled_ = true;
+}
+
+void RenderGraph::Execute(CommandBuffer& commandBuffer)
+{
+    if (!compiled_)
+        throw std::runtime_error("cannot execute render graph that has not been compiled");
+
+    for (const auto& pass : passes_)
+    {
+        if (!pass.active)
+            continue;
+
+        if (pass.desc.renderTarget != nullptr)
+        {
+            /* Render into external render target; clear with the current clear values */
+            commandBuffer.BeginRenderPass(*pass.desc.renderTarget);
+            {
+                long clearFlags = 0;
+
+                if ((pass.desc.flags & RenderGraphPassFlags::ClearColor) != 0)
+                    clearFlags |= ClearFlags::Color;
+                if ((pass.desc.flags & RenderGraphPassFlags::ClearDepth) != 0)
+                    clearFlags |= ClearFlags::DepthStencil;
+
+                if (clearFlags != 0)
+                    commandBuffer.Clear(clearFlags);
+
+                if (pass.desc.callback)
+                    pass.desc.callback(commandBuffer, *this);
+            }
+            commandBuffer.EndRenderPass();
+        }
+        else if (pass.renderTarget != nullptr)
+        {
+            /* Render into attachments; clear values are taken from SetClearColor, SetClearDepth, and SetClearStencil */
+            commandBuffer.BeginRenderPass(*pass.renderTarget, pass.renderPass);
+            {
+                if (pass.desc.callback)
+                    pass.desc.callback(commandBuffer, *this);
+            }
+            commandBuffer.EndRenderPass();
+        }
+        else if (pass.desc.callback)
+        {
+            /* Pass without attachments (e.g. compute or copy pass) */
+            pass.desc.callback(commandBuffer, *this);
+        }
+    }
+}
+
+/* ----- Resources ----- */
+
+Texture* RenderGraph::GetTexture(std::uint32_t id) const
+{
+    if (id < resources_.size())
+        return resources_[id].texture;
+    return nullptr;
+}
+
+Buffer* RenderGraph::GetBuffer(std::uint32_t id) const
+{
+    if (id < resources_.size())
+        return resources_[id].buffer;
+    return nullptr;
+}
+
+std::uint32_t RenderGraph::GetNumActivePasses() const
+{
+    std::uint32_t n = 0;
+    for (const auto& pass : passes_)
+    {
+        if (pass.active)
+            ++n;
+    }
+    return n;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Calls the specified function for each virtual resource the pass refers to (attachments, reads, and writes).
+template <typename TFunc>
+static void ForEachPassResource(const RenderGraphPassDescriptor& desc, TFunc func)
+{
+    if (desc.renderTarget == nullptr)
+    {
+        for (auto id : desc.colorAttachments)
+            func(id);
+        if (desc.depthStencilAttachment != Constants::invalidGraphResource)
+            func(desc.depthStencilAttachment);
+    }
+    for (auto id : desc.reads)
+        func(id);
+    for (auto id : desc.writes)
+        func(id);
+}
+
+// Calls the specified function for each virtual resource the pass writes to (attachments and writes).
+template <typename TFunc>
+static void ForEachPassOutput(const RenderGraphPassDescriptor& desc, TFunc func)
+{
+    if (desc.renderTarget == nullptr)
+    {
+        for (auto id : desc.colorAttachments)
+            func(id);
+        if (desc.depthStencilAttachment != Constants::invalidGraphResource)
+            func(desc.depthStencilAttachment);
+    }
+    for (auto id : desc.writes)
+        func(id);
+}
+
+static bool CompareTextureDescs(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type        == rhs.type         &&
+        lhs.format      == rhs.format       &&
+        lhs.flags       == rhs.flags        &&
+        lhs.extent      == rhs.extent       &&
+        lhs.arrayLayers == rhs.arrayLayers  &&
+        lhs.mipLevels   == rhs.mipLevels    &&
+        lhs.samples     == rhs.samples
+    );
+}
+
+static bool CompareBufferDescs(const BufferDescriptor& lhs, const BufferDescriptor& rhs)
+{
+    /* Vertex and index buffers also store their format, so they are never shared */
+    if (lhs.type == BufferType::Vertex || lhs.type == BufferType::Index)
+        return false;
+
+    return
+    (
+        lhs.type                        == rhs.type                         &&
+        lhs.size                        == rhs.size                         &&
+        lhs.flags                       == rhs.flags                        &&
+        lhs.storageBuffer.storageType   == rhs.storageBuffer.storageType    &&
+        lhs.storageBuffer.format        == rhs.storageBuffer.format         &&
+        lhs.storageBuffer.stride        == rhs.storageBuffer.stride
+    );
+}
+
+static bool CompareAttachmentFormats(const AttachmentFormatDescriptor& lhs, const AttachmentFormatDescriptor& rhs)
+{
+    return (lhs.format == rhs.format && lhs.loadOp == rhs.loadOp && lhs.storeOp == rhs.storeOp);
+}
+
+static bool CompareRenderPassDescs(const RenderPassDescriptor& lhs, const RenderPassDescriptor& rhs)
+{
+    if (lhs.colorAttachments.size() != rhs.colorAttachments.size())
+        return false;
+
+    for (std::size_t i = 0; i < lhs.colorAttachments.size(); ++i)
+    {
+        if (!CompareAttachmentFormats(lhs.colorAttachments[i], rhs.colorAttachments[i]))
+            return false;
+    }
+
+    return
+    (
+        CompareAttachmentFormats(lhs.depthAttachment, rhs.depthAttachment) &&
+        CompareAttachmentFormats(lhs.stencilAttachment, rhs.stencilAttachment)
+    );
+}
+
+std::uint32_t RenderGraph::AddResource(const std::string& name, ResourceKind kind)
+{
+    auto id = static_cast<std::uint32_t>(resources_.size());
+    {
+        VirtualResource resource;
+        resource.name = name;
+        resource.kind = kind;
+        resources_.push_back(resource);
+    }
+    compiled_ = false;
+    return id;
+}
+
+void RenderGraph::ValidateResourceID(std::uint32_t id, ResourceKind kind) const
+{
+    if (id >= resources_.size())
+        throw std::invalid_argument("invalid render graph resource ID: " + std::to_string(id));
+    if (resources_[id].kind != kind)
+        throw std::invalid_argument("render graph resource has invalid type for attachment: " + resources_[id].name);
+}
+
+void RenderGraph::BuildDependencies()
+{
+    /* Each pass depends on the last pass that has written to any of its inputs */
+    std::vector<std::uint32_t> lastWriters(resources_.size(), Constants::invalidGraphResource);
+
+    for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(passes_.size()); i < n; ++i)
+    {
+        auto& pass = passes_[i];
+
+        pass.active = false;
+        pass.dependencies.clear();
+
+        auto AddDependency = [&pass, &lastWriters](std::uint32_t id)
+        {
+            auto writer = lastWriters[id];
+            if (writer != Constants::invalidGraphResource && !Contains(pass.dependencies, writer))
+                pass.dependencies.push_back(writer);
+        };
+
+        for (auto id : pass.desc.reads)
+            AddDependency(id);
+
+        /* Writes and attachments that are not cleared modify the previous content, so they are implicit reads */
+        for (auto id : pass.desc.writes)
+            AddDependency(id);
+
+        if (pass.desc.renderTarget == nullptr)
+        {
+            if ((pass.desc.flags & RenderGraphPassFlags::ClearColor) == 0)
+            {
+                for (auto id : pass.desc.colorAttachments)
+                    AddDependency(id);
+            }
+            if ((pass.desc.flags & RenderGraphPassFlags::ClearDepth) == 0 && pass.desc.depthStencilAttachment != Constants::invalidGraphResource)
+                AddDependency(pass.desc.depthStencilAttachment);
+        }
+
+        ForEachPassOutput(
+            pass.desc,
+            [&lastWriters, i](std::uint32_t id)
+            {
+                lastWriters[id] = i;
+            }
+        );
+    }
+}
+
+void RenderGraph::CullPasses()
+{
+    /* Gather root passes, i.e. passes whose outputs are visible outside of the render graph */
+    std::vector<std::uint32_t> stack;
+
+    for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(passes_.size()); i < n; ++i)
+    {
+        const auto& desc = passes_[i].desc;
+
+        bool isRoot = ((desc.flags & RenderGraphPassFlags::KeepAlive) != 0 || desc.renderTarget != nullptr);
+
+        if (!isRoot)
+        {
+            ForEachPassOutput(
+                desc,
+                [this, &isRoot](std::uint32_t id)
+                {
+                    if (resources_[id].imported)
+                        isRoot = true;
+                }
+            );
+        }
+
+        if (isRoot)
+            stack.push_back(i);
+    }
+
+    /* Activate all passes the root passes depend on */
+    while (!stack.empty())
+    {
+        auto& pass = passes_[stack.back()];
+        stack.pop_back();
+
+        if (!pass.active)
+        {
+            pass.active = true;
+            for (auto dep : pass.dependencies)
+            {
+                if (!passes_[dep].active)
+                    stack.push_back(dep);
+            }
+        }
+    }
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+    for (auto& resource : resources_)
+        resource.used = false;
+
+    for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(passes_.size()); i < n; ++i)
+    {
+        if (!passes_[i].active)
+            continue;
+
+        ForEachPassResource(
+            passes_[i].desc,
+            [this, i](std::uint32_t id)
+            {
+                auto& resource = resources_[id];
+                if (!resource.used)
+                {
+                    resource.used       = true;
+                    resource.firstPass  = i;
+                }
+                resource.lastPass = i;
+            }
+        );
+    }
+}
+
+void RenderGraph::AssignPhysicalResources()
+{
+    /* Reset assignment of pooled resources for the new compilation */
+    for (auto& entry : texturePool_)
+    {
+        entry.freePass = 0;
+        entry.assigned = false;
+    }
+    for (auto& entry : bufferPool_)
+    {
+        entry.freePass = 0;
+        entry.assigned = false;
+    }
+
+    /* Sort transient resources by their first use, so a pooled resource can be handed over to the next resource once its lifetime ends */
+    std::vector<std::uint32_t> transients;
+
+    for (std::uint32_t id = 0, n = static_cast<std::uint32_t>(resources_.size()); id < n; ++id)
+    {
+        auto& resource = resources_[id];
+        if (!resource.imported)
+        {
+            resource.texture    = nullptr;
+            resource.buffer     = nullptr;
+            if (resource.used)
+                transients.push_back(id);
+        }
+    }
+
+    std::stable_sort(
+        transients.begin(),
+        transients.end(),
+        [this](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            return (resources_[lhs].firstPass < resources_[rhs].firstPass);
+        }
+    );
+
+    /* Assign physical resources */
+    for (auto id : transients)
+    {
+        auto& resource = resources_[id];
+        if (resource.kind == ResourceKind::Texture)
+            resource.texture = AcquireTexture(resource.textureDesc, resource.firstPass, resource.lastPass);
+        else
+            resource.buffer = AcquireBuffer(resource.bufferDesc, resource.firstPass, resource.lastPass);
+    }
+}
+
+void RenderGraph::BuildRenderTargets()
+{
+    for (auto& entry : renderPassPool_)
+        entry.assigned = false;
+    for (auto& entry : renderTargetPool_)
+        entry.assigned = false;
+
+    for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(passes_.size()); i < n; ++i)
+    {
+        auto& pass = passes_[i];
+
+        pass.renderPass     = nullptr;
+        pass.renderTarget   = nullptr;
+
+        const auto& desc = pass.desc;
+        if (!pass.active || desc.renderTarget != nullptr)
+            continue;
+        if (desc.colorAttachments.empty() && desc.depthStencilAttachment == Constants::invalidGraphResource)
+            continue;
+
+        /* Derive load and store operations from the resource usage in the other passes */
+        RenderPassDescriptor renderPassDesc;
+        std::vector<Texture*> attachments;
+
+        const bool clearColor = ((desc.flags & RenderGraphPassFlags::ClearColor) != 0);
+        const bool clearDepth = ((desc.flags & RenderGraphPassFlags::ClearDepth) != 0);
+
+        for (auto id : desc.colorAttachments)
+        {
+            renderPassDesc.colorAttachments.push_back(MakeAttachmentFormat(id, i, clearColor));
+            attachments.push_back(resources_[id].texture);
+        }
+
+        if (desc.depthStencilAttachment != Constants::invalidGraphResource)
+        {
+            auto id = desc.depthStencilAttachment;
+            renderPassDesc.depthAttachment = MakeAttachmentFormat(id, i, clearDepth);
+            if (IsStencilFormat(resources_[id].textureDesc.format))
+                renderPassDesc.stencilAttachment = renderPassDesc.depthAttachment;
+            attachments.push_back(resources_[id].texture);
+        }
+
+        pass.renderPass     = AcquireRenderPass(renderPassDesc);
+        pass.renderTarget   = AcquireRenderTarget(attachments, pass.renderPass);
+    }
+}
+
+Texture* RenderGraph::AcquireTexture(const TextureDescriptor& desc, std::uint32_t firstPass, std::uint32_t lastPass)
+{
+    /* Find pooled texture with the same descriptor that is no longer used at the first pass */
+    for (auto& entry : texturePool_)
+    {
+        if (entry.freePass <= firstPass && CompareTextureDescs(entry.desc, desc))
+        {
+            entry.freePass = lastPass + 1;
+            entry.assigned = true;
+            return entry.texture;
+        }
+    }
+
+    /* Allocate new physical texture */
+    PooledTexture entry;
+    {
+        entry.desc      = desc;
+        entry.texture   = renderSystem_.CreateTexture(desc);
+        entry.freePass  = lastPass + 1;
+        entry.assigned  = true;
+    }
+    texturePool_.push_back(entry);
+
+    return entry.texture;
+}
+
+Buffer* RenderGraph::AcquireBuffer(const BufferDescriptor& desc, std::uint32_t firstPass, std::uint32_t lastPass)
+{
+    /* Find pooled buffer with the same descriptor that is no longer used at the first pass */
+    for (auto& entry : bufferPool_)
+    {
+        if (entry.freePass <= firstPass && CompareBufferDescs(entry.desc, desc))
+        {
+            entry.freePass = lastPass + 1;
+            entry.assigned = true;
+            return entry.buffer;
+        }
+    }
+
+    /* Allocate new physical buffer */
+    PooledBuffer entry;
+    {
+        entry.desc      = desc;
+        entry.buffer    = renderSystem_.CreateBuffer(desc);
+        entry.freePass  = lastPass + 1;
+        entry.assigned  = true;
+    }
+    bufferPool_.push_back(entry);
+
+    return entry.buffer;
+}
+
+RenderPass* RenderGraph::AcquireRenderPass(const RenderPassDescriptor& desc)
+{
+    for (auto& entry : renderPassPool_)
+    {
+        if (CompareRenderPassDescs(entry.desc, desc))
+        {
+            entry.assigned = true;
+            return entry.renderPass;
+        }
+    }
+
+    PooledRenderPass entry;
+    {
+        entry.desc          = desc;
+        entry.renderPass    = renderSystem_.CreateRenderPass(desc);
+        entry.assigned      = true;
+    }
+    renderPassPool_.push_back(entry);
+
+    return entry.renderPass;
+}
+
+RenderTarget* RenderGraph::AcquireRenderTarget(const std::vector<Texture*>& attachments, const RenderPass* renderPass)
+{
+    for (auto& entry : renderTargetPool_)
+    {
+        if (entry.renderPass == renderPass && entry.attachments == attachments)
+        {
+            entry.assigned = true;
+            return entry.renderTarget;
+        }
+    }
+
+    /* Create render target for the physical attachment textures */
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.renderPass = renderPass;
+
+        for (auto texture : attachments)
+        {
+            auto format = texture->QueryDesc().format;
+
+            AttachmentType type = AttachmentType::Color;
+            if (IsDepthStencilFormat(format))
+                type = (IsStencilFormat(format) ? AttachmentType::DepthStencil : AttachmentType::Depth);
+
+            renderTargetDesc.attachments.push_back(AttachmentDescriptor{ type, texture });
+        }
+
+        auto extent = attachments.front()->QueryMipExtent(0);
+        renderTargetDesc.resolution = { extent.width, extent.height };
+    }
+
+    PooledRenderTarget entry;
+    {
+        entry.attachments   = attachments;
+        entry.renderPass    = renderPass;
+        entry.renderTarget  = renderSystem_.CreateRenderTarget(renderTargetDesc);
+        entry.assigned      = true;
+    }
+    renderTargetPool_.push_back(entry);
+
+    return entry.renderTarget;
+}
+
+AttachmentFormatDescriptor RenderGraph::MakeAttachmentFormat(std::uint32_t id, std::uint32_t passIndex, bool clear) const
+{
+    const auto& resource = resources_[id];
+
+    AttachmentFormatDescriptor attachmentFormat;
+    {
+        attachmentFormat.format = resource.textureDesc.format;
+
+        /* Previous content is only needed if it was written before or if it comes from outside the render graph */
+        if (clear)
+            attachmentFormat.loadOp = AttachmentLoadOp::Clear;
+        else if (resource.imported || IsResourceUsedBefore(id, passIndex))
+            attachmentFormat.loadOp = AttachmentLoadOp::Load;
+        else
+            attachmentFormat.loadOp = AttachmentLoadOp::Undefined;
+
+        /* Outcome is only needed if it is used afterwards or if it is visible outside of the render graph */
+        if (resource.imported || IsResourceUsedAfter(id, passIndex))
+            attachmentFormat.storeOp = AttachmentStoreOp::Store;
+        else
+            attachmentFormat.storeOp = AttachmentStoreOp::Undefined;
+    }
+    return attachmentFormat;
+}
+
+bool RenderGraph::IsResourceUsedBefore(std::uint32_t id, std::uint32_t passIndex) const
+{
+    const auto& resource = resources_[id];
+    return (resource.used && resource.firstPass < passIndex);
+}
+
+bool RenderGraph::IsResourceUsedAfter(std::uint32_t id, std::uint32_t passIndex) const
+{
+    const auto& resource = resources_[id];
+    return (resource.used && resource.lastPass > passIndex);
+}
+
+void RenderGraph::TrimPools()
+{
+    /* Release render targets first, since they refer to the pooled textures and render passes */
+    RemoveAllFromListIf(
+        renderTargetPool_,
+        [this](const PooledRenderTarget& entry)
+        {
+            if (!entry.assigned)
+            {
+                renderSystem_.Release(*entry.renderTarget);
+                return true;
+            }
+            return false;
+        }
+    );
+
+    RemoveAllFromListIf(
+        renderPassPool_,
+        [this](const PooledRenderPass& entry)
+        {
+            if (!entry.assigned)
+            {
+                renderSystem_.Release(*entry.renderPass);
+                return true;
+            }
+            return false;
+        }
+    );
+
+    RemoveAllFromListIf(
+        texturePool_,
+        [this](const PooledTexture& entry)
+        {
+            if (!entry.assigned)
+            {
+                renderSystem_.Release(*entry.texture);
+                return true;
+            }
+            return false;
+        }
+    );
+
+    RemoveAllFromListIf(
+        bufferPool_,
+        [this](const PooledBuffer& entry)
+        {
+            if (!entry.assigned)
+            {
+                renderSystem_.Release(*entry.buffer);
+                return true;
+            }
+            return false;
+        }
+    );
+}
+
+void RenderGraph::ReleaseAll()
+{
+    for (auto& entry : renderTargetPool_)
+        entry.assigned = false;
+    for (auto& entry : renderPassPool_)
+        entry.assigned = false;
+    for (auto& entry : texturePool_)
+        entry.assigned = false;
+    for (auto& entry : bufferPool_)
+        entry.assigned = false;
+    TrimPools();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -15,6 +15,8 @@
 #include <LLGL/RenderSystem.h>
 #include <array>
 #include <map>
+#include <stdexcept>
+#include <string.h>
 
 #ifdef LLGL_ENABLE_DEBUG_LAYER
 #   include "DebugLayer/DbgRenderSystem.h"
@@ -220,6 +222,122 @@ void RenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     config_ = config;
 }
 
+CommandQueue* RenderSystem::GetDedicatedCommandQueue(const CommandQueueType /*type*/)
+{
+    /* Only a single command queue is supported by default */
+    return GetCommandQueue();
+}
+
+Fence* RenderSystem::CreateTimelineFence(std::uint64_t /*initialValue*/)
+{
+    throw std::runtime_error("timeline fences are not supported by this renderer");
+}
+
+Buffer* RenderSystem::CreateBufferAsync(const BufferDescriptor& desc, const void* initialData, Fence& fence)
+{
+    /* Create buffer synchronously and signal fence */
+    auto buffer = CreateBuffer(desc, initialData);
+    GetCommandQueue()->Submit(fence);
+    return buffer;
+}
+
+Texture* RenderSystem::CreateTextureAsync(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc, Fence& fence)
+{
+    /* Create texture synchronously and signal fence */
+    auto texture = CreateTexture(textureDesc, imageDesc);
+    GetCommandQueue()->Submit(fence);
+    return texture;
+}
+
+void RenderSystem::WriteTextureAsync(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc, Fence& fence)
+{
+    /* Write texture synchronously and signal fence */
+    WriteTexture(texture, subTextureDesc, imageDesc);
+    GetCommandQueue()->Submit(fence);
+}
+
+void RenderSystem::GenerateMipsAsync(Texture& texture, Fence& fence)
+{
+    /* Generate MIP-maps synchronously and signal fence */
+    GenerateMips(texture);
+    GetCommandQueue()->Submit(fence);
+}
+
+void RenderSystem::GenerateMipsBatch(std::uint32_t numTextures, Texture* const * textures, Fence* fence)
+{
+    /* Generate MIP-maps for each texture individually and signal optional fence */
+    for (std::uint32_t i = 0; i < numTextures; ++i)
+        GenerateMips(*textures[i]);
+
+    if (fence != nullptr)
+        GetCommandQueue()->Submit(*fence);
+}
+
+GraphicsPipeline* RenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    /* Create graphics pipeline synchronously */
+    return CreateGraphicsPipeline(desc);
+}
+
+ComputePipeline* RenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    /* Create compute pipeline synchronously */
+    return CreateComputePipeline(desc);
+}
+
+TextureReadHandle RenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence)
+{
+    /* Determine native image format of the texture */
+    PendingTextureRead textureRead;
+    GetTextureReadFormat(texture.QueryDesc().format, textureRead.format, textureRead.dataType);
+
+    /* Read texture data synchronously into intermediate buffer */
+    const auto extent       = texture.QueryMipExtent(mipLevel);
+    const auto numPixels    = extent.width * extent.height * extent.depth;
+
+    textureRead.data.resize(ImageDataSize(textureRead.format, textureRead.dataType, numPixels));
+
+    const DstImageDescriptor imageDesc
+    {
+        textureRead.format,
+        textureRead.dataType,
+        textureRead.data.data(),
+        textureRead.data.size()
+    };
+    ReadTexture(texture, mipLevel, imageDesc);
+
+    /* Store pending read operation and signal fence */
+    TextureReadHandle handle;
+    handle.id = ++textureReadCounter_;
+    pendingTextureReads_[handle.id] = std::move(textureRead);
+
+    GetCommandQueue()->Submit(fence);
+
+    return handle;
+}
+
+void RenderSystem::ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc)
+{
+    auto it = pendingTextureReads_.find(handle.id);
+    if (it == pendingTextureReads_.end())
+        throw std::invalid_argument("cannot resolve texture read with invalid handle");
+
+    if (imageDesc.data != nullptr)
+    {
+        const auto& textureRead = it->second;
+        const SrcImageDescriptor srcImageDesc
+        {
+            textureRead.format,
+            textureRead.dataType,
+            textureRead.data.data(),
+            textureRead.data.size()
+        };
+        CopyTextureReadData(srcImageDesc, imageDesc);
+    }
+
+    pendingTextureReads_.erase(it);
+}
+
 
 /*
  * ======= Protected: =======
@@ -398,6 +516,27 @@ void RenderSystem::AssertImageDataSize(std::size_t dataSize, std::size_t require
     }
 }
 
+void RenderSystem::GetTextureReadFormat(const Format format, ImageFormat& imageFormat, DataType& dataType)
+{
+    if (IsCompressedFormat(format) || !FindSuitableImageFormat(format, imageFormat, dataType))
+        throw std::invalid_argument("cannot read texture with compressed or undefined format");
+}
+
+void RenderSystem::CopyTextureReadData(const SrcImageDescriptor& srcImageDesc, const DstImageDescriptor& dstImageDesc)
+{
+    if (srcImageDesc.format == dstImageDesc.format && srcImageDesc.dataType == dstImageDesc.dataType)
+    {
+        /* Copy image data directly into output buffer */
+        AssertImageDataSize(dstImageDesc.dataSize, srcImageDesc.dataSize, "texture read");
+        ::memcpy(dstImageDesc.data, srcImageDesc.data, srcImageDesc.dataSize);
+    }
+    else
+    {
+        /* Convert image data into output buffer */
+        ConvertImageBuffer(srcImageDesc, dstImageDesc, config_.threadCount);
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -95,6 +95,7 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasConservativeRasterization, "conservative rasterization" );
     LLGL_VALIDATE_FEATURE( hasStreamOutputs,             "stream outputs"             );
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"  );
+    LLGL_VALIDATE_FEATURE( hasTimelineFences,            "timeline fences"            );
 
     #undef LLGL_VALIDATE_FEATURE
 
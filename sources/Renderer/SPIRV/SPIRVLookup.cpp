@@ -23,7 +23,6 @@ static bool HasTypeId(const Op opCode)
     {
         case Op::OpUndef:
         case Op::OpSizeOf:
-        case Op::OpMemberName:
         case Op::OpExtInst:
         case Op::OpTypeForwardPointer:
         case Op::OpConstantTrue:
@@ -520,16 +519,55 @@ static bool HasResultId(const Op opCode)
 }
 
 
+// Number of op-codes covered by the lookup table; op-codes of extensions beyond this range are looked up by the switch statements.
+static const std::uint32_t g_lookupTableSize = 1024;
+
+enum : std::uint8_t
+{
+    LookupFlagType      = (1 << 0),
+    LookupFlagResult    = (1 << 1),
+};
+
+// Lookup table of the core op-codes, which is generated once from the switch statements above.
+struct LookupTable
+{
+    LookupTable()
+    {
+        for (std::uint32_t i = 0; i < g_lookupTableSize; ++i)
+        {
+            const auto opCode = static_cast<Op>(i);
+            flags[i] = static_cast<std::uint8_t>(
+                (HasTypeId(opCode) ? LookupFlagType : 0) |
+                (HasResultId(opCode) ? LookupFlagResult : 0)
+            );
+        }
+    }
+
+    std::uint8_t flags[g_lookupTableSize];
+};
+
+
 } // /namespace SPIRVHelper
 
 
 SPIRVLookup GetSPIRVLookup(spv::Op opCode)
 {
+    static const SPIRVHelper::LookupTable table;
+
     SPIRVLookup lookup;
+
+    const auto index = static_cast<std::uint32_t>(opCode);
+    if (index < SPIRVHelper::g_lookupTableSize)
+    {
+        lookup.hasType      = ((table.flags[index] & SPIRVHelper::LookupFlagType) != 0);
+        lookup.hasResult    = ((table.flags[index] & SPIRVHelper::LookupFlagResult) != 0);
+    }
+    else
     {
         lookup.hasType      = SPIRVHelper::HasTypeId(opCode);
         lookup.hasResult    = SPIRVHelper::HasResultId(opCode);
     }
+
     return lookup;
 }
 
@@ -24,7 +24,7 @@ struct SPIRVLookup
 };
 
 
-// Returns the SPIR-V lookup information for the specified instruction opcode.
+// Returns the SPIR-V lookup information for the specified instruction opcode. Core op-codes are looked up in a table that is generated once.
 SPIRVLookup GetSPIRVLookup(spv::Op opCode);
 
 // Returns the SPIR-V builder (or rather generator) name by the specified builder magic number, or null if the magic number is unknwon (see SPIRVHeader::builderMagic).
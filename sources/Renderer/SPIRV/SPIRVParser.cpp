@@ -9,17 +9,84 @@
 #include "SPIRVLookup.h"
 #include "../../Core/Helper.h"
 #include <stdexcept>
+#include <string>
 
 
 namespace LLGL
 {
 
 
-SPIRVParser::~SPIRVParser()
+/*
+ * SPIRVInstructionIterator class
+ */
+
+SPIRVInstructionIterator::SPIRVInstructionIterator(const std::uint32_t* word, const std::uint32_t* wordsEnd) :
+    word_     { word     },
+    wordsEnd_ { wordsEnd }
+{
+    Decode();
+}
+
+SPIRVInstructionIterator& SPIRVInstructionIterator::operator ++ ()
+{
+    word_ += (*word_ >> spv::WordCountShift);
+    Decode();
+    return *this;
+}
+
+SPIRVInstructionIterator SPIRVInstructionIterator::operator ++ (int)
+{
+    auto prev = *this;
+    ++(*this);
+    return prev;
+}
+
+// Word counts have already been validated by SPIRVParser::Load, so no further bounds checks are required here
+void SPIRVInstructionIterator::Decode()
+{
+    if (word_ == wordsEnd_)
+        return;
+
+    /* Read word count and opcode */
+    auto wordCount  = (word_[0] >> spv::WordCountShift) - 1;
+    auto next       = word_ + 1;
+
+    instr_.opCode   = static_cast<spv::Op>(word_[0] & spv::OpCodeMask);
+    instr_.type     = 0;
+    instr_.result   = 0;
+
+    auto lookup = GetSPIRVLookup(instr_.opCode);
+
+    /* Read type (if used) */
+    if (lookup.hasType)
+    {
+        instr_.type = *next++;
+        --wordCount;
+    }
+
+    /* Read result (if used) */
+    if (lookup.hasResult)
+    {
+        instr_.result = *next++;
+        --wordCount;
+    }
+
+    /* Read operands */
+    instr_.numOperands  = wordCount;
+    instr_.operands     = (wordCount > 0 ? next : nullptr);
+}
+
+
+/*
+ * SPIRVParser class
+ */
+
+SPIRVParser::SPIRVParser(const void* byteCode, std::size_t byteCodeSize)
 {
+    Load(byteCode, byteCodeSize);
 }
 
-void SPIRVParser::Parse(const void* byteCode, std::size_t byteCodeSize)
+void SPIRVParser::Load(const void* byteCode, std::size_t byteCodeSize)
 {
     if (!byteCode)
         throw std::invalid_argument("SPIR-V shader byte code must not be a null pointer");
@@ -28,7 +95,7 @@ void SPIRVParser::Parse(const void* byteCode, std::size_t byteCodeSize)
 
     /* Convert byte code pointer to word pointer */
     auto words      = reinterpret_cast<const std::uint32_t*>(byteCode);
-    auto numWords   = static_cast<std::uint32_t>(byteCodeSize / 4);
+    auto numWords   = byteCodeSize / 4;
 
     if (numWords < 5)
         throw std::invalid_argument("too few words in SPIR-V shader module");
@@ -42,57 +109,7 @@ void SPIRVParser::Parse(const void* byteCode, std::size_t byteCodeSize)
         header.idBound      = words[3];
         header.schema       = words[4];
     }
-    OnParseHeader(header);
 
-    /* Parse instructions */
-    for (std::uint32_t i = 5; i < numWords;)
-    {
-        /* Parse next instruction */
-        SPIRVInstruction instr;
-        {
-            /* Read word count and opcode */
-            auto firstWord = words[i++];
-
-            auto wordCount  = (firstWord >> spv::WordCountShift);
-            instr.opCode    = static_cast<spv::Op>(firstWord & spv::OpCodeMask);
-
-            --wordCount;
-
-            auto lookup = GetSPIRVLookup(instr.opCode);
-
-            /* Read type (if used) */
-            if (wordCount > 0 && lookup.hasType)
-            {
-                instr.type = words[i++];
-                --wordCount;
-            }
-
-            /* Read result (if used) */
-            if (wordCount > 0 && lookup.hasResult)
-            {
-                instr.result = words[i++];
-                --wordCount;
-            }
-
-            /* Read operands */
-            if (wordCount > 0)
-            {
-                instr.operands      = &(words[i]);
-                instr.numOperands   = wordCount;
-                i += wordCount;
-            }
-        }
-        OnParseInstruction(instr);
-    }
-}
-
-
-/*
- * ======= Protected: =======
- */
-
-void SPIRVParser::OnParseHeader(const SPIRVHeader& header)
-{
     /* Validate SPIR-V magic number */
     if (header.spirvMagic != spv::MagicNumber)
     {
@@ -101,11 +118,80 @@ void SPIRVParser::OnParseHeader(const SPIRVHeader& header)
             ToHex(spv::MagicNumber) + ", but got 0x" + ToHex(header.spirvMagic) + ")"
         );
     }
+
+    /* Validate word counts of all instructions, so they can be iterated without further checks */
+    for (std::size_t i = 5; i < numWords;)
+    {
+        const auto wordCount    = (words[i] >> spv::WordCountShift);
+        const auto lookup       = GetSPIRVLookup(static_cast<spv::Op>(words[i] & spv::OpCodeMask));
+        const auto minWordCount = 1u + (lookup.hasType ? 1u : 0u) + (lookup.hasResult ? 1u : 0u);
+
+        if (wordCount < minWordCount)
+        {
+            throw std::invalid_argument(
+                "invalid word count in SPIR-V instruction at word offset " + std::to_string(i) +
+                " (expected at least " + std::to_string(minWordCount) + ", but got " + std::to_string(wordCount) + ")"
+            );
+        }
+
+        if (wordCount > numWords - i)
+        {
+            throw std::invalid_argument(
+                "SPIR-V instruction at word offset " + std::to_string(i) + " exceeds end of shader module"
+            );
+        }
+
+        i += wordCount;
+    }
+
+    /* Store validated shader module */
+    words_      = words;
+    instrWords_ = words + 5;
+    wordsEnd_   = words + numWords;
+    header_     = header;
 }
 
-void SPIRVParser::OnParseInstruction(const SPIRVInstruction& instr)
+std::uint64_t SPIRVParser::GetHash() const
 {
-    // dummy
+    return Hash(words_, static_cast<std::size_t>(wordsEnd_ - words_) * 4);
+}
+
+// Based on MurmurHash64A by Austin Appleby, which processes 8 bytes per iteration
+std::uint64_t SPIRVParser::Hash(const void* byteCode, std::size_t byteCodeSize)
+{
+    static const std::uint64_t  m = 0xc6a4a7935bd1e995ull;
+    static const int            r = 47;
+
+    auto words      = reinterpret_cast<const std::uint32_t*>(byteCode);
+    auto numWords   = byteCodeSize / 4;
+
+    std::uint64_t h = (0x8445d61a4e774912ull ^ (byteCodeSize * m));
+
+    /* Mix two words at a time */
+    for (std::size_t i = 0; i + 1 < numWords; i += 2)
+    {
+        std::uint64_t k = (static_cast<std::uint64_t>(words[i + 1]) << 32) | words[i];
+
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    /* Mix remaining word */
+    if (numWords % 2 != 0)
+    {
+        h ^= words[numWords - 1];
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+
+    return h;
 }
 
 
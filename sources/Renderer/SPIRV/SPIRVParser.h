@@ -11,6 +11,7 @@
 
 #include "SPIRVInstruction.h"
 #include <cstddef>
+#include <iterator>
 
 
 namespace LLGL
@@ -27,24 +28,186 @@ struct SPIRVHeader
     std::uint32_t schema;
 };
 
-// SPIR-V shader module parser.
-class SPIRVParser
+// Forward iterator over the instructions of a SPIR-V shader module. Instructions are decoded on the fly as views into the byte code.
+class SPIRVInstructionIterator
 {
 
     public:
 
-        virtual ~SPIRVParser();
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = SPIRVInstruction;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const SPIRVInstruction*;
+        using reference         = const SPIRVInstruction&;
+
+        SPIRVInstructionIterator() = default;
+        SPIRVInstructionIterator(const std::uint32_t* word, const std::uint32_t* wordsEnd);
+
+        SPIRVInstructionIterator& operator ++ ();
+        SPIRVInstructionIterator operator ++ (int);
+
+        inline reference operator * () const
+        {
+            return instr_;
+        }
+
+        inline pointer operator -> () const
+        {
+            return (&instr_);
+        }
 
-        // Parses the specified SPIR-V shader byte code and throws an std::invalid_argument exception if the byte code is invalid.
-        void Parse(const void* byteCode, std::size_t byteCodeSize);
+        inline bool operator == (const SPIRVInstructionIterator& rhs) const
+        {
+            return (word_ == rhs.word_);
+        }
 
-    protected:
+        inline bool operator != (const SPIRVInstructionIterator& rhs) const
+        {
+            return (word_ != rhs.word_);
+        }
+
+    private:
+
+        void Decode();
+
+        const std::uint32_t*    word_       = nullptr;
+        const std::uint32_t*    wordsEnd_   = nullptr;
+        SPIRVInstruction        instr_;
+
+};
 
-        // Callback function for the SPIR-V shader module header.
-        virtual void OnParseHeader(const SPIRVHeader& header);
+/*
+Compile-time set of SPIR-V op-codes for the instruction filter of SPIRVParser::Visit.
+The core op-codes are stored in a bitmask table that is generated at compile time.
+*/
+template <spv::Op... TOps>
+struct SPIRVOpCodeSet
+{
+    // Number of 64-bit blocks in the bitmask table, which covers all core op-codes.
+    static const std::uint32_t numBlocks = 8;
+
+    static constexpr std::uint64_t GetBlockMask(std::uint32_t /*block*/)
+    {
+        return 0;
+    }
+
+    template <typename... TRest>
+    static constexpr std::uint64_t GetBlockMask(std::uint32_t block, spv::Op opCode, TRest... rest)
+    {
+        return
+        (
+            ((static_cast<std::uint32_t>(opCode) >> 6) == block ? (1ull << (static_cast<std::uint32_t>(opCode) & 63u)) : 0ull) |
+            GetBlockMask(block, rest...)
+        );
+    }
+
+    static constexpr bool ContainsOpCode(std::uint32_t /*opCode*/)
+    {
+        return false;
+    }
+
+    template <typename... TRest>
+    static constexpr bool ContainsOpCode(std::uint32_t opCode, spv::Op first, TRest... rest)
+    {
+        return (opCode == static_cast<std::uint32_t>(first) || ContainsOpCode(opCode, rest...));
+    }
+
+    // Returns true if the specified op-code is contained in this set.
+    static bool Contains(std::uint32_t opCode)
+    {
+        static const std::uint64_t table[numBlocks] =
+        {
+            GetBlockMask(0, TOps...), GetBlockMask(1, TOps...), GetBlockMask(2, TOps...), GetBlockMask(3, TOps...),
+            GetBlockMask(4, TOps...), GetBlockMask(5, TOps...), GetBlockMask(6, TOps...), GetBlockMask(7, TOps...),
+        };
+
+        if (opCode < numBlocks * 64)
+            return ((table[opCode >> 6] >> (opCode & 63u)) & 1u) != 0;
+        else
+            return ContainsOpCode(opCode, TOps...);
+    }
+};
+
+/*
+SPIR-V shader module parser.
+The byte code is validated entirely when it is loaded, so iterating over the instructions never fails and does not allocate memory.
+The parser does not copy the byte code, i.e. it must remain valid as long as the parser and its instructions are in use.
+*/
+class SPIRVParser
+{
+
+    public:
 
-        // Callback function for each instruction within the SPIR-V shader module.
-        virtual void OnParseInstruction(const SPIRVInstruction& instr);
+        using Iterator = SPIRVInstructionIterator;
+
+        SPIRVParser() = default;
+
+        // Loads the specified SPIR-V shader byte code. See Load.
+        SPIRVParser(const void* byteCode, std::size_t byteCodeSize);
+
+        // Loads and validates the specified SPIR-V shader byte code and throws an std::invalid_argument exception if the byte code is invalid.
+        void Load(const void* byteCode, std::size_t byteCodeSize);
+
+        // Returns the header of the loaded shader module.
+        inline const SPIRVHeader& GetHeader() const
+        {
+            return header_;
+        }
+
+        // Returns the pointer to the first word of the loaded shader module, including its header.
+        inline const std::uint32_t* GetWords() const
+        {
+            return words_;
+        }
+
+        // Returns the number of words of the loaded shader module, including its header.
+        inline std::size_t GetNumWords() const
+        {
+            return static_cast<std::size_t>(wordsEnd_ - words_);
+        }
+
+        // Returns the iterator to the first instruction.
+        inline Iterator begin() const
+        {
+            return Iterator{ instrWords_, wordsEnd_ };
+        }
+
+        // Returns the iterator after the last instruction.
+        inline Iterator end() const
+        {
+            return Iterator{ wordsEnd_, wordsEnd_ };
+        }
+
+        /*
+        Calls the visitor for each instruction whose op-code is one of the template arguments, in order of appearance.
+        Instructions with other op-codes are skipped without being decoded.
+        The visitor has the signature 'bool(const SPIRVInstruction&)' and returns false to stop the iteration.
+        */
+        template <spv::Op... TOps, typename TVisitor>
+        void Visit(TVisitor&& visitor) const
+        {
+            for (auto word = instrWords_; word != wordsEnd_; word += (*word >> spv::WordCountShift))
+            {
+                if (SPIRVOpCodeSet<TOps...>::Contains(*word & spv::OpCodeMask))
+                {
+                    if (!visitor(*Iterator{ word, wordsEnd_ }))
+                        break;
+                }
+            }
+        }
+
+        // Returns the 64-bit hash of the loaded shader module. See Hash.
+        std::uint64_t GetHash() const;
+
+        // Returns a 64-bit hash of the specified SPIR-V shader byte code, which can be used as key for shader caches.
+        static std::uint64_t Hash(const void* byteCode, std::size_t byteCodeSize);
+
+    private:
+
+        const std::uint32_t*    words_      = nullptr;
+        const std::uint32_t*    instrWords_ = nullptr;
+        const std::uint32_t*    wordsEnd_   = nullptr;
+        SPIRVHeader             header_     = {};
 
 };
 
@@ -6,87 +6,790 @@
  */
 
 #include "SPIRVReflect.h"
+#include <algorithm>
+#include <unordered_map>
+#include <mutex>
 #include <string>
+#include <stdexcept>
+#include <cstring>
 
 
 namespace LLGL
 {
 
 
-void SPIRVReflect::OnParseHeader(const SPIRVHeader& header)
+/*
+ * Internal functions
+ */
+
+// Storage class 'StorageBuffer' was introduced with SPV_KHR_storage_buffer_storage_class and is not available in all SPIR-V headers
+static const std::uint32_t g_storageClassStorageBuffer = 12;
+
+static constexpr std::uint32_t ToUInt32(spv::StorageClass storageClass)
+{
+    return static_cast<std::uint32_t>(storageClass);
+}
+
+static ShaderType ExecutionModelToShaderType(spv::ExecutionModel model)
 {
-    idBound_ = header.idBound;
-    if (idBound_ > 0)
-        names_.resize(idBound_);
+    switch (model)
+    {
+        case spv::ExecutionModel::Vertex:                   return ShaderType::Vertex;
+        case spv::ExecutionModel::TessellationControl:      return ShaderType::TessControl;
+        case spv::ExecutionModel::TessellationEvaluation:   return ShaderType::TessEvaluation;
+        case spv::ExecutionModel::Geometry:                 return ShaderType::Geometry;
+        case spv::ExecutionModel::Fragment:                 return ShaderType::Fragment;
+        case spv::ExecutionModel::GLCompute:                return ShaderType::Compute;
+        default:                                            return ShaderType::Undefined;
+    }
 }
 
-void SPIRVReflect::OnParseInstruction(const SPIRVInstruction& instr)
+
+/*
+ * SPIRVReflect class
+ */
+
+std::shared_ptr<const SPIRVModuleReflection> SPIRVReflect::Reflect(const void* byteCode, std::size_t byteCodeSize)
+{
+    using SPIRVModuleReflectionSPtr = std::shared_ptr<const SPIRVModuleReflection>;
+
+    // Cache entry with a copy of the module words, so hash collisions cannot return the reflection of another module
+    struct CacheEntry
+    {
+        std::vector<std::uint32_t>  words;
+        SPIRVModuleReflectionSPtr   reflection;
+    };
+
+    static std::mutex                                       cacheMutex;
+    static std::unordered_map<std::uint64_t, CacheEntry>    cache;
+
+    /* Validate shader module and find its reflection in the cache */
+    SPIRVParser module{ byteCode, byteCodeSize };
+
+    const auto key      = module.GetHash();
+    const auto words    = module.GetWords();
+    const auto numWords = module.GetNumWords();
+
+    auto IsSameModule = [words, numWords](const CacheEntry& entry)
+    {
+        return (entry.words.size() == numWords && ::memcmp(entry.words.data(), words, numWords * sizeof(std::uint32_t)) == 0);
+    };
+
+    {
+        std::lock_guard<std::mutex> guard { cacheMutex };
+        auto it = cache.find(key);
+        if (it != cache.end() && IsSameModule(it->second))
+            return it->second.reflection;
+    }
+
+    /* Reflect shader module outside of the lock */
+    SPIRVReflect reflect;
+    reflect.Parse(module);
+    reflect.reflection_.moduleHash = key;
+    SPIRVModuleReflectionSPtr reflection = std::make_shared<SPIRVModuleReflection>(std::move(reflect.reflection_));
+
+    /* Store reflection in cache, or return the one that has been stored in the meantime */
+    std::lock_guard<std::mutex> guard { cacheMutex };
+    auto it = cache.find(key);
+    if (it == cache.end())
+    {
+        cache[key] = CacheEntry{ std::vector<std::uint32_t>(words, words + numWords), reflection };
+        return reflection;
+    }
+    if (IsSameModule(it->second))
+        return it->second.reflection;
+
+    /* Hash collision with another module: keep the first entry and return the new reflection uncached */
+    return reflection;
+}
+
+
+void SPIRVReflect::Parse(const SPIRVParser& module)
+{
+    idBound_ = module.GetHeader().idBound;
+
+    /* Each member of a structure requires one word in its OpTypeStruct instruction */
+    maxNumMembers_ = module.GetNumWords();
+    ids_.clear();
+    ids_.resize(idBound_);
+    reflection_ = SPIRVModuleReflection{};
+
+    /* Visit all instructions that are relevant for the reflection until the first function definition */
+    module.Visit<
+        spv::Op::OpEntryPoint,
+        spv::Op::OpName,
+        spv::Op::OpMemberName,
+        spv::Op::OpDecorate,
+        spv::Op::OpMemberDecorate,
+        spv::Op::OpTypeVoid,
+        spv::Op::OpTypeBool,
+        spv::Op::OpTypeInt,
+        spv::Op::OpTypeFloat,
+        spv::Op::OpTypeVector,
+        spv::Op::OpTypeMatrix,
+        spv::Op::OpTypeImage,
+        spv::Op::OpTypeSampler,
+        spv::Op::OpTypeSampledImage,
+        spv::Op::OpTypePointer,
+        spv::Op::OpTypeArray,
+        spv::Op::OpTypeRuntimeArray,
+        spv::Op::OpTypeStruct,
+        spv::Op::OpConstant,
+        spv::Op::OpSpecConstantTrue,
+        spv::Op::OpSpecConstantFalse,
+        spv::Op::OpSpecConstant,
+        spv::Op::OpVariable,
+        spv::Op::OpFunction
+    >(
+        [this](const SPIRVInstruction& instr)
+        {
+            return OnInstruction(instr);
+        }
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool SPIRVReflect::OnInstruction(const SPIRVInstruction& instr)
 {
     switch (instr.opCode)
     {
+        case spv::Op::OpEntryPoint:
+            OpEntryPoint(instr);
+            break;
         case spv::Op::OpName:
             OpName(instr);
             break;
+        case spv::Op::OpMemberName:
+            OpMemberName(instr);
+            break;
         case spv::Op::OpDecorate:
             OpDecorate(instr);
             break;
+        case spv::Op::OpMemberDecorate:
+            OpMemberDecorate(instr);
+            break;
+        case spv::Op::OpTypeVoid:
+        case spv::Op::OpTypeBool:
+        case spv::Op::OpTypeInt:
+        case spv::Op::OpTypeFloat:
+        case spv::Op::OpTypeVector:
+        case spv::Op::OpTypeMatrix:
+        case spv::Op::OpTypeImage:
+        case spv::Op::OpTypeSampler:
+        case spv::Op::OpTypeSampledImage:
+        case spv::Op::OpTypePointer:
+            OpType(instr);
+            break;
+        case spv::Op::OpTypeArray:
+        case spv::Op::OpTypeRuntimeArray:
+            OpTypeArray(instr);
+            break;
+        case spv::Op::OpTypeStruct:
+            OpTypeStruct(instr);
+            break;
+        case spv::Op::OpConstant:
+            OpConstant(instr);
+            break;
+        case spv::Op::OpSpecConstantTrue:
+        case spv::Op::OpSpecConstantFalse:
+        case spv::Op::OpSpecConstant:
+            OpSpecConstant(instr);
+            break;
+        case spv::Op::OpVariable:
+            OpVariable(instr);
+            break;
+        case spv::Op::OpFunction:
+            return false;
         default:
             break;
     }
+    return true;
+}
+
+void SPIRVReflect::OpEntryPoint(const Instr& instr)
+{
+    /* Operands: [ExecutionModel, FunctionID, Name] */
+    SPIRVModuleReflection::EntryPoint entryPoint;
+    {
+        entryPoint.name         = instr.GetASCII(2);
+        entryPoint.shaderType   = ExecutionModelToShaderType(static_cast<spv::ExecutionModel>(instr.GetUInt32(0)));
+    }
+    reflection_.entryPoints.push_back(entryPoint);
 }
 
 void SPIRVReflect::OpName(const Instr& instr)
 {
-    SetName(instr.GetUInt32(0), instr.GetASCII(1));
+    GetId(instr.GetUInt32(0)).name = instr.GetASCII(1);
+}
+
+void SPIRVReflect::OpMemberName(const Instr& instr)
+{
+    GetMember(instr.GetUInt32(0), instr.GetUInt32(1)).name = instr.GetASCII(2);
 }
 
 void SPIRVReflect::OpDecorate(const Instr& instr)
 {
-    auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(1));
-    switch (decoration)
+    auto& info = GetId(instr.GetUInt32(0));
+    switch (static_cast<spv::Decoration>(instr.GetUInt32(1)))
     {
         case spv::Decoration::Binding:
-            OpDecorateBinding(instr);
+            info.binding = instr.GetUInt32(2);
+            break;
+        case spv::Decoration::DescriptorSet:
+            info.descriptorSet = instr.GetUInt32(2);
             break;
         case spv::Decoration::Location:
-            OpDecorateLocation(instr);
+            info.location = instr.GetUInt32(2);
+            break;
+        case spv::Decoration::SpecId:
+            info.specId = instr.GetUInt32(2);
+            break;
+        case spv::Decoration::ArrayStride:
+            info.arrayStride = instr.GetUInt32(2);
+            break;
+        case spv::Decoration::Block:
+            info.flags |= DecorationBlock;
+            break;
+        case spv::Decoration::BufferBlock:
+            info.flags |= DecorationBufferBlock;
+            break;
+        case spv::Decoration::BuiltIn:
+            info.flags |= DecorationBuiltIn;
+            break;
+        case spv::Decoration::NonWritable:
+            info.flags |= DecorationNonWritable;
+            break;
+        default:
+            break;
+    }
+}
+
+void SPIRVReflect::OpMemberDecorate(const Instr& instr)
+{
+    /* Operands: [StructID, Member, Decoration, Literals...] */
+    auto& member = GetMember(instr.GetUInt32(0), instr.GetUInt32(1));
+    switch (static_cast<spv::Decoration>(instr.GetUInt32(2)))
+    {
+        case spv::Decoration::Offset:
+            member.offset = instr.GetUInt32(3);
+            break;
+        case spv::Decoration::MatrixStride:
+            member.matrixStride = instr.GetUInt32(3);
+            break;
+        case spv::Decoration::RowMajor:
+            member.flags |= DecorationRowMajor;
+            break;
+        case spv::Decoration::BuiltIn:
+            member.flags |= DecorationBuiltIn;
+            break;
+        case spv::Decoration::NonWritable:
+            member.flags |= DecorationNonWritable;
+            break;
+        default:
+            break;
+    }
+}
+
+void SPIRVReflect::OpType(const Instr& instr)
+{
+    auto& info = GetId(instr.result);
+    info.opCode = instr.opCode;
+
+    switch (instr.opCode)
+    {
+        case spv::Op::OpTypeInt:
+            /* Operands: [Width, Signedness] */
+            info.value      = instr.GetUInt32(0);
+            info.auxValue   = instr.GetUInt32(1);
+            break;
+        case spv::Op::OpTypeFloat:
+            /* Operands: [Width] */
+            info.value      = instr.GetUInt32(0);
+            break;
+        case spv::Op::OpTypeVector:
+        case spv::Op::OpTypeMatrix:
+            /* Operands: [ComponentType, ComponentCount] or [ColumnType, ColumnCount] */
+            info.baseType   = instr.GetUInt32(0);
+            info.value      = instr.GetUInt32(1);
+            break;
+        case spv::Op::OpTypeImage:
+            /* Operands: [SampledType, Dim, Depth, Arrayed, MS, Sampled, ImageFormat, ...] */
+            info.baseType   = instr.GetUInt32(0);
+            info.value      = instr.GetUInt32(1);
+            info.auxValue   = instr.GetUInt32(5);
+            break;
+        case spv::Op::OpTypeSampledImage:
+            /* Operands: [ImageType] */
+            info.baseType   = instr.GetUInt32(0);
+            break;
+        case spv::Op::OpTypePointer:
+            /* Operands: [StorageClass, Type] */
+            info.value      = instr.GetUInt32(0);
+            info.baseType   = instr.GetUInt32(1);
+            break;
+        default:
+            break;
+    }
+}
+
+void SPIRVReflect::OpTypeArray(const Instr& instr)
+{
+    /* Operands: [ElementType, Length] (length is the ID of a constant and omitted for runtime arrays) */
+    auto& info = GetId(instr.result);
+    {
+        info.opCode     = instr.opCode;
+        info.baseType   = instr.GetUInt32(0);
+        info.value      = (instr.opCode == spv::Op::OpTypeArray ? GetId(instr.GetUInt32(1)).value : 0);
+    }
+}
+
+void SPIRVReflect::OpTypeStruct(const Instr& instr)
+{
+    /* Operands: [MemberTypes...] (member names and decorations may already have been declared) */
+    auto& info = GetId(instr.result);
+    info.opCode = instr.opCode;
+
+    /* Member names and decorations must not refer to members beyond the structure */
+    if (info.members.size() > instr.numOperands)
+    {
+        throw std::runtime_error(
+            "member index in SPIR-V shader module out of range (index " + std::to_string(info.members.size() - 1) +
+            " exceeded member count of " + std::to_string(instr.numOperands) + " in structure ID " + std::to_string(instr.result) + ")"
+        );
+    }
+
+    info.members.resize(instr.numOperands);
+
+    for (std::uint32_t i = 0; i < instr.numOperands; ++i)
+        info.members[i].type = instr.GetUInt32(i);
+}
+
+void SPIRVReflect::OpConstant(const Instr& instr)
+{
+    /* Store low and high words of the literal, which is required to determine array lengths */
+    auto& info = GetId(instr.result);
+    {
+        info.opCode     = instr.opCode;
+        info.baseType   = instr.type;
+        info.value      = instr.GetUInt32(0);
+        info.auxValue   = (instr.numOperands > 1 ? instr.GetUInt32(1) : 0);
+    }
+}
+
+void SPIRVReflect::OpSpecConstant(const Instr& instr)
+{
+    auto& info = GetId(instr.result);
+    {
+        info.opCode     = instr.opCode;
+        info.baseType   = instr.type;
+        if (instr.opCode == spv::Op::OpSpecConstant)
+        {
+            info.value      = instr.GetUInt32(0);
+            info.auxValue   = (instr.numOperands > 1 ? instr.GetUInt32(1) : 0);
+        }
+        else
+            info.value = (instr.opCode == spv::Op::OpSpecConstantTrue ? 1 : 0);
+    }
+
+    /* Only constants with a 'SpecId' decoration can be specialized by the client */
+    if (info.specId != invalidValue)
+    {
+        SPIRVModuleReflection::SpecConstant specConstant;
+        {
+            specConstant.name           = (info.name != nullptr ? info.name : "");
+            specConstant.constantID     = info.specId;
+            specConstant.type           = GetUniformType(instr.type);
+            specConstant.defaultValue   = (static_cast<std::uint64_t>(info.auxValue) << 32) | info.value;
+        }
+        reflection_.specConstants.push_back(specConstant);
+    }
+}
+
+void SPIRVReflect::OpVariable(const Instr& instr)
+{
+    /* Operands: [StorageClass, Initializer] (result type is always a pointer type) */
+    const auto& var             = GetId(instr.result);
+    const auto  storageClass    = instr.GetUInt32(0);
+    const auto  typeId          = GetId(instr.type).baseType;
+
+    switch (storageClass)
+    {
+        case ToUInt32(spv::StorageClass::UniformConstant):
+        case ToUInt32(spv::StorageClass::Uniform):
+        case g_storageClassStorageBuffer:
+            ReflectResource(var, storageClass, typeId);
+            break;
+        case ToUInt32(spv::StorageClass::PushConstant):
+            ReflectPushConstants(typeId);
+            break;
+        case ToUInt32(spv::StorageClass::Input):
+        case ToUInt32(spv::StorageClass::Output):
+            ReflectVarying(var, storageClass, typeId);
             break;
         default:
             break;
     }
 }
 
-void SPIRVReflect::OpDecorateBinding(const Instr& instr)
+void SPIRVReflect::ReflectResource(const IdInfo& var, std::uint32_t storageClass, spv::Id typeId)
+{
+    /* Resources without binding point can not be bound by the client */
+    if (var.binding == invalidValue)
+        return;
+
+    SPIRVModuleReflection::Resource resource;
+    {
+        resource.descriptorSet  = var.descriptorSet;
+        resource.binding        = var.binding;
+    }
+
+    /* Unwrap resource arrays; runtime arrays are reflected with a single element */
+    for (const IdInfo* type = &GetId(typeId); type->opCode == spv::Op::OpTypeArray || type->opCode == spv::Op::OpTypeRuntimeArray; type = &GetId(typeId))
+    {
+        if (type->opCode == spv::Op::OpTypeArray)
+            resource.arraySize *= type->value;
+        typeId = type->baseType;
+    }
+
+    const auto& type = GetId(typeId);
+    switch (type.opCode)
+    {
+        case spv::Op::OpTypeStruct:
+        {
+            /* Prefer the block name (e.g. "Settings" of "uniform Settings { ... } settings;") over the instance name */
+            resource.name       = (type.name != nullptr ? type.name : (var.name != nullptr ? var.name : ""));
+            resource.blockSize  = GetTypeSize(typeId);
+            AppendBlockFields(resource.fields, typeId, "", 0);
+
+            if (storageClass == g_storageClassStorageBuffer || (type.flags & DecorationBufferBlock) != 0)
+            {
+                resource.type               = ResourceType::StorageBuffer;
+                resource.storageBufferType  = (IsReadOnlyBlock(var, typeId) ? StorageBufferType::StructuredBuffer : StorageBufferType::RWStructuredBuffer);
+            }
+            else
+                resource.type = ResourceType::ConstantBuffer;
+        }
+        break;
+
+        case spv::Op::OpTypeSampler:
+        {
+            resource.type = ResourceType::Sampler;
+        }
+        break;
+
+        case spv::Op::OpTypeImage:
+        case spv::Op::OpTypeSampledImage:
+        {
+            const auto& image = (type.opCode == spv::Op::OpTypeSampledImage ? GetId(type.baseType) : type);
+            if (image.value == static_cast<std::uint32_t>(spv::Dim::Buffer))
+            {
+                /* Texel buffers are storage buffers in LLGL ('Sampled' operand 2 denotes a storage texel buffer) */
+                resource.type               = ResourceType::StorageBuffer;
+                resource.storageBufferType  = (image.auxValue == 2 ? StorageBufferType::RWBuffer : StorageBufferType::Buffer);
+            }
+            else
+                resource.type = ResourceType::Texture;
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    if (resource.type == ResourceType::Undefined)
+        return;
+
+    if (resource.name.empty() && var.name != nullptr)
+        resource.name = var.name;
+
+    reflection_.resources.push_back(std::move(resource));
+}
+
+void SPIRVReflect::ReflectPushConstants(spv::Id typeId)
+{
+    if (GetId(typeId).opCode == spv::Op::OpTypeStruct)
+    {
+        reflection_.pushConstantSize = GetTypeSize(typeId);
+        AppendBlockFields(reflection_.pushConstantFields, typeId, "", 0);
+    }
+}
+
+void SPIRVReflect::ReflectVarying(const IdInfo& var, std::uint32_t storageClass, spv::Id typeId)
+{
+    /* Ignore built-in variables (e.g. gl_Position) and blocks without location (e.g. gl_PerVertex) */
+    if ((var.flags & DecorationBuiltIn) != 0 || var.location == invalidValue)
+        return;
+
+    /* Unwrap per-vertex arrays of geometry and tessellation shaders */
+    while (GetId(typeId).opCode == spv::Op::OpTypeArray)
+        typeId = GetId(typeId).baseType;
+
+    /* Matrices occupy one location per column */
+    const auto& type        = GetId(typeId);
+    const auto  numColumns  = (type.opCode == spv::Op::OpTypeMatrix ? type.value : 1u);
+    const auto  format      = GetVaryingFormat(typeId);
+
+    for (std::uint32_t i = 0; i < numColumns; ++i)
+    {
+        SPIRVModuleReflection::Varying varying;
+        {
+            varying.name            = (var.name != nullptr ? var.name : "");
+            varying.location        = var.location + i;
+            varying.semanticIndex   = i;
+            varying.format          = format;
+            varying.input           = (storageClass == ToUInt32(spv::StorageClass::Input));
+        }
+        reflection_.varyings.push_back(std::move(varying));
+    }
+}
+
+void SPIRVReflect::AppendBlockFields(
+    std::vector<SPIRVModuleReflection::BufferField>&    fields,
+    spv::Id                                             structId,
+    const std::string&                                  prefix,
+    std::uint32_t                                       baseOffset) const
+{
+    const auto& members = GetId(structId).members;
+    for (std::size_t i = 0; i < members.size(); ++i)
+    {
+        const auto& member = members[i];
+
+        SPIRVModuleReflection::BufferField field;
+        {
+            field.name      = prefix + (member.name != nullptr && *member.name != '\0' ? std::string(member.name) : std::to_string(i));
+            field.offset    = baseOffset + member.offset;
+        }
+
+        /* Unwrap (multi-dimensional) arrays; the innermost stride is the stride between two flattened elements */
+        auto typeId = member.type;
+        bool isArray = false;
+        while (GetId(typeId).opCode == spv::Op::OpTypeArray || GetId(typeId).opCode == spv::Op::OpTypeRuntimeArray)
+        {
+            const auto& arrayType = GetId(typeId);
+            field.arraySize     = (isArray ? field.arraySize : 1) * arrayType.value;
+            field.arrayStride   = arrayType.arrayStride;
+            typeId              = arrayType.baseType;
+            isArray             = true;
+        }
+
+        if (GetId(typeId).opCode == spv::Op::OpTypeStruct)
+        {
+            if (isArray)
+            {
+                /* Arrays of structures are described by their stride, followed by the fields of their first element */
+                field.size = field.arraySize * field.arrayStride;
+                fields.push_back(field);
+                AppendBlockFields(fields, typeId, field.name + "[0].", field.offset);
+            }
+            else
+            {
+                /* Flatten nested structures */
+                AppendBlockFields(fields, typeId, field.name + ".", field.offset);
+            }
+        }
+        else
+        {
+            field.type          = GetUniformType(typeId);
+            field.matrixStride  = (GetId(typeId).opCode == spv::Op::OpTypeMatrix ? member.matrixStride : 0);
+            field.size          = (isArray ? field.arraySize * field.arrayStride : GetTypeSize(typeId, member.matrixStride, (member.flags & DecorationRowMajor) != 0));
+            fields.push_back(field);
+        }
+    }
+}
+
+std::uint32_t SPIRVReflect::GetTypeSize(spv::Id typeId, std::uint32_t matrixStride, bool rowMajor) const
 {
-    auto id         = instr.GetUInt32(0);
-    auto& variable  = uniforms_[id];
+    const auto& type = GetId(typeId);
+    switch (type.opCode)
+    {
+        case spv::Op::OpTypeBool:
+            return 4;
+
+        case spv::Op::OpTypeInt:
+        case spv::Op::OpTypeFloat:
+            return type.value / 8;
+
+        case spv::Op::OpTypeVector:
+            return type.value * GetTypeSize(type.baseType);
+
+        case spv::Op::OpTypeMatrix:
+        {
+            const auto& columnType      = GetId(type.baseType);
+            const auto  numColumns      = type.value;
+            const auto  numRows         = columnType.value;
+            const auto  componentSize   = GetTypeSize(columnType.baseType);
+
+            if (matrixStride == 0)
+                return numColumns * numRows * componentSize;
+
+            /* The last column (or row) is not padded to the matrix stride */
+            if (rowMajor)
+                return (numRows - 1) * matrixStride + numColumns * componentSize;
+            else
+                return (numColumns - 1) * matrixStride + numRows * componentSize;
+        }
+
+        case spv::Op::OpTypeArray:
+            if (type.arrayStride > 0)
+                return type.value * type.arrayStride;
+            else
+                return type.value * GetTypeSize(type.baseType);
 
-    variable.name           = GetName(id);
-    variable.bindingPoint   = instr.GetUInt32(2);
+        case spv::Op::OpTypeStruct:
+        {
+            std::uint32_t size = 0;
+            for (const auto& member : type.members)
+            {
+                auto memberSize = GetTypeSize(member.type, member.matrixStride, (member.flags & DecorationRowMajor) != 0);
+                size = std::max(size, member.offset + memberSize);
+            }
+            return size;
+        }
+
+        default:
+            return 0;
+    }
 }
 
-void SPIRVReflect::OpDecorateLocation(const Instr& instr)
+UniformType SPIRVReflect::GetUniformType(spv::Id typeId) const
 {
-    auto id         = instr.GetUInt32(0);
-    auto& variable  = varyings_[id];
+    const auto& type = GetId(typeId);
+    switch (type.opCode)
+    {
+        case spv::Op::OpTypeBool:
+            return UniformType::Bool1;
+
+        case spv::Op::OpTypeInt:
+            if (type.value == 32)
+                return (type.auxValue != 0 ? UniformType::Int1 : UniformType::UInt1);
+            break;
+
+        case spv::Op::OpTypeFloat:
+            if (type.value == 32)
+                return UniformType::Float1;
+            if (type.value == 64)
+                return UniformType::Double1;
+            break;
+
+        case spv::Op::OpTypeVector:
+        {
+            /* Vector types directly follow their scalar type in the UniformType enumeration */
+            auto scalarType = GetUniformType(type.baseType);
+            if (scalarType != UniformType::Undefined && type.value >= 1 && type.value <= 4)
+                return static_cast<UniformType>(static_cast<int>(scalarType) + static_cast<int>(type.value) - 1);
+        }
+        break;
+
+        case spv::Op::OpTypeMatrix:
+        {
+            static const UniformType floatMatrices[3][3] =
+            {
+                { UniformType::Float2x2, UniformType::Float2x3, UniformType::Float2x4 },
+                { UniformType::Float3x2, UniformType::Float3x3, UniformType::Float3x4 },
+                { UniformType::Float4x2, UniformType::Float4x3, UniformType::Float4x4 },
+            };
+            static const UniformType doubleMatrices[3][3] =
+            {
+                { UniformType::Double2x2, UniformType::Double2x3, UniformType::Double2x4 },
+                { UniformType::Double3x2, UniformType::Double3x3, UniformType::Double3x4 },
+                { UniformType::Double4x2, UniformType::Double4x3, UniformType::Double4x4 },
+            };
+
+            /* Matrix type FloatCxR has C columns and R rows */
+            const auto& columnType  = GetId(type.baseType);
+            const auto  numColumns  = type.value;
+            const auto  numRows     = columnType.value;
+
+            if (numColumns >= 2 && numColumns <= 4 && numRows >= 2 && numRows <= 4)
+            {
+                switch (GetUniformType(columnType.baseType))
+                {
+                    case UniformType::Float1:
+                        return floatMatrices[numColumns - 2][numRows - 2];
+                    case UniformType::Double1:
+                        return doubleMatrices[numColumns - 2][numRows - 2];
+                    default:
+                        break;
+                }
+            }
+        }
+        break;
+
+        case spv::Op::OpTypeSampler:
+        case spv::Op::OpTypeSampledImage:
+            return UniformType::Sampler;
+
+        case spv::Op::OpTypeImage:
+            /* 'Sampled' operand 2 denotes a storage image */
+            return (type.auxValue == 2 ? UniformType::Image : UniformType::Sampler);
 
-    variable.name       = GetName(id);
-    variable.location   = instr.GetUInt32(2);
+        default:
+            break;
+    }
+    return UniformType::Undefined;
 }
 
-void SPIRVReflect::SetName(spv::Id id, const char* name)
+Format SPIRVReflect::GetVaryingFormat(spv::Id typeId) const
 {
-    AssertIdBound(id);
-    names_[id] = name;
+    static const Format floatFormats[4]     = { Format::R32Float, Format::RG32Float, Format::RGB32Float, Format::RGBA32Float };
+    static const Format doubleFormats[4]    = { Format::R64Float, Format::RG64Float, Format::RGB64Float, Format::RGBA64Float };
+    static const Format sintFormats[4]      = { Format::R32SInt,  Format::RG32SInt,  Format::RGB32SInt,  Format::RGBA32SInt  };
+    static const Format uintFormats[4]      = { Format::R32UInt,  Format::RG32UInt,  Format::RGB32UInt,  Format::RGBA32UInt  };
+
+    const auto& type = GetId(typeId);
+
+    /* Matrices are reflected by their column type */
+    if (type.opCode == spv::Op::OpTypeMatrix)
+        return GetVaryingFormat(type.baseType);
+
+    /* Get scalar type and number of components */
+    const auto& scalarType      = (type.opCode == spv::Op::OpTypeVector ? GetId(type.baseType) : type);
+    const auto  numComponents   = (type.opCode == spv::Op::OpTypeVector ? type.value : 1u);
+
+    if (numComponents < 1 || numComponents > 4)
+        return Format::Undefined;
+
+    if (scalarType.opCode == spv::Op::OpTypeFloat)
+    {
+        if (scalarType.value == 32)
+            return floatFormats[numComponents - 1];
+        if (scalarType.value == 64)
+            return doubleFormats[numComponents - 1];
+    }
+    else if (scalarType.opCode == spv::Op::OpTypeInt && scalarType.value == 32)
+        return (scalarType.auxValue != 0 ? sintFormats[numComponents - 1] : uintFormats[numComponents - 1]);
+
+    return Format::Undefined;
 }
 
-const char* SPIRVReflect::GetName(spv::Id id) const
+bool SPIRVReflect::IsReadOnlyBlock(const IdInfo& var, spv::Id structId) const
 {
-    AssertIdBound(id);
-    return names_[id];
+    if ((var.flags & DecorationNonWritable) != 0)
+        return true;
+
+    const auto& members = GetId(structId).members;
+    if (members.empty())
+        return false;
+
+    for (const auto& member : members)
+    {
+        if ((member.flags & DecorationNonWritable) == 0)
+            return false;
+    }
+
+    return true;
 }
 
-void SPIRVReflect::AssertIdBound(spv::Id id) const
+SPIRVReflect::IdInfo& SPIRVReflect::GetId(spv::Id id)
+{
+    return const_cast<IdInfo&>(static_cast<const SPIRVReflect*>(this)->GetId(id));
+}
+
+const SPIRVReflect::IdInfo& SPIRVReflect::GetId(spv::Id id) const
 {
     if (id >= idBound_)
     {
@@ -95,6 +798,24 @@ void SPIRVReflect::AssertIdBound(spv::Id id) const
             " exceeded ID-bound of " + std::to_string(idBound_) + ")"
         );
     }
+    return ids_[id];
+}
+
+SPIRVReflect::Member& SPIRVReflect::GetMember(spv::Id id, std::uint32_t memberIndex)
+{
+    /* Member declarations precede their OpTypeStruct instruction, so the index is validated against the module size first */
+    if (memberIndex >= maxNumMembers_)
+    {
+        throw std::runtime_error(
+            "member index in SPIR-V shader module out of range (index " + std::to_string(memberIndex) +
+            " exceeded word count of " + std::to_string(maxNumMembers_) + " in structure ID " + std::to_string(id) + ")"
+        );
+    }
+
+    auto& members = GetId(id).members;
+    if (memberIndex >= members.size())
+        members.resize(memberIndex + 1);
+    return members[memberIndex];
 }
 
 
@@ -10,56 +10,173 @@
 
 
 #include "SPIRVParser.h"
+#include <LLGL/ShaderProgramFlags.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/Format.h>
 #include <vector>
-#include <map>
+#include <string>
+#include <memory>
 
 
 namespace LLGL
 {
 
 
-// SPIR-V shader module parser.
-class SPIRVReflect : public SPIRVParser
+/*
+Reflection output of a SPIR-V shader module.
+All strings are owned by this structure, so it remains valid after the byte code has been released.
+*/
+struct SPIRVModuleReflection
+{
+    using BufferField = ShaderReflectionDescriptor::BufferField;
+
+    struct EntryPoint
+    {
+        std::string                 name;
+        ShaderType                  shaderType          = ShaderType::Undefined;
+    };
+
+    struct Resource
+    {
+        std::string                 name;
+        ResourceType                type                = ResourceType::Undefined;
+        StorageBufferType           storageBufferType   = StorageBufferType::Undefined;
+        std::uint32_t               descriptorSet       = 0;
+        std::uint32_t               binding             = 0;
+        std::uint32_t               arraySize           = 1;
+        std::uint32_t               blockSize           = 0;    // Size (in bytes) of constant and storage buffer blocks
+        std::vector<BufferField>    fields;                     // Flattened fields of constant and storage buffer blocks
+    };
+
+    struct Varying
+    {
+        std::string                 name;
+        std::uint32_t               location            = 0;
+        std::uint32_t               semanticIndex       = 0;    // Column index of matrix varyings, which occupy one location per column
+        Format                      format              = Format::Undefined;
+        bool                        input               = false;
+    };
+
+    struct SpecConstant
+    {
+        std::string                 name;
+        std::uint32_t               constantID          = 0;
+        UniformType                 type                = UniformType::Undefined;
+        std::uint64_t               defaultValue        = 0;    // Raw bits of the default value
+    };
+
+    std::uint64_t                   moduleHash          = 0;    // Hash of the shader module (see SPIRVParser::Hash)
+    std::vector<EntryPoint>         entryPoints;
+    std::vector<Resource>           resources;
+    std::vector<Varying>            varyings;
+    std::uint32_t                   pushConstantSize    = 0;
+    std::vector<BufferField>        pushConstantFields;
+    std::vector<SpecConstant>       specConstants;
+};
+
+/*
+SPIR-V shader module reflection in a single pass over the global declarations of a shader module.
+All per-ID information is stored in a flat array that is indexed by the ID number and sized by the ID-bound of the module header.
+*/
+class SPIRVReflect
 {
 
-    protected:
+    public:
+
+        // Returns the reflection of the specified SPIR-V module. Reflections are cached by the module hash, so each module is only parsed once.
+        static std::shared_ptr<const SPIRVModuleReflection> Reflect(const void* byteCode, std::size_t byteCodeSize);
+
+        // Reflects the specified shader module. Function bodies are skipped, since they cannot declare any resources.
+        void Parse(const SPIRVParser& module);
+
+        // Returns the reflection output of the parsed module.
+        inline const SPIRVModuleReflection& GetReflection() const
+        {
+            return reflection_;
+        }
+
+    private:
+
+        using Instr = SPIRVInstruction;
+
+        static const std::uint32_t invalidValue = ~0u;
 
-        struct Uniform
+        // Bitmask of decorations that are relevant for the reflection.
+        enum DecorationFlags : std::uint32_t
         {
-            const char*     name            = nullptr;
-            std::uint32_t   bindingPoint    = 0;
-            std::uint32_t   descriptorSet   = 0;
+            DecorationBlock         = (1 << 0),
+            DecorationBufferBlock   = (1 << 1),
+            DecorationBuiltIn       = (1 << 2),
+            DecorationNonWritable   = (1 << 3),
+            DecorationRowMajor      = (1 << 4),
         };
 
-        struct Varying
+        // Structure member information, declared by OpMemberName, OpMemberDecorate, and OpTypeStruct.
+        struct Member
         {
-            const char*     name        = nullptr;
-            std::uint32_t   location    = 0;
-            bool            input       = false;
+            const char*         name            = nullptr;
+            spv::Id             type            = 0;
+            std::uint32_t       offset          = 0;
+            std::uint32_t       matrixStride    = 0;
+            std::uint32_t       flags           = 0;
         };
 
-    private:
+        // Information of a single ID, which can either be a type, a constant, or a variable.
+        struct IdInfo
+        {
+            const char*         name            = nullptr;
+            spv::Op             opCode          = spv::Op::OpNop;   // Op-code of the instruction that declared this ID
+            spv::Id             baseType        = 0;                // Component, column, element, pointee, or result type
+            std::uint32_t       value           = 0;                // Scalar width, component count, array length, storage class, image dimension, or constant value
+            std::uint32_t       auxValue        = 0;                // Integer signedness, image 'sampled' operand, or upper 32 bits of a constant value
+            std::uint32_t       binding         = invalidValue;
+            std::uint32_t       descriptorSet   = 0;
+            std::uint32_t       location        = invalidValue;
+            std::uint32_t       specId          = invalidValue;
+            std::uint32_t       arrayStride     = 0;
+            std::uint32_t       flags           = 0;
+            std::vector<Member> members;
+        };
 
-        using Instr = SPIRVInstruction;
+    private:
 
-        void OnParseHeader(const SPIRVHeader& header) override;
-        void OnParseInstruction(const SPIRVInstruction& instr) override;
+        bool OnInstruction(const SPIRVInstruction& instr);
 
+        void OpEntryPoint(const Instr& instr);
         void OpName(const Instr& instr);
+        void OpMemberName(const Instr& instr);
         void OpDecorate(const Instr& instr);
-        void OpDecorateBinding(const Instr& instr);
-        void OpDecorateLocation(const Instr& instr);
+        void OpMemberDecorate(const Instr& instr);
+        void OpType(const Instr& instr);
+        void OpTypeArray(const Instr& instr);
+        void OpTypeStruct(const Instr& instr);
+        void OpConstant(const Instr& instr);
+        void OpSpecConstant(const Instr& instr);
+        void OpVariable(const Instr& instr);
+
+        void ReflectResource(const IdInfo& var, std::uint32_t storageClass, spv::Id typeId);
+        void ReflectPushConstants(spv::Id typeId);
+        void ReflectVarying(const IdInfo& var, std::uint32_t storageClass, spv::Id typeId);
+
+        void AppendBlockFields(std::vector<SPIRVModuleReflection::BufferField>& fields, spv::Id structId, const std::string& prefix, std::uint32_t baseOffset) const;
 
-        void SetName(spv::Id id, const char* name);
-        const char* GetName(spv::Id id) const;
+        std::uint32_t GetTypeSize(spv::Id typeId, std::uint32_t matrixStride = 0, bool rowMajor = false) const;
+        UniformType GetUniformType(spv::Id typeId) const;
+        Format GetVaryingFormat(spv::Id typeId) const;
 
-        void AssertIdBound(spv::Id id) const;
+        bool IsReadOnlyBlock(const IdInfo& var, spv::Id structId) const;
 
-        std::uint32_t               idBound_    = 0;
-        std::vector<const char*>    names_;
+        IdInfo& GetId(spv::Id id);
+        const IdInfo& GetId(spv::Id id) const;
+
+        Member& GetMember(spv::Id id, std::uint32_t memberIndex);
+
+    private:
 
-        std::map<spv::Id, Uniform>  uniforms_;
-        std::map<spv::Id, Varying>  varyings_;
+        std::uint32_t           idBound_        = 0;
+        std::size_t             maxNumMembers_  = 0;
+        std::vector<IdInfo>     ids_;
+        SPIRVModuleReflection   reflection_;
 
 };
 
@@ -34,6 +34,22 @@ bool LoadVKProc(VkInstance instance, T& procAddr, const char* procName)
     return true;
 }
 
+template <typename T>
+bool LoadVKDeviceProc(VkDevice device, T& procAddr, const char* procName)
+{
+    /* Load Vulkan device procedure address */
+    procAddr = reinterpret_cast<T>(vkGetDeviceProcAddr(device, procName));
+
+    /* Check for errors */
+    if (!procAddr)
+    {
+        Log::StdErr() << "failed to load Vulkan device procedure: " << procName << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 /* --- Hardware buffer extensions --- */
 
 #define LOAD_VKPROC(NAME)                   \
@@ -52,6 +68,24 @@ static bool Load_VK_KHR_win32_surface(VkInstance instance)
 
 #undef LOAD_VKPROC
 
+#define LOAD_VKDEVICEPROC(NAME)                     \
+    if (!LoadVKDeviceProc(device, NAME, #NAME))     \
+        return false
+
+#ifdef VK_KHR_timeline_semaphore
+
+static bool Load_VK_KHR_timeline_semaphore(VkDevice device)
+{
+    LOAD_VKDEVICEPROC( vkGetSemaphoreCounterValueKHR );
+    LOAD_VKDEVICEPROC( vkWaitSemaphoresKHR           );
+    LOAD_VKDEVICEPROC( vkSignalSemaphoreKHR          );
+    return true;
+}
+
+#endif // /VK_KHR_timeline_semaphore
+
+#undef LOAD_VKDEVICEPROC
+
 
 /* --- Common extension loading functions --- */
 
@@ -92,6 +126,15 @@ bool AreExtensionsLoaded()
     return g_extAlreadyLoaded;
 }
 
+bool LoadTimelineSemaphoreExtension(VkDevice device)
+{
+    #ifdef VK_KHR_timeline_semaphore
+    return Load_VK_KHR_timeline_semaphore(device);
+    #else
+    return false;
+    #endif
+}
+
 
 } // /namespace LLGL
 
@@ -30,6 +30,13 @@ void LoadAllExtensions(VkInstance instance);
 //! Returns true if all available extensions have been loaded.
 bool AreExtensionsLoaded();
 
+/**
+Loads the device procedures of the VK_KHR_timeline_semaphore extension.
+\return True if all procedures have been loaded successfully.
+This is always false if the Vulkan headers do not provide this extension.
+*/
+bool LoadTimelineSemaphoreExtension(VkDevice device);
+
 
 } // /namespace LLGL
 
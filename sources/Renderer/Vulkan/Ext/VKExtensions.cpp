@@ -24,6 +24,16 @@ PFN_vkCreateWin32SurfaceKHR vkCreateWin32SurfaceKHR = nullptr;
 
 #endif
 
+/* Device extensions */
+
+#ifdef VK_KHR_timeline_semaphore
+
+PFN_vkGetSemaphoreCounterValueKHR   vkGetSemaphoreCounterValueKHR   = nullptr;
+PFN_vkWaitSemaphoresKHR             vkWaitSemaphoresKHR             = nullptr;
+PFN_vkSignalSemaphoreKHR            vkSignalSemaphoreKHR            = nullptr;
+
+#endif // /VK_KHR_timeline_semaphore
+
 
 } // /namespace LLGL
 
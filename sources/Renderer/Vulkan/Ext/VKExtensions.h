@@ -28,6 +28,16 @@ extern PFN_vkCreateWin32SurfaceKHR vkCreateWin32SurfaceKHR;
 
 #endif
 
+/* Device extensions */
+
+#ifdef VK_KHR_timeline_semaphore
+
+extern PFN_vkGetSemaphoreCounterValueKHR    vkGetSemaphoreCounterValueKHR;
+extern PFN_vkWaitSemaphoresKHR              vkWaitSemaphoresKHR;
+extern PFN_vkSignalSemaphoreKHR             vkSignalSemaphoreKHR;
+
+#endif // /VK_KHR_timeline_semaphore
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,7 @@
 #include "../VKCore.h"
 #include "../../CheckedCast.h"
 #include <cstddef>
+#include <memory>
 
 
 namespace LLGL
@@ -19,7 +20,10 @@ namespace LLGL
 
 
 VKComputePipeline::VKComputePipeline(
-    const VKPtr<VkDevice>& device, const ComputePipelineDescriptor& desc, VkPipelineLayout defaultPipelineLayout) :
+    const VKPtr<VkDevice>&              device,
+    const ComputePipelineDescriptor&    desc,
+    VkPipelineLayout                    defaultPipelineLayout,
+    VKPipelineCompiler*                 compiler) :
         device_         { device                    },
         pipelineLayout_ { defaultPipelineLayout     },
         pipeline_       { device, vkDestroyPipeline }
@@ -31,8 +35,44 @@ VKComputePipeline::VKComputePipeline(
         pipelineLayout_ = pipelineLayoutVK->GetVkPipelineLayout();
     }
 
-    /* Create Vulkan compute pipeline object */
-    CreateComputePipeline(desc);
+    /* Create Vulkan compute pipeline object, either immediately or on a worker thread of the pipeline compiler */
+    if (compiler != nullptr)
+    {
+        auto descCopy = std::make_shared<ComputePipelineDescriptor>(desc);
+        compileState_.Reset();
+        compiler->Enqueue(
+            [this, descCopy]()
+            {
+                try
+                {
+                    CreateComputePipeline(*descCopy);
+                    compileState_.Finish();
+                }
+                catch (const std::exception& e)
+                {
+                    compileState_.Finish(e.what());
+                }
+            }
+        );
+    }
+    else
+        CreateComputePipeline(desc);
+}
+
+VKComputePipeline::~VKComputePipeline()
+{
+    /* Pipeline must not be destroyed while it is still being compiled */
+    compileState_.WaitQuietly();
+}
+
+bool VKComputePipeline::IsReady() const
+{
+    return compileState_.IsComplete();
+}
+
+void VKComputePipeline::WaitReady()
+{
+    compileState_.Wait();
 }
 
 
@@ -48,8 +88,9 @@ void VKComputePipeline::CreateComputePipeline(const ComputePipelineDescriptor& d
         throw std::invalid_argument("failed to create compute pipeline due to missing shader program");
 
     /* Get shader stages */
-    auto shaderStageCreateInfos = shaderProgramVK->GetShaderStageCreateInfos();
-    if (shaderStageCreateInfos.size() != 1)
+    VKShaderStageCreateInfos shaderStageCreateInfos;
+    shaderProgramVK->FillShaderStageCreateInfos(shaderStageCreateInfos, desc.specializationConstants);
+    if (shaderStageCreateInfos.stages.size() != 1)
         throw std::invalid_argument("invalid number of shader stages for Vulkan compute pipeline");
 
     /* Create graphics pipeline state object */
@@ -58,7 +99,7 @@ void VKComputePipeline::CreateComputePipeline(const ComputePipelineDescriptor& d
         createInfo.sType                = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
         createInfo.pNext                = nullptr;
         createInfo.flags                = 0;
-        createInfo.stage                = shaderStageCreateInfos.front();
+        createInfo.stage                = shaderStageCreateInfos.stages.front();
         createInfo.layout               = pipelineLayout_;
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
@@ -12,6 +12,7 @@
 #include <LLGL/ComputePipeline.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "VKPipelineCompiler.h"
 
 
 namespace LLGL
@@ -25,7 +26,16 @@ class VKComputePipeline final : public ComputePipeline
 
     public:
 
-        VKComputePipeline(const VKPtr<VkDevice>& device, const ComputePipelineDescriptor& desc, VkPipelineLayout defaultPipelineLayout);
+        VKComputePipeline(
+            const VKPtr<VkDevice>&              device,
+            const ComputePipelineDescriptor&    desc,
+            VkPipelineLayout                    defaultPipelineLayout,
+            VKPipelineCompiler*                 compiler                = nullptr
+        );
+        ~VKComputePipeline();
+
+        bool IsReady() const override;
+        void WaitReady() override;
 
         inline VkPipeline GetVkPipeline() const
         {
@@ -41,9 +51,10 @@ class VKComputePipeline final : public ComputePipeline
 
         void CreateComputePipeline(const ComputePipelineDescriptor& desc);
 
-        VkDevice            device_         = VK_NULL_HANDLE;
-        VkPipelineLayout    pipelineLayout_ = VK_NULL_HANDLE;
-        VKPtr<VkPipeline>   pipeline_;
+        VkDevice                device_         = VK_NULL_HANDLE;
+        VkPipelineLayout        pipelineLayout_ = VK_NULL_HANDLE;
+        VKPtr<VkPipeline>       pipeline_;
+        VKPipelineCompileState  compileState_;
 
 };
 
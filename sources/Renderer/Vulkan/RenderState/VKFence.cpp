@@ -7,6 +7,8 @@
 
 #include "VKFence.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
+#include <stdexcept>
 
 
 namespace LLGL
@@ -14,7 +16,8 @@ namespace LLGL
 
 
 VKFence::VKFence(const VKPtr<VkDevice>& device) :
-    fence_ { device, vkDestroyFence }
+    fence_              { device, vkDestroyFence     },
+    timelineSemaphore_  { device, vkDestroySemaphore }
 {
     VkFenceCreateInfo createInfo;
     {
@@ -26,14 +29,84 @@ VKFence::VKFence(const VKPtr<VkDevice>& device) :
     VKThrowIfFailed(result, "failed to create Vulkan fence");
 }
 
+VKFence::VKFence(const VKPtr<VkDevice>& device, std::uint64_t initialValue) :
+    fence_              { device, vkDestroyFence     },
+    timelineSemaphore_  { device, vkDestroySemaphore },
+    signaledValue_      { initialValue               }
+{
+    #ifdef VK_KHR_timeline_semaphore
+
+    VkSemaphoreTypeCreateInfoKHR typeCreateInfo;
+    {
+        typeCreateInfo.sType            = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        typeCreateInfo.pNext            = nullptr;
+        typeCreateInfo.semaphoreType    = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        typeCreateInfo.initialValue     = initialValue;
+    }
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType    = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext    = (&typeCreateInfo);
+        createInfo.flags    = 0;
+    }
+    auto result = vkCreateSemaphore(device, &createInfo, nullptr, timelineSemaphore_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore");
+
+    #else
+
+    throw std::runtime_error("cannot create Vulkan timeline fence, because VK_KHR_timeline_semaphore is not available");
+
+    #endif // /VK_KHR_timeline_semaphore
+}
+
 void VKFence::Reset(VkDevice device)
 {
-    vkResetFences(device, 1, &fence_);
+    /* Timeline fences are never reset, since their value only increases */
+    if (!IsTimeline())
+        vkResetFences(device, 1, &fence_);
 }
 
 bool VKFence::Wait(VkDevice device, std::uint64_t timeout)
 {
-    return (vkWaitForFences(device, 1, &fence_, VK_TRUE, timeout) == VK_SUCCESS);
+    if (IsTimeline())
+        return WaitValue(device, signaledValue_, timeout);
+    else
+        return (vkWaitForFences(device, 1, &fence_, VK_TRUE, timeout) == VK_SUCCESS);
+}
+
+/* ----- Timeline fences ----- */
+
+std::uint64_t VKFence::GetCompletedValue(VkDevice device) const
+{
+    std::uint64_t value = 0;
+    #ifdef VK_KHR_timeline_semaphore
+    vkGetSemaphoreCounterValueKHR(device, timelineSemaphore_, &value);
+    #endif
+    return value;
+}
+
+bool VKFence::WaitValue(VkDevice device, std::uint64_t value, std::uint64_t timeout) const
+{
+    #ifdef VK_KHR_timeline_semaphore
+
+    VkSemaphore semaphore = timelineSemaphore_.Get();
+
+    VkSemaphoreWaitInfoKHR waitInfo;
+    {
+        waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        waitInfo.pNext          = nullptr;
+        waitInfo.flags          = 0;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores    = (&semaphore);
+        waitInfo.pValues        = (&value);
+    }
+    return (vkWaitSemaphoresKHR(device, &waitInfo, timeout) == VK_SUCCESS);
+
+    #else
+
+    return false;
+
+    #endif // /VK_KHR_timeline_semaphore
 }
 
 
@@ -12,6 +12,7 @@
 #include <LLGL/Fence.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include <cstdint>
 
 
 namespace LLGL
@@ -25,6 +26,9 @@ class VKFence final : public Fence
 
         VKFence(const VKPtr<VkDevice>& device);
 
+        // Creates a timeline fence with a timeline semaphore (requires VK_KHR_timeline_semaphore).
+        VKFence(const VKPtr<VkDevice>& device, std::uint64_t initialValue);
+
         void Reset(VkDevice device);
         bool Wait(VkDevice device, std::uint64_t timeout);
 
@@ -33,9 +37,42 @@ class VKFence final : public Fence
             return fence_;
         }
 
+        /* ----- Timeline fences ----- */
+
+        // Returns true if this is a timeline fence.
+        inline bool IsTimeline() const
+        {
+            return (timelineSemaphore_.Get() != VK_NULL_HANDLE);
+        }
+
+        // Returns the current value of the timeline semaphore without blocking.
+        std::uint64_t GetCompletedValue(VkDevice device) const;
+
+        // Waits until the timeline semaphore has reached the specified value or the timeout (in nanoseconds) has expired.
+        bool WaitValue(VkDevice device, std::uint64_t value, std::uint64_t timeout) const;
+
+        // Stores the highest value that has been signaled so far.
+        inline void SetSignaledValue(std::uint64_t value)
+        {
+            signaledValue_ = value;
+        }
+
+        // Returns the highest value that has been signaled so far.
+        inline std::uint64_t GetSignaledValue() const
+        {
+            return signaledValue_;
+        }
+
+        inline VkSemaphore GetTimelineSemaphore() const
+        {
+            return timelineSemaphore_;
+        }
+
     private:
 
-        VKPtr<VkFence> fence_;
+        VKPtr<VkFence>      fence_;
+        VKPtr<VkSemaphore>  timelineSemaphore_;
+        std::uint64_t       signaledValue_      = 0;
 
 };
 
@@ -13,6 +13,7 @@
 #include "../VKCore.h"
 #include "../../CheckedCast.h"
 #include <cstddef>
+#include <memory>
 #include <LLGL/GraphicsPipelineFlags.h>
 
 
@@ -25,7 +26,8 @@ VKGraphicsPipeline::VKGraphicsPipeline(
     VkPipelineLayout                    defaultPipelineLayout,
     const RenderPass*                   defaultRenderPass,
     const GraphicsPipelineDescriptor&   desc,
-    const VKGraphicsPipelineLimits&     limits) :
+    const VKGraphicsPipelineLimits&     limits,
+    VKPipelineCompiler*                 compiler) :
         device_            { device                             },
         pipeline_          { device, vkDestroyPipeline          },
         scissorEnabled_    { desc.rasterizer.scissorTestEnabled },
@@ -53,8 +55,44 @@ VKGraphicsPipeline::VKGraphicsPipeline(
     else
         throw std::invalid_argument("cannot create Vulkan graphics pipeline without render pass");
 
-    /* Create Vulkan graphics pipeline object */
-    CreateVkGraphicsPipeline(desc, limits, nativePipelineLayout, nativeRenderPass);
+    /* Create Vulkan graphics pipeline object, either immediately or on a worker thread of the pipeline compiler */
+    if (compiler != nullptr)
+    {
+        auto descCopy = std::make_shared<GraphicsPipelineDescriptor>(desc);
+        compileState_.Reset();
+        compiler->Enqueue(
+            [this, descCopy, limits, nativePipelineLayout, nativeRenderPass]()
+            {
+                try
+                {
+                    CreateVkGraphicsPipeline(*descCopy, limits, nativePipelineLayout, nativeRenderPass);
+                    compileState_.Finish();
+                }
+                catch (const std::exception& e)
+                {
+                    compileState_.Finish(e.what());
+                }
+            }
+        );
+    }
+    else
+        CreateVkGraphicsPipeline(desc, limits, nativePipelineLayout, nativeRenderPass);
+}
+
+VKGraphicsPipeline::~VKGraphicsPipeline()
+{
+    /* Pipeline must not be destroyed while it is still being compiled */
+    compileState_.WaitQuietly();
+}
+
+bool VKGraphicsPipeline::IsReady() const
+{
+    return compileState_.IsComplete();
+}
+
+void VKGraphicsPipeline::WaitReady()
+{
+    compileState_.Wait();
 }
 
 
@@ -330,7 +368,8 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
         throw std::invalid_argument("failed to create graphics pipeline due to missing shader program");
 
     /* Get shader stages */
-    auto shaderStageCreateInfos = shaderProgramVK->GetShaderStageCreateInfos();
+    VKShaderStageCreateInfos shaderStageCreateInfos;
+    shaderProgramVK->FillShaderStageCreateInfos(shaderStageCreateInfos, desc.specializationConstants);
 
     /* Initialize vertex input descriptor */
     VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo;
@@ -378,8 +417,8 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
         createInfo.sType                        = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
         createInfo.pNext                        = nullptr;
         createInfo.flags                        = 0;
-        createInfo.stageCount                   = static_cast<std::uint32_t>(shaderStageCreateInfos.size());
-        createInfo.pStages                      = shaderStageCreateInfos.data();
+        createInfo.stageCount                   = static_cast<std::uint32_t>(shaderStageCreateInfos.stages.size());
+        createInfo.pStages                      = shaderStageCreateInfos.stages.data();
         createInfo.pVertexInputState            = (&vertexInputCreateInfo);
         createInfo.pInputAssemblyState          = (&inputAssembly);
         createInfo.pTessellationState           = (inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
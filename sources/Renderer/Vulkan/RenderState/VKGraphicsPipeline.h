@@ -12,6 +12,7 @@
 #include <LLGL/GraphicsPipeline.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "VKPipelineCompiler.h"
 
 
 namespace LLGL
@@ -39,8 +40,13 @@ class VKGraphicsPipeline final : public GraphicsPipeline
             VkPipelineLayout                    defaultPipelineLayout,
             const RenderPass*                   defaultRenderPass,
             const GraphicsPipelineDescriptor&   desc,
-            const VKGraphicsPipelineLimits&     limits
+            const VKGraphicsPipelineLimits&     limits,
+            VKPipelineCompiler*                 compiler            = nullptr
         );
+        ~VKGraphicsPipeline();
+
+        bool IsReady() const override;
+        void WaitReady() override;
 
         // Returns the native VkPipeline Vulkan object.
         inline VkPipeline GetVkPipeline() const
@@ -69,11 +75,12 @@ class VKGraphicsPipeline final : public GraphicsPipeline
             VkRenderPass                        renderPass
         );
 
-        VkDevice            device_             = VK_NULL_HANDLE;
-        VKPtr<VkPipeline>   pipeline_;
+        VkDevice                device_             = VK_NULL_HANDLE;
+        VKPtr<VkPipeline>       pipeline_;
+        VKPipelineCompileState  compileState_;
 
-        bool                scissorEnabled_     = false;
-        bool                hasDynamicScissor_  = false;
+        bool                    scissorEnabled_     = false;
+        bool                    hasDynamicScissor_  = false;
 
 };
 
@@ -0,0 +1,134 @@
+/*
+ * VKPipelineCompiler.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKPipelineCompiler.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+/*
+ * VKPipelineCompileState class
+ */
+
+void VKPipelineCompileState::Reset()
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    error_.clear();
+    complete_.store(false, std::memory_order_release);
+}
+
+void VKPipelineCompileState::Finish(const std::string& error)
+{
+    /* Notify while the lock is held, since a waiting destructor may release this state as soon as the lock is free */
+    std::lock_guard<std::mutex> guard { mutex_ };
+    error_ = error;
+    complete_.store(true, std::memory_order_release);
+    cond_.notify_all();
+}
+
+void VKPipelineCompileState::Wait()
+{
+    std::unique_lock<std::mutex> lock { mutex_ };
+    cond_.wait(lock, [this]() { return IsComplete(); });
+    if (!error_.empty())
+        throw std::runtime_error(error_);
+}
+
+void VKPipelineCompileState::WaitQuietly()
+{
+    std::unique_lock<std::mutex> lock { mutex_ };
+    cond_.wait(lock, [this]() { return IsComplete(); });
+}
+
+
+/*
+ * VKPipelineCompiler class
+ */
+
+VKPipelineCompiler::~VKPipelineCompiler()
+{
+    Stop();
+}
+
+void VKPipelineCompiler::Enqueue(const Job& job)
+{
+    /* Append job to queue and wake up one worker thread */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        if (threads_.empty())
+            Start();
+        jobs_.push_back(job);
+    }
+    cond_.notify_one();
+}
+
+void VKPipelineCompiler::Stop()
+{
+    if (!threads_.empty())
+    {
+        /* Signal worker threads to quit after all remaining jobs have been executed */
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            quit_ = true;
+        }
+        cond_.notify_all();
+
+        for (auto& thread : threads_)
+            thread.join();
+
+        threads_.clear();
+        quit_ = false;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKPipelineCompiler::Start()
+{
+    /* Leave one hardware thread for the render thread (hardware concurrency is 0 if it cannot be determined) */
+    const auto hardwareThreads  = std::thread::hardware_concurrency();
+    const auto numThreads       = (hardwareThreads > 1 ? hardwareThreads - 1 : 1u);
+
+    threads_.reserve(numThreads);
+    for (unsigned i = 0; i < numThreads; ++i)
+        threads_.emplace_back(&VKPipelineCompiler::Run, this);
+}
+
+void VKPipelineCompiler::Run()
+{
+    while (true)
+    {
+        /* Wait for next job */
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock { mutex_ };
+            cond_.wait(lock, [this]() { return (quit_ || !jobs_.empty()); });
+
+            if (jobs_.empty())
+                break;
+
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+
+        /* Execute job; errors are stored in the compile state of the respective pipeline */
+        job();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
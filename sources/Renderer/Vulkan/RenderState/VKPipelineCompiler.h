@@ -0,0 +1,114 @@
+/*
+ * VKPipelineCompiler.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_PIPELINE_COMPILER_H
+#define LLGL_VK_PIPELINE_COMPILER_H
+
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+namespace LLGL
+{
+
+
+/*
+Completion state of a pipeline that is compiled by the VKPipelineCompiler.
+A default constructed state is already complete, i.e. synchronously created pipelines never wait.
+*/
+class VKPipelineCompileState
+{
+
+    public:
+
+        VKPipelineCompileState() = default;
+
+        VKPipelineCompileState(const VKPipelineCompileState&) = delete;
+        VKPipelineCompileState& operator = (const VKPipelineCompileState&) = delete;
+
+        // Marks this state as pending. Must be called before the compile job is enqueued.
+        void Reset();
+
+        // Marks this state as complete and wakes up all waiting threads. The error message is empty on success.
+        void Finish(const std::string& error = "");
+
+        // Returns true if the compilation has finished (either successfully or not).
+        inline bool IsComplete() const
+        {
+            return complete_.load(std::memory_order_acquire);
+        }
+
+        // Blocks until the compilation has finished and throws std::runtime_error if it failed.
+        void Wait();
+
+        // Blocks until the compilation has finished, but ignores any errors.
+        void WaitQuietly();
+
+    private:
+
+        std::atomic<bool>       complete_ { true };
+        std::mutex              mutex_;
+        std::condition_variable cond_;
+        std::string             error_;
+
+};
+
+/*
+Worker thread pool for background pipeline compilation (see RenderSystem::CreateGraphicsPipelineAsync).
+Vulkan allows to create pipelines from multiple threads, as long as they don't share the same pipeline cache.
+The worker threads are only started with the first enqueued job.
+*/
+class VKPipelineCompiler
+{
+
+    public:
+
+        using Job = std::function<void()>;
+
+        VKPipelineCompiler() = default;
+        ~VKPipelineCompiler();
+
+        VKPipelineCompiler(const VKPipelineCompiler&) = delete;
+        VKPipelineCompiler& operator = (const VKPipelineCompiler&) = delete;
+
+        // Enqueues the specified job. The job is responsible for finishing the compile state of its pipeline.
+        void Enqueue(const Job& job);
+
+        // Executes all remaining jobs, then stops all worker threads.
+        void Stop();
+
+    private:
+
+        void Start();
+        void Run();
+
+    private:
+
+        std::vector<std::thread>    threads_;
+        std::mutex                  mutex_;
+        std::condition_variable     cond_;
+        std::deque<Job>             jobs_;
+        bool                        quit_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -10,6 +10,7 @@
 #include "../VKTypes.h"
 #include "../../../Core/Helper.h"
 #include <LLGL/Strings.h>
+#include <algorithm>
 
 #ifdef LLGL_ENABLE_SPIRV_REFLECT
 #   include "../../SPIRV/SPIRVReflect.h"
@@ -26,6 +27,11 @@ VKShader::VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc)
     shaderModule_ { device, vkDestroyShaderModule }
 {
     Build(desc);
+
+    /* Store specialization constants without their names, which are only used for GLSL */
+    specializationConstants_ = desc.specializationConstants;
+    for (auto& constant : specializationConstants_)
+        constant.name = nullptr;
 }
 
 bool VKShader::HasErrors() const
@@ -55,6 +61,10 @@ std::string VKShader::QueryInfoLog()
         case LoadBinaryResult::ReflectFailed:
             s = errorLog_;
             break;
+        case LoadBinaryResult::EntryPointNotFound:
+            s += ToString(GetType());
+            s += " shader: entry point \"" + entryPoint_ + "\" not found in shader module";
+            break;
         default:
             break;
     }
@@ -73,6 +83,168 @@ void VKShader::FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& create
     createInfo.pSpecializationInfo  = nullptr;
 }
 
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+static ShaderReflectionDescriptor::ResourceView* FetchOrInsertResource(
+    ShaderReflectionDescriptor& reflectionDesc,
+    const std::string&          name,
+    const ResourceType          type,
+    std::uint32_t               slot)
+{
+    /* Fetch resource from list */
+    for (auto& resource : reflectionDesc.resourceViews)
+    {
+        if (resource.type == type && resource.slot == slot && resource.name == name)
+            return (&resource);
+    }
+
+    /* Allocate new resource and initialize parameters */
+    reflectionDesc.resourceViews.resize(reflectionDesc.resourceViews.size() + 1);
+    auto ref = &(reflectionDesc.resourceViews.back());
+    {
+        ref->name = name;
+        ref->type = type;
+        ref->slot = slot;
+    }
+    return ref;
+}
+
+static void ReflectSPIRVVertexAttributes(
+    const SPIRVModuleReflection&    reflection,
+    ShaderReflectionDescriptor&     reflectionDesc)
+{
+    /* Gather input varyings and sort them by location */
+    std::vector<const SPIRVModuleReflection::Varying*> inputs;
+    for (const auto& varying : reflection.varyings)
+    {
+        if (varying.input)
+            inputs.push_back(&varying);
+    }
+
+    std::sort(
+        inputs.begin(),
+        inputs.end(),
+        [](const SPIRVModuleReflection::Varying* lhs, const SPIRVModuleReflection::Varying* rhs)
+        {
+            return (lhs->location < rhs->location);
+        }
+    );
+
+    /* Add vertex attributes to output list */
+    for (auto input : inputs)
+    {
+        VertexAttribute vertexAttrib;
+        {
+            vertexAttrib.name           = input->name;
+            vertexAttrib.format         = input->format;
+            vertexAttrib.semanticIndex  = input->semanticIndex;
+        }
+        reflectionDesc.vertexAttributes.push_back(vertexAttrib);
+    }
+}
+
+static void ReflectSPIRVResources(
+    const SPIRVModuleReflection&    reflection,
+    long                            stageFlags,
+    ShaderReflectionDescriptor&     reflectionDesc)
+{
+    for (const auto& resource : reflection.resources)
+    {
+        /* LLGL uses a single descriptor set for Vulkan, so only the binding point is reflected as slot */
+        auto resourceView = FetchOrInsertResource(reflectionDesc, resource.name, resource.type, resource.binding);
+        {
+            resourceView->stageFlags            = (resourceView->stageFlags | stageFlags);
+            resourceView->arraySize             = resource.arraySize;
+            resourceView->storageBufferType     = resource.storageBufferType;
+            if (resource.type == ResourceType::ConstantBuffer)
+                resourceView->constantBufferSize = resource.blockSize;
+            if (resourceView->fields.empty())
+                resourceView->fields = resource.fields;
+        }
+    }
+}
+
+static void ReflectSPIRVPushConstants(
+    const SPIRVModuleReflection&    reflection,
+    ShaderReflectionDescriptor&     reflectionDesc)
+{
+    for (const auto& field : reflection.pushConstantFields)
+    {
+        /* Push constant blocks are shared between all shader stages, so skip fields that have already been reflected */
+        auto it = std::find_if(
+            reflectionDesc.uniforms.begin(),
+            reflectionDesc.uniforms.end(),
+            [&field](const UniformDescriptor& uniform)
+            {
+                return (uniform.name == field.name);
+            }
+        );
+
+        if (it == reflectionDesc.uniforms.end())
+        {
+            UniformDescriptor uniform;
+            {
+                uniform.name        = field.name;
+                uniform.type        = field.type;
+                uniform.location    = static_cast<UniformLocation>(field.offset);
+                uniform.size        = std::max(1u, field.arraySize);
+            }
+            reflectionDesc.uniforms.push_back(uniform);
+        }
+    }
+}
+
+static void ReflectSPIRVSpecializationConstants(
+    const SPIRVModuleReflection&    reflection,
+    ShaderReflectionDescriptor&     reflectionDesc)
+{
+    auto& specConstants = reflectionDesc.specializationConstants;
+
+    for (const auto& constant : reflection.specConstants)
+    {
+        /* Insert specialization constant sorted by its ID, unless another shader stage declared the same ID */
+        auto it = std::lower_bound(
+            specConstants.begin(),
+            specConstants.end(),
+            constant.constantID,
+            [](const ShaderReflectionDescriptor::SpecializationConstant& lhs, std::uint32_t rhs)
+            {
+                return (lhs.constantID < rhs);
+            }
+        );
+
+        if (it == specConstants.end() || it->constantID != constant.constantID)
+        {
+            ShaderReflectionDescriptor::SpecializationConstant specConstant;
+            {
+                specConstant.name       = constant.name;
+                specConstant.constantID = constant.constantID;
+                specConstant.type       = constant.type;
+            }
+            specConstants.insert(it, specConstant);
+        }
+    }
+}
+
+#endif // /LLGL_ENABLE_SPIRV_REFLECT
+
+void VKShader::Reflect(ShaderReflectionDescriptor& reflectionDesc) const
+{
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+    if (reflection_)
+    {
+        if (GetType() == ShaderType::Vertex)
+            ReflectSPIRVVertexAttributes(*reflection_, reflectionDesc);
+
+        ReflectSPIRVResources(*reflection_, GetStageFlags(), reflectionDesc);
+        ReflectSPIRVPushConstants(*reflection_, reflectionDesc);
+        ReflectSPIRVSpecializationConstants(*reflection_, reflectionDesc);
+    }
+
+    #endif // /LLGL_ENABLE_SPIRV_REFLECT
+}
+
 
 /*
  * ======= Private: =======
@@ -112,6 +284,12 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         binaryLength = shaderDesc.sourceSize;
     }
 
+    /* Store shader entry point (by default "main" for GLSL) */
+    if (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0')
+        entryPoint_ = "main";
+    else
+        entryPoint_ = shaderDesc.entryPoint;
+
     #ifdef LLGL_ENABLE_SPIRV_REFLECT
 
     /* Reflect SPIR-V shader module */
@@ -119,12 +297,8 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
 
     try
     {
-        /* Parse shader module */
-        SPIRVReflect reflect;
-        reflect.Parse(binaryBuffer, binaryLength);
-
-        /* Store reflection data */
-        //TODO...
+        /* Parse shader module (or get it from the reflection cache) */
+        reflection_ = SPIRVReflect::Reflect(binaryBuffer, binaryLength);
     }
     catch (const std::exception& e)
     {
@@ -133,6 +307,22 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         return false;
     }
 
+    /* Validate shader entry point against the shader module */
+    auto entryPointIt = std::find_if(
+        reflection_->entryPoints.begin(),
+        reflection_->entryPoints.end(),
+        [this](const SPIRVModuleReflection::EntryPoint& entryPoint)
+        {
+            return (entryPoint.name == entryPoint_ && entryPoint.shaderType == GetType());
+        }
+    );
+
+    if (entryPointIt == reflection_->entryPoints.end())
+    {
+        loadBinaryResult_ = LoadBinaryResult::EntryPointNotFound;
+        return false;
+    }
+
     #else
 
     /* Validate code size */
@@ -144,12 +334,6 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
 
     #endif
 
-    /* Store shader entry point (by default "main" for GLSL) */
-    if (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0')
-        entryPoint_ = "main";
-    else
-        entryPoint_ = shaderDesc.entryPoint;
-
     /* Create shader module */
     VkShaderModuleCreateInfo createInfo;
     {
@@ -10,14 +10,19 @@
 
 
 #include <LLGL/Shader.h>
+#include <LLGL/ShaderProgramFlags.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include <vector>
+#include <memory>
 
 
 namespace LLGL
 {
 
 
+struct SPIRVModuleReflection;
+
 class VKShader final : public Shader
 {
 
@@ -33,12 +38,21 @@ class VKShader final : public Shader
 
         void FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& createInfo) const;
 
+        // Merges the SPIR-V reflection of this shader into the specified descriptor. Does nothing if SPIR-V reflection is disabled.
+        void Reflect(ShaderReflectionDescriptor& reflectionDesc) const;
+
         // Returns the Vulkan shader module.
         inline const VKPtr<VkShaderModule>& GetShaderModule() const
         {
             return shaderModule_;
         }
 
+        // Returns the specialization constants of this shader (names are not retained).
+        inline const std::vector<SpecializationConstant>& GetSpecializationConstants() const
+        {
+            return specializationConstants_;
+        }
+
     private:
 
         // Note: "Success" is a reserved macro by X11 lib.
@@ -48,6 +62,7 @@ class VKShader final : public Shader
             Successful,
             InvalidCodeSize,
             ReflectFailed,
+            EntryPointNotFound,
         };
 
         bool Build(const ShaderDescriptor& shaderDesc);
@@ -61,6 +76,12 @@ class VKShader final : public Shader
         std::string             entryPoint_;
         std::string             errorLog_;
 
+        std::vector<SpecializationConstant> specializationConstants_;
+
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+        std::shared_ptr<const SPIRVModuleReflection> reflection_;
+        #endif
+
 };
 
 
@@ -46,7 +46,19 @@ std::string VKShaderProgram::QueryInfoLog()
 
 ShaderReflectionDescriptor VKShaderProgram::QueryReflectionDesc() const
 {
-    return {}; //TODO
+    ShaderReflectionDescriptor reflection;
+
+    /* Reflect all shaders */
+    for (auto shader : shaders_)
+    {
+        if (shader != nullptr)
+            shader->Reflect(reflection);
+    }
+
+    /* Sort output to meet the interface requirements */
+    ShaderProgram::FinalizeShaderReflection(reflection);
+
+    return reflection;
 }
 
 void VKShaderProgram::BindConstantBuffer(const std::string& name, std::uint32_t bindingIndex)
@@ -71,15 +83,106 @@ void VKShaderProgram::UnlockShaderUniform()
 
 /* --- Extended functions --- */
 
-std::vector<VkPipelineShaderStageCreateInfo> VKShaderProgram::GetShaderStageCreateInfos() const
+static std::uint32_t GetSpecializationConstantSize(const UniformType type)
+{
+    return static_cast<std::uint32_t>(type == UniformType::Double1 ? sizeof(double) : sizeof(std::uint32_t));
+}
+
+static const SpecializationConstant* FindSpecializationConstant(const std::vector<SpecializationConstant>& constants, std::uint32_t constantID)
+{
+    for (const auto& constant : constants)
+    {
+        if (constant.constantID == constantID)
+            return (&constant);
+    }
+    return nullptr;
+}
+
+static void AppendSpecializationConstant(VKShaderStageCreateInfos& createInfos, const SpecializationConstant& constant)
+{
+    /* Append map entry */
+    VkSpecializationMapEntry mapEntry;
+    {
+        mapEntry.constantID = constant.constantID;
+        mapEntry.offset     = static_cast<std::uint32_t>(createInfos.data.size());
+        mapEntry.size       = GetSpecializationConstantSize(constant.type);
+    }
+    createInfos.mapEntries.push_back(mapEntry);
+
+    /* Append constant data (booleans are of type VkBool32) */
+    VkBool32    boolValue   = VK_FALSE;
+    auto        value       = reinterpret_cast<const char*>(&(constant.value));
+
+    if (constant.type == UniformType::Bool1)
+    {
+        boolValue   = (constant.value.u32 != 0 ? VK_TRUE : VK_FALSE);
+        value       = reinterpret_cast<const char*>(&boolValue);
+    }
+
+    createInfos.data.insert(createInfos.data.end(), value, value + mapEntry.size);
+}
+
+void VKShaderProgram::FillShaderStageCreateInfos(VKShaderStageCreateInfos& createInfos, const std::vector<SpecializationConstant>& pipelineConstants) const
 {
-    auto shaderCount = shaders_.size();
-    std::vector<VkPipelineShaderStageCreateInfo> createInfos(shaderCount);
+    const auto shaderCount = shaders_.size();
+
+    createInfos.stages.resize(shaderCount);
+    createInfos.specializationInfos.resize(shaderCount);
+    createInfos.mapEntries.clear();
+    createInfos.data.clear();
+
+    /* Append specialization constants of all shaders; map entries and data are referenced by offsets until the containers have their final size */
+    std::vector<std::size_t> firstMapEntries(shaderCount, 0);
 
     for (std::size_t i = 0; i < shaderCount; ++i)
-        shaders_[i]->FillShaderStageCreateInfo(createInfos[i]);
+    {
+        const auto& shaderConstants = shaders_[i]->GetSpecializationConstants();
+
+        firstMapEntries[i] = createInfos.mapEntries.size();
+
+        for (const auto& constant : shaderConstants)
+        {
+            if (auto pipelineConstant = FindSpecializationConstant(pipelineConstants, constant.constantID))
+                AppendSpecializationConstant(createInfos, *pipelineConstant);
+            else
+                AppendSpecializationConstant(createInfos, constant);
+        }
+
+        for (const auto& constant : pipelineConstants)
+        {
+            if (FindSpecializationConstant(shaderConstants, constant.constantID) == nullptr)
+                AppendSpecializationConstant(createInfos, constant);
+        }
+    }
 
-    return createInfos;
+    /* Fill shader stages and their specialization infos */
+    for (std::size_t i = 0; i < shaderCount; ++i)
+    {
+        const auto firstMapEntry    = firstMapEntries[i];
+        const auto endMapEntry      = (i + 1 < shaderCount ? firstMapEntries[i + 1] : createInfos.mapEntries.size());
+
+        auto& stage = createInfos.stages[i];
+        shaders_[i]->FillShaderStageCreateInfo(stage);
+
+        if (firstMapEntry < endMapEntry)
+        {
+            /* Map entry offsets are relative to the data of each stage */
+            const auto dataOffset   = createInfos.mapEntries[firstMapEntry].offset;
+            const auto dataEnd      = (endMapEntry < createInfos.mapEntries.size() ? createInfos.mapEntries[endMapEntry].offset : createInfos.data.size());
+
+            for (auto j = firstMapEntry; j < endMapEntry; ++j)
+                createInfos.mapEntries[j].offset -= dataOffset;
+
+            auto& specializationInfo = createInfos.specializationInfos[i];
+            {
+                specializationInfo.mapEntryCount    = static_cast<std::uint32_t>(endMapEntry - firstMapEntry);
+                specializationInfo.pMapEntries      = &(createInfos.mapEntries[firstMapEntry]);
+                specializationInfo.dataSize         = dataEnd - dataOffset;
+                specializationInfo.pData            = &(createInfos.data[dataOffset]);
+            }
+            stage.pSpecializationInfo = (&specializationInfo);
+        }
+    }
 }
 
 void VKShaderProgram::FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateInfo& createInfo) const
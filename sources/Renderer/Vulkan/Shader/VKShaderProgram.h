@@ -21,6 +21,15 @@ namespace LLGL
 
 class VKShader;
 
+// Shader stage create infos with their specialization infos. All pointers refer to the containers of this structure.
+struct VKShaderStageCreateInfos
+{
+    std::vector<VkPipelineShaderStageCreateInfo>    stages;
+    std::vector<VkSpecializationInfo>               specializationInfos;
+    std::vector<VkSpecializationMapEntry>           mapEntries;
+    std::vector<char>                               data;
+};
+
 class VKShaderProgram final : public ShaderProgram
 {
 
@@ -42,9 +51,8 @@ class VKShaderProgram final : public ShaderProgram
 
         /* --- Extended functions --- */
 
-        //TODO: replace by "FillShaderStageCreateInfos" to avoid std::vector
-        std::vector<VkPipelineShaderStageCreateInfo> GetShaderStageCreateInfos() const;
-        //void FillShaderStageCreateInfos(std::size_t maxNumCreateInfos, VkPipelineShaderStageCreateInfo* createInfos) const;
+        // Fills the shader stage create infos. The pipeline constants override the specialization constants of the shaders with the same ID.
+        void FillShaderStageCreateInfos(VKShaderStageCreateInfos& createInfos, const std::vector<SpecializationConstant>& pipelineConstants) const;
 
         void FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateInfo& createInfo) const;
 
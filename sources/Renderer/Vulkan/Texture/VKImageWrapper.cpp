@@ -71,7 +71,9 @@ void VKImageWrapper::CreateVkImage(
     std::uint32_t           numArrayLayers,
     VkImageCreateFlags      createFlags,
     VkSampleCountFlagBits   samplesFlags,
-    VkImageUsageFlags       usageFlags)
+    VkImageUsageFlags       usageFlags,
+    std::uint32_t           numQueueFamilies,
+    const std::uint32_t*    queueFamilies)
 {
     /* Create image object */
     VkImageCreateInfo createInfo;
@@ -87,11 +89,23 @@ void VKImageWrapper::CreateVkImage(
         createInfo.samples                  = samplesFlags;
         createInfo.tiling                   = VK_IMAGE_TILING_OPTIMAL;
         createInfo.usage                    = usageFlags;
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE; // only used by graphics queue
+        createInfo.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED;
+    }
+
+    /* Share image concurrently if it is accessed by more than one queue family, so no ownership transfers are required */
+    if (numQueueFamilies > 1)
+    {
+        createInfo.sharingMode              = VK_SHARING_MODE_CONCURRENT;
+        createInfo.queueFamilyIndexCount    = numQueueFamilies;
+        createInfo.pQueueFamilyIndices      = queueFamilies;
+    }
+    else
+    {
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
         createInfo.queueFamilyIndexCount    = 0;
         createInfo.pQueueFamilyIndices      = nullptr;
-        createInfo.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED;
     }
+
     VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan image");
 }
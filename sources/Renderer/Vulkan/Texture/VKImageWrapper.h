@@ -44,7 +44,9 @@ class VKImageWrapper
             std::uint32_t           numArrayLayers,
             VkImageCreateFlags      createFlags,
             VkSampleCountFlagBits   samplesFlags,
-            VkImageUsageFlags       usageFlags
+            VkImageUsageFlags       usageFlags,
+            std::uint32_t           numQueueFamilies    = 0,
+            const std::uint32_t*    queueFamilies       = nullptr
         );
 
         void ReleaseVkImage();
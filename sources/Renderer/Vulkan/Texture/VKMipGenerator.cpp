@@ -0,0 +1,376 @@
+/*
+ * VKMipGenerator.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKMipGenerator.h"
+#include "VKTexture.h"
+#include "../VKCore.h"
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+VKMipGenerator::VKMipGenerator(const VKPtr<VkDevice>& device, VkPhysicalDevice physicalDevice, VkCommandPool commandPool) :
+    device_         { device         },
+    physicalDevice_ { physicalDevice },
+    commandPool_    { commandPool    }
+{
+}
+
+VKMipGenerator::~VKMipGenerator()
+{
+    /* Command buffers are freed after the device has become idle, so none of them is in flight anymore */
+    for (const auto& submitted : submittedCommandBuffers_)
+        freeCommandBuffers_.push_back(submitted.commandBuffer);
+    if (recordCommandBuffer_ != VK_NULL_HANDLE)
+        freeCommandBuffers_.push_back(recordCommandBuffer_);
+    if (!freeCommandBuffers_.empty())
+        vkFreeCommandBuffers(device_, commandPool_, static_cast<std::uint32_t>(freeCommandBuffers_.size()), freeCommandBuffers_.data());
+}
+
+void VKMipGenerator::RecordGenerateMips(
+    VkCommandBuffer commandBuffer,
+    VKTexture&      textureVK,
+    std::uint32_t   baseMipLevel,
+    std::uint32_t   numMipLevels,
+    std::uint32_t   baseArrayLayer,
+    std::uint32_t   numArrayLayers)
+{
+    /* A single MIP level has nothing to generate */
+    if (numMipLevels < 2 || numArrayLayers == 0)
+        return;
+
+    auto image  = textureVK.GetVkImage();
+    auto filter = GetBlitFilter(textureVK.GetVkFormat());
+
+    const auto lastMipLevel = baseMipLevel + numMipLevels - 1;
+
+    /* Initialize image memory barriers for the base MIP level and the MIP levels to be generated */
+    VkImageMemoryBarrier barriers[2];
+
+    for (auto& barrier : barriers)
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = image;
+        barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseArrayLayer = baseArrayLayer;
+        barrier.subresourceRange.layerCount     = numArrayLayers;
+    }
+
+    /* Transition base MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL without discarding its content */
+    barriers[0].srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
+    barriers[0].dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+    barriers[0].oldLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[0].newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].subresourceRange.baseMipLevel   = baseMipLevel;
+    barriers[0].subresourceRange.levelCount     = 1;
+
+    /* Transition all other MIP levels to VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL (their content is overwritten anyway) */
+    barriers[1].srcAccessMask                   = 0;
+    barriers[1].dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+    barriers[1].newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[1].subresourceRange.baseMipLevel   = baseMipLevel + 1;
+    barriers[1].subresourceRange.levelCount     = numMipLevels - 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        2, barriers
+    );
+
+    /* Blit each MIP level from its previous MIP level for all array layers at once */
+    auto& barrier = barriers[0];
+
+    barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barrier.subresourceRange.levelCount     = 1;
+
+    auto extent = textureVK.GetVkExtent();
+    auto currExtent = VkExtent3D
+    {
+        std::max(1u, extent.width  >> baseMipLevel),
+        std::max(1u, extent.height >> baseMipLevel),
+        std::max(1u, extent.depth  >> baseMipLevel)
+    };
+
+    for (auto mipLevel = baseMipLevel + 1; mipLevel <= lastMipLevel; ++mipLevel)
+    {
+        /* Determine extent of next MIP level */
+        VkExtent3D nextExtent;
+        {
+            nextExtent.width    = std::max(1u, currExtent.width  / 2);
+            nextExtent.height   = std::max(1u, currExtent.height / 2);
+            nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
+        }
+
+        /* Blit previous MIP level into next MIP level (with smaller extent) */
+        VkImageBlit blit;
+        {
+            blit.srcSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.mipLevel        = mipLevel - 1;
+            blit.srcSubresource.baseArrayLayer  = baseArrayLayer;
+            blit.srcSubresource.layerCount      = numArrayLayers;
+            blit.srcOffsets[0]                  = { 0, 0, 0 };
+            blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
+            blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
+            blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
+            blit.dstSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.dstSubresource.mipLevel        = mipLevel;
+            blit.dstSubresource.baseArrayLayer  = baseArrayLayer;
+            blit.dstSubresource.layerCount      = numArrayLayers;
+            blit.dstOffsets[0]                  = { 0, 0, 0 };
+            blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
+            blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
+            blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
+        }
+        vkCmdBlitImage(
+            commandBuffer,
+            image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1, &blit,
+            filter
+        );
+
+        /* Transition generated MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, so it can be read by the next blit */
+        if (mipLevel < lastMipLevel)
+        {
+            barrier.subresourceRange.baseMipLevel = mipLevel;
+            vkCmdPipelineBarrier(
+                commandBuffer,
+                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                0, nullptr,
+                0, nullptr,
+                1, &barrier
+            );
+        }
+
+        currExtent = nextExtent;
+    }
+
+    /* Transition all source MIP levels and the last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+    barriers[0].srcAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+    barriers[0].dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+    barriers[0].oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[0].subresourceRange.baseMipLevel   = baseMipLevel;
+    barriers[0].subresourceRange.levelCount     = numMipLevels - 1;
+
+    barriers[1].srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+    barriers[1].oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[1].newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[1].subresourceRange.baseMipLevel   = lastMipLevel;
+    barriers[1].subresourceRange.levelCount     = 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        2, barriers
+    );
+}
+
+void VKMipGenerator::Enqueue(
+    VKTexture&      textureVK,
+    std::uint32_t   baseMipLevel,
+    std::uint32_t   numMipLevels,
+    std::uint32_t   baseArrayLayer,
+    std::uint32_t   numArrayLayers)
+{
+    if (numMipLevels < 2 || numArrayLayers == 0)
+        return;
+
+    /* Validate image format now, so no exception can be thrown while the command buffer is being recorded */
+    GetBlitFilter(textureVK.GetVkFormat());
+
+    /* Ignore duplicate requests, e.g. when the same texture is updated several times per frame */
+    for (const auto& request : pendingRequests_)
+    {
+        if ( request.texture        == &textureVK      &&
+             request.baseMipLevel   == baseMipLevel    &&
+             request.numMipLevels   == numMipLevels    &&
+             request.baseArrayLayer == baseArrayLayer  &&
+             request.numArrayLayers == numArrayLayers )
+        {
+            return;
+        }
+    }
+
+    pendingRequests_.push_back({ &textureVK, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers });
+}
+
+void VKMipGenerator::Discard(const VKTexture& textureVK)
+{
+    pendingRequests_.erase(
+        std::remove_if(
+            pendingRequests_.begin(),
+            pendingRequests_.end(),
+            [&textureVK](const Request& request)
+            {
+                return (request.texture == &textureVK);
+            }
+        ),
+        pendingRequests_.end()
+    );
+}
+
+VkCommandBuffer VKMipGenerator::RecordPendingRequests()
+{
+    if (pendingRequests_.empty())
+        return VK_NULL_HANDLE;
+
+    /* Keep the command buffer of a failed submission, since it has never been in flight */
+    if (recordCommandBuffer_ == VK_NULL_HANDLE)
+        recordCommandBuffer_ = AcquireCommandBuffer();
+
+    /* Record all pending requests into a single command buffer */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    auto result = vkBeginCommandBuffer(recordCommandBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin recording Vulkan command buffer for MIP-map generation");
+
+    for (const auto& request : pendingRequests_)
+    {
+        RecordGenerateMips(
+            recordCommandBuffer_,
+            *request.texture,
+            request.baseMipLevel,
+            request.numMipLevels,
+            request.baseArrayLayer,
+            request.numArrayLayers
+        );
+    }
+
+    result = vkEndCommandBuffer(recordCommandBuffer_);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for MIP-map generation");
+
+    return recordCommandBuffer_;
+}
+
+void VKMipGenerator::CommitPendingRequests(VkFence fence)
+{
+    if (recordCommandBuffer_ != VK_NULL_HANDLE)
+    {
+        submittedCommandBuffers_.push_back({ recordCommandBuffer_, fence });
+        recordCommandBuffer_ = VK_NULL_HANDLE;
+    }
+    pendingRequests_.clear();
+}
+
+void VKMipGenerator::TrackSubmitFence(VkFence fence)
+{
+    /* A fence is only signaled after all previous submissions to the same queue have been completed */
+    for (auto& submitted : submittedCommandBuffers_)
+    {
+        if (submitted.fence == VK_NULL_HANDLE)
+            submitted.fence = fence;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Returns true if the specified format has a depth or stencil aspect
+static bool IsVkDepthStencilFormat(VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_D16_UNORM:
+        case VK_FORMAT_X8_D24_UNORM_PACK32:
+        case VK_FORMAT_D32_SFLOAT:
+        case VK_FORMAT_S8_UINT:
+        case VK_FORMAT_D16_UNORM_S8_UINT:
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+VkFilter VKMipGenerator::GetBlitFilter(VkFormat format) const
+{
+    /* Barriers and blits are recorded for the color aspect only */
+    if (IsVkDepthStencilFormat(format))
+        throw std::runtime_error("cannot generate MIP-maps for Vulkan image with depth-stencil format");
+
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(physicalDevice_, format, &formatProperties);
+
+    const auto features = formatProperties.optimalTilingFeatures;
+
+    if ((features & VK_FORMAT_FEATURE_BLIT_SRC_BIT) == 0 || (features & VK_FORMAT_FEATURE_BLIT_DST_BIT) == 0)
+        throw std::runtime_error("cannot generate MIP-maps for Vulkan image format that does not support blit operations");
+
+    /* Fall back to nearest filtering for formats without linear filter support (e.g. integer formats) */
+    if ((features & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0)
+        return VK_FILTER_LINEAR;
+    else
+        return VK_FILTER_NEAREST;
+}
+
+VkCommandBuffer VKMipGenerator::AcquireCommandBuffer()
+{
+    /* Reuse command buffers whose submission has been completed */
+    for (auto it = submittedCommandBuffers_.begin(); it != submittedCommandBuffers_.end();)
+    {
+        if (it->fence != VK_NULL_HANDLE && vkGetFenceStatus(device_, it->fence) == VK_SUCCESS)
+        {
+            freeCommandBuffers_.push_back(it->commandBuffer);
+            it = submittedCommandBuffers_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    if (!freeCommandBuffers_.empty())
+    {
+        auto commandBuffer = freeCommandBuffers_.back();
+        freeCommandBuffers_.pop_back();
+        return commandBuffer;
+    }
+
+    /* Allocate new command buffer for batched MIP-map generation */
+    VkCommandBufferAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.commandPool           = commandPool_;
+        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount    = 1;
+    }
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    auto result = vkAllocateCommandBuffers(device_, &allocInfo, &commandBuffer);
+    VKThrowIfFailed(result, "failed to allocate Vulkan command buffer for MIP-map generation");
+
+    return commandBuffer;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,133 @@
+/*
+ * VKMipGenerator.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_MIP_GENERATOR_H
+#define LLGL_VK_MIP_GENERATOR_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKTexture;
+
+/*
+Records MIP-map generation for any number of textures into a single command buffer, which is submitted by the command queue together with its next submission.
+All textures are expected to be in the VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL layout before and after the generation.
+*/
+class VKMipGenerator
+{
+
+    public:
+
+        VKMipGenerator(const VKPtr<VkDevice>& device, VkPhysicalDevice physicalDevice, VkCommandPool commandPool);
+
+        // Frees all command buffers. The device must be idle at this point.
+        ~VKMipGenerator();
+
+        VKMipGenerator(const VKMipGenerator&) = delete;
+        VKMipGenerator& operator = (const VKMipGenerator&) = delete;
+
+        // Records the commands to generate the specified range of MIP-maps into the specified command buffer.
+        void RecordGenerateMips(
+            VkCommandBuffer commandBuffer,
+            VKTexture&      textureVK,
+            std::uint32_t   baseMipLevel,
+            std::uint32_t   numMipLevels,
+            std::uint32_t   baseArrayLayer,
+            std::uint32_t   numArrayLayers
+        );
+
+        // Appends the specified range of MIP-maps to the list of pending requests.
+        void Enqueue(
+            VKTexture&      textureVK,
+            std::uint32_t   baseMipLevel,
+            std::uint32_t   numMipLevels,
+            std::uint32_t   baseArrayLayer,
+            std::uint32_t   numArrayLayers
+        );
+
+        // Removes all pending requests for the specified texture, e.g. when the texture is released.
+        void Discard(const VKTexture& textureVK);
+
+        /*
+        Records all pending requests into a command buffer that is not in flight and returns it, or returns VK_NULL_HANDLE if there are no pending requests.
+        The requests remain pending until CommitPendingRequests is called, so a failed submission can be recorded again.
+        */
+        VkCommandBuffer RecordPendingRequests();
+
+        /*
+        Clears the pending requests after their command buffer has been submitted successfully.
+        The fence must be signaled once that submission has been completed, or VK_NULL_HANDLE if it is not known yet (see TrackSubmitFence).
+        */
+        void CommitPendingRequests(VkFence fence);
+
+        // Specifies a fence of a later submission to the same queue for all submitted command buffers whose completion is not tracked by a fence yet.
+        void TrackSubmitFence(VkFence fence);
+
+        // Returns true if there are any pending requests.
+        inline bool HasPending() const
+        {
+            return !pendingRequests_.empty();
+        }
+
+    private:
+
+        struct Request
+        {
+            VKTexture*      texture;
+            std::uint32_t   baseMipLevel;
+            std::uint32_t   numMipLevels;
+            std::uint32_t   baseArrayLayer;
+            std::uint32_t   numArrayLayers;
+        };
+
+        // Returns the blit filter for the specified format, or throws an exception for depth-stencil formats and formats that do not support blits.
+        VkFilter GetBlitFilter(VkFormat format) const;
+
+        // Returns a command buffer whose previous submission has been completed, or allocates a new one.
+        VkCommandBuffer AcquireCommandBuffer();
+
+    private:
+
+        struct SubmittedCommandBuffer
+        {
+            VkCommandBuffer commandBuffer;
+            VkFence         fence;
+        };
+
+        const VKPtr<VkDevice>&              device_;
+        VkPhysicalDevice                    physicalDevice_         = VK_NULL_HANDLE;
+        VkCommandPool                       commandPool_            = VK_NULL_HANDLE;
+
+        /*
+        Command buffers are submitted with the fence of the command queue submission they belong to, so no extra submission is required.
+        They can only be recorded again once that fence has been signaled.
+        */
+        VkCommandBuffer                     recordCommandBuffer_    = VK_NULL_HANDLE;
+        std::vector<SubmittedCommandBuffer> submittedCommandBuffers_;
+        std::vector<VkCommandBuffer>        freeCommandBuffers_;
+
+        std::vector<Request>                pendingRequests_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -17,14 +17,17 @@ namespace LLGL
 
 
 VKTexture::VKTexture(
-    const VKPtr<VkDevice>& device, VKDeviceMemoryManager& deviceMemoryMngr, const TextureDescriptor& desc) :
+    const VKPtr<VkDevice>&              device,
+    VKDeviceMemoryManager&              deviceMemoryMngr,
+    const TextureDescriptor&            desc,
+    const std::vector<std::uint32_t>&   queueFamilies) :
         Texture       { desc.type                  },
         imageWrapper_ { device                     },
         imageView_    { device, vkDestroyImageView },
         format_       { VKTypes::Map(desc.format)  }
 {
     /* Create Vulkan image and allocate memory region */
-    CreateImage(device, desc);
+    CreateImage(device, desc, queueFamilies);
     imageWrapper_.AllocateMemoryRegion(deviceMemoryMngr);
 }
 
@@ -264,7 +267,7 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     return usageFlags;
 }
 
-void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
+void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc, const std::vector<std::uint32_t>& queueFamilies)
 {
     /* Setup texture parameters */
     auto imageType  = GetVkImageType(desc.type);
@@ -283,7 +286,9 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
         numArrayLayers_,
         GetVkImageCreateFlags(desc),
         GetVkImageSampleCountFlags(desc),
-        GetVkImageUsageFlags(desc)
+        GetVkImageUsageFlags(desc),
+        static_cast<std::uint32_t>(queueFamilies.size()),
+        queueFamilies.data()
     );
 }
 
@@ -13,6 +13,7 @@
 #include "VKImageWrapper.h"
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include <vector>
 #include <cstdint>
 
 
@@ -31,7 +32,8 @@ class VKTexture final : public Texture
         VKTexture(
             const VKPtr<VkDevice>& device,
             VKDeviceMemoryManager& deviceMemoryMngr,
-            const TextureDescriptor& desc
+            const TextureDescriptor& desc,
+            const std::vector<std::uint32_t>& queueFamilies
         );
 
         Extent3D QueryMipExtent(std::uint32_t mipLevel) const override;
@@ -84,6 +86,21 @@ class VKTexture final : public Texture
             return numArrayLayers_;
         }
 
+        /*
+        Sets the layout the image is left in by all commands of the render system, e.g. after the initial upload.
+        Commands that need another layout temporarily must transition the image back to this layout.
+        */
+        inline void SetVkImageLayout(VkImageLayout layout)
+        {
+            imageLayout_ = layout;
+        }
+
+        // Returns the tracked image layout, or VK_IMAGE_LAYOUT_UNDEFINED if the image has no content yet.
+        inline VkImageLayout GetVkImageLayout() const
+        {
+            return imageLayout_;
+        }
+
         // Returns the region of the hardware device memory.
         inline VKDeviceMemoryRegion* GetMemoryRegion() const
         {
@@ -92,7 +109,7 @@ class VKTexture final : public Texture
 
     private:
 
-        void CreateImage(VkDevice device, const TextureDescriptor& desc);
+        void CreateImage(VkDevice device, const TextureDescriptor& desc, const std::vector<std::uint32_t>& queueFamilies);
 
         VKImageWrapper          imageWrapper_;
         VKPtr<VkImageView>      imageView_;
@@ -101,6 +118,7 @@ class VKTexture final : public Texture
         VkExtent3D              extent_;
         std::uint32_t           numMipLevels_   = 0;
         std::uint32_t           numArrayLayers_ = 0;
+        VkImageLayout           imageLayout_    = VK_IMAGE_LAYOUT_UNDEFINED;
 
 };
 
@@ -20,6 +20,8 @@
 #include "Buffer/VKIndexBuffer.h"
 #include "../CheckedCast.h"
 #include "../StaticLimits.h"
+#include "../../Core/Helper.h"
+#include <LLGL/CommandQueueFlags.h>
 #include <cstddef>
 
 
@@ -29,21 +31,46 @@ namespace LLGL
 
 static const std::uint32_t g_maxNumViewportsPerBatch = 16;
 
+// Returns the queue family for the specified type of command queue (see VKRenderSystem::GetDedicatedCommandQueue).
+static std::uint32_t GetQueueFamilyForType(const QueueFamilyIndices& queueFamilyIndices, const CommandQueueType type)
+{
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (queueFamilyIndices.computeFamily != QueueFamilyIndices::invalidIndex)
+                return queueFamilyIndices.computeFamily;
+            break;
+        case CommandQueueType::Transfer:
+            if (queueFamilyIndices.transferFamily != QueueFamilyIndices::invalidIndex)
+                return queueFamilyIndices.transferFamily;
+            break;
+        default:
+            break;
+    }
+    return queueFamilyIndices.graphicsFamily;
+}
+
 VKCommandBuffer::VKCommandBuffer(
     const VKPtr<VkDevice>&          device,
-    VkQueue                         graphicsQueue,
     const QueueFamilyIndices&       queueFamilyIndices,
     const CommandBufferDescriptor&  desc) :
-        device_             { device                           },
-        commandPool_        { device, vkDestroyCommandPool     },
-        queuePresentFamily_ { queueFamilyIndices.presentFamily }
+        device_                 { device                                                },
+        commandPool_            { device, vkDestroyCommandPool                          },
+        secondary_              { ((desc.flags & CommandBufferFlags::Secondary) != 0)   },
+        queuePresentFamily_     { queueFamilyIndices.presentFamily                      },
+        pendingPipelinePolicy_  { desc.pendingPipelinePolicy                            }
 {
     std::size_t bufferCount = std::max(1u, desc.numNativeBuffers);
 
-    /* Create native command buffer objects */
-    CreateCommandPool(queueFamilyIndices.graphicsFamily);
+    /*
+    Create native command buffer objects.
+    Each command buffer has its own command pool, so different command buffers can be recorded on different threads without synchronization.
+    */
+    CreateCommandPool(GetQueueFamilyForType(queueFamilyIndices, desc.queueType));
     CreateCommandBuffers(bufferCount);
-    CreateRecordingFences(graphicsQueue, bufferCount);
+
+    /* Command buffers have not been submitted yet, so there is nothing to wait for */
+    recordingFenceList_.resize(bufferCount, VK_NULL_HANDLE);
 
     /* Acquire first native command buffer */
     AcquireNextBuffer();
@@ -364,33 +391,17 @@ void VKCommandBuffer::BeginRenderPass(
     std::uint32_t       numClearValues,
     const ClearValue*   clearValues)
 {
-    if (renderTarget.IsRenderContext())
-    {
-        /* Get Vulkan render context object */
-        auto& renderContextVK = LLGL_CAST(VKRenderContext&, renderTarget);
+    /* Store information about framebuffer attachments */
+    StoreFramebufferAttributes(renderTarget);
 
-        /* Store information about framebuffer attachments */
-        renderPass_             = renderContextVK.GetSwapChainRenderPass().GetVkRenderPass();
-        framebuffer_            = renderContextVK.GetVkFramebuffer();
-        framebufferExtent_      = renderContextVK.GetVkExtent();
-        numColorAttachments_    = renderContextVK.GetNumColorAttachments();
-        hasDSVAttachment_       = (renderContextVK.HasDepthAttachment() || renderContextVK.HasStencilAttachment());
-    }
-    else
+    /* Keep track of render contexts, so the queue submission can be synchronized with the swap-chain */
+    if (renderTarget.IsRenderContext())
     {
-        /* Get Vulkan render target object and store its extent for subsequent commands */
-        auto& renderTargetVK = LLGL_CAST(VKRenderTarget&, renderTarget);
-
-        /* Store information about framebuffer attachments */
-        renderPass_             = renderTargetVK.GetVkRenderPass();
-        framebuffer_            = renderTargetVK.GetVkFramebuffer();
-        framebufferExtent_      = renderTargetVK.GetVkExtent();
-        numColorAttachments_    = renderTargetVK.GetNumColorAttachments();
-        hasDSVAttachment_       = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
+        auto renderContextVK = LLGL_CAST(VKRenderContext*, &renderTarget);
+        if (!Contains(renderContexts_, renderContextVK))
+            renderContexts_.push_back(renderContextVK);
     }
 
-    scissorRectInvalidated_ = true;
-
     /* Declare array or clear values */
     VkClearValue clearValuesVK[LLGL_MAX_NUM_ATTACHMENTS];
     std::uint32_t numClearValuesVK = 0;
@@ -453,7 +464,7 @@ void VKCommandBuffer::BeginRenderPass(
         beginInfo.clearValueCount   = numClearValuesVK;
         beginInfo.pClearValues      = clearValuesVK;
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
 }
 
 void VKCommandBuffer::EndRenderPass()
@@ -473,6 +484,18 @@ void VKCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 {
     auto& graphicsPipelineVK = LLGL_CAST(VKGraphicsPipeline&, graphicsPipeline);
 
+    /* Skip all draw commands until the next pipeline is bound, or wait until the pipeline is ready */
+    if (!graphicsPipelineVK.IsReady())
+    {
+        if (pendingPipelinePolicy_ == PendingPipelinePolicy::Skip)
+        {
+            skipDrawCommands_ = true;
+            return;
+        }
+        graphicsPipelineVK.WaitReady();
+    }
+    skipDrawCommands_ = false;
+
     /* Bind graphics pipeline */
     vkCmdBindPipeline(commandBuffer_, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipelineVK.GetVkPipeline());
 
@@ -496,6 +519,19 @@ void VKCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 void VKCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
     auto& computePipelineVK = LLGL_CAST(VKComputePipeline&, computePipeline);
+
+    /* Skip all dispatch commands until the next pipeline is bound, or wait until the pipeline is ready */
+    if (!computePipelineVK.IsReady())
+    {
+        if (pendingPipelinePolicy_ == PendingPipelinePolicy::Skip)
+        {
+            skipDispatchCommands_ = true;
+            return;
+        }
+        computePipelineVK.WaitReady();
+    }
+    skipDispatchCommands_ = false;
+
     vkCmdBindPipeline(commandBuffer_, VK_PIPELINE_BIND_POINT_COMPUTE, computePipelineVK.GetVkPipeline());
 }
 
@@ -590,41 +626,65 @@ void VKCommandBuffer::EndRenderCondition()
 
 void VKCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDraw(commandBuffer_, numVertices, 1, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDrawIndexed(commandBuffer_, numIndices, 1, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, 0);
 }
 
 void VKCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDraw(commandBuffer_, numVertices, numInstances, firstVertex, firstInstance);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, 0, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, 0);
 }
 
 void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    if (skipDrawCommands_)
+        return;
+
     vkCmdDrawIndexed(commandBuffer_, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
@@ -632,16 +692,128 @@ void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
 
 void VKCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
 {
+    if (skipDispatchCommands_)
+        return;
+
     vkCmdDispatch(commandBuffer_, groupSizeX, groupSizeY, groupSizeZ);
 }
 
+/* ----- Secondary Command Buffers ----- */
+
+void VKCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
+{
+    auto& secondaryCommandBufferVK = LLGL_CAST(VKCommandBuffer&, secondaryCommandBuffer);
+
+    VkCommandBuffer commandBuffers[] = { secondaryCommandBufferVK.GetVkCommandBuffer() };
+
+    vkCmdExecuteCommands(commandBuffer_, 1, commandBuffers);
+}
+
 /* ----- Extended functions ----- */
 
-void VKCommandBuffer::AcquireNextBuffer()
+static VkCommandBufferUsageFlags GetVkCommandBufferUsageFlags(long flags)
 {
-    commandBufferIndex_ = (commandBufferIndex_ + 1) % commandBufferList_.size();
-    commandBuffer_      = commandBufferList_[commandBufferIndex_];
-    recordingFence_     = recordingFenceList_[commandBufferIndex_].Get();
+    VkCommandBufferUsageFlags usageFlags = 0;
+
+    if ((flags & RecordingFlags::OneTimeSubmit) != 0)
+        usageFlags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    else
+        usageFlags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+
+    return usageFlags;
+}
+
+void VKCommandBuffer::BeginRecording(long flags)
+{
+    /* Use next internal VkCommandBuffer object to reduce latency */
+    AcquireNextBuffer();
+
+    recordingFlags_     = flags;
+    subpassContents_    = ((flags & RecordingFlags::SecondaryContents) != 0 ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
+    renderContexts_.clear();
+
+    /* Begin recording of current command buffer */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = GetVkCommandBufferUsageFlags(flags);
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    auto result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
+}
+
+void VKCommandBuffer::BeginSecondaryRecording(RenderTarget& renderTarget, const RenderPass* renderPass, long flags)
+{
+    /* Use next internal VkCommandBuffer object to reduce latency */
+    AcquireNextBuffer();
+
+    recordingFlags_     = flags;
+    subpassContents_    = VK_SUBPASS_CONTENTS_INLINE;
+
+    /* Store information about framebuffer attachments, which are used for the clear commands */
+    StoreFramebufferAttributes(renderTarget);
+
+    if (renderPass != nullptr)
+    {
+        auto renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
+        renderPass_ = renderPassVK->GetVkRenderPass();
+    }
+
+    /* Inherit render pass state from the primary command buffer */
+    VkCommandBufferInheritanceInfo inheritanceInfo;
+    {
+        inheritanceInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.pNext                   = nullptr;
+        inheritanceInfo.renderPass              = renderPass_;
+        inheritanceInfo.subpass                 = 0;
+
+        /* The framebuffer of a render context changes with each swap-chain image, so it can only be specified for render targets */
+        if (renderTarget.IsRenderContext())
+            inheritanceInfo.framebuffer         = VK_NULL_HANDLE;
+        else
+            inheritanceInfo.framebuffer         = framebuffer_;
+
+        inheritanceInfo.occlusionQueryEnable    = VK_FALSE;
+        inheritanceInfo.queryFlags              = 0;
+        inheritanceInfo.pipelineStatistics      = 0;
+    }
+
+    /* Begin recording of current command buffer */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = (GetVkCommandBufferUsageFlags(flags) | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT);
+        beginInfo.pInheritanceInfo  = (&inheritanceInfo);
+    }
+    auto result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin secondary Vulkan command buffer");
+}
+
+void VKCommandBuffer::EndRecording()
+{
+    /* End recording of current command buffer */
+    auto result = vkEndCommandBuffer(commandBuffer_);
+    VKThrowIfFailed(result, "failed to end Vulkan command buffer");
+
+    /* Pipeline bindings do not carry over to the next recording */
+    skipDrawCommands_       = false;
+    skipDispatchCommands_   = false;
+
+    if (secondary_)
+    {
+        /* Reset inherited render pass and framebuffer attributes */
+        renderPass_     = VK_NULL_HANDLE;
+        framebuffer_    = VK_NULL_HANDLE;
+    }
+}
+
+void VKCommandBuffer::SetQueueSubmitFence(VkFence fence)
+{
+    recordingFenceList_[commandBufferIndex_]    = fence;
+    recordingFence_                             = fence;
 }
 
 
@@ -673,37 +845,52 @@ void VKCommandBuffer::CreateCommandBuffers(std::size_t bufferCount)
         allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.pNext                 = nullptr;
         allocInfo.commandPool           = commandPool_;
-        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.level                 = (secondary_ ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY);
         allocInfo.commandBufferCount    = static_cast<std::uint32_t>(bufferCount);
     }
     auto result = vkAllocateCommandBuffers(device_, &allocInfo, commandBufferList_.data());
     VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
 }
 
-void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::size_t numFences)
+void VKCommandBuffer::AcquireNextBuffer()
 {
-    recordingFenceList_.reserve(numFences);
+    commandBufferIndex_ = (commandBufferIndex_ + 1) % commandBufferList_.size();
+    commandBuffer_      = commandBufferList_[commandBufferIndex_];
+    recordingFence_     = recordingFenceList_[commandBufferIndex_];
+
+    /* Wait until the GPU has completed the previous submission of this command buffer */
+    if (recordingFence_ != VK_NULL_HANDLE)
+        vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
+}
 
-    VkFenceCreateInfo createInfo;
+void VKCommandBuffer::StoreFramebufferAttributes(RenderTarget& renderTarget)
+{
+    if (renderTarget.IsRenderContext())
     {
-        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        createInfo.pNext = nullptr;
-        createInfo.flags = 0;
-    }
+        /* Get Vulkan render context object */
+        auto& renderContextVK = LLGL_CAST(VKRenderContext&, renderTarget);
 
-    for (std::size_t i = 0; i < numFences; ++i)
+        /* Store information about framebuffer attachments */
+        renderPass_             = renderContextVK.GetSwapChainRenderPass().GetVkRenderPass();
+        framebuffer_            = renderContextVK.GetVkFramebuffer();
+        framebufferExtent_      = renderContextVK.GetVkExtent();
+        numColorAttachments_    = renderContextVK.GetNumColorAttachments();
+        hasDSVAttachment_       = (renderContextVK.HasDepthAttachment() || renderContextVK.HasStencilAttachment());
+    }
+    else
     {
-        VKPtr<VkFence> fence { device_, vkDestroyFence };
-        {
-            /* Create fence for command buffer recording */
-            auto result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
-            VKThrowIfFailed(result, "failed to create Vulkan fence");
+        /* Get Vulkan render target object and store its extent for subsequent commands */
+        auto& renderTargetVK = LLGL_CAST(VKRenderTarget&, renderTarget);
 
-            /* Initial fence signal */
-            vkQueueSubmit(graphicsQueue, 0, nullptr, fence);
-        }
-        recordingFenceList_.emplace_back(std::move(fence));
+        /* Store information about framebuffer attachments */
+        renderPass_             = renderTargetVK.GetVkRenderPass();
+        framebuffer_            = renderTargetVK.GetVkFramebuffer();
+        framebufferExtent_      = renderTargetVK.GetVkExtent();
+        numColorAttachments_    = renderTargetVK.GetNumColorAttachments();
+        hasDSVAttachment_       = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
     }
+
+    scissorRectInvalidated_ = true;
 }
 
 void VKCommandBuffer::ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments)
@@ -22,6 +22,7 @@ namespace LLGL
 
 
 class VKResourceHeap;
+class VKRenderContext;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -32,7 +33,6 @@ class VKCommandBuffer final : public CommandBuffer
 
         VKCommandBuffer(
             const VKPtr<VkDevice>&          device,
-            VkQueue                         graphicsQueue,
             const QueueFamilyIndices&       queueFamilyIndices,
             const CommandBufferDescriptor&  desc
         );
@@ -124,10 +124,23 @@ class VKCommandBuffer final : public CommandBuffer
 
         void Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ) override;
 
+        /* ----- Secondary Command Buffers ----- */
+
+        void Execute(CommandBuffer& secondaryCommandBuffer) override;
+
         /* ----- Extended functions ----- */
 
-        // Acquires the next native VkCommandBuffer object.
-        void AcquireNextBuffer();
+        // Acquires the next native VkCommandBuffer object, waits until it is no longer in use, and begins its recording.
+        void BeginRecording(long flags);
+
+        // Same as BeginRecording but for a secondary command buffer, which continues the render pass of the specified render target.
+        void BeginSecondaryRecording(RenderTarget& renderTarget, const RenderPass* renderPass, long flags);
+
+        // Ends recording of the current native VkCommandBuffer object.
+        void EndRecording();
+
+        // Sets the fence the current native VkCommandBuffer object has been submitted with. This fence is waited for before the next recording.
+        void SetQueueSubmitFence(VkFence fence);
 
         // Returns the native VkCommandBuffer object.
         inline VkCommandBuffer GetVkCommandBuffer() const
@@ -135,17 +148,31 @@ class VKCommandBuffer final : public CommandBuffer
             return commandBuffer_;
         }
 
-        // Returns the fence used to submit the command buffer to the queue.
-        inline VkFence GetQueueSubmitFence() const
+        // Returns the flags of the current recording (see RecordingFlags).
+        inline long GetRecordingFlags() const
+        {
+            return recordingFlags_;
+        }
+
+        // Returns true if this is a secondary command buffer (see CommandBufferFlags::Secondary).
+        inline bool IsSecondary() const
+        {
+            return secondary_;
+        }
+
+        // Returns the list of render contexts this command buffer renders into during the current recording.
+        inline const std::vector<VKRenderContext*>& GetRenderContexts() const
         {
-            return recordingFence_;
+            return renderContexts_;
         }
 
     private:
 
         void CreateCommandPool(std::uint32_t queueFamilyIndex);
         void CreateCommandBuffers(std::size_t bufferCount);
-        void CreateRecordingFences(VkQueue graphicsQueue, std::size_t numFences);
+
+        void AcquireNextBuffer();
+        void StoreFramebufferAttributes(RenderTarget& renderTarget);
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
@@ -166,9 +193,13 @@ class VKCommandBuffer final : public CommandBuffer
         std::vector<VkCommandBuffer>    commandBufferList_;
         VkCommandBuffer                 commandBuffer_;
         std::size_t                     commandBufferIndex_         = 0;
+        bool                            secondary_                  = false;
 
-        std::vector<VKPtr<VkFence>>     recordingFenceList_;
-        VkFence                         recordingFence_;
+        // Fences of the last queue submission for each native command buffer (owned by VKCommandQueue).
+        std::vector<VkFence>            recordingFenceList_;
+        VkFence                         recordingFence_             = VK_NULL_HANDLE;
+        long                            recordingFlags_             = 0;
+        VkSubpassContents               subpassContents_            = VK_SUBPASS_CONTENTS_INLINE;
 
         VkClearColorValue               clearColor_                 = { 0.0f, 0.0f, 0.0f, 0.0f };
         VkClearDepthStencilValue        clearDepthStencil_          = { 1.0f, 0 };
@@ -187,9 +218,15 @@ class VKCommandBuffer final : public CommandBuffer
 
         std::uint32_t                   queuePresentFamily_         = 0;
 
+        std::vector<VKRenderContext*>   renderContexts_;
+
         bool                            scissorEnabled_             = false;
         bool                            scissorRectInvalidated_     = true;
 
+        PendingPipelinePolicy           pendingPipelinePolicy_      = PendingPipelinePolicy::Wait;
+        bool                            skipDrawCommands_           = false;    // Set while a pending graphics pipeline has been skipped
+        bool                            skipDispatchCommands_       = false;    // Set while a pending compute pipeline has been skipped
+
 };
 
 
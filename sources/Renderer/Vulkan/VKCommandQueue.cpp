@@ -7,56 +7,45 @@
 
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
+#include "VKRenderContext.h"
 #include "RenderState/VKFence.h"
+#include "Texture/VKMipGenerator.h"
+#include "Ext/VKExtensions.h"
 #include "../CheckedCast.h"
+#include "../../Core/Helper.h"
+#include <stdexcept>
 
 
 namespace LLGL
 {
 
 
-VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue) :
-    device_        { device        },
-    graphicsQueue_ { graphicsQueue }
+/*
+Number of fences that are used to submit command buffers to the queue.
+This also limits the number of submissions that can be in flight at the same time.
+*/
+static const std::size_t g_numSubmitFences = 8;
+
+VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue queue, std::uint32_t queueFamily) :
+    device_         { device        },
+    queue_          { queue         },
+    queueFamily_    { queueFamily   }
 {
+    CreateSubmitFences(g_numSubmitFences);
 }
 
 /* ----- Command Buffers ----- */
 
-static VkCommandBufferUsageFlags GetVkCommandBufferUsageFlags(long flags)
+void VKCommandQueue::Begin(CommandBuffer& commandBuffer, long flags)
 {
-    VkCommandBufferUsageFlags usageFlags = 0;
-
-    if ((flags & RecordingFlags::OneTimeSubmit) != 0)
-        usageFlags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    else
-        usageFlags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
-
-    return usageFlags;
+    auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
+    commandBufferVK.BeginRecording(flags);
 }
 
-void VKCommandQueue::Begin(CommandBuffer& commandBuffer, long flags)
+void VKCommandQueue::BeginSecondary(CommandBuffer& commandBuffer, RenderTarget& renderTarget, const RenderPass* renderPass, long flags)
 {
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
-
-    /* Use next internal VkCommandBuffer object to reduce latency */
-    commandBufferVK.AcquireNextBuffer();
-
-    /* Wait for fence before recording */
-    VkFence fence = commandBufferVK.GetQueueSubmitFence();
-    vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
-    vkResetFences(device_, 1, &fence);
-
-    /* Begin recording of current command buffer */
-    VkCommandBufferBeginInfo beginInfo;
-    {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.flags             = GetVkCommandBufferUsageFlags(flags);
-        beginInfo.pInheritanceInfo  = nullptr;
-    }
-    auto result = vkBeginCommandBuffer(commandBufferVK.GetVkCommandBuffer(), &beginInfo);
-    VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
+    commandBufferVK.BeginSecondaryRecording(renderTarget, renderPass, flags);
 }
 
 void VKCommandQueue::End(CommandBuffer& commandBuffer)
@@ -64,34 +53,70 @@ void VKCommandQueue::End(CommandBuffer& commandBuffer)
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
 
     /* End recording of current command buffer */
-    auto result = vkEndCommandBuffer(commandBufferVK.GetVkCommandBuffer());
-    VKThrowIfFailed(result, "failed to end Vulkan command buffer");
+    commandBufferVK.EndRecording();
 
-    /* Immediately submit command buffer */
-    Submit(commandBuffer);
+    /* Immediately submit command buffer (secondary command buffers are only executed within primary command buffers) */
+    if (!commandBufferVK.IsSecondary() && (commandBufferVK.GetRecordingFlags() & RecordingFlags::DeferredSubmit) == 0)
+        Submit(commandBuffer);
 }
 
 void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
-    auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
+    CommandBuffer* commandBuffers[] = { &commandBuffer };
+    Submit(1, commandBuffers);
+}
+
+void VKCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    if (numCommandBuffers == 0)
+        return;
+
+    std::lock_guard<std::mutex> guard { mutex_ };
 
-    VkCommandBuffer commandBuffers[] = { commandBufferVK.GetVkCommandBuffer() };
+    submitCommandBuffers_.clear();
+    submitWaitSemaphores_.clear();
+    submitWaitStages_.clear();
+    submitSignalSemaphores_.clear();
+    submitRenderContexts_.clear();
+
+    /* Gather native command buffers and semaphores of all render contexts they render into */
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffers[i]);
+        if (commandBufferVK->IsSecondary())
+            throw std::runtime_error("cannot submit secondary command buffer to Vulkan command queue");
+        submitCommandBuffers_.push_back(commandBufferVK->GetVkCommandBuffer());
+        GatherRenderContextSemaphores(*commandBufferVK);
+    }
+
+    /* Submit all command buffers with a single fence */
+    auto fence = NextSubmitFence();
 
-    /* Submit command buffer to graphics queue */
     VkSubmitInfo submitInfo;
     {
         submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 0;
-        submitInfo.pWaitSemaphores      = nullptr;
-        submitInfo.pWaitDstStageMask    = 0;
-        submitInfo.commandBufferCount   = 1;
-        submitInfo.pCommandBuffers      = commandBuffers;
-        submitInfo.signalSemaphoreCount = 0;
-        submitInfo.pSignalSemaphores    = nullptr;
+        submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(submitWaitSemaphores_.size());
+        submitInfo.pWaitSemaphores      = submitWaitSemaphores_.data();
+        submitInfo.pWaitDstStageMask    = submitWaitStages_.data();
+        submitInfo.commandBufferCount   = static_cast<std::uint32_t>(submitCommandBuffers_.size());
+        submitInfo.pCommandBuffers      = submitCommandBuffers_.data();
+        submitInfo.signalSemaphoreCount = static_cast<std::uint32_t>(submitSignalSemaphores_.size());
+        submitInfo.pSignalSemaphores    = submitSignalSemaphores_.data();
     }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, commandBufferVK.GetQueueSubmitFence());
-    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+    auto result = QueueSubmit(1, &submitInfo, fence);
+    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan queue");
+
+    /* Command buffers must wait for this fence before they can be recorded again */
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffers[i]);
+        commandBufferVK->SetQueueSubmitFence(fence);
+    }
+
+    /* The current frame of each render context is in flight until this submission has been completed (no extra submission for a frame fence) */
+    for (auto renderContextVK : submitRenderContexts_)
+        renderContextVK->SetSubmitFence(fence);
 }
 
 /* ----- Fences ----- */
@@ -99,8 +124,19 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
+
+    /* Timeline fences are signaled with the next value */
+    if (fenceVK.IsTimeline())
+    {
+        Signal(fence, fenceVK.GetSignaledValue() + 1);
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
     fenceVK.Reset(device_);
-    vkQueueSubmit(graphicsQueue_, 0, nullptr, fenceVK.GetHardwareFence());
+    auto result = QueueSubmit(0, nullptr, fenceVK.GetHardwareFence());
+    VKThrowIfFailed(result, "failed to submit fence to Vulkan queue");
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -111,9 +147,421 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void VKCommandQueue::WaitIdle()
 {
-    vkQueueWaitIdle(graphicsQueue_);
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Deferred MIP-map generation belongs to the work that has been submitted so far */
+    if (mipGenerator_ != nullptr && mipGenerator_->HasPending())
+    {
+        auto result = QueueSubmit(0, nullptr, VK_NULL_HANDLE);
+        VKThrowIfFailed(result, "failed to submit MIP-map generation to Vulkan queue");
+    }
+
+    vkQueueWaitIdle(queue_);
+}
+
+void VKCommandQueue::Signal(Fence& fence, std::uint64_t value)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (!fenceVK.IsTimeline())
+        throw std::invalid_argument("cannot signal value for binary fence");
+
+    #ifdef VK_KHR_timeline_semaphore
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Timeline semaphore values must strictly increase */
+    if (value <= fenceVK.GetSignaledValue())
+        throw std::invalid_argument("cannot signal timeline fence with a value that is not greater than its previously signaled value");
+
+    /* Submit empty batch that signals the timeline semaphore with the new value */
+    VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo;
+    {
+        timelineSubmitInfo.sType                        = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineSubmitInfo.pNext                        = nullptr;
+        timelineSubmitInfo.waitSemaphoreValueCount      = 0;
+        timelineSubmitInfo.pWaitSemaphoreValues         = nullptr;
+        timelineSubmitInfo.signalSemaphoreValueCount    = 1;
+        timelineSubmitInfo.pSignalSemaphoreValues       = (&value);
+    }
+
+    VkSemaphore semaphore = fenceVK.GetTimelineSemaphore();
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = (&timelineSubmitInfo);
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = (&semaphore);
+    }
+    auto result = QueueSubmit(1, &submitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit timeline semaphore signal to Vulkan queue");
+
+    fenceVK.SetSignaledValue(value);
+
+    #endif // /VK_KHR_timeline_semaphore
+}
+
+std::uint64_t VKCommandQueue::GetCompletedValue(Fence& fence)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (fenceVK.IsTimeline())
+        return fenceVK.GetCompletedValue(device_);
+    else
+        return (vkGetFenceStatus(device_, fenceVK.GetHardwareFence()) == VK_SUCCESS ? 1 : 0);
+}
+
+// Returns true if all fences are timeline fences, or false if all fences are binary fences.
+static bool AreTimelineFences(std::uint32_t numFences, Fence* const * fences)
+{
+    const bool timeline = LLGL_CAST(VKFence*, fences[0])->IsTimeline();
+    for (std::uint32_t i = 1; i < numFences; ++i)
+    {
+        if (LLGL_CAST(VKFence*, fences[i])->IsTimeline() != timeline)
+            throw std::invalid_argument("cannot wait for binary and timeline fences at the same time");
+    }
+    return timeline;
+}
+
+bool VKCommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, const std::uint64_t* values, bool waitAll, std::uint64_t timeout)
+{
+    if (numFences == 0)
+        return true;
+
+    if (AreTimelineFences(numFences, fences))
+    {
+        #ifdef VK_KHR_timeline_semaphore
+
+        /* Wait for all or any timeline semaphores with a single call */
+        std::vector<VkSemaphore> waitSemaphores(numFences);
+        for (std::uint32_t i = 0; i < numFences; ++i)
+            waitSemaphores[i] = LLGL_CAST(VKFence*, fences[i])->GetTimelineSemaphore();
+
+        VkSemaphoreWaitInfoKHR waitInfo;
+        {
+            waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+            waitInfo.pNext          = nullptr;
+            waitInfo.flags          = (waitAll ? 0 : VK_SEMAPHORE_WAIT_ANY_BIT_KHR);
+            waitInfo.semaphoreCount = numFences;
+            waitInfo.pSemaphores    = waitSemaphores.data();
+            waitInfo.pValues        = values;
+        }
+        return (vkWaitSemaphoresKHR(device_, &waitInfo, timeout) == VK_SUCCESS);
+
+        #else
+
+        return false;
+
+        #endif // /VK_KHR_timeline_semaphore
+    }
+    else
+    {
+        /* Wait for all or any binary fences with a single call */
+        std::vector<VkFence> waitFences(numFences);
+        for (std::uint32_t i = 0; i < numFences; ++i)
+            waitFences[i] = LLGL_CAST(VKFence*, fences[i])->GetHardwareFence();
+
+        return (vkWaitForFences(device_, numFences, waitFences.data(), VKBoolean(waitAll), timeout) == VK_SUCCESS);
+    }
+}
+
+/* ----- Queue synchronization ----- */
+
+void VKCommandQueue::WaitQueue(CommandQueue& otherQueue)
+{
+    auto& otherQueueVK = LLGL_CAST(VKCommandQueue&, otherQueue);
+
+    /* Submissions to the same native queue are already executed in order */
+    if (otherQueueVK.GetVkQueue() == queue_)
+        return;
+
+    /* Let the other queue signal a semaphore after all its previous submissions (each queue only locks itself to avoid deadlocks) */
+    std::size_t semaphoreIndex = 0;
+    VkSemaphore semaphore = VK_NULL_HANDLE;
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        semaphoreIndex  = AcquireQueueSemaphore();
+        semaphore       = queueSemaphores_[semaphoreIndex].semaphore.Get();
+    }
+    otherQueueVK.SignalQueueSemaphore(semaphore);
+
+    /* Wait for that semaphore on this queue */
+    WaitQueueSemaphore(semaphoreIndex);
+}
+
+/* ----- Extended functions ----- */
+
+void VKCommandQueue::SetMipGenerator(VKMipGenerator* mipGenerator)
+{
+    mipGenerator_ = mipGenerator;
 }
 
+void VKCommandQueue::SubmitPendingMips()
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    if (mipGenerator_ != nullptr && mipGenerator_->HasPending())
+    {
+        auto result = QueueSubmit(0, nullptr, VK_NULL_HANDLE);
+        VKThrowIfFailed(result, "failed to submit MIP-map generation to Vulkan queue");
+    }
+}
+
+VkFence VKCommandQueue::SubmitBatch(const VkSubmitInfo& submitInfo, VkFence fence)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    if (fence == VK_NULL_HANDLE)
+        fence = NextSubmitFence();
+
+    auto result = QueueSubmit(1, &submitInfo, fence);
+    VKThrowIfFailed(result, "failed to submit internal commands to Vulkan queue");
+
+    return fence;
+}
+
+VkResult VKCommandQueue::Present(const VkPresentInfoKHR& presentInfo)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    return vkQueuePresentKHR(queue_, &presentInfo);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKCommandQueue::QueueSemaphore::QueueSemaphore(const VKPtr<VkDevice>& device) :
+    semaphore { device, vkDestroySemaphore },
+    fence     { device, vkDestroyFence     }
+{
+}
+
+void VKCommandQueue::CreateSubmitFences(std::size_t numFences)
+{
+    submitFences_.reserve(numFences);
+
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+    }
+
+    for (std::size_t i = 0; i < numFences; ++i)
+    {
+        VKPtr<VkFence> fence { device_, vkDestroyFence };
+        {
+            auto result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+            VKThrowIfFailed(result, "failed to create Vulkan fence");
+        }
+        submitFences_.emplace_back(std::move(fence));
+    }
+}
+
+VkFence VKCommandQueue::NextSubmitFence()
+{
+    submitFenceIndex_ = (submitFenceIndex_ + 1) % submitFences_.size();
+    VkFence fence = submitFences_[submitFenceIndex_].Get();
+
+    /*
+    Wait for the oldest submission before the fence is reused.
+    Command buffers that still refer to this fence will at most wait for the new submission, which follows immediately.
+    */
+    vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+    vkResetFences(device_, 1, &fence);
+
+    return fence;
+}
+
+void VKCommandQueue::GatherRenderContextSemaphores(VKCommandBuffer& commandBufferVK)
+{
+    for (auto renderContextVK : commandBufferVK.GetRenderContexts())
+    {
+        if (Contains(submitRenderContexts_, renderContextVK))
+            continue;
+
+        submitRenderContexts_.push_back(renderContextVK);
+
+        /* Wait for the swap-chain image to be available and signal the presentation when rendering is finished */
+        VkSemaphore waitSemaphore = VK_NULL_HANDLE, signalSemaphore = VK_NULL_HANDLE;
+        renderContextVK->AcquireSubmitSemaphores(waitSemaphore, signalSemaphore);
+
+        if (waitSemaphore != VK_NULL_HANDLE)
+        {
+            submitWaitSemaphores_.push_back(waitSemaphore);
+            submitWaitStages_.push_back(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+        }
+
+        submitSignalSemaphores_.push_back(signalSemaphore);
+    }
+}
+
+VkResult VKCommandQueue::QueueSubmit(std::uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence)
+{
+    /* Deferred MIP-map generation must be executed before any command that might sample these textures */
+    VkCommandBuffer mipCommandBuffer = VK_NULL_HANDLE;
+    if (mipGenerator_ != nullptr)
+        mipCommandBuffer = mipGenerator_->RecordPendingRequests();
+
+    if (mipCommandBuffer == VK_NULL_HANDLE)
+    {
+        auto result = vkQueueSubmit(queue_, submitCount, submits, fence);
+
+        /* Any fence of the ring buffer also tracks the completion of earlier MIP-map generation that has been submitted with an external fence */
+        if (result == VK_SUCCESS && mipGenerator_ != nullptr && fence != VK_NULL_HANDLE && IsSubmitFence(fence))
+            mipGenerator_->TrackSubmitFence(fence);
+
+        return result;
+    }
+
+    /* Command buffer for MIP-map generation can only be recorded again once this submission has been completed */
+    if (fence == VK_NULL_HANDLE)
+        fence = NextSubmitFence();
+
+    /* Prepend MIP-map generation as its own batch, so it does not wait for the semaphores of the other batches */
+    VkSubmitInfo mipSubmitInfo;
+    {
+        mipSubmitInfo.sType                 = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        mipSubmitInfo.pNext                 = nullptr;
+        mipSubmitInfo.waitSemaphoreCount    = 0;
+        mipSubmitInfo.pWaitSemaphores       = nullptr;
+        mipSubmitInfo.pWaitDstStageMask     = nullptr;
+        mipSubmitInfo.commandBufferCount    = 1;
+        mipSubmitInfo.pCommandBuffers       = (&mipCommandBuffer);
+        mipSubmitInfo.signalSemaphoreCount  = 0;
+        mipSubmitInfo.pSignalSemaphores     = nullptr;
+    }
+
+    submitBatches_.clear();
+    submitBatches_.push_back(mipSubmitInfo);
+    submitBatches_.insert(submitBatches_.end(), submits, submits + submitCount);
+
+    auto result = vkQueueSubmit(queue_, static_cast<std::uint32_t>(submitBatches_.size()), submitBatches_.data(), fence);
+
+    /* Keep requests pending if the submission failed, so they are recorded again with the next submission */
+    if (result == VK_SUCCESS)
+    {
+        if (IsSubmitFence(fence))
+        {
+            mipGenerator_->CommitPendingRequests(fence);
+            mipGenerator_->TrackSubmitFence(fence);
+        }
+        else
+            mipGenerator_->CommitPendingRequests(VK_NULL_HANDLE);
+    }
+
+    return result;
+}
+
+bool VKCommandQueue::IsSubmitFence(VkFence fence) const
+{
+    for (const auto& submitFence : submitFences_)
+    {
+        if (submitFence.Get() == fence)
+            return true;
+    }
+    return false;
+}
+
+std::size_t VKCommandQueue::AcquireQueueSemaphore()
+{
+    /* Find a semaphore whose previous wait operation has been executed, i.e. whose dedicated fence has been signaled */
+    for (std::size_t i = 0; i < queueSemaphores_.size(); ++i)
+    {
+        auto& entry = queueSemaphores_[i];
+        if (entry.inFlight)
+        {
+            if (vkGetFenceStatus(device_, entry.fence) != VK_SUCCESS)
+                continue;
+            vkResetFences(device_, 1, &entry.fence);
+        }
+        entry.inFlight = true;
+        return i;
+    }
+
+    /* Create new semaphore with its own fence */
+    QueueSemaphore entry { device_ };
+
+    VkSemaphoreCreateInfo semaphoreInfo;
+    {
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = nullptr;
+        semaphoreInfo.flags = 0;
+    }
+    auto result = vkCreateSemaphore(device_, &semaphoreInfo, nullptr, entry.semaphore.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan semaphore for queue synchronization");
+
+    VkFenceCreateInfo fenceInfo;
+    {
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceInfo.pNext = nullptr;
+        fenceInfo.flags = 0;
+    }
+    result = vkCreateFence(device_, &fenceInfo, nullptr, entry.fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for queue synchronization");
+
+    entry.inFlight = true;
+    queueSemaphores_.emplace_back(std::move(entry));
+
+    return (queueSemaphores_.size() - 1);
+}
+
+void VKCommandQueue::SignalQueueSemaphore(VkSemaphore semaphore)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Deferred MIP-map generation belongs to the work that has been submitted so far */
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = (&semaphore);
+    }
+    auto result = QueueSubmit(1, &submitInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to submit semaphore signal to Vulkan queue");
+}
+
+void VKCommandQueue::WaitQueueSemaphore(std::size_t semaphoreIndex)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto&       entry       = queueSemaphores_[semaphoreIndex];
+    VkSemaphore semaphore   = entry.semaphore.Get();
+
+    /*
+    Wait for the semaphore with an empty batch.
+    The second synchronization scope of a semaphore wait includes all commands that are submitted later to this queue.
+    */
+    const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 1;
+        submitInfo.pWaitSemaphores      = (&semaphore);
+        submitInfo.pWaitDstStageMask    = (&waitStage);
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+    }
+
+    /* Semaphore can be reused once the wait operation has been executed, which is signaled by its dedicated fence */
+    auto result = QueueSubmit(1, &submitInfo, entry.fence);
+    VKThrowIfFailed(result, "failed to submit semaphore wait to Vulkan queue");
+}
 
 } // /namespace LLGL
 
@@ -14,12 +14,18 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "RenderState/VKFence.h"
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
+class VKCommandBuffer;
+class VKRenderContext;
+class VKMipGenerator;
+
 class VKCommandQueue final : public CommandQueue
 {
 
@@ -27,14 +33,23 @@ class VKCommandQueue final : public CommandQueue
 
         /* ----- Common ----- */
 
-        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue);
+        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue queue, std::uint32_t queueFamily);
 
         /* ----- Command Buffers ----- */
 
         void Begin(CommandBuffer& commandBuffer, long flags = 0) override;
+
+        void BeginSecondary(
+            CommandBuffer&      commandBuffer,
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass  = nullptr,
+            long                flags       = 0
+        ) override;
+
         void End(CommandBuffer& commandBuffer) override;
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
 
         /* ----- Fences ----- */
 
@@ -43,10 +58,119 @@ class VKCommandQueue final : public CommandQueue
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
         void WaitIdle() override;
 
+        void Signal(Fence& fence, std::uint64_t value) override;
+
+        std::uint64_t GetCompletedValue(Fence& fence) override;
+
+        bool WaitFences(
+            std::uint32_t           numFences,
+            Fence* const *          fences,
+            const std::uint64_t*    values,
+            bool                    waitAll,
+            std::uint64_t           timeout
+        ) override;
+
+        /* ----- Queue synchronization ----- */
+
+        void WaitQueue(CommandQueue& otherQueue) override;
+
+        /* ----- Extended functions ----- */
+
+        // Sets the MIP-map generator whose deferred work is prepended to each queue submission.
+        void SetMipGenerator(VKMipGenerator* mipGenerator);
+
+        // Submits the deferred MIP-map generation without waiting for the next queue submission.
+        void SubmitPendingMips();
+
+        /*
+        Submits a batch of internal commands under the same lock as all other submissions to this native queue.
+        If no fence is specified, a fence from the internal ring buffer is used. Returns the fence that is signaled once the batch has been completed.
+        */
+        VkFence SubmitBatch(const VkSubmitInfo& submitInfo, VkFence fence = VK_NULL_HANDLE);
+
+        // Queues the presentation of a swap-chain image under the same lock as all submissions to this native queue.
+        VkResult Present(const VkPresentInfoKHR& presentInfo);
+
+        // Returns the native Vulkan queue.
+        inline VkQueue GetVkQueue() const
+        {
+            return queue_;
+        }
+
+        // Returns the queue family index of the native Vulkan queue.
+        inline std::uint32_t GetQueueFamily() const
+        {
+            return queueFamily_;
+        }
+
     private:
 
-        VkDevice    device_;
-        VkQueue     graphicsQueue_  = VK_NULL_HANDLE;
+        /*
+        Semaphore for cross-queue synchronization with its own fence, which is signaled once this queue has executed the wait operation.
+        The fence is never shared with other submissions, so the semaphore cannot be reused while its wait operation is still pending.
+        */
+        struct QueueSemaphore
+        {
+            QueueSemaphore(const VKPtr<VkDevice>& device);
+
+            VKPtr<VkSemaphore>  semaphore;
+            VKPtr<VkFence>      fence;
+            bool                inFlight    = false;
+        };
+
+    private:
+
+        void CreateSubmitFences(std::size_t numFences);
+
+        // Returns the next fence from the ring buffer of submission fences, after it has been waited for and reset.
+        VkFence NextSubmitFence();
+
+        void GatherRenderContextSemaphores(VKCommandBuffer& commandBufferVK);
+
+        /*
+        Submits the specified batches to the native queue, preceded by a batch with the deferred MIP-map generation within the same submission.
+        The queue must already be locked. A fence from the ring buffer is used if there is deferred work but no fence is specified.
+        */
+        VkResult QueueSubmit(std::uint32_t submitCount, const VkSubmitInfo* submits, VkFence fence);
+
+        // Returns true if the specified fence is part of the ring buffer of submission fences.
+        bool IsSubmitFence(VkFence fence) const;
+
+        // Returns the index of an unsignaled semaphore from the pool and marks it as in flight. It is used to synchronize this queue with another queue.
+        std::size_t AcquireQueueSemaphore();
+
+        // Submits an empty batch that signals the specified semaphore when all previous submissions to this queue have been completed.
+        void SignalQueueSemaphore(VkSemaphore semaphore);
+
+        // Submits an empty batch that waits for the specified semaphore from the pool and signals its dedicated fence.
+        void WaitQueueSemaphore(std::size_t semaphoreIndex);
+
+        const VKPtr<VkDevice>&              device_;
+
+        /*
+        Serializes all submissions to the native queue and the ring of submission fences, so command buffers can be submitted from multiple threads.
+        There is only one command queue for each native queue, so this is the only lock for the native queue.
+        */
+        std::mutex                          mutex_;
+
+        VkQueue                             queue_              = VK_NULL_HANDLE;
+        std::uint32_t                       queueFamily_        = 0;
+
+        std::vector<VKPtr<VkFence>>         submitFences_;
+        std::size_t                         submitFenceIndex_   = 0;
+
+        VKMipGenerator*                     mipGenerator_       = nullptr;
+
+        /* Pool of semaphores for cross-queue synchronization (see WaitQueue) */
+        std::vector<QueueSemaphore>         queueSemaphores_;
+
+        /* Intermediate lists for queue submissions (to avoid allocations with each submission) */
+        std::vector<VkSubmitInfo>           submitBatches_;
+        std::vector<VkCommandBuffer>        submitCommandBuffers_;
+        std::vector<VkSemaphore>            submitWaitSemaphores_;
+        std::vector<VkPipelineStageFlags>   submitWaitStages_;
+        std::vector<VkSemaphore>            submitSignalSemaphores_;
+        std::vector<VKRenderContext*>       submitRenderContexts_;
 
 };
 
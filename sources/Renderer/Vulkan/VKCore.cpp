@@ -238,6 +238,20 @@ QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFla
     return indices;
 }
 
+std::uint32_t VKFindDedicatedQueueFamily(VkPhysicalDevice device, const VkQueueFlags requiredFlags, const VkQueueFlags excludedFlags)
+{
+    auto queueFamilies = VKQueryQueueFamilyProperties(device);
+
+    for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(queueFamilies.size()); ++i)
+    {
+        const auto& family = queueFamilies[i];
+        if (family.queueCount > 0 && (family.queueFlags & requiredFlags) == requiredFlags && (family.queueFlags & excludedFlags) == 0)
+            return i;
+    }
+
+    return QueueFamilyIndices::invalidIndex;
+}
+
 VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features)
 {
     for (auto format : candidates)
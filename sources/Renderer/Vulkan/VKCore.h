@@ -38,10 +38,13 @@ struct QueueFamilyIndices
         {
             std::uint32_t graphicsFamily;
             std::uint32_t presentFamily;
-            //std::uint32_t transferFamily;
         };
     };
 
+    // Queue families for asynchronous work; these are equal to the graphics family if the device has no dedicated queue families.
+    std::uint32_t computeFamily     = invalidIndex;
+    std::uint32_t transferFamily    = invalidIndex;
+
     inline bool Complete() const
     {
         return (graphicsFamily != invalidIndex && presentFamily != invalidIndex);
@@ -79,6 +82,10 @@ std::vector<VkQueueFamilyProperties> VKQueryQueueFamilyProperties(VkPhysicalDevi
 
 SurfaceSupportDetails VKQuerySurfaceSupport(VkPhysicalDevice device, VkSurfaceKHR surface);
 QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFlags flags, VkSurfaceKHR* surface = nullptr);
+
+// Returns the first queue family that supports all required flags but none of the excluded flags, or QueueFamilyIndices::invalidIndex if there is no such family.
+std::uint32_t VKFindDedicatedQueueFamily(VkPhysicalDevice device, const VkQueueFlags requiredFlags, const VkQueueFlags excludedFlags);
+
 VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
 
 // Returns the memory type index that supports the specified type bits and properties, or throws an std::runtime_error exception on failure.
@@ -6,6 +6,7 @@
  */
 
 #include "VKRenderContext.h"
+#include "VKCommandQueue.h"
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "Memory/VKDeviceMemoryManager.h"
@@ -30,6 +31,7 @@ VKRenderContext::VKRenderContext(
     VkPhysicalDevice physicalDevice,
     const VKPtr<VkDevice>& device,
     VKDeviceMemoryManager& deviceMemoryMngr,
+    VKCommandQueue& commandQueue,
     RenderContextDescriptor desc,
     const std::shared_ptr<Surface>& surface) :
         RenderContext        { desc.videoMode, desc.vsync    },
@@ -37,10 +39,13 @@ VKRenderContext::VKRenderContext(
         physicalDevice_      { physicalDevice                },
         device_              { device                        },
         deviceMemoryMngr_    { deviceMemoryMngr              },
+        commandQueue_        { commandQueue                  },
         surface_             { instance, vkDestroySurfaceKHR },
         swapChain_           { device, vkDestroySwapchainKHR },
         swapChainRenderPass_ { device                        },
-        depthStencilBuffer_  { device                        }
+        depthStencilBuffer_  { device                        },
+        presentMode_         { desc.presentMode              },
+        numFramesInFlight_   { std::max(1u, desc.maxFrameLatency) }
 {
     SetOrCreateSurface(surface, desc.videoMode, nullptr);
     desc.videoMode = GetVideoMode();
@@ -62,26 +67,37 @@ VKRenderContext::~VKRenderContext()
 
 void VKRenderContext::Present()
 {
-    /* Initialize semaphores */
-    VkSemaphore waitSemaphorse[] = { imageAvailableSemaphore_ };
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    VkSemaphore signalSemaphores[] = { renderFinishedSemaphore_ };
+    auto& frame = framesInFlight_[currentFrame_];
 
-    /* Submit signal semaphore to graphics queue */
-    VkSubmitInfo submitInfo;
+    if (frame.numRenderFinishedSemaphores == 0)
     {
-        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 1;
-        submitInfo.pWaitSemaphores      = waitSemaphorse;
-        submitInfo.pWaitDstStageMask    = waitStages;
-        submitInfo.commandBufferCount   = 0;
-        submitInfo.pCommandBuffers      = nullptr;
-        submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores    = signalSemaphores;
+        /* Nothing has been submitted into this render context in the current frame, so submit the semaphores on their own */
+        VkSemaphore waitSemaphores[] = { VK_NULL_HANDLE };
+        VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+        VkSemaphore signalSemaphores[] = { VK_NULL_HANDLE };
+
+        AcquireSubmitSemaphores(waitSemaphores[0], signalSemaphores[0]);
+
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = (waitSemaphores[0] != VK_NULL_HANDLE ? 1 : 0);
+            submitInfo.pWaitSemaphores      = waitSemaphores;
+            submitInfo.pWaitDstStageMask    = waitStages;
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = signalSemaphores;
+        }
+        frame.frameFence = commandQueue_.SubmitBatch(submitInfo);
     }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
-    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+
+    /* Gather all semaphores that have been signaled by the submissions of the current frame */
+    std::vector<VkSemaphore> waitSemaphores(frame.numRenderFinishedSemaphores);
+
+    for (std::uint32_t i = 0; i < frame.numRenderFinishedSemaphores; ++i)
+        waitSemaphores[i] = frame.renderFinishedSemaphores[i].Get();
 
     /* Present result on screen */
     VkSwapchainKHR swapChains[] = { swapChain_ };
@@ -90,17 +106,21 @@ void VKRenderContext::Present()
     {
         presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.pNext               = nullptr;
-        presentInfo.waitSemaphoreCount  = 1;
-        presentInfo.pWaitSemaphores     = signalSemaphores;
+        presentInfo.waitSemaphoreCount  = frame.numRenderFinishedSemaphores;
+        presentInfo.pWaitSemaphores     = waitSemaphores.data();
         presentInfo.swapchainCount      = 1;
         presentInfo.pSwapchains         = swapChains;
         presentInfo.pImageIndices       = &presentImageIndex_;
         presentInfo.pResults            = nullptr;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    auto result = commandQueue_.Present(presentInfo);
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
-    /* Get image index for next presentation */
+    /* Swap-chain image is in use until the last submission of this frame has been completed */
+    swapChainImageFences_[presentImageIndex_] = frame.frameFence;
+
+    /* Get image index for next presentation with the synchronization objects of the next frame */
+    currentFrame_ = (currentFrame_ + 1) % numFramesInFlight_;
     AcquireNextPresentImage();
 }
 
@@ -126,6 +146,27 @@ bool VKRenderContext::HasDepthStencilBuffer() const
     return (depthStencilBuffer_.GetVkFormat() != VK_FORMAT_UNDEFINED);
 }
 
+void VKRenderContext::AcquireSubmitSemaphores(VkSemaphore& waitSemaphore, VkSemaphore& signalSemaphore)
+{
+    auto& frame = framesInFlight_[currentFrame_];
+
+    /* Only the first submission of a frame must wait for the swap-chain image to become available */
+    if (!frame.imageAvailableWaited)
+    {
+        waitSemaphore = frame.imageAvailableSemaphore.Get();
+        frame.imageAvailableWaited = true;
+    }
+    else
+        waitSemaphore = VK_NULL_HANDLE;
+
+    signalSemaphore = NextRenderFinishedSemaphore();
+}
+
+void VKRenderContext::SetSubmitFence(VkFence fence)
+{
+    framesInFlight_[currentFrame_].frameFence = fence;
+}
+
 
 /*
  * ======= Private: =======
@@ -136,7 +177,7 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
     const auto& prevVideoMode = GetVideoMode();
 
     /* Wait until graphics queue is idle before resources are destroyed and recreated */
-    vkQueueWaitIdle(graphicsQueue_);
+    WaitIdle();
 
     /* Recreate presenting semaphores and Vulkan surface */
     CreatePresentSemaphores();
@@ -159,6 +200,10 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
 
 bool VKRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
 {
+    /* Wait until graphics queue is idle before the synchronization objects are recreated */
+    WaitIdle();
+    CreatePresentSemaphores();
+
     /* Recreate swap-chain with new vsnyc settings */
     CreateSwapChain(GetVideoMode(), vsyncDesc);
     return true;
@@ -179,9 +224,17 @@ void VKRenderContext::CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore)
 
 void VKRenderContext::CreatePresentSemaphores()
 {
-    /* Create presentation semaphorse */
-    CreateGpuSemaphore(imageAvailableSemaphore_);
-    CreateGpuSemaphore(renderFinishedSemaphore_);
+    /* Create presentation semaphores for each frame in flight */
+    framesInFlight_.clear();
+    framesInFlight_.reserve(numFramesInFlight_);
+
+    for (std::uint32_t i = 0; i < numFramesInFlight_; ++i)
+    {
+        framesInFlight_.emplace_back(device_);
+        CreateGpuSemaphore(framesInFlight_.back().imageAvailableSemaphore);
+    }
+
+    currentFrame_ = 0;
 }
 
 void VKRenderContext::CreateGpuSurface()
@@ -266,12 +319,11 @@ void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc,
     if (surfaceSupportDetails_.caps.maxImageCount > 0)
         imageCount = std::max(imageCount, std::min(videoModeDesc.swapChainSize, surfaceSupportDetails_.caps.maxImageCount));
 
-    /* Get device queues for graphics and presentation */
-    VkSurfaceKHR surface = surface_.Get();
-    auto queueFamilyIndices = VKFindQueueFamilies(physicalDevice_, VK_QUEUE_GRAPHICS_BIT, &surface);
-
-    vkGetDeviceQueue(device_, queueFamilyIndices.graphicsFamily, 0, &graphicsQueue_);
-    vkGetDeviceQueue(device_, queueFamilyIndices.presentFamily, 0, &presentQueue_);
+    /* Presentation is submitted to the graphics queue, so it shares the lock of all other submissions to that queue */
+    VkBool32 presentSupport = VK_FALSE;
+    vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice_, commandQueue_.GetQueueFamily(), surface_, &presentSupport);
+    if (!presentSupport)
+        throw std::runtime_error("Vulkan graphics queue does not support presentation to the surface of the render context");
 
     /* Pick swap-chain presentation mode (with v-sync parameters) */
     auto presentMode = PickSwapPresentMode(surfaceSupportDetails_.presentModes, vsyncDesc);
@@ -289,20 +341,9 @@ void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc,
         createInfo.imageExtent                  = swapChainExtent_;
         createInfo.imageArrayLayers             = 1;
         createInfo.imageUsage                   = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
-
-        if (queueFamilyIndices.graphicsFamily != queueFamilyIndices.presentFamily)
-        {
-            createInfo.imageSharingMode         = VK_SHARING_MODE_CONCURRENT;
-            createInfo.queueFamilyIndexCount    = 2;
-            createInfo.pQueueFamilyIndices      = queueFamilyIndices.indices;
-        }
-        else
-        {
-            createInfo.imageSharingMode         = VK_SHARING_MODE_EXCLUSIVE;
-            createInfo.queueFamilyIndexCount    = 0;
-            createInfo.pQueueFamilyIndices      = nullptr;
-        }
-
+        createInfo.imageSharingMode             = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount        = 0;
+        createInfo.pQueueFamilyIndices          = nullptr;
         createInfo.preTransform                 = surfaceSupportDetails_.caps.currentTransform;
         createInfo.compositeAlpha               = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
         createInfo.presentMode                  = presentMode;
@@ -320,6 +361,9 @@ void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc,
     result = vkGetSwapchainImagesKHR(device_, swapChain_, &imageCount, swapChainImages_.data());
     VKThrowIfFailed(result, "failed to query Vulkan swap-chain images");
 
+    swapChainImageFences_.clear();
+    swapChainImageFences_.resize(imageCount, VK_NULL_HANDLE);
+
     /* Create all swap-chain dependent resources */
     CreateSwapChainImageViews();
     CreateSwapChainFramebuffers();
@@ -444,6 +488,19 @@ VkSurfaceFormatKHR VKRenderContext::PickSwapSurfaceFormat(const std::vector<VkSu
 
 VkPresentModeKHR VKRenderContext::PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, const VsyncDescriptor& vsyncDesc) const
 {
+    /* Check if a specific presentation mode has been requested */
+    switch (presentMode_)
+    {
+        case PresentMode::Fifo:
+            return VK_PRESENT_MODE_FIFO_KHR;
+        case PresentMode::Mailbox:
+            return PickSwapPresentModeOrFifo(presentModes, VK_PRESENT_MODE_MAILBOX_KHR);
+        case PresentMode::Immediate:
+            return PickSwapPresentModeOrFifo(presentModes, VK_PRESENT_MODE_IMMEDIATE_KHR);
+        default:
+            break;
+    }
+
     if (!vsyncDesc.enabled)
     {
         /* Check if MAILBOX or IMMEDIATE presentation mode is available, to avoid vertical synchronization */
@@ -456,6 +513,15 @@ VkPresentModeKHR VKRenderContext::PickSwapPresentMode(const std::vector<VkPresen
     return VK_PRESENT_MODE_FIFO_KHR;
 }
 
+VkPresentModeKHR VKRenderContext::PickSwapPresentModeOrFifo(const std::vector<VkPresentModeKHR>& presentModes, VkPresentModeKHR presentMode) const
+{
+    /* FIFO presentation mode is the only one that is guaranteed to be supported */
+    if (Contains(presentModes, presentMode))
+        return presentMode;
+    else
+        return VK_PRESENT_MODE_FIFO_KHR;
+}
+
 VkExtent2D VKRenderContext::PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCaps, std::uint32_t width, std::uint32_t height) const
 {
     if (surfaceCaps.currentExtent.width == std::numeric_limits<std::uint32_t>::max())
@@ -501,15 +567,85 @@ VkFormat VKRenderContext::PickDepthFormat() const
 
 void VKRenderContext::AcquireNextPresentImage()
 {
+    auto& frame = framesInFlight_[currentFrame_];
+
+    /* Wait until the GPU has completed the frame that previously used these synchronization objects */
+    if (frame.frameFence != VK_NULL_HANDLE)
+    {
+        vkWaitForFences(device_, 1, &frame.frameFence, VK_TRUE, UINT64_MAX);
+        frame.frameFence = VK_NULL_HANDLE;
+    }
+
+    frame.numRenderFinishedSemaphores = 0;
+
     /* Get next image for presentation */
-    vkAcquireNextImageKHR(
+    auto result = vkAcquireNextImageKHR(
         device_,
         swapChain_,
         UINT64_MAX,
-        imageAvailableSemaphore_,
+        frame.imageAvailableSemaphore,
         VK_NULL_HANDLE,
         &presentImageIndex_
     );
+
+    /* Semaphore is only signaled if an image has been acquired, otherwise no submission must wait for it */
+    frame.imageAvailableWaited = (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR);
+
+    /* Wait until the swap-chain image is no longer in use by a previous frame */
+    auto& imageFence = swapChainImageFences_[presentImageIndex_];
+    if (imageFence != VK_NULL_HANDLE)
+    {
+        vkWaitForFences(device_, 1, &imageFence, VK_TRUE, UINT64_MAX);
+        imageFence = VK_NULL_HANDLE;
+    }
+}
+
+void VKRenderContext::WaitIdle()
+{
+    auto& frame = framesInFlight_[currentFrame_];
+
+    /*
+    Consume the pending signal of the image acquisition, which is not a queue operation and hence not covered by waiting for the queue.
+    A semaphore must not be destroyed while a signal operation on it is still pending.
+    */
+    if (!frame.imageAvailableWaited)
+    {
+        VkSemaphore             waitSemaphore   = frame.imageAvailableSemaphore.Get();
+        VkPipelineStageFlags    waitStage       = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = 1;
+            submitInfo.pWaitSemaphores      = (&waitSemaphore);
+            submitInfo.pWaitDstStageMask    = (&waitStage);
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 0;
+            submitInfo.pSignalSemaphores    = nullptr;
+        }
+        commandQueue_.SubmitBatch(submitInfo);
+
+        frame.imageAvailableWaited = true;
+    }
+
+    commandQueue_.WaitIdle();
+}
+
+VkSemaphore VKRenderContext::NextRenderFinishedSemaphore()
+{
+    auto& frame = framesInFlight_[currentFrame_];
+
+    /* Create new semaphore if all semaphores of this frame are already in use */
+    if (frame.numRenderFinishedSemaphores == frame.renderFinishedSemaphores.size())
+    {
+        VKPtr<VkSemaphore> semaphore { device_, vkDestroySemaphore };
+        CreateGpuSemaphore(semaphore);
+        frame.renderFinishedSemaphores.emplace_back(std::move(semaphore));
+    }
+
+    return frame.renderFinishedSemaphores[frame.numRenderFinishedSemaphores++].Get();
 }
 
 
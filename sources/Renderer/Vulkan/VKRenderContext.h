@@ -25,6 +25,7 @@ namespace LLGL
 
 class VKDeviceMemoryManager;
 class VKDeviceMemoryRegion;
+class VKCommandQueue;
 
 class VKRenderContext final : public RenderContext
 {
@@ -38,6 +39,7 @@ class VKRenderContext final : public RenderContext
             VkPhysicalDevice physicalDevice,
             const VKPtr<VkDevice>& device,
             VKDeviceMemoryManager& deviceMemoryMngr,
+            VKCommandQueue& commandQueue,
             RenderContextDescriptor desc,
             const std::shared_ptr<Surface>& surface
         );
@@ -74,6 +76,15 @@ class VKRenderContext final : public RenderContext
         // Returns true if this render context has a depth-stencil buffer.
         bool HasDepthStencilBuffer() const;
 
+        /*
+        Returns the semaphores for the next queue submission that renders into this render context.
+        The submission must wait for 'waitSemaphore' (unless it is VK_NULL_HANDLE) and signal 'signalSemaphore'.
+        */
+        void AcquireSubmitSemaphores(VkSemaphore& waitSemaphore, VkSemaphore& signalSemaphore);
+
+        // Sets the fence of the latest queue submission that renders into this render context. The current frame is in flight until this fence has been signaled.
+        void SetSubmitFence(VkFence fence);
+
     private:
 
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
@@ -93,12 +104,37 @@ class VKRenderContext final : public RenderContext
 
         VkSurfaceFormatKHR PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const;
         VkPresentModeKHR PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, const VsyncDescriptor& vsyncDesc) const;
+        VkPresentModeKHR PickSwapPresentModeOrFifo(const std::vector<VkPresentModeKHR>& presentModes, VkPresentModeKHR presentMode) const;
         VkExtent2D PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCaps, std::uint32_t width, std::uint32_t height) const;
         VkFormat PickDepthStencilFormat() const;
         VkFormat PickDepthFormat() const;
 
         void AcquireNextPresentImage();
 
+        // Waits until the command queue is idle and no semaphore of the current frame has a pending signal operation, so they can be destroyed.
+        void WaitIdle();
+
+        VkSemaphore NextRenderFinishedSemaphore();
+
+        // Synchronization objects for each frame that can be in flight.
+        struct VKFrameInFlight
+        {
+            VKFrameInFlight(const VKPtr<VkDevice>& device) :
+                imageAvailableSemaphore { device, vkDestroySemaphore }
+            {
+            }
+
+            VKPtr<VkSemaphore>              imageAvailableSemaphore;
+            bool                            imageAvailableWaited        = false;
+
+            // Semaphores signaled by each submission into this render context; the presentation waits for all of them.
+            std::vector<VKPtr<VkSemaphore>> renderFinishedSemaphores;
+            std::uint32_t                   numRenderFinishedSemaphores = 0;
+
+            // Fence of the last submission into this render context in this frame (refers to a fence of the command queue, so no extra submission is required).
+            VkFence                         frameFence                  = VK_NULL_HANDLE;
+        };
+
         /* ----- Common objects ----- */
 
         VkInstance                          instance_                   = VK_NULL_HANDLE;
@@ -106,6 +142,7 @@ class VKRenderContext final : public RenderContext
         const VKPtr<VkDevice>&              device_;
 
         VKDeviceMemoryManager&              deviceMemoryMngr_;
+        VKCommandQueue&                     commandQueue_;
 
         VKPtr<VkSurfaceKHR>                 surface_;
         SurfaceSupportDetails               surfaceSupportDetails_;
@@ -121,11 +158,14 @@ class VKRenderContext final : public RenderContext
 
         VKDepthStencilBuffer                depthStencilBuffer_;
 
-        VkQueue                             graphicsQueue_              = VK_NULL_HANDLE;
-        VkQueue                             presentQueue_               = VK_NULL_HANDLE;
+        PresentMode                         presentMode_                = PresentMode::Default;
+
+        std::vector<VKFrameInFlight>        framesInFlight_;
+        std::uint32_t                       numFramesInFlight_          = 2;
+        std::uint32_t                       currentFrame_               = 0;
 
-        VKPtr<VkSemaphore>                  imageAvailableSemaphore_;
-        VKPtr<VkSemaphore>                  renderFinishedSemaphore_;
+        // Fence of the last frame that rendered into each swap-chain image (refers to a fence of the command queue).
+        std::vector<VkFence>                swapChainImageFences_;
 
 };
 
@@ -14,6 +14,7 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include "../../Core/Vendor.h"
+#include "../../Core/Assertion.h"
 #include "../GLCommon/GLTypes.h"
 #include "VKCore.h"
 #include "VKTypes.h"
@@ -63,16 +64,102 @@ static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long bufferFlags)
         return VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 }
 
-static void FillBufferCreateInfo(VkBufferCreateInfo& createInfo, VkDeviceSize size, VkBufferUsageFlags usage)
+// Buffers are shared concurrently between all queue families that are in use, so they can be accessed on any command queue without ownership transfers.
+static void FillBufferCreateInfo(
+    VkBufferCreateInfo& createInfo, VkDeviceSize size, VkBufferUsageFlags usage, const std::vector<std::uint32_t>& queueFamilies)
 {
     createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     createInfo.pNext                    = nullptr;
     createInfo.flags                    = 0;
     createInfo.size                     = size;
     createInfo.usage                    = usage;
-    createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
-    createInfo.queueFamilyIndexCount    = 0;
-    createInfo.pQueueFamilyIndices      = nullptr;
+    if (queueFamilies.size() > 1)
+    {
+        createInfo.sharingMode              = VK_SHARING_MODE_CONCURRENT;
+        createInfo.queueFamilyIndexCount    = static_cast<std::uint32_t>(queueFamilies.size());
+        createInfo.pQueueFamilyIndices      = queueFamilies.data();
+    }
+    else
+    {
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+}
+
+static void RecordImageLayoutTransition(
+    VkCommandBuffer commandBuffer, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout, std::uint32_t numMipLevels, std::uint32_t numArrayLayers)
+{
+    /* Initialize image memory barrier descriptor */
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = 0;
+        barrier.dstAccessMask                   = 0;
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = newLayout;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = image;
+        barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel   = 0;
+        barrier.subresourceRange.levelCount     = numMipLevels;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = numArrayLayers;
+    }
+
+    /* Initialize pipeline state flags */
+    VkPipelineStageFlags srcStageMask = 0;
+    VkPipelineStageFlags dstStageMask = 0;
+
+    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+    {
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    }
+    else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    {
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    }
+
+    /* Record image barrier command */
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+static void RecordCopyBuffer(
+    VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset = 0, VkDeviceSize dstOffset = 0)
+{
+    VkBufferCopy region;
+    {
+        region.srcOffset    = srcOffset;
+        region.dstOffset    = dstOffset;
+        region.size         = size;
+    }
+    vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &region);
+}
+
+static void RecordCopyBufferToImage(
+    VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, const VkExtent3D& extent, std::uint32_t numLayers)
+{
+    VkBufferImageCopy region;
+    {
+        region.bufferOffset                     = 0;
+        region.bufferRowLength                  = 0;
+        region.bufferImageHeight                = 0;
+        region.imageSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel        = 0;
+        region.imageSubresource.baseArrayLayer  = 0;
+        region.imageSubresource.layerCount      = numLayers;
+        region.imageOffset                      = { 0, 0, 0 };
+        region.imageExtent                      = extent;
+    }
+    vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 }
 
 #ifdef TEST_VULKAN_MEMORY_MNGR
@@ -161,6 +248,7 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     QueryDeviceProperties();
     CreateLogicalDevice();
     CreateStagingCommandResources();
+    CreateTransferCommandResources();
     CreateDefaultPipelineLayout();
 
     /* Create device memory manager */
@@ -178,9 +266,13 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
 
 VKRenderSystem::~VKRenderSystem()
 {
-    /* Release resource and wait until device becomes idle */
-    ReleaseStagingCommandResources();
+    /* Wait until device becomes idle, then release pending texture reads and staging resources */
     vkDeviceWaitIdle(device_);
+
+    for (auto& textureRead : pendingTextureReads_)
+        ReleaseTextureRead(*textureRead.second);
+
+    ReleaseStagingCommandResources();
 }
 
 /* ----- Render Context ----- */
@@ -189,7 +281,7 @@ RenderContext* VKRenderSystem::CreateRenderContext(const RenderContextDescriptor
 {
     return TakeOwnership(
         renderContexts_,
-        MakeUnique<VKRenderContext>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, desc, surface)
+        MakeUnique<VKRenderContext>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, *commandQueue_, desc, surface)
     );
 }
 
@@ -205,13 +297,35 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* VKRenderSystem::GetDedicatedCommandQueue(const CommandQueueType type)
+{
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (computeCommandQueue_)
+                return computeCommandQueue_.get();
+            break;
+
+        case CommandQueueType::Transfer:
+            if (transferCommandQueue_)
+                return transferCommandQueue_.get();
+            if (computeCommandQueue_)
+                return computeCommandQueue_.get();
+            break;
+
+        default:
+            break;
+    }
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
     return TakeOwnership(
         commandBuffers_,
-        MakeUnique<VKCommandBuffer>(device_, graphicsQueue_, queueFamilyIndices_, desc)
+        MakeUnique<VKCommandBuffer>(device_, queueFamilyIndices_, desc)
     );
 }
 
@@ -239,7 +353,8 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
     FillBufferCreateInfo(
         stagingCreateInfo,
         static_cast<VkDeviceSize>(desc.size),
-        GetStagingVkBufferUsageFlags(desc.flags)
+        GetStagingVkBufferUsageFlags(desc.flags),
+        sharedQueueFamilies_
     );
 
     VKBufferWithRequirements stagingBuffer { device_ };
@@ -263,7 +378,17 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
     buffer->BindToMemory(device_, memoryRegion);
 
     /* Copy staging buffer into hardware buffer */
-    CopyBuffer(stagingBuffer.buffer, buffer->GetVkBuffer(), static_cast<VkDeviceSize>(desc.size));
+    if (HasDedicatedTransferQueue())
+    {
+        /* Upload buffer on the transfer queue, then let the graphics queue wait for it (buffers are shared concurrently, so no ownership transfer is required) */
+        BeginTransferCommands();
+        {
+            RecordCopyBuffer(transferCommandBuffer_, stagingBuffer.buffer, buffer->GetVkBuffer(), static_cast<VkDeviceSize>(desc.size));
+        }
+        EndTransferCommands();
+    }
+    else
+        CopyBuffer(stagingBuffer.buffer, buffer->GetVkBuffer(), static_cast<VkDeviceSize>(desc.size));
 
     if ((desc.flags & g_stagingBufferRelatedFlags) != 0)
     {
@@ -368,7 +493,8 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, const void* data, std::size_t d
         FillBufferCreateInfo(
             stagingCreateInfo,
             static_cast<VkDeviceSize>(dataSize),
-            VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            sharedQueueFamilies_
         );
 
         VKBufferWithRequirements stagingBuffer { device_ };
@@ -451,39 +577,27 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     const auto initialDataSize  = static_cast<VkDeviceSize>(TextureBufferSize(textureDesc.format, imageSize));
 
     /* Set up initial image data */
-    const void* initialData = nullptr;
-    ByteBuffer tempImageBuffer;
+    ImageFormat dstFormat       = ImageFormat::RGBA;
+    DataType    dstDataType     = DataType::Int8;
+    bool        convertImage    = false;
+    ByteBuffer  tempImageBuffer;
 
     if (imageDesc)
     {
         /* Check if image data must be converted */
-        ImageFormat dstFormat   = ImageFormat::RGBA;
-        DataType    dstDataType = DataType::Int8;
-
         if (FindSuitableImageFormat(textureDesc.format, dstFormat, dstDataType))
-        {
-            /* Convert image format (will be null if no conversion is necessary) */
-            tempImageBuffer = ConvertImageBuffer(*imageDesc, dstFormat, dstDataType, cfg.threadCount);
-        }
+            convertImage = (imageDesc->format != dstFormat || imageDesc->dataType != dstDataType);
 
-        if (tempImageBuffer)
+        if (convertImage)
         {
-            /*
-            Validate that source image data was large enough so conversion is valid,
-            then use temporary image buffer as source for initial data
-            */
+            /* Validate that source image data is large enough so conversion is valid */
             const auto srcImageDataSize = imageSize * ImageFormatSize(imageDesc->format) * DataTypeSize(imageDesc->dataType);
             AssertImageDataSize(imageDesc->dataSize, static_cast<std::size_t>(srcImageDataSize));
-            initialData = tempImageBuffer.get();
         }
         else
         {
-            /*
-            Validate that image data is large enough,
-            then use input data as source for initial data
-            */
+            /* Validate that image data is large enough to be copied as is */
             AssertImageDataSize(imageDesc->dataSize, static_cast<std::size_t>(initialDataSize));
-            initialData = imageDesc->data;
         }
     }
     else if (cfg.imageInitialization.enabled)
@@ -499,42 +613,85 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         }
         else
             tempImageBuffer = GenerateEmptyByteBuffer(static_cast<std::size_t>(initialDataSize));
-
-        initialData = tempImageBuffer.get();
     }
 
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
-    FillBufferCreateInfo(stagingCreateInfo, initialDataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT); // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(desc.flags)
+    FillBufferCreateInfo(stagingCreateInfo, initialDataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, sharedQueueFamilies_); // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(desc.flags)
 
     VKBufferWithRequirements stagingBuffer { device_ };
     VKDeviceMemoryRegion* memoryRegionStaging = nullptr;
 
-    std::tie(stagingBuffer, memoryRegionStaging) = CreateStagingBuffer(
-        stagingCreateInfo,
-        initialData,
-        static_cast<std::size_t>(initialDataSize)
-    );
+    std::tie(stagingBuffer, memoryRegionStaging) = CreateStagingBuffer(stagingCreateInfo);
+
+    /* Write initial image data directly into the mapped staging memory, i.e. without an intermediate image buffer */
+    if (imageDesc != nullptr || tempImageBuffer)
+    {
+        auto stagingDeviceMemory = memoryRegionStaging->GetParentChunk();
+
+        if (auto memory = stagingDeviceMemory->Map(device_, memoryRegionStaging->GetOffset(), initialDataSize))
+        {
+            if (convertImage)
+            {
+                /* Convert image format into staging memory */
+                const DstImageDescriptor dstImageDesc { dstFormat, dstDataType, memory, static_cast<std::size_t>(initialDataSize) };
+                ConvertImageBuffer(*imageDesc, dstImageDesc, cfg.threadCount);
+            }
+            else if (imageDesc != nullptr)
+            {
+                /* Copy image data as is */
+                ::memcpy(memory, imageDesc->data, static_cast<std::size_t>(initialDataSize));
+            }
+            else
+            {
+                /* Copy default image data */
+                ::memcpy(memory, tempImageBuffer.get(), static_cast<std::size_t>(initialDataSize));
+            }
+            stagingDeviceMemory->Unmap(device_);
+        }
+    }
 
     /* Create device texture */
-    auto textureVK      = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+    auto textureVK      = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc, sharedQueueFamilies_);
 
     auto image          = textureVK->GetVkImage();
     auto mipLevels      = textureVK->GetNumMipLevels();
     auto arrayLayers    = textureVK->GetNumArrayLayers();
 
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    auto formatVK = VKTypes::Map(textureDesc.format);
-    TransitionImageLayout(image, formatVK, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels, arrayLayers);
-    {
-        CopyBufferToImage(
-            stagingBuffer.buffer,
-            image,
-            GetTextureVkExtent(textureDesc),
-            GetTextureLayertCount(textureDesc)
-        );
+    if (HasDedicatedTransferQueue())
+    {
+        /* Upload image on the transfer queue including the final layout transition, then let the graphics queue wait for it */
+        BeginTransferCommands();
+        {
+            RecordImageLayoutTransition(transferCommandBuffer_, image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels, arrayLayers);
+            RecordCopyBufferToImage(
+                transferCommandBuffer_,
+                stagingBuffer.buffer,
+                image,
+                GetTextureVkExtent(textureDesc),
+                GetTextureLayertCount(textureDesc)
+            );
+            RecordTransferImageLayoutTransition(image, mipLevels, arrayLayers);
+        }
+        EndTransferCommands();
+    }
+    else
+    {
+        auto formatVK = VKTypes::Map(textureDesc.format);
+        TransitionImageLayout(image, formatVK, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, mipLevels, arrayLayers);
+        {
+            CopyBufferToImage(
+                stagingBuffer.buffer,
+                image,
+                GetTextureVkExtent(textureDesc),
+                GetTextureLayertCount(textureDesc)
+            );
+        }
+        TransitionImageLayout(image, formatVK, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels, arrayLayers);
     }
-    TransitionImageLayout(image, formatVK, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels, arrayLayers);
+
+    textureVK->SetVkImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
     /* Release staging buffer */
     deviceMemoryMngr_->Release(memoryRegionStaging);
@@ -547,8 +704,9 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void VKRenderSystem::Release(Texture& texture)
 {
-    /* Release device memory region, then release texture object */
+    /* Drop deferred MIP-map generation, release device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    mipGenerator_->Discard(textureVK);
     deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
     RemoveFromUniqueSet(textures_, &texture);
 }
@@ -560,7 +718,85 @@ void VKRenderSystem::WriteTexture(Texture& texture, const SubTextureDescriptor&
 
 void VKRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
 {
-    //todo
+    LLGL_ASSERT_PTR(imageDesc.data);
+
+    auto& textureVK = LLGL_CAST(const VKTexture&, texture);
+
+    /* Copy texture data into staging buffer and wait until the copy has finished */
+    auto textureRead = RecordTextureRead(textureVK, mipLevel);
+
+    VkFence fence = SubmitTextureRead(*textureRead, VK_NULL_HANDLE);
+    vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+
+    /* Copy staging buffer into output image */
+    try
+    {
+        ResolveStagingTextureRead(*textureRead, imageDesc);
+    }
+    catch (...)
+    {
+        ReleaseTextureRead(*textureRead);
+        throw;
+    }
+
+    ReleaseTextureRead(*textureRead);
+}
+
+TextureReadHandle VKRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence)
+{
+    auto& textureVK = LLGL_CAST(const VKTexture&, texture);
+    auto& fenceVK   = LLGL_CAST(VKFence&, fence);
+
+    /* Staging data can only be tracked with a binary fence that is signaled by the copy submission itself */
+    if (fenceVK.IsTimeline())
+        throw std::invalid_argument("cannot read texture asynchronously with timeline fence (use a binary fence instead)");
+
+    /* Copy texture data into staging buffer and signal fence once the copy has finished */
+    auto textureRead = RecordTextureRead(textureVK, mipLevel);
+
+    fenceVK.Reset(device_);
+    SubmitTextureRead(*textureRead, fenceVK.GetHardwareFence());
+
+    /* Store pending read operation */
+    std::lock_guard<std::mutex> guard { pendingTextureReadsMutex_ };
+
+    TextureReadHandle handle;
+    handle.id = ++pendingTextureReadCounter_;
+    pendingTextureReads_[handle.id] = std::move(textureRead);
+
+    return handle;
+}
+
+void VKRenderSystem::ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc)
+{
+    /* Take ownership of pending read operation */
+    std::unique_ptr<VKTextureRead> textureRead;
+    {
+        std::lock_guard<std::mutex> guard { pendingTextureReadsMutex_ };
+
+        auto it = pendingTextureReads_.find(handle.id);
+        if (it == pendingTextureReads_.end())
+            throw std::invalid_argument("cannot resolve texture read with invalid handle");
+
+        textureRead = std::move(it->second);
+        pendingTextureReads_.erase(it);
+    }
+
+    /* Copy staging buffer into output image */
+    if (imageDesc.data != nullptr)
+    {
+        try
+        {
+            ResolveStagingTextureRead(*textureRead, imageDesc);
+        }
+        catch (...)
+        {
+            ReleaseTextureRead(*textureRead);
+            throw;
+        }
+    }
+
+    ReleaseTextureRead(*textureRead);
 }
 
 void VKRenderSystem::GenerateMips(Texture& texture)
@@ -580,7 +816,7 @@ void VKRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
 
     const auto maxNumMipLevels      = textureVK.GetNumMipLevels();
-    const auto maxNumArrayLayers    = std::uint32_t(1u); //TODO...
+    const auto maxNumArrayLayers    = textureVK.GetNumArrayLayers();
 
     if (baseMipLevel < maxNumMipLevels && baseArrayLayer < maxNumArrayLayers && numMipLevels > 0 && numArrayLayers > 0)
     {
@@ -594,6 +830,22 @@ void VKRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
     }
 }
 
+void VKRenderSystem::GenerateMipsBatch(std::uint32_t numTextures, Texture* const * textures, Fence* fence)
+{
+    /* Append all textures to the pending MIP-map generations, which are then submitted at once */
+    for (std::uint32_t i = 0; i < numTextures; ++i)
+    {
+        auto textureVK = LLGL_CAST(VKTexture*, textures[i]);
+        mipGenerator_->Enqueue(*textureVK, 0, textureVK->GetNumMipLevels(), 0, textureVK->GetNumArrayLayers());
+    }
+
+    /* Submitting the fence also submits the pending MIP-map generation within the same queue submission */
+    if (fence != nullptr)
+        commandQueue_->Submit(*fence);
+    else
+        commandQueue_->SubmitPendingMips();
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& desc)
@@ -704,6 +956,26 @@ ComputePipeline* VKRenderSystem::CreateComputePipeline(const ComputePipelineDesc
     return TakeOwnership(computePipelines_, MakeUnique<VKComputePipeline>(device_, desc, defaultPipelineLayout_));
 }
 
+GraphicsPipeline* VKRenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    return TakeOwnership(
+        graphicsPipelines_,
+        MakeUnique<VKGraphicsPipeline>(
+            device_,
+            defaultPipelineLayout_,
+            (!renderContexts_.empty() ? (*renderContexts_.begin())->GetRenderPass() : nullptr),
+            desc,
+            gfxPipelineLimits_,
+            &pipelineCompiler_
+        )
+    );
+}
+
+ComputePipeline* VKRenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    return TakeOwnership(computePipelines_, MakeUnique<VKComputePipeline>(device_, desc, defaultPipelineLayout_, &pipelineCompiler_));
+}
+
 void VKRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
     RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
@@ -733,6 +1005,13 @@ Fence* VKRenderSystem::CreateFence()
     return TakeOwnership(fences_, MakeUnique<VKFence>(device_));
 }
 
+Fence* VKRenderSystem::CreateTimelineFence(std::uint64_t initialValue)
+{
+    if (!timelineSemaphores_)
+        throw std::runtime_error("timeline fences are not supported, because VK_KHR_timeline_semaphore is not available");
+    return TakeOwnership(fences_, MakeUnique<VKFence>(device_, initialValue));
+}
+
 void VKRenderSystem::Release(Fence& fence)
 {
     RemoveFromUniqueSet(fences_, &fence);
@@ -933,6 +1212,9 @@ void VKRenderSystem::QueryDeviceProperties()
         caps.features.hasConservativeRasterization      = false;
         caps.features.hasStreamOutputs                  = false;
         caps.features.hasLogicOp                        = true;
+        #ifdef VK_KHR_timeline_semaphore
+        caps.features.hasTimelineFences                 = CheckDeviceExtensionSupport(physicalDevice_, { VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME });
+        #endif
 
         /* Query limits */
         caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -972,8 +1254,33 @@ void VKRenderSystem::CreateLogicalDevice()
     /* Initialize queue create description */
     queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice_, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
 
+    /*
+    Find dedicated queue families for async-compute and transfer work.
+    If there is no transfer-only family, transfers fall back to the async-compute family, and compute falls back to the graphics family.
+    */
+    queueFamilyIndices_.computeFamily   = VKFindDedicatedQueueFamily(physicalDevice_, VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+    queueFamilyIndices_.transferFamily  = VKFindDedicatedQueueFamily(physicalDevice_, VK_QUEUE_TRANSFER_BIT, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+
+    if (queueFamilyIndices_.computeFamily == QueueFamilyIndices::invalidIndex)
+        queueFamilyIndices_.computeFamily = queueFamilyIndices_.graphicsFamily;
+    if (queueFamilyIndices_.transferFamily == QueueFamilyIndices::invalidIndex)
+        queueFamilyIndices_.transferFamily = queueFamilyIndices_.computeFamily;
+
+    /* Share buffers and textures between all distinct queue families of the command queues */
+    sharedQueueFamilies_ = { queueFamilyIndices_.graphicsFamily };
+    if (!Contains(sharedQueueFamilies_, queueFamilyIndices_.computeFamily))
+        sharedQueueFamilies_.push_back(queueFamilyIndices_.computeFamily);
+    if (!Contains(sharedQueueFamilies_, queueFamilyIndices_.transferFamily))
+        sharedQueueFamilies_.push_back(queueFamilyIndices_.transferFamily);
+
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
-    std::set<std::uint32_t> uniqueQueueFamilies = { queueFamilyIndices_.graphicsFamily, queueFamilyIndices_.presentFamily };
+    std::set<std::uint32_t> uniqueQueueFamilies =
+    {
+        queueFamilyIndices_.graphicsFamily,
+        queueFamilyIndices_.presentFamily,
+        queueFamilyIndices_.computeFamily,
+        queueFamilyIndices_.transferFamily,
+    };
 
     float queuePriority = 1.0f;
     for (auto family : uniqueQueueFamilies)
@@ -990,28 +1297,61 @@ void VKRenderSystem::CreateLogicalDevice()
         queueCreateInfos.push_back(info);
     }
 
+    /* Enable optional device extensions */
+    std::vector<const char*> deviceExtensions = g_deviceExtensions;
+    const void* deviceCreateInfoNext = nullptr;
+
+    #ifdef VK_KHR_timeline_semaphore
+
+    /* Timeline semaphores are used for timeline fences (the feature is always available if the extension is supported) */
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures;
+    {
+        timelineSemaphoreFeatures.sType             = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timelineSemaphoreFeatures.pNext             = nullptr;
+        timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+    }
+
+    if (GetRenderingCaps().features.hasTimelineFences)
+    {
+        deviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+        deviceCreateInfoNext = (&timelineSemaphoreFeatures);
+    }
+
+    #endif // /VK_KHR_timeline_semaphore
+
     /* Create logical device */
     VkDeviceCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext                    = nullptr;
+        createInfo.pNext                    = deviceCreateInfoNext;
         createInfo.flags                    = 0;
         createInfo.queueCreateInfoCount     = static_cast<std::uint32_t>(queueCreateInfos.size());
         createInfo.pQueueCreateInfos        = queueCreateInfos.data();
         createInfo.enabledLayerCount        = 0;
         createInfo.ppEnabledLayerNames      = nullptr;
-        createInfo.enabledExtensionCount    = static_cast<std::uint32_t>(g_deviceExtensions.size());
-        createInfo.ppEnabledExtensionNames  = g_deviceExtensions.data();
+        createInfo.enabledExtensionCount    = static_cast<std::uint32_t>(deviceExtensions.size());
+        createInfo.ppEnabledExtensionNames  = deviceExtensions.data();
         createInfo.pEnabledFeatures         = &features_;
     }
     VkResult result = vkCreateDevice(physicalDevice_, &createInfo, nullptr, device_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan logical device");
 
-    /* Query device graphics queue */
+    /* Load device procedures of optional extensions */
+    if (GetRenderingCaps().features.hasTimelineFences)
+        timelineSemaphores_ = LoadTimelineSemaphoreExtension(device_);
+
+    /* Query device queues (compute and transfer queues are equal to the graphics queue if there are no dedicated queue families) */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
+    vkGetDeviceQueue(device_, queueFamilyIndices_.computeFamily, 0, &computeQueue_);
+    vkGetDeviceQueue(device_, queueFamilyIndices_.transferFamily, 0, &transferQueue_);
 
-    /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, graphicsQueue_);
+    /* Create command queue interfaces; dedicated queues are only created for distinct native queues */
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, graphicsQueue_, queueFamilyIndices_.graphicsFamily);
+
+    if (computeQueue_ != graphicsQueue_)
+        computeCommandQueue_ = MakeUnique<VKCommandQueue>(device_, computeQueue_, queueFamilyIndices_.computeFamily);
+    if (transferQueue_ != graphicsQueue_ && transferQueue_ != computeQueue_)
+        transferCommandQueue_ = MakeUnique<VKCommandQueue>(device_, transferQueue_, queueFamilyIndices_.transferFamily);
 }
 
 void VKRenderSystem::CreateStagingCommandResources()
@@ -1038,13 +1378,98 @@ void VKRenderSystem::CreateStagingCommandResources()
     }
     result = vkAllocateCommandBuffers(device_, &allocInfo, &stagingCommandBuffer_);
     VKThrowIfFailed(result, "failed to create Vulkan command buffer for staging buffers");
+
+    /* Create MIP-map generator, whose pending work must be submitted before any other command buffer */
+    mipGenerator_ = MakeUnique<VKMipGenerator>(device_, physicalDevice_, stagingCommandPool_);
+    commandQueue_->SetMipGenerator(mipGenerator_.get());
+}
+
+static const std::size_t g_numTransferSemaphores = 4;
+
+VKRenderSystem::VKTransferSemaphore::VKTransferSemaphore(const VKPtr<VkDevice>& device) :
+    semaphore { device, vkDestroySemaphore },
+    fence     { device, vkDestroyFence     }
+{
+}
+
+void VKRenderSystem::CreateTransferCommandResources()
+{
+    /* Initial resource data is only uploaded on a separate queue if the device provides one */
+    if (transferQueue_ == graphicsQueue_)
+        return;
+
+    /* Create transfer command pool */
+    VkCommandPoolCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        createInfo.queueFamilyIndex = queueFamilyIndices_.transferFamily;
+    }
+    auto result = vkCreateCommandPool(device_, &createInfo, nullptr, transferCommandPool_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan command pool for transfer queue");
+
+    /* Allocate transfer command buffer */
+    VkCommandBufferAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.commandPool           = transferCommandPool_;
+        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount    = 1;
+    }
+    result = vkAllocateCommandBuffers(device_, &allocInfo, &transferCommandBuffer_);
+    VKThrowIfFailed(result, "failed to create Vulkan command buffer for transfer queue");
+
+    /*
+    Create ring buffer of transfer semaphores.
+    Each semaphore lets the graphics queue wait for an upload and has its own fence, which is signaled once the graphics queue has executed that wait.
+    */
+    VkSemaphoreCreateInfo semaphoreCreateInfo;
+    {
+        semaphoreCreateInfo.sType   = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreCreateInfo.pNext   = nullptr;
+        semaphoreCreateInfo.flags   = 0;
+    }
+
+    VkFenceCreateInfo fenceCreateInfo;
+    {
+        fenceCreateInfo.sType   = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceCreateInfo.pNext   = nullptr;
+        fenceCreateInfo.flags   = VK_FENCE_CREATE_SIGNALED_BIT;
+    }
+
+    transferSemaphores_.reserve(g_numTransferSemaphores);
+    for (std::size_t i = 0; i < g_numTransferSemaphores; ++i)
+    {
+        transferSemaphores_.emplace_back(device_);
+        auto& transfer = transferSemaphores_.back();
+
+        result = vkCreateSemaphore(device_, &semaphoreCreateInfo, nullptr, transfer.semaphore.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan semaphore for transfer queue");
+
+        result = vkCreateFence(device_, &fenceCreateInfo, nullptr, transfer.fence.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for transfer queue");
+    }
 }
 
 void VKRenderSystem::ReleaseStagingCommandResources()
 {
-    /* Release staging command buffer */
+    /* Release MIP-map generator and staging command buffer */
+    commandQueue_->SetMipGenerator(nullptr);
+    mipGenerator_.reset();
+
     vkFreeCommandBuffers(device_, stagingCommandPool_, 1, &stagingCommandBuffer_);
     stagingCommandBuffer_ = VK_NULL_HANDLE;
+
+    /* Release transfer command buffer and semaphores */
+    transferSemaphores_.clear();
+
+    if (transferCommandBuffer_ != VK_NULL_HANDLE)
+    {
+        vkFreeCommandBuffers(device_, transferCommandPool_, 1, &transferCommandBuffer_);
+        transferCommandBuffer_ = VK_NULL_HANDLE;
+    }
 }
 
 void VKRenderSystem::CreateDefaultPipelineLayout()
@@ -1079,6 +1504,9 @@ bool VKRenderSystem::IsExtensionRequired(const std::string& name) const
         || name == VK_KHR_XLIB_SURFACE_EXTENSION_NAME
         #endif
         || (debugLayerEnabled_ && name == VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+        #ifdef VK_KHR_timeline_semaphore
+        || name == VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME
+        #endif
     );
 }
 
@@ -1119,28 +1547,28 @@ VKBuffer* VKRenderSystem::CreateHardwareBuffer(const BufferDescriptor& desc, VkB
     {
         case BufferType::Vertex:
         {
-            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT));
+            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT), sharedQueueFamilies_);
             return TakeOwnership(buffers_, MakeUnique<VKBuffer>(BufferType::Vertex, device_, createInfo));
         }
         break;
 
         case BufferType::Index:
         {
-            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_INDEX_BUFFER_BIT));
+            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_INDEX_BUFFER_BIT), sharedQueueFamilies_);
             return TakeOwnership(buffers_, MakeUnique<VKIndexBuffer>(device_, createInfo, desc.indexBuffer.format));
         }
         break;
 
         case BufferType::Constant:
         {
-            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT));
+            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT), sharedQueueFamilies_);
             return TakeOwnership(buffers_, MakeUnique<VKBuffer>(BufferType::Constant, device_, createInfo));
         }
         break;
 
         case BufferType::Storage:
         {
-            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+            FillBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), sharedQueueFamilies_);
             return TakeOwnership(buffers_, MakeUnique<VKBuffer>(BufferType::Storage, device_, createInfo));
         }
         break;
@@ -1206,31 +1634,120 @@ void VKRenderSystem::EndStagingCommands()
     /* End command buffer record */
     vkEndCommandBuffer(stagingCommandBuffer_);
 
-    /* Submit command buffer to queue */
+    /* Submit command buffer to queue and wait until it has been completed, so the staging resources can be reused */
     VkSubmitInfo submitInfo = {};
     {
         submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.commandBufferCount   = 1;
         submitInfo.pCommandBuffers      = (&stagingCommandBuffer_);
     }
-    vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(graphicsQueue_);
+    VkFence fence = commandQueue_->SubmitBatch(submitInfo);
+    vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
 }
 
 void VKRenderSystem::TransitionImageLayout(
     VkImage image, VkFormat /*format*/, VkImageLayout oldLayout, VkImageLayout newLayout, std::uint32_t numMipLevels, std::uint32_t numArrayLayers)
 {
     BeginStagingCommands();
+    RecordImageLayoutTransition(stagingCommandBuffer_, image, oldLayout, newLayout, numMipLevels, numArrayLayers);
+    EndStagingCommands();
+}
 
-    /* Initialize image memory barrier descriptor */
+void VKRenderSystem::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset, VkDeviceSize dstOffset)
+{
+    BeginStagingCommands();
+    RecordCopyBuffer(stagingCommandBuffer_, srcBuffer, dstBuffer, size, srcOffset, dstOffset);
+    EndStagingCommands();
+}
+
+void VKRenderSystem::CopyBufferToImage(VkBuffer srcBuffer, VkImage dstImage, const VkExtent3D& extent, std::uint32_t numLayers)
+{
+    BeginStagingCommands();
+    RecordCopyBufferToImage(stagingCommandBuffer_, srcBuffer, dstImage, extent, numLayers);
+    EndStagingCommands();
+}
+
+bool VKRenderSystem::HasDedicatedTransferQueue() const
+{
+    return (transferCommandBuffer_ != VK_NULL_HANDLE);
+}
+
+void VKRenderSystem::BeginTransferCommands()
+{
+    /* Wait until the graphics queue has executed the oldest wait operation, before its semaphore is reused */
+    transferSemaphoreIndex_ = (transferSemaphoreIndex_ + 1) % transferSemaphores_.size();
+    auto& transfer = transferSemaphores_[transferSemaphoreIndex_];
+
+    VkFence fence = transfer.fence.Get();
+    vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+
+    /* Begin recording of transfer command buffer */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    auto result = vkBeginCommandBuffer(transferCommandBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin recording Vulkan command buffer");
+}
+
+void VKRenderSystem::EndTransferCommands()
+{
+    auto& transfer = transferSemaphores_[transferSemaphoreIndex_];
+
+    /* End command buffer record */
+    vkEndCommandBuffer(transferCommandBuffer_);
+
+    /* Submit upload to the command queue of the transfer queue, which signals the semaphore for the graphics queue */
+    VkSemaphore semaphore = transfer.semaphore.Get();
+
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = (&transferCommandBuffer_);
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = (&semaphore);
+    }
+    VkFence uploadFence = GetTransferCommandQueue()->SubmitBatch(submitInfo);
+
+    /*
+    Let the graphics queue wait for the semaphore with an empty batch; only subsequent graphics work waits for the upload.
+    The semaphore wait also makes the uploaded data visible to all commands on the graphics queue.
+    */
+    const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    VkSubmitInfo waitSubmitInfo = {};
+    {
+        waitSubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        waitSubmitInfo.waitSemaphoreCount   = 1;
+        waitSubmitInfo.pWaitSemaphores      = (&semaphore);
+        waitSubmitInfo.pWaitDstStageMask    = (&waitStage);
+    }
+    VkFence waitFence = transfer.fence.Get();
+    vkResetFences(device_, 1, &waitFence);
+    commandQueue_->SubmitBatch(waitSubmitInfo, waitFence);
+
+    /* Only wait for the upload, so the staging buffer can be released without stalling on pending graphics work */
+    vkWaitForFences(device_, 1, &uploadFence, VK_TRUE, UINT64_MAX);
+}
+
+void VKRenderSystem::RecordTransferImageLayoutTransition(VkImage image, std::uint32_t numMipLevels, std::uint32_t numArrayLayers)
+{
+    /*
+    Transition the uploaded image into the sampling layout on the transfer queue.
+    The destination scope is empty, since the semaphore for the graphics queue already makes the image visible to all subsequent commands.
+    */
     VkImageMemoryBarrier barrier;
     {
         barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
         barrier.pNext                           = nullptr;
-        barrier.srcAccessMask                   = 0;
+        barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
         barrier.dstAccessMask                   = 0;
-        barrier.oldLayout                       = oldLayout;
-        barrier.newLayout                       = newLayout;
+        barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
         barrier.image                           = image;
@@ -1240,68 +1757,241 @@ void VKRenderSystem::TransitionImageLayout(
         barrier.subresourceRange.baseArrayLayer = 0;
         barrier.subresourceRange.layerCount     = numArrayLayers;
     }
+    vkCmdPipelineBarrier(
+        transferCommandBuffer_, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier
+    );
+}
 
-    /* Initialize pipeline state flags */
-    VkPipelineStageFlags srcStageMask = 0;
-    VkPipelineStageFlags dstStageMask = 0;
+VKCommandQueue* VKRenderSystem::GetTransferCommandQueue() const
+{
+    /* The transfer queue is shared with the async-compute queue if there is no transfer-only queue family */
+    if (transferCommandQueue_)
+        return transferCommandQueue_.get();
+    else
+        return computeCommandQueue_.get();
+}
 
-    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+VKRenderSystem::VKTextureRead::VKTextureRead(const VKPtr<VkDevice>& device) :
+    stagingBuffer { device }
+{
+}
+
+// Returns the access flags of all operations that can access an image in the specified layout.
+static VkAccessFlags GetImageLayoutAccessMask(VkImageLayout layout)
+{
+    switch (layout)
     {
-        barrier.srcAccessMask = 0;
-        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        srcStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-        dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        case VK_IMAGE_LAYOUT_GENERAL:
+            return (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            return (VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            return (VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL:
+            return (VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_SHADER_READ_BIT);
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            return VK_ACCESS_SHADER_READ_BIT;
+        case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+            return VK_ACCESS_TRANSFER_READ_BIT;
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+            return VK_ACCESS_TRANSFER_WRITE_BIT;
+        default:
+            return 0;
     }
-    else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+}
+
+static void RecordTextureReadBarrier(
+    VkCommandBuffer         commandBuffer,
+    VkImage                 image,
+    VkImageAspectFlags      aspectMask,
+    std::uint32_t           mipLevel,
+    std::uint32_t           numArrayLayers,
+    VkImageLayout           oldLayout,
+    VkImageLayout           newLayout,
+    VkAccessFlags           srcAccessMask,
+    VkAccessFlags           dstAccessMask,
+    VkPipelineStageFlags    srcStageMask,
+    VkPipelineStageFlags    dstStageMask)
+{
+    VkImageMemoryBarrier barrier;
     {
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-        srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = srcAccessMask;
+        barrier.dstAccessMask                   = dstAccessMask;
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = newLayout;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = image;
+        barrier.subresourceRange.aspectMask     = aspectMask;
+        barrier.subresourceRange.baseMipLevel   = mipLevel;
+        barrier.subresourceRange.levelCount     = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = numArrayLayers;
     }
-
-    /* Record image barrier command */
-    vkCmdPipelineBarrier(stagingCommandBuffer_, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
-
-    EndStagingCommands();
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
 }
 
-void VKRenderSystem::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset, VkDeviceSize dstOffset)
+std::unique_ptr<VKRenderSystem::VKTextureRead> VKRenderSystem::RecordTextureRead(const VKTexture& textureVK, std::uint32_t mipLevel)
 {
-    BeginStagingCommands();
+    /* Determine native image format of the texture (only one image aspect can be copied at a time) */
+    const auto format = textureVK.QueryDesc().format;
+    if (IsStencilFormat(format))
+        throw std::invalid_argument("cannot read texture with combined depth-stencil format");
 
-    /* Record copy command */
-    VkBufferCopy region;
+    auto textureRead = MakeUnique<VKTextureRead>(device_);
+    GetTextureReadFormat(format, textureRead->format, textureRead->dataType);
+
+    /* Determine image region to copy: array layers are copied via the subresource, 3D textures via the extent */
+    const auto mipExtent        = textureVK.QueryMipExtent(mipLevel);
+    const auto numArrayLayers   = textureVK.GetNumArrayLayers();
+
+    VkExtent3D imageExtent { mipExtent.width, mipExtent.height, 1 };
+
+    switch (textureVK.GetType())
     {
-        region.srcOffset    = srcOffset;
-        region.dstOffset    = dstOffset;
-        region.size         = size;
+        case TextureType::Texture1D:
+        case TextureType::Texture1DArray:
+            imageExtent.height = 1;
+            break;
+        case TextureType::Texture3D:
+            imageExtent.depth = mipExtent.depth;
+            break;
+        default:
+            break;
     }
-    vkCmdCopyBuffer(stagingCommandBuffer_, srcBuffer, dstBuffer, 1, &region);
 
-    EndStagingCommands();
-}
+    textureRead->dataSize = ImageDataSize(
+        textureRead->format,
+        textureRead->dataType,
+        imageExtent.width * imageExtent.height * imageExtent.depth * numArrayLayers
+    );
 
-void VKRenderSystem::CopyBufferToImage(VkBuffer srcBuffer, VkImage dstImage, const VkExtent3D& extent, std::uint32_t numLayers)
-{
-    BeginStagingCommands();
+    /* Create host-visible staging buffer */
+    VkBufferCreateInfo stagingCreateInfo;
+    FillBufferCreateInfo(stagingCreateInfo, static_cast<VkDeviceSize>(textureRead->dataSize), VK_BUFFER_USAGE_TRANSFER_DST_BIT, sharedQueueFamilies_);
+
+    std::tie(textureRead->stagingBuffer, textureRead->memoryRegion) = CreateStagingBuffer(stagingCreateInfo);
+
+    /* Allocate command buffer for this read operation, so it can be submitted without waiting for the queue to become idle */
+    VkCommandBufferAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.commandPool           = stagingCommandPool_;
+        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount    = 1;
+    }
+    auto result = vkAllocateCommandBuffers(device_, &allocInfo, &(textureRead->commandBuffer));
+    VKThrowIfFailed(result, "failed to create Vulkan command buffer for texture read");
+
+    /* Record copy command enclosed by layout transitions */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    result = vkBeginCommandBuffer(textureRead->commandBuffer, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin Vulkan command buffer for texture read");
+
+    const auto image        = textureVK.GetVkImage();
+    const auto aspectMask   = (IsDepthFormat(format) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT);
+    const auto imageLayout  = textureVK.GetVkImageLayout();
+    const auto accessMask   = GetImageLayoutAccessMask(imageLayout);
+
+    RecordTextureReadBarrier(
+        textureRead->commandBuffer, image, aspectMask, mipLevel, numArrayLayers,
+        imageLayout, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        accessMask, VK_ACCESS_TRANSFER_READ_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT
+    );
 
-    /* Record copy command */
     VkBufferImageCopy region;
     {
         region.bufferOffset                     = 0;
         region.bufferRowLength                  = 0;
         region.bufferImageHeight                = 0;
-        region.imageSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel        = 0;
+        region.imageSubresource.aspectMask      = aspectMask;
+        region.imageSubresource.mipLevel        = mipLevel;
         region.imageSubresource.baseArrayLayer  = 0;
-        region.imageSubresource.layerCount      = numLayers;
+        region.imageSubresource.layerCount      = numArrayLayers;
         region.imageOffset                      = { 0, 0, 0 };
-        region.imageExtent                      = extent;
+        region.imageExtent                      = imageExtent;
     }
-    vkCmdCopyBufferToImage(stagingCommandBuffer_, srcBuffer, dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    vkCmdCopyImageToBuffer(textureRead->commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, textureRead->stagingBuffer.buffer, 1, &region);
 
-    EndStagingCommands();
+    /* Restore the tracked layout (an image without content stays in the transfer layout, since later transitions start from the undefined layout) */
+    if (imageLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        RecordTextureReadBarrier(
+            textureRead->commandBuffer, image, aspectMask, mipLevel, numArrayLayers,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, imageLayout,
+            VK_ACCESS_TRANSFER_READ_BIT, accessMask,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+        );
+    }
+
+    result = vkEndCommandBuffer(textureRead->commandBuffer);
+    VKThrowIfFailed(result, "failed to end Vulkan command buffer for texture read");
+
+    return textureRead;
+}
+
+VkFence VKRenderSystem::SubmitTextureRead(const VKTextureRead& textureRead, VkFence fence)
+{
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = (&textureRead.commandBuffer);
+    }
+    return commandQueue_->SubmitBatch(submitInfo, fence);
+}
+
+void VKRenderSystem::ResolveStagingTextureRead(VKTextureRead& textureRead, const DstImageDescriptor& imageDesc)
+{
+    auto stagingDeviceMemory = textureRead.memoryRegion->GetParentChunk();
+
+    if (auto memory = stagingDeviceMemory->Map(device_, textureRead.memoryRegion->GetOffset(), static_cast<VkDeviceSize>(textureRead.dataSize)))
+    {
+        const SrcImageDescriptor srcImageDesc
+        {
+            textureRead.format,
+            textureRead.dataType,
+            memory,
+            textureRead.dataSize
+        };
+
+        try
+        {
+            CopyTextureReadData(srcImageDesc, imageDesc);
+        }
+        catch (...)
+        {
+            stagingDeviceMemory->Unmap(device_);
+            throw;
+        }
+
+        stagingDeviceMemory->Unmap(device_);
+    }
+}
+
+void VKRenderSystem::ReleaseTextureRead(VKTextureRead& textureRead)
+{
+    if (textureRead.commandBuffer != VK_NULL_HANDLE)
+    {
+        vkFreeCommandBuffers(device_, stagingCommandPool_, 1, &(textureRead.commandBuffer));
+        textureRead.commandBuffer = VK_NULL_HANDLE;
+    }
+    if (textureRead.memoryRegion != nullptr)
+    {
+        deviceMemoryMngr_->Release(textureRead.memoryRegion);
+        textureRead.memoryRegion = nullptr;
+    }
+    textureRead.stagingBuffer.Release();
 }
 
 void VKRenderSystem::AssertBufferCPUAccess(const VKBuffer& bufferVK)
@@ -1310,7 +2000,6 @@ void VKRenderSystem::AssertBufferCPUAccess(const VKBuffer& bufferVK)
         throw std::runtime_error("hardware buffer was not created with CPU access (missing staging VkBuffer)");
 }
 
-//TODO: add parameters
 void VKRenderSystem::GenerateMipsPrimary(
     VKTexture&      textureVK,
     std::uint32_t   baseMipLevel,
@@ -1318,125 +2007,11 @@ void VKRenderSystem::GenerateMipsPrimary(
     std::uint32_t   baseArrayLayer,
     std::uint32_t   numArrayLayers)
 {
-    /* Get Vulkan image object */
-    auto image  = textureVK.GetVkImage();
-    auto extent = textureVK.GetVkExtent();
-
-    TransitionImageLayout(image, VK_FORMAT_UNDEFINED, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, numMipLevels, numArrayLayers);
-
-    BeginStagingCommands();
-
-    /* Initialize image memory barrier */
-    VkImageMemoryBarrier barrier;
-
-    barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    barrier.pNext                           = nullptr;
-    barrier.srcAccessMask                   = 0;
-    barrier.dstAccessMask                   = 0;
-    barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
-    barrier.newLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
-    barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-    barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-    barrier.image                           = image;
-    barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-    barrier.subresourceRange.baseMipLevel   = 0;
-    barrier.subresourceRange.levelCount     = 1;
-    barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount     = 1;
-
-    /* Blit each MIP-map from previous (lower) MIP level */
-    for (std::uint32_t arrayLayer = 0; arrayLayer < numArrayLayers; ++arrayLayer)
-    {
-        auto currExtent = extent;
-
-        for (std::uint32_t mipLevel = 1; mipLevel < numMipLevels; ++mipLevel)
-        {
-            /* Determine extent of next MIP level */
-            auto nextExtent = currExtent;
-
-            nextExtent.width    = std::max(1u, currExtent.width  / 2);
-            nextExtent.height   = std::max(1u, currExtent.height / 2);
-            nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
-
-            /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
-            barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.subresourceRange.baseMipLevel   = mipLevel - 1;
-            barrier.subresourceRange.baseArrayLayer = arrayLayer;
-
-            vkCmdPipelineBarrier(
-                stagingCommandBuffer_,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Blit previous MIP level into next higher MIP level (with smaller extent) */
-            VkImageBlit blit;
-
-            blit.srcSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
-            blit.srcSubresource.mipLevel        = mipLevel - 1;
-            blit.srcSubresource.baseArrayLayer  = arrayLayer;
-            blit.srcSubresource.layerCount      = 1;
-            blit.srcOffsets[0]                  = { 0, 0, 0 };
-            blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
-            blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
-            blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
-            blit.dstSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
-            blit.dstSubresource.mipLevel        = mipLevel;
-            blit.dstSubresource.baseArrayLayer  = arrayLayer;
-            blit.dstSubresource.layerCount      = 1;
-            blit.dstOffsets[0]                  = { 0, 0, 0 };
-            blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
-            blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
-            blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
-
-            vkCmdBlitImage(
-                stagingCommandBuffer_,
-                image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                1, &blit,
-                VK_FILTER_LINEAR
-            );
-
-            /* Transition previous MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
-            barrier.oldLayout       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-            vkCmdPipelineBarrier(
-                stagingCommandBuffer_,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Reduce image extent to next MIP level */
-            currExtent = nextExtent;
-        }
-
-        /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-        barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
-        barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.subresourceRange.baseMipLevel   = numMipLevels - 1;
+    mipGenerator_->Enqueue(textureVK, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
 
-        vkCmdPipelineBarrier(
-            stagingCommandBuffer_,
-            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-            0, nullptr,
-            0, nullptr,
-            1, &barrier
-        );
-    }
-
-    EndStagingCommands();
+    /* Submit immediately, unless MIP-map generation is deferred until the next queue submission */
+    if (!GetConfiguration().deferMipGeneration)
+        commandQueue_->SubmitPendingMips();
 }
 
 
@@ -28,6 +28,7 @@
 #include "Texture/VKTexture.h"
 #include "Texture/VKSampler.h"
 #include "Texture/VKRenderTarget.h"
+#include "Texture/VKMipGenerator.h"
 
 #include "RenderState/VKQuery.h"
 #include "RenderState/VKFence.h"
@@ -35,13 +36,16 @@
 #include "RenderState/VKPipelineLayout.h"
 #include "RenderState/VKGraphicsPipeline.h"
 #include "RenderState/VKComputePipeline.h"
+#include "RenderState/VKPipelineCompiler.h"
 #include "RenderState/VKResourceHeap.h"
 
 #include <string>
 #include <memory>
 #include <vector>
 #include <set>
+#include <map>
 #include <tuple>
+#include <mutex>
 
 
 namespace LLGL
@@ -67,6 +71,7 @@ class VKRenderSystem final : public RenderSystem
         /* ----- Command queues ----- */
 
         CommandQueue* GetCommandQueue() override;
+        CommandQueue* GetDedicatedCommandQueue(const CommandQueueType type) override;
 
         /* ----- Command buffers ----- */
 
@@ -97,8 +102,12 @@ class VKRenderSystem final : public RenderSystem
         void WriteTexture(Texture& texture, const SubTextureDescriptor& subTextureDesc, const SrcImageDescriptor& imageDesc) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        TextureReadHandle ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, Fence& fence) override;
+        void ResolveTextureRead(const TextureReadHandle& handle, const DstImageDescriptor& imageDesc) override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, std::uint32_t baseMipLevel, std::uint32_t numMipLevels, std::uint32_t baseArrayLayer = 0, std::uint32_t numArrayLayers = 1) override;
+        void GenerateMipsBatch(std::uint32_t numTextures, Texture* const * textures, Fence* fence = nullptr) override;
 
         /* ----- Sampler States ---- */
 
@@ -143,6 +152,9 @@ class VKRenderSystem final : public RenderSystem
         GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
         ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
 
+        GraphicsPipeline* CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipelineAsync(const ComputePipelineDescriptor& desc) override;
+
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
@@ -155,9 +167,34 @@ class VKRenderSystem final : public RenderSystem
         /* ----- Fences ----- */
 
         Fence* CreateFence() override;
+        Fence* CreateTimelineFence(std::uint64_t initialValue = 0) override;
 
         void Release(Fence& fence) override;
 
+    private:
+
+        // Texture read operation with its own staging buffer and command buffer.
+        struct VKTextureRead
+        {
+            VKTextureRead(const VKPtr<VkDevice>& device);
+
+            VKBufferWithRequirements    stagingBuffer;
+            VKDeviceMemoryRegion*       memoryRegion    = nullptr;
+            VkCommandBuffer             commandBuffer   = VK_NULL_HANDLE;
+            ImageFormat                 format          = ImageFormat::RGBA;
+            DataType                    dataType        = DataType::UInt8;
+            std::size_t                 dataSize        = 0;
+        };
+
+        // Semaphore that lets the graphics queue wait for an upload on the transfer queue, with a fence that is signaled once the wait has been executed.
+        struct VKTransferSemaphore
+        {
+            VKTransferSemaphore(const VKPtr<VkDevice>& device);
+
+            VKPtr<VkSemaphore>          semaphore;
+            VKPtr<VkFence>              fence;
+        };
+
     private:
 
         void CreateInstance(const ApplicationDescriptor* applicationDesc);
@@ -168,6 +205,7 @@ class VKRenderSystem final : public RenderSystem
         void CreateLogicalDevice();
 
         void CreateStagingCommandResources();
+        void CreateTransferCommandResources();
         void ReleaseStagingCommandResources();
 
         void CreateDefaultPipelineLayout();
@@ -197,8 +235,27 @@ class VKRenderSystem final : public RenderSystem
         void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size, VkDeviceSize srcOffset = 0, VkDeviceSize dstOffset = 0);
         void CopyBufferToImage(VkBuffer srcBuffer, VkImage dstImage, const VkExtent3D& extent, std::uint32_t numLayers);
 
+        // Returns true if initial resource data is uploaded on a dedicated transfer queue.
+        bool HasDedicatedTransferQueue() const;
+
+        // Begins recording of upload commands for the dedicated transfer queue.
+        void BeginTransferCommands();
+
+        // Submits the upload commands to the transfer queue, lets the graphics queue wait for them, and waits until the upload has been completed.
+        void EndTransferCommands();
+
+        void RecordTransferImageLayoutTransition(VkImage image, std::uint32_t numMipLevels, std::uint32_t numArrayLayers);
+
+        // Returns the command queue that owns the native transfer queue.
+        VKCommandQueue* GetTransferCommandQueue() const;
+
         void AssertBufferCPUAccess(const VKBuffer& bufferVK);
 
+        std::unique_ptr<VKTextureRead> RecordTextureRead(const VKTexture& textureVK, std::uint32_t mipLevel);
+        VkFence SubmitTextureRead(const VKTextureRead& textureRead, VkFence fence);
+        void ResolveStagingTextureRead(VKTextureRead& textureRead, const DstImageDescriptor& imageDesc);
+        void ReleaseTextureRead(VKTextureRead& textureRead);
+
         void GenerateMipsPrimary(
             VKTexture&      textureVK,
             std::uint32_t   baseMipLevel,
@@ -215,17 +272,36 @@ class VKRenderSystem final : public RenderSystem
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
 
         QueueFamilyIndices                      queueFamilyIndices_;
+
+        /* Distinct queue families of all command queues, which share all buffers and textures concurrently */
+        std::vector<std::uint32_t>              sharedQueueFamilies_;
+
         VkPhysicalDeviceMemoryProperties        memoryProperties_;
         VkPhysicalDeviceFeatures                features_;
 
         VkQueue                                 graphicsQueue_          = VK_NULL_HANDLE;
+        VkQueue                                 computeQueue_           = VK_NULL_HANDLE;
+        VkQueue                                 transferQueue_          = VK_NULL_HANDLE;
 
         VKPtr<VkCommandPool>                    stagingCommandPool_;
         VkCommandBuffer                         stagingCommandBuffer_   = VK_NULL_HANDLE;
 
+        VKPtr<VkCommandPool>                    transferCommandPool_;
+        VkCommandBuffer                         transferCommandBuffer_  = VK_NULL_HANDLE;
+        std::vector<VKTransferSemaphore>        transferSemaphores_;
+        std::size_t                             transferSemaphoreIndex_ = 0;
+
+        std::unique_ptr<VKMipGenerator>         mipGenerator_;
+
+        /* Pending texture reads can be started and resolved from multiple threads */
+        std::mutex                                              pendingTextureReadsMutex_;
+        std::map<std::uint64_t, std::unique_ptr<VKTextureRead>>   pendingTextureReads_;
+        std::uint64_t                                           pendingTextureReadCounter_  = 0;
+
         VKPtr<VkPipelineLayout>                 defaultPipelineLayout_;
 
         bool                                    debugLayerEnabled_      = false;
+        bool                                    timelineSemaphores_     = false;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
 
@@ -235,6 +311,8 @@ class VKRenderSystem final : public RenderSystem
 
         HWObjectContainer<VKRenderContext>      renderContexts_;
         HWObjectInstance<VKCommandQueue>        commandQueue_;
+        HWObjectInstance<VKCommandQueue>        computeCommandQueue_;
+        HWObjectInstance<VKCommandQueue>        transferCommandQueue_;
         HWObjectContainer<VKCommandBuffer>      commandBuffers_;
         HWObjectContainer<VKBuffer>             buffers_;
         HWObjectContainer<VKBufferArray>        bufferArrays_;
@@ -251,6 +329,11 @@ class VKRenderSystem final : public RenderSystem
         HWObjectContainer<VKQuery>              queries_;
         HWObjectContainer<VKFence>              fences_;
 
+        /* ----- Background workers ----- */
+
+        // Declared after all containers, so it executes its remaining jobs before any pipeline or shader is released.
+        VKPipelineCompiler                      pipelineCompiler_;
+
 };
 
 
@@ -0,0 +1,232 @@
+/*
+ * Test10_SPIRV.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+// Micro-benchmark of the internal SPIR-V parser and reflection.
+// Usage: Test10_SPIRV [-n <number of modules>] [<file.spv> ...]
+// All specified modules are repeated until the corpus has the requested number of modules (default is 30000).
+
+#include "../sources/Renderer/SPIRV/SPIRVReflect.h"
+#include <vector>
+#include <string>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <cstdlib>
+
+
+struct SPIRVModule
+{
+    std::string                 filename;
+    std::vector<std::uint32_t>  words;
+};
+
+static bool LoadSPIRVModule(const std::string& filename, SPIRVModule& module)
+{
+    std::ifstream file{ filename, std::ios::binary | std::ios::ate };
+    if (!file.good())
+        return false;
+
+    auto size = static_cast<std::size_t>(file.tellg());
+    file.seekg(0);
+
+    module.filename = filename;
+    module.words.resize((size + 3) / 4);
+    file.read(reinterpret_cast<char*>(module.words.data()), static_cast<std::streamsize>(size));
+
+    return true;
+}
+
+class SPIRVBenchmark
+{
+
+    public:
+
+        SPIRVBenchmark(const std::vector<SPIRVModule>& modules, std::size_t corpusSize) :
+            modules_    { modules    },
+            corpusSize_ { corpusSize }
+        {
+            for (std::size_t i = 0; i < corpusSize_; ++i)
+                corpusBytes_ += modules_[i % modules_.size()].words.size() * 4;
+        }
+
+        void Run()
+        {
+            std::cout << "run SPIR-V benchmark over " << corpusSize_ << " modules (" << (corpusBytes_ / 1024) << " KB) ..." << std::endl << std::endl;
+
+            MeasureTime("validate (SPIRVParser::Load)", std::bind(&SPIRVBenchmark::TestValidate, this));
+            MeasureTime("iterate all instructions", std::bind(&SPIRVBenchmark::TestIterate, this));
+            MeasureTime("visit OpDecorate instructions", std::bind(&SPIRVBenchmark::TestVisit, this));
+            MeasureTime("hash (SPIRVParser::Hash)", std::bind(&SPIRVBenchmark::TestHash, this));
+            MeasureTime("reflect (SPIRVReflect::Parse)", std::bind(&SPIRVBenchmark::TestReflect, this));
+            MeasureTime("reflect cached (SPIRVReflect::Reflect)", std::bind(&SPIRVBenchmark::TestReflectCached, this));
+
+            /* Print checksum, so the compiler can not discard any of the benchmarks */
+            std::cout << "checksum: " << std::hex << checksum_ << std::dec << std::endl;
+        }
+
+    private:
+
+        const SPIRVModule& GetModule(std::size_t i) const
+        {
+            return modules_[i % modules_.size()];
+        }
+
+        void MeasureTime(const std::string& title, const std::function<void()>& callback)
+        {
+            auto startTime = std::chrono::high_resolution_clock::now();
+            {
+                callback();
+            }
+            auto endTime = std::chrono::high_resolution_clock::now();
+
+            auto duration   = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+            auto durationMs = static_cast<double>(duration) / 1000000.0;
+
+            std::cout << title << std::endl;
+            std::cout << "\tduration: " << std::fixed << std::setprecision(3) << durationMs << "ms";
+            std::cout << " (" << (static_cast<double>(duration) / static_cast<double>(corpusSize_)) << "ns per module, ";
+            std::cout << (static_cast<double>(corpusBytes_) / (1024.0 * 1024.0)) / (durationMs / 1000.0) << " MB/s)" << "\n\n";
+        }
+
+        void TestValidate()
+        {
+            for (std::size_t i = 0; i < corpusSize_; ++i)
+            {
+                const auto& words = GetModule(i).words;
+                LLGL::SPIRVParser parser{ words.data(), words.size() * 4 };
+                checksum_ += parser.GetHeader().idBound;
+            }
+        }
+
+        void TestIterate()
+        {
+            for (std::size_t i = 0; i < corpusSize_; ++i)
+            {
+                const auto& words = GetModule(i).words;
+                LLGL::SPIRVParser parser{ words.data(), words.size() * 4 };
+                for (const auto& instr : parser)
+                    checksum_ += instr.numOperands;
+            }
+        }
+
+        void TestVisit()
+        {
+            for (std::size_t i = 0; i < corpusSize_; ++i)
+            {
+                const auto& words = GetModule(i).words;
+                LLGL::SPIRVParser parser{ words.data(), words.size() * 4 };
+                parser.Visit<spv::Op::OpDecorate>(
+                    [this](const LLGL::SPIRVInstruction& instr)
+                    {
+                        checksum_ += instr.numOperands;
+                        return true;
+                    }
+                );
+            }
+        }
+
+        void TestHash()
+        {
+            for (std::size_t i = 0; i < corpusSize_; ++i)
+            {
+                const auto& words = GetModule(i).words;
+                checksum_ ^= LLGL::SPIRVParser::Hash(words.data(), words.size() * 4);
+            }
+        }
+
+        void TestReflect()
+        {
+            LLGL::SPIRVReflect reflect;
+            for (std::size_t i = 0; i < corpusSize_; ++i)
+            {
+                const auto& words = GetModule(i).words;
+                LLGL::SPIRVParser parser{ words.data(), words.size() * 4 };
+                reflect.Parse(parser);
+                checksum_ += reflect.GetReflection().resources.size();
+            }
+        }
+
+        void TestReflectCached()
+        {
+            for (std::size_t i = 0; i < corpusSize_; ++i)
+            {
+                const auto& words = GetModule(i).words;
+                auto reflection = LLGL::SPIRVReflect::Reflect(words.data(), words.size() * 4);
+                checksum_ += reflection->resources.size();
+            }
+        }
+
+    private:
+
+        const std::vector<SPIRVModule>& modules_;
+        std::size_t                     corpusSize_     = 0;
+        std::size_t                     corpusBytes_    = 0;
+        std::uint64_t                   checksum_       = 0;
+
+};
+
+int main(int argc, char* argv[])
+{
+    std::size_t                 corpusSize = 30000;
+    std::vector<std::string>    filenames;
+
+    /* Parse command line arguments */
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc)
+            corpusSize = static_cast<std::size_t>(std::strtoul(argv[++i], nullptr, 10));
+        else
+            filenames.push_back(arg);
+    }
+
+    if (filenames.empty())
+        filenames = { "Triangle.vert.spv", "Triangle.frag.spv" };
+
+    /* Load SPIR-V modules */
+    std::vector<SPIRVModule> modules;
+    for (const auto& filename : filenames)
+    {
+        SPIRVModule module;
+        if (LoadSPIRVModule(filename, module))
+        {
+            try
+            {
+                LLGL::SPIRVParser parser{ module.words.data(), module.words.size() * 4 };
+                modules.push_back(std::move(module));
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << filename << ": " << e.what() << std::endl;
+            }
+        }
+        else
+            std::cerr << "failed to read file: " << filename << std::endl;
+    }
+
+    if (modules.empty() || corpusSize == 0)
+    {
+        std::cerr << "no SPIR-V modules to benchmark" << std::endl;
+        return 1;
+    }
+
+    /* Run benchmark */
+    SPIRVBenchmark benchmark{ modules, corpusSize };
+    benchmark.Run();
+
+    #ifdef _WIN32
+    system("pause");
+    #endif
+
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,256 @@
+/*
+ * Test11_RenderGraph.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <iostream>
+
+
+static bool g_testFailed = false;
+
+static void Check(bool condition, const std::string& message)
+{
+    std::cout << (condition ? "passed: " : "FAILED: ") << message << std::endl;
+    if (!condition)
+        g_testFailed = true;
+}
+
+// Two passes accumulate into the same texture (the second one without clearing), which is then read by the final pass.
+static void Test_AccumulateAttachment(LLGL::RenderSystem& renderer, LLGL::RenderContext& context, LLGL::CommandBuffer& commands)
+{
+    LLGL::RenderGraph renderGraph { renderer };
+
+    LLGL::TextureDescriptor texDesc;
+    {
+        texDesc.type    = LLGL::TextureType::Texture2D;
+        texDesc.format  = LLGL::Format::RGBA8UNorm;
+        texDesc.flags   = LLGL::TextureFlags::AttachmentUsage | LLGL::TextureFlags::SampleUsage;
+        texDesc.extent  = { 256, 256, 1 };
+    }
+    auto accum = renderGraph.CreateTexture("Accum", texDesc);
+
+    int numExecuted = 0;
+    auto CountPass = [&numExecuted](LLGL::CommandBuffer&, const LLGL::RenderGraph&) { ++numExecuted; };
+
+    LLGL::RenderGraphPassDescriptor basePass;
+    {
+        basePass.name               = "Base";
+        basePass.flags              = LLGL::RenderGraphPassFlags::ClearColor;
+        basePass.colorAttachments   = { accum };
+        basePass.callback           = CountPass;
+    }
+    renderGraph.AddPass(basePass);
+
+    LLGL::RenderGraphPassDescriptor accumPass;
+    {
+        accumPass.name              = "Accumulate";
+        accumPass.colorAttachments  = { accum };
+        accumPass.callback          = CountPass;
+    }
+    renderGraph.AddPass(accumPass);
+
+    LLGL::RenderGraphPassDescriptor finalPass;
+    {
+        finalPass.name          = "Final";
+        finalPass.reads         = { accum };
+        finalPass.renderTarget  = &context;
+        finalPass.callback      = CountPass;
+    }
+    renderGraph.AddPass(finalPass);
+
+    renderGraph.Compile();
+    Check(renderGraph.GetNumActivePasses() == 3, "accumulating attachment keeps both producing passes");
+
+    auto queue = renderer.GetCommandQueue();
+    queue->Begin(commands);
+    renderGraph.Execute(commands);
+    queue->End(commands);
+
+    Check(numExecuted == 3, "accumulating attachment executes all passes");
+}
+
+// Two passes write into the same buffer (read-modify-write), which is then read by the final pass.
+static void Test_AccumulateWrites(LLGL::RenderSystem& renderer, LLGL::RenderContext& context)
+{
+    LLGL::RenderGraph renderGraph { renderer };
+
+    LLGL::BufferDescriptor bufferDesc;
+    {
+        bufferDesc.type = LLGL::BufferType::Storage;
+        bufferDesc.size = 1024;
+    }
+    auto histogram = renderGraph.CreateBuffer("Histogram", bufferDesc);
+
+    LLGL::RenderGraphPassDescriptor firstPass;
+    {
+        firstPass.name      = "FirstHalf";
+        firstPass.writes    = { histogram };
+    }
+    renderGraph.AddPass(firstPass);
+
+    LLGL::RenderGraphPassDescriptor secondPass;
+    {
+        secondPass.name     = "SecondHalf";
+        secondPass.writes   = { histogram };
+    }
+    renderGraph.AddPass(secondPass);
+
+    LLGL::RenderGraphPassDescriptor finalPass;
+    {
+        finalPass.name          = "Final";
+        finalPass.reads         = { histogram };
+        finalPass.renderTarget  = &context;
+    }
+    renderGraph.AddPass(finalPass);
+
+    renderGraph.Compile();
+    Check(renderGraph.GetNumActivePasses() == 3, "read-modify-write keeps both writing passes");
+}
+
+// A pass whose outputs are never read is culled, together with its transient output.
+static void Test_CullDeadPass(LLGL::RenderSystem& renderer, LLGL::RenderContext& context, LLGL::CommandBuffer& commands)
+{
+    LLGL::RenderGraph renderGraph { renderer };
+
+    LLGL::TextureDescriptor texDesc;
+    {
+        texDesc.type    = LLGL::TextureType::Texture2D;
+        texDesc.format  = LLGL::Format::RGBA8UNorm;
+        texDesc.flags   = LLGL::TextureFlags::AttachmentUsage | LLGL::TextureFlags::SampleUsage;
+        texDesc.extent  = { 256, 256, 1 };
+    }
+    auto live = renderGraph.CreateTexture("Live", texDesc);
+    auto dead = renderGraph.CreateTexture("Dead", texDesc);
+
+    int numLiveExecuted = 0, numDeadExecuted = 0;
+
+    LLGL::RenderGraphPassDescriptor livePass;
+    {
+        livePass.name               = "Live";
+        livePass.flags              = LLGL::RenderGraphPassFlags::ClearColor;
+        livePass.colorAttachments   = { live };
+        livePass.callback           = [&numLiveExecuted](LLGL::CommandBuffer&, const LLGL::RenderGraph&) { ++numLiveExecuted; };
+    }
+    renderGraph.AddPass(livePass);
+
+    LLGL::RenderGraphPassDescriptor deadPass;
+    {
+        deadPass.name               = "Dead";
+        deadPass.flags              = LLGL::RenderGraphPassFlags::ClearColor;
+        deadPass.colorAttachments   = { dead };
+        deadPass.callback           = [&numDeadExecuted](LLGL::CommandBuffer&, const LLGL::RenderGraph&) { ++numDeadExecuted; };
+    }
+    renderGraph.AddPass(deadPass);
+
+    LLGL::RenderGraphPassDescriptor finalPass;
+    {
+        finalPass.name          = "Final";
+        finalPass.reads         = { live };
+        finalPass.renderTarget  = &context;
+        finalPass.callback      = [&numLiveExecuted](LLGL::CommandBuffer&, const LLGL::RenderGraph&) { ++numLiveExecuted; };
+    }
+    renderGraph.AddPass(finalPass);
+
+    renderGraph.Compile();
+    Check(renderGraph.GetNumActivePasses() == 2, "pass without readers is culled");
+    Check(renderGraph.GetTexture(dead) == nullptr, "output of culled pass is not allocated");
+    Check(renderGraph.GetNumPhysicalTextures() == 1, "only the live transient is allocated");
+
+    auto queue = renderer.GetCommandQueue();
+    queue->Begin(commands);
+    renderGraph.Execute(commands);
+    queue->End(commands);
+
+    Check(numLiveExecuted == 2 && numDeadExecuted == 0, "culled pass is not executed");
+}
+
+// Two transients with equal descriptors and disjoint lifetimes share one pooled texture.
+static void Test_AliasTransients(LLGL::RenderSystem& renderer, LLGL::RenderContext& context)
+{
+    LLGL::RenderGraph renderGraph { renderer };
+
+    LLGL::TextureDescriptor texDesc;
+    {
+        texDesc.type    = LLGL::TextureType::Texture2D;
+        texDesc.format  = LLGL::Format::RGBA8UNorm;
+        texDesc.flags   = LLGL::TextureFlags::AttachmentUsage | LLGL::TextureFlags::SampleUsage;
+        texDesc.extent  = { 256, 256, 1 };
+    }
+    auto first  = renderGraph.CreateTexture("First", texDesc);
+    auto second = renderGraph.CreateTexture("Second", texDesc);
+
+    texDesc.extent = { 128, 128, 1 };
+    auto half = renderGraph.CreateTexture("Half", texDesc);
+
+    /* Lifetimes: "First" in passes 0-1, "Half" in passes 1-3, "Second" in passes 2-3 */
+    LLGL::RenderGraphPassDescriptor firstPass;
+    {
+        firstPass.name              = "First";
+        firstPass.flags             = LLGL::RenderGraphPassFlags::ClearColor;
+        firstPass.colorAttachments  = { first };
+    }
+    renderGraph.AddPass(firstPass);
+
+    LLGL::RenderGraphPassDescriptor downsamplePass;
+    {
+        downsamplePass.name             = "Downsample";
+        downsamplePass.flags            = LLGL::RenderGraphPassFlags::ClearColor;
+        downsamplePass.reads            = { first };
+        downsamplePass.colorAttachments = { half };
+    }
+    renderGraph.AddPass(downsamplePass);
+
+    LLGL::RenderGraphPassDescriptor secondPass;
+    {
+        secondPass.name             = "Second";
+        secondPass.flags            = LLGL::RenderGraphPassFlags::ClearColor;
+        secondPass.colorAttachments = { second };
+    }
+    renderGraph.AddPass(secondPass);
+
+    LLGL::RenderGraphPassDescriptor finalPass;
+    {
+        finalPass.name          = "Final";
+        finalPass.reads         = { half, second };
+        finalPass.renderTarget  = &context;
+    }
+    renderGraph.AddPass(finalPass);
+
+    renderGraph.Compile();
+    Check(renderGraph.GetNumActivePasses() == 4, "all passes contribute to the final pass");
+    Check(renderGraph.GetTexture(first) == renderGraph.GetTexture(second), "transients with disjoint lifetimes share one pooled texture");
+    Check(renderGraph.GetTexture(half) != renderGraph.GetTexture(first), "transients with different descriptors are not aliased");
+    Check(renderGraph.GetNumPhysicalTextures() == 2, "aliased transients allocate one physical texture");
+}
+
+int main()
+{
+    try
+    {
+        // Load render system module
+        auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+        // Create render context
+        LLGL::RenderContextDescriptor contextDesc;
+        contextDesc.videoMode.resolution = { 256, 256 };
+
+        auto context = renderer->CreateRenderContext(contextDesc);
+        auto commands = renderer->CreateCommandBuffer();
+
+        // Run tests
+        Test_AccumulateAttachment(*renderer, *context, *commands);
+        Test_AccumulateWrites(*renderer, *context);
+        Test_CullDeadPass(*renderer, *context, *commands);
+        Test_AliasTransients(*renderer, *context);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return (g_testFailed ? 1 : 0);
+}
@@ -0,0 +1,176 @@
+/*
+ * Test12_TextureFile.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TextureFile.h>
+#include <LLGL/Format.h>
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+
+
+static bool g_testFailed = false;
+
+static void Check(bool condition, const std::string& message)
+{
+    std::cout << (condition ? "passed: " : "FAILED: ") << message << std::endl;
+    if (!condition)
+        g_testFailed = true;
+}
+
+// Byte value of the specified texel component; padding bytes are filled with 0xEE, which never occurs as texel value.
+static std::uint8_t TexelValue(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t x, std::uint32_t y, std::uint32_t component)
+{
+    return static_cast<std::uint8_t>(mipLevel * 64 + arrayLayer * 32 + y * 8 + x * 3 + component);
+}
+
+static void WriteUInt32(std::ofstream& file, std::uint32_t value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Writes an uncompressed GL_RGB8 KTX file with a full MIP-map chain, whose rows are padded to 4 bytes as required by KTX 1.1.
+static void WriteKTXFileRGB8(const std::string& filename, std::uint32_t width, std::uint32_t height, std::uint32_t numArrayElements)
+{
+    static const std::uint8_t identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    const auto numMipLevels = LLGL::NumMipLevels(width, height);
+    const auto numLayers    = std::max(1u, numArrayElements);
+
+    std::ofstream file { filename, std::ios::binary };
+    file.write(reinterpret_cast<const char*>(identifier), sizeof(identifier));
+
+    WriteUInt32(file, 0x04030201);      // endianness
+    WriteUInt32(file, 0x1401);          // glType = GL_UNSIGNED_BYTE
+    WriteUInt32(file, 1);               // glTypeSize
+    WriteUInt32(file, 0x1907);          // glFormat = GL_RGB
+    WriteUInt32(file, 0x8051);          // glInternalFormat = GL_RGB8
+    WriteUInt32(file, 0x1907);          // glBaseInternalFormat = GL_RGB
+    WriteUInt32(file, width);           // pixelWidth
+    WriteUInt32(file, height);          // pixelHeight
+    WriteUInt32(file, 0);               // pixelDepth
+    WriteUInt32(file, numArrayElements);// numberOfArrayElements
+    WriteUInt32(file, 1);               // numberOfFaces
+    WriteUInt32(file, numMipLevels);    // numberOfMipmapLevels
+    WriteUInt32(file, 0);               // bytesOfKeyValueData
+
+    for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+    {
+        const auto mipWidth     = std::max(1u, width  >> mipLevel);
+        const auto mipHeight    = std::max(1u, height >> mipLevel);
+        const auto rowPitch     = (mipWidth * 3 + 3) / 4 * 4;
+
+        WriteUInt32(file, rowPitch * mipHeight * numLayers);
+
+        for (std::uint32_t arrayLayer = 0; arrayLayer < numLayers; ++arrayLayer)
+        {
+            for (std::uint32_t y = 0; y < mipHeight; ++y)
+            {
+                std::vector<std::uint8_t> row(rowPitch, 0xEE);
+                for (std::uint32_t x = 0; x < mipWidth; ++x)
+                {
+                    for (std::uint32_t c = 0; c < 3; ++c)
+                        row[x * 3 + c] = TexelValue(mipLevel, arrayLayer, x, y, c);
+                }
+                file.write(reinterpret_cast<const char*>(row.data()), row.size());
+            }
+        }
+    }
+}
+
+// Returns true if the image descriptor contains the tightly packed texels of the specified MIP-map level and array layer.
+static bool IsTightlyPacked(const LLGL::SrcImageDescriptor& imageDesc, const LLGL::Extent3D& extent, std::uint32_t mipLevel, std::uint32_t arrayLayer)
+{
+    if (imageDesc.dataSize != extent.width * extent.height * 3)
+        return false;
+
+    auto data = reinterpret_cast<const std::uint8_t*>(imageDesc.data);
+    for (std::uint32_t y = 0; y < extent.height; ++y)
+    {
+        for (std::uint32_t x = 0; x < extent.width; ++x)
+        {
+            for (std::uint32_t c = 0; c < 3; ++c)
+            {
+                if (*data++ != TexelValue(mipLevel, arrayLayer, x, y, c))
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Loads an RGB8 MIP-map chain whose rows are padded in the KTX file (3 bytes per texel, odd widths).
+static void Test_KTXPaddedRowsRGB8()
+{
+    const std::string filename = "Test12_RGB8.ktx";
+    WriteKTXFileRGB8(filename, 5, 3, 0);
+    {
+        LLGL::TextureFile textureFile { filename };
+
+        Check(textureFile.GetDesc().format == LLGL::Format::RGB8UNorm, "KTX RGB8 format");
+        Check(textureFile.GetNumMipLevels() == 3, "KTX RGB8 MIP-map chain");
+
+        for (std::uint32_t mipLevel = 0; mipLevel < textureFile.GetNumMipLevels(); ++mipLevel)
+        {
+            Check(
+                IsTightlyPacked(textureFile.GetImageDesc(mipLevel), textureFile.GetMipExtent(mipLevel), mipLevel, 0),
+                "KTX RGB8 MIP-map level " + std::to_string(mipLevel) + " without row padding"
+            );
+        }
+    }
+    std::remove(filename.c_str());
+}
+
+// Loads an RGB8 array texture with padded rows, whose array layers must remain contiguous after repacking.
+static void Test_KTXPaddedRowsRGB8Array()
+{
+    const std::string filename = "Test12_RGB8Array.ktx";
+    WriteKTXFileRGB8(filename, 3, 2, 2);
+    {
+        LLGL::TextureFile textureFile { filename };
+
+        Check(textureFile.GetDesc().type == LLGL::TextureType::Texture2DArray, "KTX RGB8 array texture type");
+        Check(textureFile.GetNumArrayLayers() == 2, "KTX RGB8 array layers");
+
+        for (std::uint32_t mipLevel = 0; mipLevel < textureFile.GetNumMipLevels(); ++mipLevel)
+        {
+            const auto extent = textureFile.GetMipExtent(mipLevel);
+            for (std::uint32_t arrayLayer = 0; arrayLayer < 2; ++arrayLayer)
+            {
+                Check(
+                    IsTightlyPacked(textureFile.GetImageDesc(mipLevel, arrayLayer), extent, mipLevel, arrayLayer),
+                    "KTX RGB8 MIP-map level " + std::to_string(mipLevel) + ", array layer " + std::to_string(arrayLayer) + " without row padding"
+                );
+            }
+
+            LLGL::SrcImageDescriptor imageDesc;
+            Check(
+                textureFile.GetContiguousImageDesc(mipLevel, imageDesc) && imageDesc.dataSize == extent.width * extent.height * 3 * 2,
+                "KTX RGB8 MIP-map level " + std::to_string(mipLevel) + " with contiguous array layers"
+            );
+        }
+    }
+    std::remove(filename.c_str());
+}
+
+int main()
+{
+    try
+    {
+        Test_KTXPaddedRowsRGB8();
+        Test_KTXPaddedRowsRGB8Array();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return (g_testFailed ? 1 : 0);
+}
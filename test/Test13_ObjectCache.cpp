@@ -0,0 +1,183 @@
+/*
+ * Test13_ObjectCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+
+
+static bool g_testFailed = false;
+
+static void Check(bool condition, const std::string& message)
+{
+    std::cout << (condition ? "passed: " : "FAILED: ") << message << std::endl;
+    if (!condition)
+        g_testFailed = true;
+}
+
+static void WriteShaderFile(const std::string& filename, const std::string& source)
+{
+    std::ofstream file { filename };
+    file << source;
+}
+
+static const char* g_vertShaderSource =
+(
+    "#version 130\n"
+    "in vec2 position;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(position, 0.0, 1.0);\n"
+    "}\n"
+);
+
+static const char* g_fragShaderSource =
+(
+    "#version 130\n"
+    "out vec4 fragColor;\n"
+    "void main() {\n"
+    "    fragColor = vec4(1.0);\n"
+    "}\n"
+);
+
+// Equal sampler descriptors hit the cache, and the native sampler is only released with the last reference.
+static void Test_SamplerRefCount(LLGL::RenderSystem& renderer)
+{
+    LLGL::ObjectCache cache { renderer };
+
+    LLGL::SamplerDescriptor samplerDesc;
+    {
+        samplerDesc.minFilter = LLGL::SamplerFilter::Nearest;
+    }
+    auto sampler1 = cache.CreateSampler(samplerDesc);
+    auto sampler2 = cache.CreateSampler(samplerDesc);
+
+    const auto& stats = cache.GetStatistics().samplers;
+    Check(sampler1 == sampler2, "equal sampler descriptors return the same sampler");
+    Check(stats.hits == 1 && stats.misses == 1 && stats.objects == 1, "equal sampler descriptors count one hit and one miss");
+
+    samplerDesc.magFilter = LLGL::SamplerFilter::Nearest;
+    auto sampler3 = cache.CreateSampler(samplerDesc);
+    Check(sampler3 != sampler1 && stats.misses == 2 && stats.objects == 2, "different sampler descriptor misses the cache");
+
+    cache.Release(*sampler2);
+    Check(stats.objects == 2, "sampler with remaining reference is kept");
+
+    cache.Release(*sampler1);
+    cache.Release(*sampler3);
+    Check(stats.objects == 0, "sampler is released with its last reference");
+
+    cache.ResetStatistics();
+    samplerDesc.magFilter = LLGL::SamplerFilter::Linear;
+    auto sampler4 = cache.CreateSampler(samplerDesc);
+    Check(stats.hits == 0 && stats.misses == 1 && stats.objects == 1, "released sampler misses the cache");
+    cache.Release(*sampler4);
+}
+
+// Shader files are identified by their content, and modified files are read again.
+static void Test_ShaderFiles(LLGL::RenderSystem& renderer)
+{
+    LLGL::ObjectCache cache { renderer };
+
+    WriteShaderFile("Test13_A.vert", g_vertShaderSource);
+    WriteShaderFile("Test13_B.vert", g_vertShaderSource);
+
+    auto shaderA = cache.CreateShader({ LLGL::ShaderType::Vertex, "Test13_A.vert" });
+    auto shaderB = cache.CreateShader({ LLGL::ShaderType::Vertex, "Test13_B.vert" });
+
+    const auto& stats = cache.GetStatistics().shaders;
+    Check(shaderA == shaderB, "shader files with equal content return the same shader");
+    Check(stats.hits == 1 && stats.misses == 1, "shader files with equal content count one hit and one miss");
+
+    /* Modify file with a different size, so the change is detected even within the resolution of the modification time */
+    WriteShaderFile("Test13_A.vert", std::string(g_vertShaderSource) + "// modified\n");
+
+    auto shaderC = cache.CreateShader({ LLGL::ShaderType::Vertex, "Test13_A.vert" });
+    Check(shaderC != shaderA && stats.misses == 2 && stats.objects == 2, "modified shader file misses the cache");
+
+    cache.Release(*shaderA);
+    cache.Release(*shaderB);
+    cache.Release(*shaderC);
+    Check(stats.objects == 0, "shaders are released with their last reference");
+
+    std::remove("Test13_A.vert");
+    std::remove("Test13_B.vert");
+}
+
+// Shader programs are identified by their attached shaders and vertex formats, and retain their attached shaders.
+static void Test_ShaderPrograms(LLGL::RenderSystem& renderer)
+{
+    LLGL::ObjectCache cache { renderer };
+
+    LLGL::ShaderDescriptor vertShaderDesc { LLGL::ShaderType::Vertex, g_vertShaderSource };
+    vertShaderDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+    auto vertShader = cache.CreateShader(vertShaderDesc);
+
+    LLGL::ShaderDescriptor fragShaderDesc { LLGL::ShaderType::Fragment, g_fragShaderSource };
+    fragShaderDesc.sourceType = LLGL::ShaderSourceType::CodeString;
+    auto fragShader = cache.CreateShader(fragShaderDesc);
+
+    LLGL::VertexFormat vertexFormat;
+    vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+    LLGL::ShaderProgramDescriptor shaderProgramDesc;
+    {
+        shaderProgramDesc.vertexFormats     = { vertexFormat };
+        shaderProgramDesc.vertexShader      = vertShader;
+        shaderProgramDesc.fragmentShader    = fragShader;
+    }
+    auto shaderProgram1 = cache.CreateShaderProgram(shaderProgramDesc);
+    auto shaderProgram2 = cache.CreateShaderProgram(shaderProgramDesc);
+
+    const auto& stats = cache.GetStatistics();
+    Check(shaderProgram1 == shaderProgram2, "equal shader program descriptors return the same shader program");
+    Check(stats.shaderPrograms.hits == 1 && stats.shaderPrograms.misses == 1, "equal shader program descriptors count one hit and one miss");
+
+    LLGL::VertexFormat otherVertexFormat;
+    otherVertexFormat.AppendAttribute({ "position", LLGL::Format::RGB32Float });
+
+    shaderProgramDesc.vertexFormats = { otherVertexFormat };
+    auto shaderProgram3 = cache.CreateShaderProgram(shaderProgramDesc);
+    Check(shaderProgram3 != shaderProgram1 && stats.shaderPrograms.objects == 2, "different vertex format misses the cache");
+
+    /* Shaders are retained by the shader programs */
+    cache.Release(*vertShader);
+    cache.Release(*fragShader);
+    Check(stats.shaders.objects == 2, "shaders are retained by their shader programs");
+
+    cache.Release(*shaderProgram1);
+    cache.Release(*shaderProgram2);
+    cache.Release(*shaderProgram3);
+    Check(stats.shaderPrograms.objects == 0 && stats.shaders.objects == 0, "shader programs release their retained shaders");
+}
+
+int main()
+{
+    try
+    {
+        // Load render system module
+        auto renderer = LLGL::RenderSystem::Load("OpenGL");
+
+        // Create render context to activate the GL context
+        LLGL::RenderContextDescriptor contextDesc;
+        contextDesc.videoMode.resolution = { 256, 256 };
+
+        renderer->CreateRenderContext(contextDesc);
+
+        // Run tests
+        Test_SamplerRefCount(*renderer);
+        Test_ShaderFiles(*renderer);
+        Test_ShaderPrograms(*renderer);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return (g_testFailed ? 1 : 0);
+}